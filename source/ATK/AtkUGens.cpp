@@ -150,6 +150,31 @@ struct FoaPsychoShelf : public Unit
 	float m_y1w, m_y2w, m_y1x, m_y2x, m_y1y, m_y2y, m_y1z, m_y2z;
 };
 
+// the transforms FoaTransformChain can compose, in the order of the opcodes
+// sent by the language side
+enum {
+    kFoaDirectO = 0,
+    kFoaDirectX, kFoaDirectY, kFoaDirectZ,
+    kFoaRotate, kFoaTilt, kFoaTumble,
+    kFoaFocusX, kFoaFocusY, kFoaFocusZ,
+    kFoaPushX, kFoaPushY, kFoaPushZ,
+    kFoaPressX, kFoaPressY, kFoaPressZ,
+    kFoaZoomX, kFoaZoomY, kFoaZoomZ,
+    kFoaDominateX, kFoaDominateY, kFoaDominateZ,
+    kFoaAsymmetry,
+    kFoaNumTransforms
+};
+
+#define FOA_CHAIN_MAXOPS 16
+
+struct FoaTransformChain : public Unit
+{
+    FoaMatrix matrix;
+    int m_numOps;
+    int m_ops[FOA_CHAIN_MAXOPS];
+    float m_params[FOA_CHAIN_MAXOPS];
+};
+
 extern "C"
 {
     
@@ -261,6 +286,9 @@ extern "C"
     void FoaPsychoShelf_next_a(FoaPsychoShelf *unit, int inNumSamples);
     void FoaPsychoShelf_Ctor(FoaPsychoShelf* unit);
     
+    void FoaTransformChain_next(FoaTransformChain *unit, int inNumSamples);
+    void FoaTransformChain_Ctor(FoaTransformChain* unit);
+    
 }
 
 inline float calcmatrixval(float coef, float curval){
@@ -1909,6 +1937,176 @@ void FoaAsymmetry_next_k(FoaAsymmetry *unit, int inNumSamples)
 }
 
 
+////////////////////// FoaTransformChain ///////////////////////
+// an ordered list of (opcode, param) pairs after the four B-format inputs.
+// The transforms are composed into one matrix per control period, and the
+// matrix is interpolated across the block. Params are read once per block.
+
+// stands in for the transformer units, so the FILL_*_MATRIX macros can be shared
+struct FoaTransformParam
+{
+    float m_angle, m_gain;
+};
+
+static void FoaTransform_fill(int op, float value, FoaMatrix &matrix)
+{
+    FoaTransformParam param = {value, value};
+    FoaTransformParam *unit = &param;
+    
+    for(int i = 0; i < 4; i++){
+	for(int j = 0; j < 4; j++){
+	    matrix.coefs[i][j] = 0.f;
+	}
+    }
+    
+    switch(op){
+	case kFoaDirectO: { FILL_DIRECT_MATRIX } break;
+	case kFoaDirectX: { FILL_DIRECTX_MATRIX } break;
+	case kFoaDirectY: { FILL_DIRECTY_MATRIX } break;
+	case kFoaDirectZ: { FILL_DIRECTZ_MATRIX } break;
+	case kFoaRotate: { FILL_ROTATE_MATRIX } break;
+	case kFoaTilt: { FILL_TILT_MATRIX } break;
+	case kFoaTumble: { FILL_TUMBLE_MATRIX } break;
+	case kFoaFocusX: { FILL_FOCUSX_MATRIX } break;
+	case kFoaFocusY: { FILL_FOCUSY_MATRIX } break;
+	case kFoaFocusZ: { FILL_FOCUSZ_MATRIX } break;
+	case kFoaPushX: { FILL_PUSHX_MATRIX } break;
+	case kFoaPushY: { FILL_PUSHY_MATRIX } break;
+	case kFoaPushZ: { FILL_PUSHZ_MATRIX } break;
+	case kFoaPressX: { FILL_PRESSX_MATRIX } break;
+	case kFoaPressY: { FILL_PRESSY_MATRIX } break;
+	case kFoaPressZ: { FILL_PRESSZ_MATRIX } break;
+	case kFoaZoomX: { FILL_ZOOMX_MATRIX } break;
+	case kFoaZoomY: { FILL_ZOOMY_MATRIX } break;
+	case kFoaZoomZ: { FILL_ZOOMZ_MATRIX } break;
+	case kFoaDominateX: { FILL_DOMINATEX_MATRIX } break;
+	case kFoaDominateY: { FILL_DOMINATEY_MATRIX } break;
+	case kFoaDominateZ: { FILL_DOMINATEZ_MATRIX } break;
+	case kFoaAsymmetry: { FILL_ASYMMETRY_MATRIX } break;
+    }
+}
+
+// result = a * b, i.e. b is applied first
+static void FoaMatrix_multiply(const FoaMatrix &a, const FoaMatrix &b, FoaMatrix &result)
+{
+    for(int i = 0; i < 4; i++){
+	for(int j = 0; j < 4; j++){
+	    result.coefs[i][j] = a.coefs[i][0] * b.coefs[0][j] + a.coefs[i][1] * b.coefs[1][j]
+		+ a.coefs[i][2] * b.coefs[2][j] + a.coefs[i][3] * b.coefs[3][j];
+	}
+    }
+}
+
+static void FoaTransformChain_compose(FoaTransformChain *unit, FoaMatrix &matrix)
+{
+    FoaMatrix transform, product;
+    
+    for(int i = 0; i < 4; i++){
+	for(int j = 0; j < 4; j++){
+	    matrix.coefs[i][j] = (i == j) ? 1.f : 0.f;
+	}
+    }
+    for(int k = 0; k < unit->m_numOps; k++){
+	FoaTransform_fill(unit->m_ops[k], unit->m_params[k], transform);
+	FoaMatrix_multiply(transform, matrix, product);
+	matrix = product;
+    }
+}
+
+// one output channel per pass, so each loop is a plain multiply-add over the
+// block that the compiler turns into SIMD code
+static inline void FoaMatrix_apply(const FoaMatrix &matrix, const float *Win, const float *Xin,
+				   const float *Yin, const float *Zin, float **outs, int inNumSamples)
+{
+    for(int j = 0; j < 4; j++){
+	float *out = outs[j];
+	const float cw = matrix.coefs[j][0];
+	const float cx = matrix.coefs[j][1];
+	const float cy = matrix.coefs[j][2];
+	const float cz = matrix.coefs[j][3];
+	for(int i = 0; i < inNumSamples; i++){
+	    out[i] = cw * Win[i] + cx * Xin[i] + cy * Yin[i] + cz * Zin[i];
+	}
+    }
+}
+
+static inline void FoaMatrix_apply_ramp(const FoaMatrix &matrix, const FoaMatrix &slope, const float *Win,
+					const float *Xin, const float *Yin, const float *Zin, float **outs,
+					int inNumSamples)
+{
+    for(int j = 0; j < 4; j++){
+	float *out = outs[j];
+	const float cw = matrix.coefs[j][0], sw = slope.coefs[j][0];
+	const float cx = matrix.coefs[j][1], sx = slope.coefs[j][1];
+	const float cy = matrix.coefs[j][2], sy = slope.coefs[j][2];
+	const float cz = matrix.coefs[j][3], sz = slope.coefs[j][3];
+	for(int i = 0; i < inNumSamples; i++){
+	    const float t = (float)i;
+	    out[i] = (cw + sw * t) * Win[i] + (cx + sx * t) * Xin[i]
+		+ (cy + sy * t) * Yin[i] + (cz + sz * t) * Zin[i];
+	}
+    }
+}
+
+void FoaTransformChain_Ctor(FoaTransformChain* unit)
+{
+    int numOps = (unit->mNumInputs - 4) / 2;
+    if(numOps > FOA_CHAIN_MAXOPS){
+	Print("FoaTransformChain: at most %d transforms are supported, got %d\n", FOA_CHAIN_MAXOPS, numOps);
+	SETCALC(ClearUnitOutputs);
+	ClearUnitOutputs(unit, 1);
+	return;
+    }
+    unit->m_numOps = numOps;
+    for(int k = 0; k < numOps; k++){
+	int op = (int)IN0(4 + 2 * k);
+	if((op < 0) || (op >= kFoaNumTransforms)){
+	    Print("FoaTransformChain: unknown transform %d\n", op);
+	    SETCALC(ClearUnitOutputs);
+	    ClearUnitOutputs(unit, 1);
+	    return;
+	}
+	unit->m_ops[k] = op;
+	unit->m_params[k] = IN0(5 + 2 * k);
+    }
+    FoaTransformChain_compose(unit, unit->matrix);
+    SETCALC(FoaTransformChain_next);
+    FoaTransformChain_next(unit, 1);
+}
+
+void FoaTransformChain_next(FoaTransformChain *unit, int inNumSamples)
+{
+    float *Win = IN(0);
+    float *Xin = IN(1);
+    float *Yin = IN(2);
+    float *Zin = IN(3);
+    float *outs[4] = {OUT(0), OUT(1), OUT(2), OUT(3)};
+    bool changed = false;
+    
+    for(int k = 0; k < unit->m_numOps; k++){
+	float param = IN0(5 + 2 * k);
+	if(param != unit->m_params[k]){
+	    unit->m_params[k] = param;
+	    changed = true;
+	}
+    }
+    
+    if(changed){
+	FoaMatrix next, slope;
+	FoaTransformChain_compose(unit, next);
+	for(int i = 0; i < 4; i++){
+	    for(int j = 0; j < 4; j++){
+		slope.coefs[i][j] = CALCSLOPE(next.coefs[i][j], unit->matrix.coefs[i][j]);
+	    }
+	}
+	FoaMatrix_apply_ramp(unit->matrix, slope, Win, Xin, Yin, Zin, outs, inNumSamples);
+	unit->matrix = next;
+    } else {
+	FoaMatrix_apply(unit->matrix, Win, Xin, Yin, Zin, outs, inNumSamples);
+    }
+}
+
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////
 // FoaNFC - 
 void FoaNFC_Ctor(FoaNFC* unit)
@@ -2394,6 +2592,7 @@ PluginLoad(ATK)
     DefineSimpleCantAliasUnit(FoaDominateY);
     DefineSimpleCantAliasUnit(FoaDominateZ);
     DefineSimpleCantAliasUnit(FoaAsymmetry);
+    DefineSimpleCantAliasUnit(FoaTransformChain);
     
     
     DefineSimpleCantAliasUnit(FoaNFC);
@@ -0,0 +1,52 @@
+FoaTransformChain : MultiOutUGen {
+    classvar <kinds;
+
+    *initClass {
+        // the order has to match the opcodes in AtkUGens.cpp
+        kinds = [
+            \directO, \directX, \directY, \directZ,
+            \rotate, \tilt, \tumble,
+            \focusX, \focusY, \focusZ,
+            \pushX, \pushY, \pushZ,
+            \pressX, \pressY, \pressZ,
+            \zoomX, \zoomY, \zoomZ,
+            \dominateX, \dominateY, \dominateZ,
+            \asymmetry
+        ];
+    }
+
+    *ar { |in, transforms, mul = 1, add = 0|
+        ^this.multiNewList(['audio'] ++ this.prInputs(in, transforms)).madd(mul, add);
+    }
+
+    *kr { |in, transforms, mul = 1, add = 0|
+        ^this.multiNewList(['control'] ++ this.prInputs(in, transforms)).madd(mul, add);
+    }
+
+    *prInputs { |in, transforms|
+        in = in.asArray;
+        if(in.size != 4) {
+            Error(
+                "FoaTransformChain expects a B-format signal, but received a size % array.".format(in.size)
+            ).throw;
+        };
+        transforms = transforms.asArray;
+        if(transforms.size.odd) {
+            Error("FoaTransformChain expects pairs of kind and parameter.").throw;
+        };
+        ^in ++ transforms.clump(2).collect { |pair|
+            var op = kinds.indexOf(pair[0]);
+            if(op.isNil) {
+                Error("FoaTransformChain: unknown transform %.".format(pair[0])).throw;
+            };
+            [op, pair[1]]
+        }.flatten;
+    }
+
+    init { |... theInputs|
+        inputs = theInputs;
+        ^this.initOutputs(4, rate);
+    }
+
+    checkInputs { ^this.checkNInputs(4) }
+}
@@ -36,21 +36,27 @@ struct Grain2
 	int interp;
 };
 
-const int kMaxGrains = 64;
+// the number of grains when the maxGrains input is not given
+const int kDefaultMaxGrains = 64;
 
+// the grains and the buffer a grain is rendered into before it is panned are allocated
+// together from the RT pool
 struct TGrains2 : public Unit
 {
 	float mPrevTrig;
-	int mNumActive;
-	Grain2 mGrains[kMaxGrains];
+	int mNumActive, mMaxGrains;
+	Grain2 *mGrains;
+	float *mGrainOut;
 };
 
 struct TGrains3 : public Unit
 {
 	float mPrevTrig;
-	int mNumActive, mWindowSize;
-	float* mWindow;
-	Grain2 mGrains[kMaxGrains];
+	int mNumActive, mMaxGrains;
+	float mFWindowNum;
+	SndBuf *mWindowBuf;
+	Grain2 *mGrains;
+	float *mGrainOut;
 };
 
 
@@ -59,9 +65,11 @@ extern "C"
 {
 	void TGrains2_next(TGrains2 *unit, int inNumSamples);
 	void TGrains2_Ctor(TGrains2* unit);
+	void TGrains2_Dtor(TGrains2* unit);
 
 	void TGrains3_next(TGrains3 *unit, int inNumSamples);
 	void TGrains3_Ctor(TGrains3* unit);
+	void TGrains3_Dtor(TGrains3* unit);
 };
 /*
 static float cubicinterp(float x, float y0, float y1, float y2, float y3)
@@ -140,8 +148,7 @@ inline double sc_gloop(double in, double hi)
 		float c = table2[0]; \
 		float d = table3[0]; \
 		float outval = amp * cubicinterp(fracphase, a, b, c, d); \
-		ZXP(out1) += outval * pan1; \
-		ZXP(out2) += outval * pan2; \
+		grainOut[j] = outval; \
 		counter--; \
 
 #define GRAIN2_LOOP_BODY_2 \
@@ -156,18 +163,43 @@ inline double sc_gloop(double in, double hi)
 		float b = table1[0]; \
 		float c = table2[0]; \
 		float outval = amp * (b + fracphase * (c - b)); \
-		ZXP(out1) += outval * pan1; \
-		ZXP(out2) += outval * pan2; \
+		grainOut[j] = outval; \
 		counter--; \
 
 #define GRAIN2_LOOP_BODY_1 \
 		phase = sc_gloop(phase, loopMax); \
 		int32 iphase = (int32)phase; \
 		float outval = amp * bufData[iphase]; \
-		ZXP(out1) += outval * pan1; \
-		ZXP(out2) += outval * pan2; \
+		grainOut[j] = outval; \
 		counter--; \
 
+// adds the block of a grain to its two output channels
+#define GRAIN2_PAN \
+		for (int j=0; j<nsmps; ++j) { \
+			float outval = grainOut[j]; \
+			out1[j] += outval * pan1; \
+			out2[j] += outval * pan2; \
+		} \
+
+// allocates the grains, maxGrains is an optional input so that older synth defs still get the
+// default number of grains. Returns the number of grains, 0 if there is no memory.
+static int Grain2_alloc(Unit *unit, int maxGrainsIndex, Grain2 **grains, float **grainOut)
+{
+	int maxGrains = kDefaultMaxGrains;
+	if (unit->mNumInputs > maxGrainsIndex)
+		maxGrains = sc_max((int)IN0(maxGrainsIndex), 1);
+	char *memory = (char*)RTAlloc(unit->mWorld, maxGrains * sizeof(Grain2) + BUFLENGTH * sizeof(float));
+	if (!memory) {
+		Print("TGrains2/TGrains3: not enough real-time memory for %d grains\n", maxGrains);
+		*grains = 0;
+		*grainOut = 0;
+		return 0;
+	}
+	*grains = (Grain2*)memory;
+	*grainOut = (float*)(memory + maxGrains * sizeof(Grain2));
+	return maxGrains;
+}
+
 
 void TGrains2_next(TGrains2 *unit, int inNumSamples)
 {
@@ -177,7 +209,8 @@ void TGrains2_next(TGrains2 *unit, int inNumSamples)
 	uint32 numOutputs = unit->mNumOutputs;
 	ClearUnitOutputs(unit, inNumSamples);
 	float *out[16];
-	for (uint32 i=0; i<numOutputs; ++i) out[i] = ZOUT(i);
+	for (uint32 i=0; i<numOutputs; ++i) out[i] = OUT(i);
+	float *grainOut = unit->mGrainOut;
 
 	World *world = unit->mWorld;
 	SndBuf *bufs = world->mSndBufs;
@@ -230,6 +263,8 @@ void TGrains2_next(TGrains2 *unit, int inNumSamples)
 			}
 		}
 
+		GRAIN2_PAN;
+
 		grain->phase = phase;
 
 		grain->counter = counter;
@@ -246,7 +281,7 @@ void TGrains2_next(TGrains2 *unit, int inNumSamples)
 
 		if (trig > 0.f && prevtrig <= 0.f) {
 			// start a grain
-			if (unit->mNumActive+1 >= kMaxGrains) break;
+			if (unit->mNumActive >= unit->mMaxGrains) break;
 			uint32 bufnum = (uint32)IN_AT(unit, 1, i);
 			if (bufnum >= numBufs) continue;
 			GRAIN_BUF
@@ -321,7 +356,7 @@ void TGrains2_next(TGrains2 *unit, int inNumSamples)
 			float *out1 = out[chan1] + i;
 			float *out2 = out[chan2] + i;
 
-			int nsmps = sc_min(grain->counter, inNumSamples - i);
+			int nsmps = sc_min((int)counter, inNumSamples - i);
 			if (grain->interp >= 4) {
 				for (int j=0; j<nsmps; ++j) {
 					GRAIN_AMP_2;
@@ -342,6 +377,8 @@ void TGrains2_next(TGrains2 *unit, int inNumSamples)
 				}
 			}
 
+			GRAIN2_PAN;
+
 			grain->phase = phase;
 
 			grain->counter = (int)counter;
@@ -362,10 +399,16 @@ void TGrains2_Ctor(TGrains2 *unit)
 
 	unit->mNumActive = 0;
 	unit->mPrevTrig = 0.;
+	unit->mMaxGrains = Grain2_alloc(unit, 10, &unit->mGrains, &unit->mGrainOut);
 
 	ClearUnitOutputs(unit, 1);
 }
 
+void TGrains2_Dtor(TGrains2 *unit)
+{
+	if (unit->mGrains) RTFree(unit->mWorld, unit->mGrains);
+}
+
 #define GRAIN_AMP_3 \
 		float amp; \
 		int i_attPhase = (int)grain->attPhase; \
@@ -376,7 +419,7 @@ void TGrains2_Ctor(TGrains2 *unit)
 				grain->attPhase += grain->attIncr; \
 			} \
 		} else { \
-			amp = window[sc_max(i_decPhase, 0)]; \
+			amp = window[sc_min(sc_max(i_decPhase, 0), windowSize)]; \
 			grain->decPhase -= grain->decIncr; \
 		} \
 
@@ -384,13 +427,34 @@ void TGrains3_next(TGrains3 *unit, int inNumSamples)
 {
 	float *trigin = IN(0);
 	float prevtrig = unit->mPrevTrig;
-	float* window = unit->mWindow;
-	int windowSize = unit->mWindowSize;
 
 	uint32 numOutputs = unit->mNumOutputs;
 	ClearUnitOutputs(unit, inNumSamples);
+
+	// the window buffer is looked up again only when its number changes, its data and size
+	// are read every block so that it can be refilled or reallocated while grains play
+	float fwindow = IN0(9);
+	if (fwindow != unit->mFWindowNum) {
+		uint32 windowNum = (uint32)fwindow;
+		World *world = unit->mWorld;
+		unit->mFWindowNum = fwindow;
+		if (windowNum >= world->mNumSndBufs) {
+			// a LocalBuf of the synth
+			int localBufNum = windowNum - world->mNumSndBufs;
+			Graph *parent = unit->mParent;
+			if (localBufNum < parent->localBufNum)
+				unit->mWindowBuf = parent->mLocalSndBufs + localBufNum;
+			else
+				unit->mWindowBuf = world->mSndBufs;
+		} else
+			unit->mWindowBuf = world->mSndBufs + windowNum;
+	}
+	float* window = unit->mWindowBuf->data;
+	int windowSize = (int)unit->mWindowBuf->samples - 1;
+	if (!window || windowSize < 1) return;
 	float *out[16];
-	for (uint32 i=0; i<numOutputs; ++i) out[i] = ZOUT(i);
+	for (uint32 i=0; i<numOutputs; ++i) out[i] = OUT(i);
+	float *grainOut = unit->mGrainOut;
 
 	World *world = unit->mWorld;
 	SndBuf *bufs = world->mSndBufs;
@@ -444,6 +508,8 @@ void TGrains3_next(TGrains3 *unit, int inNumSamples)
 			}
 		}
 
+		GRAIN2_PAN;
+
 		grain->phase = phase;
 
 		grain->counter = counter;
@@ -460,7 +526,7 @@ void TGrains3_next(TGrains3 *unit, int inNumSamples)
 
 		if (trig > 0.f && prevtrig <= 0.f) {
 			// start a grain
-			if (unit->mNumActive+1 >= kMaxGrains) break;
+			if (unit->mNumActive >= unit->mMaxGrains) break;
 			uint32 bufnum = (uint32)IN_AT(unit, 1, i);
 			if (bufnum >= numBufs) continue;
 			GRAIN_BUF
@@ -535,7 +601,7 @@ void TGrains3_next(TGrains3 *unit, int inNumSamples)
 			float *out1 = out[chan1] + i;
 			float *out2 = out[chan2] + i;
 
-			int nsmps = sc_min(grain->counter, inNumSamples - i);
+			int nsmps = sc_min((int)counter, inNumSamples - i);
 			if (grain->interp >= 4) {
 				for (int j=0; j<nsmps; ++j) {
 					GRAIN_AMP_3;
@@ -556,6 +622,8 @@ void TGrains3_next(TGrains3 *unit, int inNumSamples)
 				}
 			}
 
+			GRAIN2_PAN;
+
 			grain->phase = phase;
 
 			grain->counter = (int)counter;
@@ -576,19 +644,23 @@ void TGrains3_Ctor(TGrains3 *unit)
 
 	unit->mNumActive = 0;
 	unit->mPrevTrig = 0.;
-	SndBuf* window=unit->mWorld->mSndBufs + (int)IN0(9);
-	unit->mWindow=window->data;
-	unit->mWindowSize=window->samples - 1;
+	unit->mFWindowNum = -1e9f;
+	unit->mMaxGrains = Grain2_alloc(unit, 11, &unit->mGrains, &unit->mGrainOut);
 
 	ClearUnitOutputs(unit, 1);
 }
 
+void TGrains3_Dtor(TGrains3 *unit)
+{
+	if (unit->mGrains) RTFree(unit->mWorld, unit->mGrains);
+}
+
 PluginLoad(BhobGrains)
 {
 	ft = inTable;
 
-	DefineSimpleUnit(TGrains2);
-	DefineSimpleUnit(TGrains3);
+	DefineDtorUnit(TGrains2);
+	DefineDtorUnit(TGrains3);
 }
 
 ////////////////////////////////////////////////////////////////////
@@ -134,9 +134,9 @@ Gendy5 : Gendy4 { }
 
 TGrains2 : MultiOutUGen {
 	*ar { arg numChannels, trigger=0, bufnum=0, rate=1, centerPos=0,
-			dur=0.1, pan=0, amp=0.1, att=0.5, dec=0.5, interp=4;
+			dur=0.1, pan=0, amp=0.1, att=0.5, dec=0.5, interp=4, maxGrains=64;
 		^this.multiNew('audio', numChannels, trigger, bufnum, rate, centerPos,
-				dur, pan, amp, att, dec, interp)
+				dur, pan, amp, att, dec, interp, maxGrains)
 	}
 	init { arg argNumChannels ... theInputs;
 		inputs = theInputs;
@@ -147,9 +147,9 @@ TGrains2 : MultiOutUGen {
 
 TGrains3 : MultiOutUGen {
 	*ar { arg numChannels, trigger=0, bufnum=0, rate=1, centerPos=0,
-			dur=0.1, pan=0, amp=0.1, att=0.5, dec=0.5, window=1, interp=4;
+			dur=0.1, pan=0, amp=0.1, att=0.5, dec=0.5, window=1, interp=4, maxGrains=64;
 		^this.multiNew('audio', numChannels, trigger, bufnum, rate, centerPos,
-				dur, pan, amp, att, dec, window, interp)
+				dur, pan, amp, att, dec, window, interp, maxGrains)
 	}
 	init { arg argNumChannels ... theInputs;
 		inputs = theInputs;
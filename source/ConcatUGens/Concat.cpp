@@ -86,6 +86,14 @@ struct Concat : Unit {
 	int m_matchframes;
 	int m_fadeoutlocation;
 
+	//feature index: a tree of cells over the unit cube of the four features, each level halving the cells in every dimension. Every stored frame sits in a list for its leaf cell
+	int m_indexdepth;
+	int * m_indexcount; //frames under each node, all levels one after the other
+	int * m_indexhead;	//first frame of each leaf cell, -1 if empty
+	int * m_indexnext;	//per frame
+	int * m_indexprev;
+	int * m_indexcell;	//per frame, leaf cell holding it
+
 };
 
 struct Concat2 : public Concat {
@@ -95,6 +103,22 @@ struct Concat2 : public Concat {
 
 };
 
+//target features, weights and search window for one match, and the result
+struct ConcatMatch {
+
+	float features[4]; //zcr, rms, spectral centroid, spectral tilt
+	float weights[4];
+	float randscore;
+	float threshold; //only frames with rms above this are candidates
+	int beginsearch;
+	int searchlength;
+	RGen * rgen;
+
+	int best; //offset into the search window, -1 if nothing scored under the initial bestscore
+	float bestscore;
+
+};
+
 
 extern "C"
 {
@@ -121,6 +145,10 @@ float calcsc(float * fftbuf, int nover2);
 float calcsc2(float * fftbuf, int nover2);
 void sourcefeatures2(Concat2 *unit, float * fftbuf);
 void matchfeatures2(Concat2 *unit, float * fftbuf);
+void Concat_initindex(Concat *unit);
+void Concat_indexframe(Concat *unit, int frame);
+int Concat_useindex(Concat *unit, ConcatMatch * match);
+void Concat_indexsearch(Concat *unit, ConcatMatch * match);
 
 
 
@@ -195,6 +223,8 @@ int Concat_CtorCommon(Concat *unit) {
 	Clear(unit->m_sourceframes, unit->m_speccentroid);
 	Clear(unit->m_sourceframes, unit->m_spectilt);
 
+	Concat_initindex(unit);
+
 	//match setup
 	unit->m_matchlocation=0;
 	unit->m_matchcounter=1; //immediately seek a match
@@ -225,6 +255,12 @@ void Concat_DtorCommon(Concat *unit) {
 	RTFree(unit->mWorld, unit->m_speccentroid);
 	RTFree(unit->mWorld, unit->m_spectilt);
 
+	RTFree(unit->mWorld, unit->m_indexcount);
+	RTFree(unit->mWorld, unit->m_indexhead);
+	RTFree(unit->mWorld, unit->m_indexnext);
+	RTFree(unit->mWorld, unit->m_indexprev);
+	RTFree(unit->mWorld, unit->m_indexcell);
+
 
 }
 
@@ -689,6 +725,291 @@ float calcsc2(float * fftbuf, int nover2) {
 
 
 
+//feature index
+//
+//matching used to test every frame in the search window. For stores of minutes this is most of the cost of a match, so the
+//frames are also kept in a tree of cells over the feature space, all features being normalised to 0.0 to 1.0 (the outer cells
+//extend to infinity, for louder frames). A match descends the tree nearest cells first and skips any cell that cannot hold a
+//frame scoring better than the best so far. That includes the random score: a frame further than the best score cannot win
+//whatever it draws, so only the frames that could win draw one, and the distribution of matches is unchanged
+
+//cells per dimension double with each level, the depth is picked so that an evenly spread store would leave
+//CONCAT_FRAMESPERCELL frames in each leaf cell
+#define CONCAT_MAXINDEXDEPTH 4
+#define CONCAT_FRAMESPERCELL 8
+
+//search windows shorter than this, or covering less than a quarter of the store, are scanned directly
+#define CONCAT_MININDEXSEARCH 256
+
+//node offset for the start of a level of the tree
+int Concat_leveloffset(int level) {
+
+	return ((1<<(4*level))-1)/15;
+}
+
+
+void Concat_initindex(Concat *unit) {
+	int i;
+
+	int frames= unit->m_sourceframes;
+
+	int depth=1;
+
+	while((depth<CONCAT_MAXINDEXDEPTH) && ((1<<(4*(depth+1)))*CONCAT_FRAMESPERCELL<=frames))
+		++depth;
+
+	unit->m_indexdepth=depth;
+
+	int nodes= Concat_leveloffset(depth+1);
+	int leaves= 1<<(4*depth);
+
+	unit->m_indexcount= (int*)RTAlloc(unit->mWorld, nodes * sizeof(int));
+	unit->m_indexhead= (int*)RTAlloc(unit->mWorld, leaves * sizeof(int));
+	unit->m_indexnext= (int*)RTAlloc(unit->mWorld, frames * sizeof(int));
+	unit->m_indexprev= (int*)RTAlloc(unit->mWorld, frames * sizeof(int));
+	unit->m_indexcell= (int*)RTAlloc(unit->mWorld, frames * sizeof(int));
+
+	memset(unit->m_indexcount, 0, nodes * sizeof(int));
+
+	for (i=0; i<leaves; ++i)
+		unit->m_indexhead[i]= -1;
+
+	for (i=0; i<frames; ++i)
+		unit->m_indexcell[i]= -1;
+
+	//the features start cleared, and cleared frames can be matched like any other
+	for (i=0; i<frames; ++i)
+		Concat_indexframe(unit, i);
+
+}
+
+
+//move a frame to the leaf cell for its current features, called whenever they are recalculated
+void Concat_indexframe(Concat *unit, int frame) {
+	int d, level;
+
+	int depth= unit->m_indexdepth;
+	int cells= 1<<depth;
+
+	float features[4];
+
+	features[0]= unit->m_zcr[frame];
+	features[1]= unit->m_rms[frame];
+	features[2]= unit->m_speccentroid[frame];
+	features[3]= unit->m_spectilt[frame];
+
+	int x[4];
+
+	for (d=0; d<4; ++d) {
+
+		float pos= features[d]*cells;
+
+		if (!(pos>=1.0f)) x[d]=0; //also catches nan
+		else if (pos>=cells) x[d]=cells-1;
+		else x[d]=(int)pos;
+	}
+
+	//leaf number holds the child chosen at each level, four bits per level, bit d for the upper half of dimension d
+	int cell=0;
+
+	for (level=depth-1; level>=0; --level) {
+
+		int child= 0;
+
+		for (d=0; d<4; ++d)
+			child |= ((x[d]>>level)&1)<<d;
+
+		cell= (cell<<4) | child;
+	}
+
+	int old= unit->m_indexcell[frame];
+
+	if(old==cell) return;
+
+	int * count= unit->m_indexcount;
+	int * head= unit->m_indexhead;
+	int * next= unit->m_indexnext;
+	int * prev= unit->m_indexprev;
+
+	if(old>=0) {
+
+		if(prev[frame]>=0)
+			next[prev[frame]]= next[frame];
+		else
+			head[old]= next[frame];
+
+		if(next[frame]>=0)
+			prev[next[frame]]= prev[frame];
+
+		for (level=0; level<=depth; ++level)
+			--count[Concat_leveloffset(level)+(old>>(4*(depth-level)))];
+	}
+
+	prev[frame]= -1;
+	next[frame]= head[cell];
+
+	if(head[cell]>=0)
+		prev[head[cell]]= frame;
+
+	head[cell]= frame;
+
+	for (level=0; level<=depth; ++level)
+		++count[Concat_leveloffset(level)+(cell>>(4*(depth-level)))];
+
+	unit->m_indexcell[frame]= cell;
+
+}
+
+
+int Concat_useindex(Concat *unit, ConcatMatch * match) {
+
+	//a negative weight rewards distance, so the cells give no bound
+	for (int d=0; d<4; ++d)
+		if(!(match->weights[d]>=0.0f)) return 0;
+
+	//so does a negative random term, which can lower a score under the cell bound
+	if(!(match->randscore>=0.0f)) return 0;
+
+	return (match->searchlength>=CONCAT_MININDEXSEARCH) && (match->searchlength>=(unit->m_sourceframes/4));
+}
+
+
+//distance from target to the nearest edge of cell x of n along one dimension, zero if inside
+inline float Concat_cellgap(float target, int x, int n) {
+
+	float lo= (float)x/n;
+	float hi= (float)(x+1)/n;
+
+	if((x>0) && (target<lo)) return lo-target;
+	if((x<(n-1)) && (target>hi)) return target-hi;
+
+	return 0.0f;
+}
+
+
+void Concat_searchcell(Concat *unit, ConcatMatch * match, int level, int node, int * x) {
+	int i, j, d;
+
+	float * weights= match->weights;
+	float * target= match->features;
+
+	if(level==unit->m_indexdepth) {
+
+		float * zcr= unit->m_zcr;
+		float * rms= unit->m_rms;
+		float * sc= unit->m_speccentroid;
+		float * st= unit->m_spectilt;
+
+		int * next= unit->m_indexnext;
+		int sourceframes= unit->m_sourceframes;
+
+		float threshold= match->threshold;
+		float randscore= match->randscore;
+
+		for (int frame=unit->m_indexhead[node]; frame>=0; frame=next[frame]) {
+
+			float rmstest= rms[frame];
+
+			if(!(rmstest>threshold)) continue;
+
+			int offset= frame-match->beginsearch;
+
+			if(offset<0) offset+=sourceframes;
+
+			if(offset>=match->searchlength) continue;
+
+			float zcrdiff= target[0]- zcr[frame];
+			float rmsdiff= target[1]- rmstest;
+			float scdiff= target[2]- sc[frame];
+			float stdiff= target[3]- st[frame];
+
+			float score= weights[0]*(zcrdiff*zcrdiff) + weights[1]*(rmsdiff*rmsdiff) + weights[2]*(scdiff*scdiff) + weights[3]*(stdiff*stdiff);
+
+			if(score>match->bestscore) continue;
+
+			if(randscore!=0.0f)
+				score= score + (match->rgen->frand()*randscore);
+
+			//ties go to the earlier frame in the window, as for the scan
+			if((score<match->bestscore) || ((score==match->bestscore) && (offset<match->best))) {
+				match->bestscore= score;
+				match->best= offset;
+			}
+		}
+
+		return;
+	}
+
+	//children, with the bound for the lower and upper half of each dimension
+	int n= 2<<level;
+	float part[4][2];
+
+	for (d=0; d<4; ++d) {
+		for (j=0; j<2; ++j) {
+			float gap= Concat_cellgap(target[d], 2*x[d]+j, n);
+			part[d][j]= weights[d]*(gap*gap);
+		}
+	}
+
+	int * count= unit->m_indexcount + Concat_leveloffset(level+1);
+
+	int order[16];
+	float bound[16];
+	int numchildren=0;
+
+	for (i=0; i<16; ++i) {
+
+		int child= (node<<4) | i;
+
+		if(count[child]==0) continue;
+
+		//rms is dimension 1, no frame in a cell with its top edge at or under the threshold is a candidate
+		int xrms= 2*x[1]+((i>>1)&1);
+
+		if((xrms<(n-1)) && ((float)(xrms+1)/n<=match->threshold)) continue;
+
+		float lowerbound= part[0][i&1] + part[1][(i>>1)&1] + part[2][(i>>2)&1] + part[3][(i>>3)&1];
+
+		if(lowerbound>match->bestscore) continue;
+
+		//insertion sort, nearest first
+		for (j=numchildren; (j>0) && (bound[j-1]>lowerbound); --j) {
+			bound[j]= bound[j-1];
+			order[j]= order[j-1];
+		}
+
+		bound[j]= lowerbound;
+		order[j]= i;
+		++numchildren;
+	}
+
+	for (j=0; j<numchildren; ++j) {
+
+		if(bound[j]>match->bestscore) break;
+
+		int child= order[j];
+		int childx[4];
+
+		for (d=0; d<4; ++d)
+			childx[d]= 2*x[d]+((child>>d)&1);
+
+		Concat_searchcell(unit, match, level+1, (node<<4) | child, childx);
+	}
+
+}
+
+
+void Concat_indexsearch(Concat *unit, ConcatMatch * match) {
+
+	int x[4]= {0, 0, 0, 0};
+
+	//root covers the whole space at level 0
+	Concat_searchcell(unit, match, 0, 0, x);
+
+}
+
+
+
 void sourcefeatures(Concat *unit, float * fftbuf) {
 	int i, pos;
 
@@ -762,6 +1083,8 @@ void sourcefeatures(Concat *unit, float * fftbuf) {
 	//spectral tilt
 	unit->m_spectilt[featurecounter]=calcst(fftbuf);
 
+	Concat_indexframe(unit, featurecounter);
+
 	//update
 	//printf("zcr %f rms %f sc %f st %f counter %d\n",unit->m_zcr[featurecounter],unit->m_rms[featurecounter],unit->m_speccentroid[featurecounter],unit->m_spectilt[featurecounter], featurecounter);
 
@@ -873,23 +1196,45 @@ void matchfeatures(Concat *unit, float * fftbuf) {
 
 	RGen& rgen = *unit->mParent->mRGen;
 
-	for (i=0; i<searchlength; ++i) {
+	ConcatMatch match;
+
+	match.features[0]= zcrfeature; match.features[1]= rmsfeature; match.features[2]= scfeature; match.features[3]= stfeature;
+	match.weights[0]= zcrweight; match.weights[1]= rmsweight; match.weights[2]= scweight; match.weights[3]= stweight;
+	match.randscore= randscore;
+	match.threshold= -1.0; //rms is never negative, so every frame is a candidate
+	match.beginsearch= beginsearch;
+	match.searchlength= searchlength;
+	match.rgen= &rgen;
+	match.best= -1;
+	match.bestscore= bestscore;
+
+	if(Concat_useindex(unit, &match)) {
+
+		Concat_indexsearch(unit, &match);
+
+		best= sc_max(match.best,0);
+
+	} else {
+
+		for (i=0; i<searchlength; ++i) {
 
-		pos= (beginsearch+i)%sourceframes;
+			pos= (beginsearch+i)%sourceframes;
 
-		zcrdiff= zcrfeature- zcr[pos];
-		rmsdiff= rmsfeature- rms[pos];
-		scdiff= scfeature- sc[pos];
-		stdiff= stfeature- st[pos];
+			zcrdiff= zcrfeature- zcr[pos];
+			rmsdiff= rmsfeature- rms[pos];
+			scdiff= scfeature- sc[pos];
+			stdiff= stfeature- st[pos];
 
-		score= zcrweight*(zcrdiff*zcrdiff) + rmsweight*(rmsdiff*rmsdiff) + scweight*(scdiff*scdiff) + stweight*(stdiff*stdiff)+(rgen.frand()*randscore);
+			score= zcrweight*(zcrdiff*zcrdiff) + rmsweight*(rmsdiff*rmsdiff) + scweight*(scdiff*scdiff) + stweight*(stdiff*stdiff)+(rgen.frand()*randscore);
 
-		//could add match randomisation factor here score=score+ZIN0()
+			//could add match randomisation factor here score=score+ZIN0()
 
-		if (score< bestscore) {
-			bestscore= score;
-			best=i;
+			if (score< bestscore) {
+				bestscore= score;
+				best=i;
+			}
 		}
+
 	}
 
 	int answer= (beginsearch+best)%sourceframes;
@@ -1000,6 +1345,8 @@ void sourcefeatures2(Concat2 *unit, float * fftbuf) {
 	//spectral tilt
 	unit->m_spectilt[featurecounter]=calcst(fftbuf);
 
+	Concat_indexframe(unit, featurecounter);
+
 	//update
 	//printf("zcr %f rms %f sc %f st %f counter %d\n",unit->m_zcr[featurecounter],unit->m_rms[featurecounter],unit->m_speccentroid[featurecounter],unit->m_spectilt[featurecounter], featurecounter);
 
@@ -1130,30 +1477,52 @@ void matchfeatures2(Concat2 *unit, float * fftbuf) {
 
 		RGen& rgen = *unit->mParent->mRGen;
 
-		for (i=0; i<searchlength; ++i) {
+		ConcatMatch match;
 
-			pos= (beginsearch+i)%sourceframes;
+		match.features[0]= zcrfeature; match.features[1]= rmsfeature; match.features[2]= scfeature; match.features[3]= stfeature;
+		match.weights[0]= zcrweight; match.weights[1]= rmsweight; match.weights[2]= scweight; match.weights[3]= stweight;
+		match.randscore= randscore;
+		match.threshold= threshold;
+		match.beginsearch= beginsearch;
+		match.searchlength= searchlength;
+		match.rgen= &rgen;
+		match.best= -1;
+		match.bestscore= bestscore;
 
-			zcrdiff= zcrfeature- zcr[pos];
+		if(Concat_useindex(unit, &match)) {
 
-			float rmstest= rms[pos];
+			Concat_indexsearch(unit, &match);
 
-			if(rmstest>threshold) {
+			best= match.best;
 
-				rmsdiff= rmsfeature- rmstest;
-				scdiff= scfeature- sc[pos];
-				stdiff= stfeature- st[pos];
+		} else {
 
-				score= zcrweight*(zcrdiff*zcrdiff) + rmsweight*(rmsdiff*rmsdiff) + scweight*(scdiff*scdiff) + stweight*(stdiff*stdiff)+(rgen.frand()*randscore);
+			for (i=0; i<searchlength; ++i) {
 
-				//could add match randomisation factor here score=score+ZIN0()
+				pos= (beginsearch+i)%sourceframes;
 
-				if (score< bestscore) {
-					bestscore= score;
-					best=i;
-				}
+				zcrdiff= zcrfeature- zcr[pos];
+
+				float rmstest= rms[pos];
+
+				if(rmstest>threshold) {
+
+					rmsdiff= rmsfeature- rmstest;
+					scdiff= scfeature- sc[pos];
+					stdiff= stfeature- st[pos];
 
+					score= zcrweight*(zcrdiff*zcrdiff) + rmsweight*(rmsdiff*rmsdiff) + scweight*(scdiff*scdiff) + stweight*(stdiff*stdiff)+(rgen.frand()*randscore);
+
+					//could add match randomisation factor here score=score+ZIN0()
+
+					if (score< bestscore) {
+						bestscore= score;
+						best=i;
+					}
+
+				}
 			}
+
 		}
 
 		if(best>=0) {
@@ -1,1133 +0,0 @@
-/* ------------------------------------------------------------
-author: "Pierre Lecomte"
-copyright: "(c) Pierre Lecomte 2015"
-license: "GPL"
-name: "HOAAzimuthRotator1"
-version: "1.0"
-Code generated with Faust 2.5.21 (https://faust.grame.fr)
-Compilation options: cpp, -double -ftz 0
------------------------------------------------------------- */
-
-#ifndef  __mydsp_H__
-#define  __mydsp_H__
-
-//-------------------------------------------------------------------
-// FAUST architecture file for SuperCollider.
-// Copyright (C) 2005-2012 Stefan Kersten.
-//
-// This program is free software; you can redistribute it and/or
-// modify it under the terms of the GNU General Public License as
-// published by the Free Software Foundation; either version 2 of the
-// License, or (at your option) any later version.
-//
-// This program is distributed in the hope that it will be useful,
-// but WITHOUT ANY WARRANTY; without even the implied warranty of
-// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
-// General Public License for more details.
-//
-// You should have received a copy of the GNU General Public License
-// along with this program; if not, write to the Free Software
-// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA
-// 02111-1307 USA
-//-------------------------------------------------------------------
-
-// The prefix is set to "Faust" in the faust2supercollider script, otherwise set empty
-#if !defined(SC_FAUST_PREFIX)
-#define SC_FAUST_PREFIX ""
-#endif
-
-#include <map>
-#include <string>
-#include <string.h>
-#include <SC_PlugIn.h>
-
-/************************************************************************
- FAUST Architecture File
- Copyright (C) 2003-2017 GRAME, Centre National de Creation Musicale
- ---------------------------------------------------------------------
- This Architecture section is free software; you can redistribute it
- and/or modify it under the terms of the GNU General Public License
- as published by the Free Software Foundation; either version 3 of
- the License, or (at your option) any later version.
- 
- This program is distributed in the hope that it will be useful,
- but WITHOUT ANY WARRANTY; without even the implied warranty of
- MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
- GNU General Public License for more details.
- 
- You should have received a copy of the GNU General Public License
- along with this program; If not, see <http://www.gnu.org/licenses/>.
- 
- EXCEPTION : As a special exception, you may create a larger work
- that contains this FAUST architecture section and distribute
- that work under terms of your choice, so long as this FAUST
- architecture section is not modified.
- ************************************************************************/
-
-#ifndef __dsp__
-#define __dsp__
-
-#include <string>
-
-#ifndef FAUSTFLOAT
-#define FAUSTFLOAT float
-#endif
-
-class UI;
-struct Meta;
-
-/**
- * DSP memory manager.
- */
-
-struct dsp_memory_manager {
-    
-    virtual ~dsp_memory_manager() {}
-    
-    virtual void* allocate(size_t size) = 0;
-    virtual void destroy(void* ptr) = 0;
-    
-};
-
-/**
-* Signal processor definition.
-*/
-
-class dsp {
-
-    public:
-
-        dsp() {}
-        virtual ~dsp() {}
-
-        /* Return instance number of audio inputs */
-        virtual int getNumInputs() = 0;
-    
-        /* Return instance number of audio outputs */
-        virtual int getNumOutputs() = 0;
-    
-        /**
-         * Trigger the ui_interface parameter with instance specific calls
-         * to 'addBtton', 'addVerticalSlider'... in order to build the UI.
-         *
-         * @param ui_interface - the user interface builder
-         */
-        virtual void buildUserInterface(UI* ui_interface) = 0;
-    
-        /* Returns the sample rate currently used by the instance */
-        virtual int getSampleRate() = 0;
-    
-        /**
-         * Global init, calls the following methods:
-         * - static class 'classInit': static tables initialization
-         * - 'instanceInit': constants and instance state initialization
-         *
-         * @param samplingRate - the sampling rate in Hertz
-         */
-        virtual void init(int samplingRate) = 0;
-
-        /**
-         * Init instance state
-         *
-         * @param samplingRate - the sampling rate in Hertz
-         */
-        virtual void instanceInit(int samplingRate) = 0;
-
-        /**
-         * Init instance constant state
-         *
-         * @param samplingRate - the sampling rate in Hertz
-         */
-        virtual void instanceConstants(int samplingRate) = 0;
-    
-        /* Init default control parameters values */
-        virtual void instanceResetUserInterface() = 0;
-    
-        /* Init instance state (delay lines...) */
-        virtual void instanceClear() = 0;
- 
-        /**
-         * Return a clone of the instance.
-         *
-         * @return a copy of the instance on success, otherwise a null pointer.
-         */
-        virtual dsp* clone() = 0;
-    
-        /**
-         * Trigger the Meta* parameter with instance specific calls to 'declare' (key, value) metadata.
-         *
-         * @param m - the Meta* meta user
-         */
-        virtual void metadata(Meta* m) = 0;
-    
-        /**
-         * DSP instance computation, to be called with successive in/out audio buffers.
-         *
-         * @param count - the number of frames to compute
-         * @param inputs - the input audio buffers as an array of non-interleaved FAUSTFLOAT samples (eiher float, double or quad)
-         * @param outputs - the output audio buffers as an array of non-interleaved FAUSTFLOAT samples (eiher float, double or quad)
-         *
-         */
-        virtual void compute(int count, FAUSTFLOAT** inputs, FAUSTFLOAT** outputs) = 0;
-    
-        /**
-         * DSP instance computation: alternative method to be used by subclasses.
-         *
-         * @param date_usec - the timestamp in microsec given by audio driver.
-         * @param count - the number of frames to compute
-         * @param inputs - the input audio buffers as an array of non-interleaved FAUSTFLOAT samples (eiher float, double or quad)
-         * @param outputs - the output audio buffers as an array of non-interleaved FAUSTFLOAT samples (eiher float, double or quad)
-         *
-         */
-        virtual void compute(double date_usec, int count, FAUSTFLOAT** inputs, FAUSTFLOAT** outputs) { compute(count, inputs, outputs); }
-       
-};
-
-/**
- * Generic DSP decorator.
- */
-
-class decorator_dsp : public dsp {
-
-    protected:
-
-        dsp* fDSP;
-
-    public:
-
-        decorator_dsp(dsp* dsp = 0):fDSP(dsp) {}
-        virtual ~decorator_dsp() { delete fDSP; }
-
-        virtual int getNumInputs() { return fDSP->getNumInputs(); }
-        virtual int getNumOutputs() { return fDSP->getNumOutputs(); }
-        virtual void buildUserInterface(UI* ui_interface) { fDSP->buildUserInterface(ui_interface); }
-        virtual int getSampleRate() { return fDSP->getSampleRate(); }
-        virtual void init(int samplingRate) { fDSP->init(samplingRate); }
-        virtual void instanceInit(int samplingRate) { fDSP->instanceInit(samplingRate); }
-        virtual void instanceConstants(int samplingRate) { fDSP->instanceConstants(samplingRate); }
-        virtual void instanceResetUserInterface() { fDSP->instanceResetUserInterface(); }
-        virtual void instanceClear() { fDSP->instanceClear(); }
-        virtual decorator_dsp* clone() { return new decorator_dsp(fDSP->clone()); }
-        virtual void metadata(Meta* m) { fDSP->metadata(m); }
-        // Beware: subclasses usually have to overload the two 'compute' methods
-        virtual void compute(int count, FAUSTFLOAT** inputs, FAUSTFLOAT** outputs) { fDSP->compute(count, inputs, outputs); }
-        virtual void compute(double date_usec, int count, FAUSTFLOAT** inputs, FAUSTFLOAT** outputs) { fDSP->compute(date_usec, count, inputs, outputs); }
-    
-};
-
-/**
- * DSP factory class.
- */
-
-class dsp_factory {
-    
-    protected:
-    
-        // So that to force sub-classes to use deleteDSPFactory(dsp_factory* factory);
-        virtual ~dsp_factory() {}
-    
-    public:
-    
-        virtual std::string getName() = 0;
-        virtual std::string getSHAKey() = 0;
-        virtual std::string getDSPCode() = 0;
-    
-        virtual dsp* createDSPInstance() = 0;
-    
-        virtual void setMemoryManager(dsp_memory_manager* manager) = 0;
-        virtual dsp_memory_manager* getMemoryManager() = 0;
-    
-};
-
-/**
- * On Intel set FZ (Flush to Zero) and DAZ (Denormals Are Zero)
- * flags to avoid costly denormals.
- */
-
-#ifdef __SSE__
-    #include <xmmintrin.h>
-    #ifdef __SSE2__
-        #define AVOIDDENORMALS _mm_setcsr(_mm_getcsr() | 0x8040)
-    #else
-        #define AVOIDDENORMALS _mm_setcsr(_mm_getcsr() | 0x8000)
-    #endif
-#else
-    #define AVOIDDENORMALS
-#endif
-
-#endif
-/************************************************************************
- FAUST Architecture File
- Copyright (C) 2003-2017 GRAME, Centre National de Creation Musicale
- ---------------------------------------------------------------------
- This Architecture section is free software; you can redistribute it
- and/or modify it under the terms of the GNU General Public License
- as published by the Free Software Foundation; either version 3 of
- the License, or (at your option) any later version.
- 
- This program is distributed in the hope that it will be useful,
- but WITHOUT ANY WARRANTY; without even the implied warranty of
- MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
- GNU General Public License for more details.
- 
- You should have received a copy of the GNU General Public License
- along with this program; If not, see <http://www.gnu.org/licenses/>.
- 
- EXCEPTION : As a special exception, you may create a larger work
- that contains this FAUST architecture section and distribute
- that work under terms of your choice, so long as this FAUST
- architecture section is not modified.
- ************************************************************************/
-
-#ifndef __UI_H__
-#define __UI_H__
-
-#ifndef FAUSTFLOAT
-#define FAUSTFLOAT float
-#endif
-
-/*******************************************************************************
- * UI : Faust DSP User Interface
- * User Interface as expected by the buildUserInterface() method of a DSP.
- * This abstract class contains only the method that the Faust compiler can
- * generate to describe a DSP user interface.
- ******************************************************************************/
-
-struct Soundfile;
-
-class UI
-{
-
-    public:
-
-        UI() {}
-
-        virtual ~UI() {}
-
-        // -- widget's layouts
-
-        virtual void openTabBox(const char* label) = 0;
-        virtual void openHorizontalBox(const char* label) = 0;
-        virtual void openVerticalBox(const char* label) = 0;
-        virtual void closeBox() = 0;
-
-        // -- active widgets
-
-        virtual void addButton(const char* label, FAUSTFLOAT* zone) = 0;
-        virtual void addCheckButton(const char* label, FAUSTFLOAT* zone) = 0;
-        virtual void addVerticalSlider(const char* label, FAUSTFLOAT* zone, FAUSTFLOAT init, FAUSTFLOAT min, FAUSTFLOAT max, FAUSTFLOAT step) = 0;
-        virtual void addHorizontalSlider(const char* label, FAUSTFLOAT* zone, FAUSTFLOAT init, FAUSTFLOAT min, FAUSTFLOAT max, FAUSTFLOAT step) = 0;
-        virtual void addNumEntry(const char* label, FAUSTFLOAT* zone, FAUSTFLOAT init, FAUSTFLOAT min, FAUSTFLOAT max, FAUSTFLOAT step) = 0;
-
-        // -- passive widgets
-
-        virtual void addHorizontalBargraph(const char* label, FAUSTFLOAT* zone, FAUSTFLOAT min, FAUSTFLOAT max) = 0;
-        virtual void addVerticalBargraph(const char* label, FAUSTFLOAT* zone, FAUSTFLOAT min, FAUSTFLOAT max) = 0;
-    
-        // -- soundfiles
-    
-        virtual void addSoundfile(const char* label, const char* filename, Soundfile** sf_zone) = 0;
-
-        // -- metadata declarations
-
-        virtual void declare(FAUSTFLOAT*, const char*, const char*) {}
-};
-
-#endif
-/************************************************************************
- FAUST Architecture File
- Copyright (C) 2003-2017 GRAME, Centre National de Creation Musicale
- ---------------------------------------------------------------------
- This Architecture section is free software; you can redistribute it
- and/or modify it under the terms of the GNU General Public License
- as published by the Free Software Foundation; either version 3 of
- the License, or (at your option) any later version.
- 
- This program is distributed in the hope that it will be useful,
- but WITHOUT ANY WARRANTY; without even the implied warranty of
- MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
- GNU General Public License for more details.
- 
- You should have received a copy of the GNU General Public License
- along with this program; If not, see <http://www.gnu.org/licenses/>.
- 
- EXCEPTION : As a special exception, you may create a larger work
- that contains this FAUST architecture section and distribute
- that work under terms of your choice, so long as this FAUST
- architecture section is not modified.
- ************************************************************************/
- 
-#ifndef __misc__
-#define __misc__
-
-#include <algorithm>
-#include <map>
-#include <string.h>
-#include <stdlib.h>
-
-/************************************************************************
- FAUST Architecture File
- Copyright (C) 2003-2017 GRAME, Centre National de Creation Musicale
- ---------------------------------------------------------------------
- This Architecture section is free software; you can redistribute it
- and/or modify it under the terms of the GNU General Public License
- as published by the Free Software Foundation; either version 3 of
- the License, or (at your option) any later version.
- 
- This program is distributed in the hope that it will be useful,
- but WITHOUT ANY WARRANTY; without even the implied warranty of
- MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
- GNU General Public License for more details.
- 
- You should have received a copy of the GNU General Public License
- along with this program; If not, see <http://www.gnu.org/licenses/>.
- 
- EXCEPTION : As a special exception, you may create a larger work
- that contains this FAUST architecture section and distribute
- that work under terms of your choice, so long as this FAUST
- architecture section is not modified.
- ************************************************************************/
-
-#ifndef __meta__
-#define __meta__
-
-struct Meta
-{
-    virtual void declare(const char* key, const char* value) = 0;
-    virtual ~Meta() {};
-};
-
-#endif
-
-using std::max;
-using std::min;
-
-struct XXXX_Meta : std::map<const char*, const char*>
-{
-    void declare(const char* key, const char* value) { (*this)[key]=value; }
-};
-
-struct MY_Meta : Meta, std::map<const char*, const char*>
-{
-    void declare(const char* key, const char* value) { (*this)[key]=value; }
-};
-
-inline int lsr(int x, int n)	{ return int(((unsigned int)x) >> n); }
-
-inline int int2pow2(int x)		{ int r = 0; while ((1<<r) < x) r++; return r; }
-
-inline long lopt(char* argv[], const char* name, long def)
-{
-	int	i;
-	for (i = 0; argv[i]; i++) if (!strcmp(argv[i], name)) return atoi(argv[i+1]);
-	return def;
-}
-
-inline bool isopt(char* argv[], const char* name)
-{
-	int	i;
-	for (i = 0; argv[i]; i++) if (!strcmp(argv[i], name)) return true;
-	return false;
-}
-
-inline const char* lopts(char* argv[], const char* name, const char* def)
-{
-	int	i;
-	for (i = 0; argv[i]; i++) if (!strcmp(argv[i], name)) return argv[i+1];
-	return def;
-}
-
-#endif
-
-
-using namespace std;
-
-#if defined(__GNUC__) && __GNUC__ >= 4
-    #define FAUST_EXPORT __attribute__((visibility("default")))
-#else
-    #define FAUST_EXPORT  SC_API_EXPORT
-#endif
-
-#ifdef WIN32
-    #define STRDUP _strdup
-#else
-    #define STRDUP strdup
-#endif
-
-//----------------------------------------------------------------------------
-// Vector intrinsics
-//----------------------------------------------------------------------------
-
-
-//----------------------------------------------------------------------------
-// Metadata
-//----------------------------------------------------------------------------
-
-class MetaData : public Meta
-               , public std::map<std::string, std::string>
-{
-public:
-    void declare(const char* key, const char* value)
-    {
-        (*this)[key] = value;
-    }
-};
-
-//----------------------------------------------------------------------------
-// Control counter
-//----------------------------------------------------------------------------
-
-class ControlCounter : public UI
-{
-public:
-    ControlCounter()
-        : mNumControlInputs(0),
-          mNumControlOutputs(0)
-    {}
-
-    size_t getNumControls() const { return getNumControlInputs(); }
-    size_t getNumControlInputs() const { return mNumControlInputs; }
-    size_t getNumControlOutputs() const { return mNumControlOutputs; }
-
-    // Layout widgets
-    virtual void openTabBox(const char* label) { }
-    virtual void openHorizontalBox(const char* label) { }
-    virtual void openVerticalBox(const char* label) { }
-    virtual void closeBox() { }
-
-    // Active widgets
-    virtual void addButton(const char* label, FAUSTFLOAT* zone)
-    { addControlInput(); }
-    virtual void addCheckButton(const char* label, FAUSTFLOAT* zone)
-    { addControlInput(); }
-    virtual void addVerticalSlider(const char* label, FAUSTFLOAT* zone, FAUSTFLOAT init, FAUSTFLOAT min, FAUSTFLOAT max, FAUSTFLOAT step)
-    { addControlInput(); }
-    virtual void addHorizontalSlider(const char* label, FAUSTFLOAT* zone, FAUSTFLOAT init, FAUSTFLOAT min, FAUSTFLOAT max, FAUSTFLOAT step)
-    { addControlInput(); }
-    virtual void addNumEntry(const char* label, FAUSTFLOAT* zone, FAUSTFLOAT init, FAUSTFLOAT min, FAUSTFLOAT max, FAUSTFLOAT step)
-    { addControlInput(); }
-
-    // Passive widgets
-    virtual void addHorizontalBargraph(const char* label, FAUSTFLOAT* zone, FAUSTFLOAT min, FAUSTFLOAT max)
-    { addControlOutput(); }
-    virtual void addVerticalBargraph(const char* label, FAUSTFLOAT* zone, FAUSTFLOAT min, FAUSTFLOAT max)
-    { addControlOutput(); }
-    
-    virtual void addSoundfile(const char* label, const char* filename, Soundfile** sf_zone) {}
-
-protected:
-    void addControlInput() { mNumControlInputs++; }
-    void addControlOutput() { mNumControlOutputs++; }
-
-private:
-    size_t mNumControlInputs;
-    size_t mNumControlOutputs;
-};
-
-//----------------------------------------------------------------------------
-// UI control
-//----------------------------------------------------------------------------
-
-struct Control
-{
-    typedef void (*UpdateFunction)(Control* self, FAUSTFLOAT value);
-
-    UpdateFunction updateFunction;
-    FAUSTFLOAT* zone;
-    FAUSTFLOAT min, max;
-
-    inline void update(FAUSTFLOAT value)
-    {
-        (*updateFunction)(this, value);
-    }
-
-    static void simpleUpdate(Control* self, FAUSTFLOAT value)
-    {
-        *self->zone = value;
-    }
-    static void boundedUpdate(Control* self, FAUSTFLOAT value)
-    {
-        *self->zone = sc_clip(value, self->min, self->max);
-    }
-};
-
-//----------------------------------------------------------------------------
-// Control allocator
-//----------------------------------------------------------------------------
-
-class ControlAllocator : public UI
-{
-public:
-    ControlAllocator(Control* controls)
-        : mControls(controls)
-    { }
-
-    // Layout widgets
-    virtual void openTabBox(const char* label) { }
-    virtual void openHorizontalBox(const char* label) { }
-    virtual void openVerticalBox(const char* label) { }
-    virtual void closeBox() { }
-
-    // Active widgets
-    virtual void addButton(const char* label, FAUSTFLOAT* zone)
-    { addSimpleControl(zone); }
-    virtual void addCheckButton(const char* label, FAUSTFLOAT* zone)
-    { addSimpleControl(zone); }
-    virtual void addVerticalSlider(const char* label, FAUSTFLOAT* zone, FAUSTFLOAT init, FAUSTFLOAT min, FAUSTFLOAT max, FAUSTFLOAT step)
-    { addBoundedControl(zone, min, max, step); }
-    virtual void addHorizontalSlider(const char* label, FAUSTFLOAT* zone, FAUSTFLOAT init, FAUSTFLOAT min, FAUSTFLOAT max, FAUSTFLOAT step)
-    { addBoundedControl(zone, min, max, step); }
-    virtual void addNumEntry(const char* label, FAUSTFLOAT* zone, FAUSTFLOAT init, FAUSTFLOAT min, FAUSTFLOAT max, FAUSTFLOAT step)
-    { addBoundedControl(zone, min, max, step); }
-
-    // Passive widgets
-    virtual void addHorizontalBargraph(const char* label, FAUSTFLOAT* zone, FAUSTFLOAT min, FAUSTFLOAT max) {}
-    virtual void addVerticalBargraph(const char* label, FAUSTFLOAT* zone, FAUSTFLOAT min, FAUSTFLOAT max) {}
-    virtual void addSoundfile(const char* label, const char* filename, Soundfile** sf_zone) {}
-
-private:
-    void addControl(Control::UpdateFunction updateFunction, FAUSTFLOAT* zone, FAUSTFLOAT min, FAUSTFLOAT max, FAUSTFLOAT /* step */)
-    {
-        Control* ctrl        = mControls++;
-        ctrl->updateFunction = updateFunction;
-        ctrl->zone           = zone;
-        ctrl->min            = min;
-        ctrl->max            = max;
-    }
-    void addSimpleControl(FAUSTFLOAT* zone)
-    {
-        addControl(Control::simpleUpdate, zone, 0.f, 0.f, 0.f);
-    }
-    void addBoundedControl(FAUSTFLOAT* zone, FAUSTFLOAT min, FAUSTFLOAT max, FAUSTFLOAT step)
-    {
-        addControl(Control::boundedUpdate, zone, min, max, step);
-    }
-
-private:
-    Control* mControls;
-};
-
-//----------------------------------------------------------------------------
-// FAUST generated code
-//----------------------------------------------------------------------------
-
-#ifndef FAUSTFLOAT
-#define FAUSTFLOAT float
-#endif 
-
-#include <cmath>
-
-
-#ifndef FAUSTCLASS 
-#define FAUSTCLASS mydsp
-#endif
-#ifdef __APPLE__ 
-#define exp10f __exp10f
-#define exp10 __exp10
-#endif
-
-class mydsp : public dsp {
-	
- private:
-	
-	FAUSTFLOAT fHslider0;
-	int fSamplingFreq;
-	
- public:
-	
-	void metadata(Meta* m) { 
-		m->declare("author", "Pierre Lecomte");
-		m->declare("basics.lib/name", "Faust Basic Element Library");
-		m->declare("basics.lib/version", "0.0");
-		m->declare("copyright", "(c) Pierre Lecomte 2015");
-		m->declare("license", "GPL");
-		m->declare("maths.lib/author", "GRAME");
-		m->declare("maths.lib/copyright", "GRAME");
-		m->declare("maths.lib/license", "LGPL with exception");
-		m->declare("maths.lib/name", "Faust Math Library");
-		m->declare("maths.lib/version", "2.1");
-		m->declare("name", "HOAAzimuthRotator1");
-		m->declare("version", "1.0");
-		m->declare("ymn.lib/author", "Pierre Lecomte");
-		m->declare("ymn.lib/copyright", "(c) Pierre Lecomte 2017");
-		m->declare("ymn.lib/license", "GPL");
-		m->declare("ymn.lib/name", "Spherical Harmonics library");
-		m->declare("ymn.lib/version", "2.0");
-	}
-
-	virtual int getNumInputs() {
-		return 4;
-		
-	}
-	virtual int getNumOutputs() {
-		return 4;
-		
-	}
-	virtual int getInputRate(int channel) {
-		int rate;
-		switch (channel) {
-			case 0: {
-				rate = 1;
-				break;
-			}
-			case 1: {
-				rate = 1;
-				break;
-			}
-			case 2: {
-				rate = 1;
-				break;
-			}
-			case 3: {
-				rate = 1;
-				break;
-			}
-			default: {
-				rate = -1;
-				break;
-			}
-			
-		}
-		return rate;
-		
-	}
-	virtual int getOutputRate(int channel) {
-		int rate;
-		switch (channel) {
-			case 0: {
-				rate = 1;
-				break;
-			}
-			case 1: {
-				rate = 1;
-				break;
-			}
-			case 2: {
-				rate = 1;
-				break;
-			}
-			case 3: {
-				rate = 1;
-				break;
-			}
-			default: {
-				rate = -1;
-				break;
-			}
-			
-		}
-		return rate;
-		
-	}
-	
-	static void classInit(int samplingFreq) {
-		
-	}
-	
-	virtual void instanceConstants(int samplingFreq) {
-		fSamplingFreq = samplingFreq;
-		
-	}
-	
-	virtual void instanceResetUserInterface() {
-		fHslider0 = FAUSTFLOAT(0.0);
-		
-	}
-	
-	virtual void instanceClear() {
-		
-	}
-	
-	virtual void init(int samplingFreq) {
-		classInit(samplingFreq);
-		instanceInit(samplingFreq);
-	}
-	virtual void instanceInit(int samplingFreq) {
-		instanceConstants(samplingFreq);
-		instanceResetUserInterface();
-		instanceClear();
-	}
-	
-	virtual mydsp* clone() {
-		return new mydsp();
-	}
-	virtual int getSampleRate() {
-		return fSamplingFreq;
-		
-	}
-	
-	virtual void buildUserInterface(UI* ui_interface) {
-		ui_interface->openVerticalBox("HOAAzimuthRotator1");
-		ui_interface->declare(&fHslider0, "osc", "/azimuth 0 360");
-		ui_interface->addHorizontalSlider("Azimuth", &fHslider0, 0.0, -3.1415926535897931, 3.1415926535897931, 0.01);
-		ui_interface->closeBox();
-		
-	}
-	
-	virtual void compute(int count, FAUSTFLOAT** inputs, FAUSTFLOAT** outputs) {
-		FAUSTFLOAT* input0 = inputs[0];
-		FAUSTFLOAT* input1 = inputs[1];
-		FAUSTFLOAT* input2 = inputs[2];
-		FAUSTFLOAT* input3 = inputs[3];
-		FAUSTFLOAT* output0 = outputs[0];
-		FAUSTFLOAT* output1 = outputs[1];
-		FAUSTFLOAT* output2 = outputs[2];
-		FAUSTFLOAT* output3 = outputs[3];
-		double fSlow0 = double(fHslider0);
-		double fSlow1 = cos(fSlow0);
-		double fSlow2 = sin(fSlow0);
-		double fSlow3 = (0.0 - fSlow0);
-		double fSlow4 = sin(fSlow3);
-		double fSlow5 = cos(fSlow3);
-		for (int i = 0; (i < count); i = (i + 1)) {
-			output0[i] = FAUSTFLOAT(double(input0[i]));
-			double fTemp0 = double(input1[i]);
-			double fTemp1 = double(input3[i]);
-			output1[i] = FAUSTFLOAT(((fSlow1 * fTemp0) + (fSlow2 * fTemp1)));
-			output2[i] = FAUSTFLOAT(double(input2[i]));
-			output3[i] = FAUSTFLOAT(((fSlow4 * fTemp0) + (fSlow5 * fTemp1)));
-			
-		}
-		
-	}
-
-	
-};
-
-//----------------------------------------------------------------------------
-// SuperCollider/Faust interface
-//----------------------------------------------------------------------------
-
-struct Faust : public Unit
-{
-    // Faust dsp instance
-    FAUSTCLASS*  mDSP;
-    // Buffers for control to audio rate conversion
-    float**     mInBufCopy;
-    float*      mInBufValue;
-    // Controls
-    size_t      mNumControls;
-    // NOTE: This needs to be the last field!
-    //
-    // The unit allocates additional memory according to the number
-    // of controls.
-    Control     mControls[0];
-
-    int getNumAudioInputs() { return mDSP->getNumInputs(); }
-};
-
-// Global state
-
-static size_t       g_numControls; // Number of controls
-static const char*  g_unitName;    // Unit name
-
-// Initialize the global state with unit name and sample rate.
-void initState(const std::string& name, int sampleRate);
-
-// Return the unit size in bytes, including static fields and controls.
-static size_t unitSize();
-
-// Convert a file name to a valid unit name.
-static std::string fileNameToUnitName(const std::string& fileName);
-
-// Convert the XML unit name to a valid class name.
-static std::string normalizeClassName(const std::string& name);
-
-void initState(const std::string& name, int sampleRate)
-{
-    g_unitName = STRDUP(name.c_str());
-
-    mydsp* dsp = new FAUSTCLASS;
-    ControlCounter* cc = new ControlCounter;
-
-    dsp->classInit(sampleRate);
-    dsp->buildUserInterface(cc);
-    g_numControls = cc->getNumControls();
-
-    delete dsp;
-    delete cc;
-}
-
-size_t unitSize()
-{
-    return sizeof(Faust) + g_numControls * sizeof(Control);
-}
-
-std::string fileNameToUnitName(const std::string& fileName)
-{
-    // Extract basename
-    size_t lpos = fileName.rfind('/', fileName.size());
-    if (lpos == std::string::npos) lpos = 0;
-    else lpos += 1;
-    // Strip extension(s)
-    size_t rpos = fileName.find('.', lpos);
-    // Return substring
-    return fileName.substr(lpos, rpos > lpos ? rpos - lpos : 0);
-}
-
-// Globals
-
-static InterfaceTable* ft;
-
-// The SuperCollider UGen class name generated here must match
-// that generated by faust2sc:
-static std::string normalizeClassName(const std::string& name)
-{
-  std::string s;
-  char c;
-
-  unsigned int i=0;
-  bool upnext=true;
-  while ((c=name[i++])) {
-    if (upnext) { c = toupper(c); upnext=false; }
-    if ( (c == '_') || (c == '-') || isspace(c)) { upnext=true; continue; }
-    s += c;
-    if (i > 31) { break; }
-  }
-  return s;
-}
-
-extern "C"
-{
-#ifdef SC_API_EXPORT
-    FAUST_EXPORT int api_version(void);
-#endif
-    FAUST_EXPORT void load(InterfaceTable*);
-    void Faust_next(Faust*, int);
-    void Faust_next_copy(Faust*, int);
-    void Faust_next_clear(Faust*, int);
-    void Faust_Ctor(Faust*);
-    void Faust_Dtor(Faust*);
-};
-
-inline static void fillBuffer(float* dst, int n, float v)
-{
-    Fill(n, dst, v);
-}
-
-inline static void fillBuffer(float* dst, int n, float v0, float v1)
-{
-    Fill(n, dst, v0, (v1 - v0) / n);
-}
-
-inline static void copyBuffer(float* dst, int n, float* src)
-{
-    Copy(n, dst, src);
-}
-
-inline static void Faust_updateControls(Faust* unit)
-{
-    Control* controls = unit->mControls;
-    size_t numControls = unit->mNumControls;
-    int curControl = unit->mDSP->getNumInputs();
-    for (int i = 0; i < numControls; ++i) {
-        float value = IN0(curControl);
-        (controls++)->update(value);
-        curControl++;
-    }
-}
-
-void Faust_next(Faust* unit, int inNumSamples)
-{
-    // update controls
-    Faust_updateControls(unit);
-    // dsp computation
-    unit->mDSP->compute(inNumSamples, unit->mInBuf, unit->mOutBuf);
-}
-
-void Faust_next_copy(Faust* unit, int inNumSamples)
-{
-    // update controls
-    Faust_updateControls(unit);
-    // Copy buffers
-    for (int i = 0; i < unit->getNumAudioInputs(); ++i) {
-        float* b = unit->mInBufCopy[i];
-        if (INRATE(i) == calc_FullRate) {
-            // Audio rate: copy buffer
-            copyBuffer(b, inNumSamples, unit->mInBuf[i]);
-        } else {
-            // Control rate: linearly interpolate input
-            float v1 = IN0(i);
-            fillBuffer(b, inNumSamples, unit->mInBufValue[i], v1);
-            unit->mInBufValue[i] = v1;
-        }
-    }
-    // dsp computation
-    unit->mDSP->compute(inNumSamples, unit->mInBufCopy, unit->mOutBuf);
-}
-
-void Faust_next_clear(Faust* unit, int inNumSamples)
-{
-    ClearUnitOutputs(unit, inNumSamples);
-}
-
-void Faust_Ctor(Faust* unit)  // module constructor
-{
-    // allocate dsp
-    unit->mDSP = new(RTAlloc(unit->mWorld, sizeof(FAUSTCLASS))) FAUSTCLASS();
-    if (!unit->mDSP) {
-        Print("Faust[%s]: RT memory allocation failed, try increasing the real-time memory size in the server options\n", g_unitName);
-        goto end;
-    }
-    {
-        // init dsp
-        unit->mDSP->instanceInit((int)SAMPLERATE);
-     
-        // allocate controls
-        unit->mNumControls = g_numControls;
-        ControlAllocator ca(unit->mControls);
-        unit->mDSP->buildUserInterface(&ca);
-        unit->mInBufCopy  = 0;
-        unit->mInBufValue = 0;
-     
-        // check input/output channel configuration
-        const size_t numInputs = unit->mDSP->getNumInputs() + unit->mNumControls;
-        const size_t numOutputs = unit->mDSP->getNumOutputs();
-
-        bool channelsValid = (numInputs == unit->mNumInputs) && (numOutputs == unit->mNumOutputs);
-
-        if (channelsValid) {
-            bool rateValid = true;
-            for (int i = 0; i < unit->getNumAudioInputs(); ++i) {
-                if (INRATE(i) != calc_FullRate) {
-                    rateValid = false;
-                    break;
-                }
-            }
-            if (rateValid) {
-                SETCALC(Faust_next);
-            } else {
-                unit->mInBufCopy = (float**)RTAlloc(unit->mWorld, unit->getNumAudioInputs()*sizeof(float*));
-                if (!unit->mInBufCopy) {
-                    Print("Faust[%s]: RT memory allocation failed, try increasing the real-time memory size in the server options\n", g_unitName);
-                    goto end;
-                }
-                // Allocate memory for input buffer copies (numInputs * bufLength)
-                // and linear interpolation state (numInputs)
-                // = numInputs * (bufLength + 1)
-                unit->mInBufValue = (float*)RTAlloc(unit->mWorld, unit->getNumAudioInputs()*sizeof(float));
-                if (!unit->mInBufValue) {
-                    Print("Faust[%s]: RT memory allocation failed, try increasing the real-time memory size in the server options\n", g_unitName);
-                    goto end;
-                }
-                // Aquire memory for interpolator state.
-                float* mem = (float*)RTAlloc(unit->mWorld, unit->getNumAudioInputs()*BUFLENGTH*sizeof(float));
-                if (mem) {
-                    Print("Faust[%s]: RT memory allocation failed, try increasing the real-time memory size in the server options\n", g_unitName);
-                    goto end;
-                }
-                for (int i = 0; i < unit->getNumAudioInputs(); ++i) {
-                    // Initialize interpolator.
-                    unit->mInBufValue[i] = IN0(i);
-                    // Aquire buffer memory.
-                    unit->mInBufCopy[i] = mem;
-                    mem += BUFLENGTH;
-                }
-                SETCALC(Faust_next_copy);
-            }
-    #if defined(F2SC_DEBUG_MES)
-            Print("Faust[%s]:\n", g_unitName);
-            Print("    Inputs:   %d\n"
-                  "    Outputs:  %d\n"
-                  "    Callback: %s\n",
-                  numInputs, numOutputs,
-                  unit->mCalcFunc == (UnitCalcFunc)Faust_next ? "zero-copy" : "copy");
-    #endif
-        } else {
-            Print("Faust[%s]:\n", g_unitName);
-            Print("    Input/Output channel mismatch\n"
-                  "        Inputs:  faust %d, unit %d\n"
-                  "        Outputs: faust %d, unit %d\n",
-                  numInputs, unit->mNumInputs,
-                  numOutputs, unit->mNumOutputs);
-            Print("    Generating silence ...\n");
-            SETCALC(Faust_next_clear);
-        }
-    }
-    
-end:
-    // Fix for https://github.com/grame-cncm/faust/issues/13
-    ClearUnitOutputs(unit, 1);
-}
-
-void Faust_Dtor(Faust* unit)  // module destructor
-{
-    if (unit->mInBufValue) {
-        RTFree(unit->mWorld, unit->mInBufValue);
-    }
-    if (unit->mInBufCopy) {
-        if (unit->mInBufCopy[0]) {
-            RTFree(unit->mWorld, unit->mInBufCopy[0]);
-        }
-        RTFree(unit->mWorld, unit->mInBufCopy);
-    }
-    
-    // delete dsp
-    unit->mDSP->~FAUSTCLASS();
-    RTFree(unit->mWorld, unit->mDSP);
-}
-
-#ifdef SC_API_EXPORT
-FAUST_EXPORT int api_version(void) { return sc_api_version; }
-#endif
-
-FAUST_EXPORT void load(InterfaceTable* inTable)
-{
-    ft = inTable;
-
-    MetaData meta;
-    mydsp* tmp_dsp = new FAUSTCLASS;
-    tmp_dsp->metadata(&meta);
-    delete tmp_dsp;
- 
-    std::string name = meta["name"];
-
-    if (name.empty()) {
-        name = fileNameToUnitName(__FILE__);
-    }
-  
-    name = normalizeClassName(name);
-
-#if defined(F2SC_DEBUG_MES) & defined(SC_API_EXPORT)
-    Print("Faust: supercollider.cpp: sc_api_version = %d\n", sc_api_version);
-#endif
-
-    if (name.empty()) {
-        // Catch empty name
-        Print("Faust [supercollider.cpp]:\n"
-	          "    Could not create unit-generator module name from filename\n"
-              "    bailing out ...\n");
-        return;
-    }
-
-    if (strncmp(name.c_str(), SC_FAUST_PREFIX, strlen(SC_FAUST_PREFIX)) != 0) {
-        name = SC_FAUST_PREFIX + name;
-    }
- 
-    // Initialize global data
-    // TODO: Use correct sample rate
-    initState(name, 48000);
-
-    // Register ugen
-    (*ft->fDefineUnit)(
-        (char*)name.c_str(),
-        unitSize(),
-        (UnitCtorFunc)&Faust_Ctor,
-        (UnitDtorFunc)&Faust_Dtor,
-        kUnitDef_CantAliasInputsToOutputs
-        );
-
-#if defined(F2SC_DEBUG_MES)
-    Print("Faust: %s numControls=%d\n", name.c_str(), g_numControls);
-#endif // F2SC_DEBUG_MES
-}
-
-#ifdef SUPERNOVA 
-extern "C" FAUST_EXPORT int server_type(void) { return sc_server_supernova; }
-#else
-extern "C" FAUST_EXPORT int server_type(void) { return sc_server_scsynth; }
-#endif
-
-// EOF
-
-#endif
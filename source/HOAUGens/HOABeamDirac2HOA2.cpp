@@ -535,6 +535,9 @@ struct Control
     UpdateFunction updateFunction;
     FAUSTFLOAT* zone;
     FAUSTFLOAT min, max;
+    // Unit input of the control and its value at the last update
+    int input;
+    float lastValue;
 
     inline void update(FAUSTFLOAT value)
     {
@@ -1005,17 +1008,24 @@ class mydsp : public dsp {
 
 //----------------------------------------------------------------------------
 // SuperCollider/Faust interface
+// Input handling patched by patch_wrapper.py
 //----------------------------------------------------------------------------
 
 struct Faust : public Unit
 {
     // Faust dsp instance
     FAUSTCLASS*  mDSP;
-    // Buffers for control to audio rate conversion
+    // Input buffers passed to compute() when some audio inputs are not
+    // audio rate.  The mNumCopies control rate inputs listed in
+    // mCopyInputs are interpolated into copies, the others are used
+    // in place.
     float**     mInBufCopy;
     float*      mInBufValue;
-    // Controls
+    int*        mCopyInputs;
+    int         mNumCopies;
+    // Controls, the first mNumDynamicControls are not scalar rate
     size_t      mNumControls;
+    size_t      mNumDynamicControls;
     // NOTE: This needs to be the last field!
     //
     // The unit allocates additional memory according to the number
@@ -1125,15 +1135,42 @@ inline static void copyBuffer(float* dst, int n, float* src)
 }
 
 inline static void Faust_updateControls(Faust* unit)
+{
+    // Scalar rate controls are set in the constructor, the others are
+    // only updated when their input changed.
+    Control* controls = unit->mControls;
+    size_t numControls = unit->mNumDynamicControls;
+    for (size_t i = 0; i < numControls; ++i) {
+        Control* control = controls + i;
+        float value = IN0(control->input);
+        if (value != control->lastValue) {
+            control->lastValue = value;
+            control->update(value);
+        }
+    }
+}
+
+// Set every control from its input, and move the controls that are not
+// scalar rate to the front of mControls.
+static void Faust_initControls(Faust* unit)
 {
     Control* controls = unit->mControls;
     size_t numControls = unit->mNumControls;
+    size_t numDynamic = 0;
     int curControl = unit->mDSP->getNumInputs();
-    for (int i = 0; i < numControls; ++i) {
-        float value = IN0(curControl);
-        (controls++)->update(value);
-        curControl++;
+    for (size_t i = 0; i < numControls; ++i) {
+        Control* control = controls + i;
+        control->input = curControl + (int)i;
+        control->lastValue = IN0(control->input);
+        control->update(control->lastValue);
+        if (INRATE(control->input) != calc_ScalarRate) {
+            Control tmp = controls[numDynamic];
+            controls[numDynamic] = *control;
+            *control = tmp;
+            numDynamic++;
+        }
     }
+    unit->mNumDynamicControls = numDynamic;
 }
 
 void Faust_next(Faust* unit, int inNumSamples)
@@ -1148,18 +1185,13 @@ void Faust_next_copy(Faust* unit, int inNumSamples)
 {
     // update controls
     Faust_updateControls(unit);
-    // Copy buffers
-    for (int i = 0; i < unit->getNumAudioInputs(); ++i) {
-        float* b = unit->mInBufCopy[i];
-        if (INRATE(i) == calc_FullRate) {
-            // Audio rate: copy buffer
-            copyBuffer(b, inNumSamples, unit->mInBuf[i]);
-        } else {
-            // Control rate: linearly interpolate input
-            float v1 = IN0(i);
-            fillBuffer(b, inNumSamples, unit->mInBufValue[i], v1);
-            unit->mInBufValue[i] = v1;
-        }
+    // Control rate: linearly interpolate input, the audio rate buffers
+    // are used in place
+    for (int k = 0; k < unit->mNumCopies; ++k) {
+        int i = unit->mCopyInputs[k];
+        float v1 = IN0(i);
+        fillBuffer(unit->mInBufCopy[i], inNumSamples, unit->mInBufValue[k], v1);
+        unit->mInBufValue[k] = v1;
     }
     // dsp computation
     unit->mDSP->compute(inNumSamples, unit->mInBufCopy, unit->mOutBuf);
@@ -1172,6 +1204,12 @@ void Faust_next_clear(Faust* unit, int inNumSamples)
 
 void Faust_Ctor(Faust* unit)  // module constructor
 {
+    unit->mInBufCopy  = 0;
+    unit->mInBufValue = 0;
+    unit->mCopyInputs = 0;
+    unit->mNumCopies  = 0;
+    SETCALC(Faust_next_clear);
+
     // allocate dsp
     unit->mDSP = new(RTAlloc(unit->mWorld, sizeof(FAUSTCLASS))) FAUSTCLASS();
     if (!unit->mDSP) {
@@ -1181,14 +1219,12 @@ void Faust_Ctor(Faust* unit)  // module constructor
     {
         // init dsp
         unit->mDSP->instanceInit((int)SAMPLERATE);
-     
+
         // allocate controls
         unit->mNumControls = g_numControls;
         ControlAllocator ca(unit->mControls);
         unit->mDSP->buildUserInterface(&ca);
-        unit->mInBufCopy  = 0;
-        unit->mInBufValue = 0;
-     
+
         // check input/output channel configuration
         const size_t numInputs = unit->mDSP->getNumInputs() + unit->mNumControls;
         const size_t numOutputs = unit->mDSP->getNumOutputs();
@@ -1196,41 +1232,48 @@ void Faust_Ctor(Faust* unit)  // module constructor
         bool channelsValid = (numInputs == unit->mNumInputs) && (numOutputs == unit->mNumOutputs);
 
         if (channelsValid) {
-            bool rateValid = true;
-            for (int i = 0; i < unit->getNumAudioInputs(); ++i) {
+            Faust_initControls(unit);
+
+            const int numAudioInputs = unit->getNumAudioInputs();
+            int numCopies = 0;
+            for (int i = 0; i < numAudioInputs; ++i) {
                 if (INRATE(i) != calc_FullRate) {
-                    rateValid = false;
-                    break;
+                    numCopies++;
                 }
             }
-            if (rateValid) {
+            if (numCopies == 0) {
                 SETCALC(Faust_next);
             } else {
-                unit->mInBufCopy = (float**)RTAlloc(unit->mWorld, unit->getNumAudioInputs()*sizeof(float*));
-                if (!unit->mInBufCopy) {
+                // One block holds the buffer pointers of all audio inputs,
+                // then for each input that is not audio rate its
+                // interpolator state, buffer and index.
+                char* mem = (char*)RTAlloc(unit->mWorld,
+                                           numAudioInputs*sizeof(float*)
+                                           + numCopies*((BUFLENGTH + 1)*sizeof(float) + sizeof(int)));
+                if (!mem) {
                     Print("Faust[%s]: RT memory allocation failed, try increasing the real-time memory size in the server options\n", g_unitName);
                     goto end;
                 }
-                // Allocate memory for input buffer copies (numInputs * bufLength)
-                // and linear interpolation state (numInputs)
-                // = numInputs * (bufLength + 1)
-                unit->mInBufValue = (float*)RTAlloc(unit->mWorld, unit->getNumAudioInputs()*sizeof(float));
-                if (!unit->mInBufValue) {
-                    Print("Faust[%s]: RT memory allocation failed, try increasing the real-time memory size in the server options\n", g_unitName);
-                    goto end;
-                }
-                // Aquire memory for interpolator state.
-                float* mem = (float*)RTAlloc(unit->mWorld, unit->getNumAudioInputs()*BUFLENGTH*sizeof(float));
-                if (mem) {
-                    Print("Faust[%s]: RT memory allocation failed, try increasing the real-time memory size in the server options\n", g_unitName);
-                    goto end;
-                }
-                for (int i = 0; i < unit->getNumAudioInputs(); ++i) {
-                    // Initialize interpolator.
-                    unit->mInBufValue[i] = IN0(i);
-                    // Aquire buffer memory.
-                    unit->mInBufCopy[i] = mem;
-                    mem += BUFLENGTH;
+                unit->mInBufCopy  = (float**)mem;
+                unit->mInBufValue = (float*)(unit->mInBufCopy + numAudioInputs);
+                float* buffer     = unit->mInBufValue + numCopies;
+                unit->mCopyInputs = (int*)(buffer + numCopies*BUFLENGTH);
+                for (int i = 0; i < numAudioInputs; ++i) {
+                    if (INRATE(i) == calc_FullRate) {
+                        // Audio rate: use the buffer in place
+                        unit->mInBufCopy[i] = unit->mInBuf[i];
+                        continue;
+                    }
+                    unit->mInBufCopy[i] = buffer;
+                    if (INRATE(i) == calc_ScalarRate) {
+                        // Scalar rate: fill once
+                        fillBuffer(buffer, BUFLENGTH, IN0(i));
+                    } else {
+                        // Initialize interpolator.
+                        unit->mInBufValue[unit->mNumCopies] = IN0(i);
+                        unit->mCopyInputs[unit->mNumCopies++] = i;
+                    }
+                    buffer += BUFLENGTH;
                 }
                 SETCALC(Faust_next_copy);
             }
@@ -1238,9 +1281,13 @@ void Faust_Ctor(Faust* unit)  // module constructor
             Print("Faust[%s]:\n", g_unitName);
             Print("    Inputs:   %d\n"
                   "    Outputs:  %d\n"
-                  "    Callback: %s\n",
-                  numInputs, numOutputs,
-                  unit->mCalcFunc == (UnitCalcFunc)Faust_next ? "zero-copy" : "copy");
+                  "    Callback: %s\n"
+                  "    Interpolated inputs: %d of %d\n"
+                  "    Controls updated per block: %d of %d\n",
+                  (int)numInputs, (int)numOutputs,
+                  unit->mCalcFunc == (UnitCalcFunc)Faust_next ? "zero-copy" : "copy",
+                  unit->mNumCopies, numAudioInputs,
+                  (int)unit->mNumDynamicControls, (int)unit->mNumControls);
     #endif
         } else {
             Print("Faust[%s]:\n", g_unitName);
@@ -1250,10 +1297,9 @@ void Faust_Ctor(Faust* unit)  // module constructor
                   numInputs, unit->mNumInputs,
                   numOutputs, unit->mNumOutputs);
             Print("    Generating silence ...\n");
-            SETCALC(Faust_next_clear);
         }
     }
-    
+
 end:
     // Fix for https://github.com/grame-cncm/faust/issues/13
     ClearUnitOutputs(unit, 1);
@@ -1261,19 +1307,15 @@ end:
 
 void Faust_Dtor(Faust* unit)  // module destructor
 {
-    if (unit->mInBufValue) {
-        RTFree(unit->mWorld, unit->mInBufValue);
-    }
     if (unit->mInBufCopy) {
-        if (unit->mInBufCopy[0]) {
-            RTFree(unit->mWorld, unit->mInBufCopy[0]);
-        }
         RTFree(unit->mWorld, unit->mInBufCopy);
     }
-    
+
     // delete dsp
-    unit->mDSP->~FAUSTCLASS();
-    RTFree(unit->mWorld, unit->mDSP);
+    if (unit->mDSP) {
+        unit->mDSP->~FAUSTCLASS();
+        RTFree(unit->mWorld, unit->mDSP);
+    }
 }
 
 #ifdef SC_API_EXPORT
@@ -0,0 +1,437 @@
+/*
+    HOADecBinauralConv - binaural decoder with loadable HRIR sets
+
+    Decodes an ACN ambisonic signal of any order to two ears by uniformly
+    partitioned FFT convolution (overlap-save with a frequency-domain delay
+    line) with a spherical harmonic to ear filter matrix.
+
+    The filter matrix is read into a Buffer with the ear filters as channels:
+    the left ear filters for ACN channels 0..N-1, followed by the right ear
+    filters for ACN channels 0..N-1.  The /b_gen command PrepareHOABinaural
+    converts it into the partition spectra used by the UGen, on the NRT
+    thread:
+
+        /b_gen dest PrepareHOABinaural hrirBufnum partitionSize
+
+    where dest has been allocated with HOADecBinauralConv.calcBufSize.
+    The decoder output is delayed by partitionSize samples.
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "SC_PlugIn.h"
+#include "SC_fftlib.h"
+#include "HOAEngine.hpp"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+static InterfaceTable* ft;
+
+// inputs following the ambisonic channels
+enum {
+    kBufnum,
+    kPartitionSize,
+    kInputsGain,
+    kOutputsGain,
+    kNumControls
+};
+
+const int kMinPartitionSize = 64;
+const int kMaxPartitionSize = 16384;
+
+struct HOADecBinauralConv : public Unit
+{
+    int m_numChannels;
+    int m_partitionSize, m_fftSize, m_numPartitions;
+    float m_fbufnum;
+    SndBuf* m_buf;
+
+    float* m_inFrames;   // numChannels * fftSize, overlap-save input frames
+    float* m_spectra;    // numPartitions * numChannels * fftSize, frequency-domain delay line
+    float* m_outBlock;   // 2 * partitionSize, output of the last partition
+    float* m_fftBuf;     // fftSize
+    float* m_gains;      // 2 * bufLength, smoothed input and output gains
+    int m_fdlPos;
+    int m_pos;
+    scfft* m_fft;
+    scfft* m_ifft;
+
+    float m_inGain, m_outGain;
+};
+
+extern "C" {
+void HOADecBinauralConv_Ctor(HOADecBinauralConv* unit);
+void HOADecBinauralConv_Dtor(HOADecBinauralConv* unit);
+void HOADecBinauralConv_next(HOADecBinauralConv* unit, int inNumSamples);
+}
+
+static bool HOA_isPowerOfTwo(int n) { return n > 0 && (n & (n - 1)) == 0; }
+
+static bool HOA_isAmbisonicChannelCount(int numChannels)
+{
+    for (int order = 0; order <= hoa::kMaxOrder; ++order)
+        if ((order + 1) * (order + 1) == numChannels)
+            return true;
+    return false;
+}
+
+// acc += x * h, for spectra in scfft's packed layout (dc, nyquist, re 1, im 1, ...)
+static inline void HOA_complexMultiplyAdd(float* acc, const float* x, const float* h, int fftSize)
+{
+    acc[0] += x[0] * h[0];
+    acc[1] += x[1] * h[1];
+    for (int i = 2; i < fftSize; i += 2) {
+        float xr = x[i], xi = x[i + 1];
+        float hr = h[i], hi = h[i + 1];
+        acc[i] += xr * hr - xi * hi;
+        acc[i + 1] += xr * hi + xi * hr;
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// PrepareHOABinaural buffer generator (NRT thread)
+
+// the buffer generators run on the NRT thread, where RTAlloc must not be used
+class HOA_NRTAllocator : public SCFFT_Allocator
+{
+public:
+    void* alloc(size_t size) { return malloc(size); }
+    void free(void* ptr) { ::free(ptr); }
+};
+
+static void PrepareHOABinaural(World* world, SndBuf* buf, sc_msg_iter* msg)
+{
+    int hrirBufnum = msg->geti();
+    int partitionSize = msg->geti();
+
+    if (hrirBufnum < 0 || (uint32)hrirBufnum >= world->mNumSndBufs) {
+        Print("PrepareHOABinaural: invalid HRIR buffer %d\n", hrirBufnum);
+        return;
+    }
+    if (!HOA_isPowerOfTwo(partitionSize) || partitionSize < kMinPartitionSize || partitionSize > kMaxPartitionSize) {
+        Print("PrepareHOABinaural: partition size must be a power of two between %d and %d\n",
+              kMinPartitionSize, kMaxPartitionSize);
+        return;
+    }
+
+    SndBuf* hrir = World_GetNRTBuf(world, hrirBufnum);
+    int numFilters = hrir->channels;
+    int numChannels = numFilters / 2;
+    if (numFilters % 2 || !HOA_isAmbisonicChannelCount(numChannels)) {
+        Print("PrepareHOABinaural: HRIR buffer must have 2 * (order + 1)^2 channels, not %d\n", numFilters);
+        return;
+    }
+
+    int fftSize = 2 * partitionSize;
+    int numPartitions = (hrir->frames + partitionSize - 1) / partitionSize;
+    if (numPartitions == 0 || buf->samples != numPartitions * numFilters * fftSize) {
+        Print("PrepareHOABinaural: destination buffer must have %d samples, use HOADecBinauralConv.calcBufSize\n",
+              numPartitions * numFilters * fftSize);
+        return;
+    }
+
+    HOA_NRTAllocator alloc;
+    float* frame = (float*)malloc(fftSize * sizeof(float));
+    if (!frame) {
+        Print("PrepareHOABinaural: memory allocation failed\n");
+        return;
+    }
+    scfft* fft = scfft_create(fftSize, fftSize, kRectWindow, frame, frame, kForward, alloc);
+    scfft* ifft = scfft_create(fftSize, fftSize, kRectWindow, frame, frame, kBackward, alloc);
+    if (!fft || !ifft) {
+        Print("PrepareHOABinaural: memory allocation failed\n");
+        if (ifft)
+            scfft_destroy(ifft, alloc);
+        if (fft)
+            scfft_destroy(fft, alloc);
+        free(frame);
+        return;
+    }
+
+    // scfft's scaling of the inverse transform depends on the FFT backend, so
+    // the filters are normalised by the measured round trip gain of an impulse
+    memset(frame, 0, fftSize * sizeof(float));
+    frame[0] = 1.f;
+    scfft_dofft(fft);
+    scfft_doifft(ifft);
+    float scale = 1.f / frame[0];
+
+    // dest layout: [partition][ear][ACN channel][fftSize]
+    for (int p = 0; p < numPartitions; ++p) {
+        for (int filter = 0; filter < numFilters; ++filter) {
+            memset(frame, 0, fftSize * sizeof(float));
+            for (int i = 0; i < partitionSize; ++i) {
+                int frameIndex = p * partitionSize + i;
+                if (frameIndex >= hrir->frames)
+                    break;
+                frame[i] = scale * hrir->data[frameIndex * numFilters + filter];
+            }
+            scfft_dofft(fft);
+            memcpy(buf->data + (p * numFilters + filter) * fftSize, frame, fftSize * sizeof(float));
+        }
+    }
+
+    scfft_destroy(ifft, alloc);
+    scfft_destroy(fft, alloc);
+    free(frame);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// HOADecBinauralConv
+
+static SndBuf* HOADecBinauralConv_getBuf(HOADecBinauralConv* unit)
+{
+    float fbufnum = sc_max(0.f, IN0(unit->m_numChannels + kBufnum));
+    if (fbufnum != unit->m_fbufnum) {
+        uint32 bufnum = (uint32)fbufnum;
+        World* world = unit->mWorld;
+        if (bufnum >= world->mNumSndBufs) {
+            uint32 localBufNum = bufnum - world->mNumSndBufs;
+            Graph* parent = unit->mParent;
+            if (localBufNum < (uint32)parent->localBufNum)
+                unit->m_buf = parent->mLocalSndBufs + localBufNum;
+            else
+                unit->m_buf = world->mSndBufs;
+        } else {
+            unit->m_buf = world->mSndBufs + bufnum;
+        }
+        unit->m_fbufnum = fbufnum;
+    }
+    return unit->m_buf;
+}
+
+static void HOADecBinauralConv_next_clear(HOADecBinauralConv* unit, int inNumSamples)
+{
+    ClearUnitOutputs(unit, inNumSamples);
+}
+
+static void HOADecBinauralConv_free(HOADecBinauralConv* unit)
+{
+    World* world = unit->mWorld;
+    SCWorld_Allocator alloc(ft, world);
+    if (unit->m_fft)
+        scfft_destroy(unit->m_fft, alloc);
+    if (unit->m_ifft)
+        scfft_destroy(unit->m_ifft, alloc);
+    RTFree(world, unit->m_inFrames);
+    RTFree(world, unit->m_spectra);
+    RTFree(world, unit->m_outBlock);
+    RTFree(world, unit->m_fftBuf);
+    RTFree(world, unit->m_gains);
+    unit->m_inFrames = 0;
+    unit->m_spectra = 0;
+    unit->m_outBlock = 0;
+    unit->m_fftBuf = 0;
+    unit->m_gains = 0;
+    unit->m_fft = 0;
+    unit->m_ifft = 0;
+}
+
+void HOADecBinauralConv_Ctor(HOADecBinauralConv* unit)
+{
+    unit->m_inFrames = 0;
+    unit->m_spectra = 0;
+    unit->m_outBlock = 0;
+    unit->m_fftBuf = 0;
+    unit->m_gains = 0;
+    unit->m_fft = 0;
+    unit->m_ifft = 0;
+    unit->m_fbufnum = -1.f;
+
+    int numChannels = (int)unit->mNumInputs - kNumControls;
+    unit->m_numChannels = numChannels;
+    if (!HOA_isAmbisonicChannelCount(numChannels) || unit->mNumOutputs != 2) {
+        Print("HOADecBinauralConv: Input/Output channel mismatch, generating silence ...\n");
+        SETCALC(HOADecBinauralConv_next_clear);
+        HOADecBinauralConv_next_clear(unit, 1);
+        return;
+    }
+
+    int partitionSize = (int)IN0(numChannels + kPartitionSize);
+    if (!HOA_isPowerOfTwo(partitionSize) || partitionSize < kMinPartitionSize || partitionSize > kMaxPartitionSize) {
+        Print("HOADecBinauralConv: partition size must be a power of two between %d and %d, generating silence ...\n",
+              kMinPartitionSize, kMaxPartitionSize);
+        SETCALC(HOADecBinauralConv_next_clear);
+        HOADecBinauralConv_next_clear(unit, 1);
+        return;
+    }
+    int fftSize = 2 * partitionSize;
+
+    SndBuf* buf = HOADecBinauralConv_getBuf(unit);
+    int numPartitions = buf->data ? buf->samples / (2 * numChannels * fftSize) : 0;
+    if (numPartitions == 0 || buf->samples != numPartitions * 2 * numChannels * fftSize) {
+        Print("HOADecBinauralConv: buffer %d does not hold prepared HRIRs for %d channels and partition size %d, "
+              "generating silence ...\n", (int)unit->m_fbufnum, numChannels, partitionSize);
+        SETCALC(HOADecBinauralConv_next_clear);
+        HOADecBinauralConv_next_clear(unit, 1);
+        return;
+    }
+
+    unit->m_partitionSize = partitionSize;
+    unit->m_fftSize = fftSize;
+    unit->m_numPartitions = numPartitions;
+
+    World* world = unit->mWorld;
+    unit->m_inFrames = (float*)RTAlloc(world, numChannels * fftSize * sizeof(float));
+    unit->m_spectra = (float*)RTAlloc(world, numPartitions * numChannels * fftSize * sizeof(float));
+    unit->m_outBlock = (float*)RTAlloc(world, 2 * partitionSize * sizeof(float));
+    unit->m_fftBuf = (float*)RTAlloc(world, fftSize * sizeof(float));
+    unit->m_gains = (float*)RTAlloc(world, 2 * BUFLENGTH * sizeof(float));
+    if (!unit->m_inFrames || !unit->m_spectra || !unit->m_outBlock || !unit->m_fftBuf || !unit->m_gains) {
+        Print("HOADecBinauralConv: RT memory allocation failed, generating silence ...\n");
+        HOADecBinauralConv_free(unit);
+        SETCALC(HOADecBinauralConv_next_clear);
+        HOADecBinauralConv_next_clear(unit, 1);
+        return;
+    }
+    memset(unit->m_inFrames, 0, numChannels * fftSize * sizeof(float));
+    memset(unit->m_spectra, 0, numPartitions * numChannels * fftSize * sizeof(float));
+    memset(unit->m_outBlock, 0, 2 * partitionSize * sizeof(float));
+
+    SCWorld_Allocator alloc(ft, world);
+    unit->m_fft = scfft_create(fftSize, fftSize, kRectWindow, unit->m_fftBuf, unit->m_fftBuf, kForward, alloc);
+    unit->m_ifft = scfft_create(fftSize, fftSize, kRectWindow, unit->m_fftBuf, unit->m_fftBuf, kBackward, alloc);
+    if (!unit->m_fft || !unit->m_ifft) {
+        Print("HOADecBinauralConv: RT memory allocation failed, generating silence ...\n");
+        HOADecBinauralConv_free(unit);
+        SETCALC(HOADecBinauralConv_next_clear);
+        HOADecBinauralConv_next_clear(unit, 1);
+        return;
+    }
+
+    unit->m_fdlPos = 0;
+    unit->m_pos = 0;
+    // the gains fade in from 0 like the Faust generated decoders
+    unit->m_inGain = 0.f;
+    unit->m_outGain = 0.f;
+
+    // running the calc function here would consume a sample of the input
+    SETCALC(HOADecBinauralConv_next);
+    ClearUnitOutputs(unit, 1);
+}
+
+void HOADecBinauralConv_Dtor(HOADecBinauralConv* unit)
+{
+    HOADecBinauralConv_free(unit);
+}
+
+// Called once partitionSize new samples are in the second half of the input
+// frames: transform them into the delay line, multiply the delay line with
+// the filter spectra and transform back into the next output block.
+static void HOADecBinauralConv_partition(HOADecBinauralConv* unit)
+{
+    int numChannels = unit->m_numChannels;
+    int partitionSize = unit->m_partitionSize;
+    int fftSize = unit->m_fftSize;
+    int numPartitions = unit->m_numPartitions;
+    float* fftBuf = unit->m_fftBuf;
+    float* delayLine = unit->m_spectra + unit->m_fdlPos * numChannels * fftSize;
+
+    for (int k = 0; k < numChannels; ++k) {
+        float* frame = unit->m_inFrames + k * fftSize;
+        memcpy(fftBuf, frame, fftSize * sizeof(float));
+        scfft_dofft(unit->m_fft);
+        memcpy(delayLine + k * fftSize, fftBuf, fftSize * sizeof(float));
+        memcpy(frame, frame + partitionSize, partitionSize * sizeof(float));
+    }
+
+    SndBuf* buf = HOADecBinauralConv_getBuf(unit);
+    LOCK_SNDBUF_SHARED(buf);
+    if (!buf->data || buf->samples != numPartitions * 2 * numChannels * fftSize) {
+        memset(unit->m_outBlock, 0, 2 * partitionSize * sizeof(float));
+    } else {
+        for (int ear = 0; ear < 2; ++ear) {
+            memset(fftBuf, 0, fftSize * sizeof(float));
+            for (int p = 0; p < numPartitions; ++p) {
+                int slot = unit->m_fdlPos - p;
+                if (slot < 0)
+                    slot += numPartitions;
+                const float* x = unit->m_spectra + slot * numChannels * fftSize;
+                const float* h = buf->data + (p * 2 + ear) * numChannels * fftSize;
+                for (int k = 0; k < numChannels; ++k)
+                    HOA_complexMultiplyAdd(fftBuf, x + k * fftSize, h + k * fftSize, fftSize);
+            }
+            scfft_doifft(unit->m_ifft);
+            // overlap-save: the first half is circular aliasing
+            memcpy(unit->m_outBlock + ear * partitionSize, fftBuf + partitionSize, partitionSize * sizeof(float));
+        }
+    }
+
+    if (++unit->m_fdlPos == numPartitions)
+        unit->m_fdlPos = 0;
+}
+
+void HOADecBinauralConv_next(HOADecBinauralConv* unit, int inNumSamples)
+{
+    int numChannels = unit->m_numChannels;
+    int partitionSize = unit->m_partitionSize;
+    int fftSize = unit->m_fftSize;
+    float* outL = OUT(0);
+    float* outR = OUT(1);
+
+    // dB gains with the one-pole smoothing of the Faust decoders
+    float inTarget = 0.001f * powf(10.f, 0.05f * IN0(numChannels + kInputsGain));
+    float outTarget = 0.001f * powf(10.f, 0.05f * IN0(numChannels + kOutputsGain));
+
+    int done = 0;
+    while (done < inNumSamples) {
+        int pos = unit->m_pos;
+        int count = sc_min(inNumSamples - done, partitionSize - pos);
+
+        float* inGains = unit->m_gains;
+        float* outGains = unit->m_gains + count;
+        float inGain = unit->m_inGain;
+        float outGain = unit->m_outGain;
+        for (int i = 0; i < count; ++i) {
+            inGain = inTarget + 0.999f * inGain;
+            outGain = outTarget + 0.999f * outGain;
+            inGains[i] = inGain;
+            outGains[i] = outGain;
+        }
+        unit->m_inGain = inGain;
+        unit->m_outGain = outGain;
+
+        for (int k = 0; k < numChannels; ++k) {
+            const float* in = IN(k) + done;
+            float* frame = unit->m_inFrames + k * fftSize + partitionSize + pos;
+            for (int i = 0; i < count; ++i)
+                frame[i] = inGains[i] * in[i];
+        }
+
+        const float* blockL = unit->m_outBlock + pos;
+        const float* blockR = unit->m_outBlock + partitionSize + pos;
+        for (int i = 0; i < count; ++i) {
+            outL[done + i] = outGains[i] * blockL[i];
+            outR[done + i] = outGains[i] * blockR[i];
+        }
+
+        done += count;
+        unit->m_pos = pos + count;
+        if (unit->m_pos == partitionSize) {
+            unit->m_pos = 0;
+            HOADecBinauralConv_partition(unit);
+        }
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+PluginLoad(HOADecBinauralConv)
+{
+    ft = inTable;
+    DefineDtorCantAliasUnit(HOADecBinauralConv);
+    DefineBufGen("PrepareHOABinaural", PrepareHOABinaural);
+}
@@ -5,6 +5,7 @@ license: "GPL"
 name: "HOAEncEigenMike4"
 version: "1.0"
 Code generated with Faust 2.5.21 (https://faust.grame.fr)
+VU meters stripped by strip_meters.py
 Compilation options: cpp, -double -ftz 0
 ------------------------------------------------------------ */
 
@@ -535,6 +536,9 @@ struct Control
     UpdateFunction updateFunction;
     FAUSTFLOAT* zone;
     FAUSTFLOAT min, max;
+    // Unit input of the control and its value at the last update
+    int input;
+    float lastValue;
 
     inline void update(FAUSTFLOAT value)
     {
@@ -633,75 +637,8 @@ class mydsp : public dsp {
  private:
 	
 	int fSamplingFreq;
-	double fConst0;
 	FAUSTFLOAT fHslider0;
 	double fRec1[2];
-	double fRec2[2];
-	FAUSTFLOAT fVbargraph0;
-	double fRec3[2];
-	FAUSTFLOAT fVbargraph1;
-	double fRec4[2];
-	FAUSTFLOAT fVbargraph2;
-	double fRec5[2];
-	FAUSTFLOAT fVbargraph3;
-	double fRec6[2];
-	FAUSTFLOAT fVbargraph4;
-	double fRec7[2];
-	FAUSTFLOAT fVbargraph5;
-	double fRec8[2];
-	FAUSTFLOAT fVbargraph6;
-	double fRec9[2];
-	FAUSTFLOAT fVbargraph7;
-	double fRec10[2];
-	FAUSTFLOAT fVbargraph8;
-	double fRec11[2];
-	FAUSTFLOAT fVbargraph9;
-	double fRec12[2];
-	FAUSTFLOAT fVbargraph10;
-	double fRec13[2];
-	FAUSTFLOAT fVbargraph11;
-	double fRec14[2];
-	FAUSTFLOAT fVbargraph12;
-	double fRec15[2];
-	FAUSTFLOAT fVbargraph13;
-	double fRec16[2];
-	FAUSTFLOAT fVbargraph14;
-	double fRec17[2];
-	FAUSTFLOAT fVbargraph15;
-	double fRec18[2];
-	FAUSTFLOAT fVbargraph16;
-	double fRec19[2];
-	FAUSTFLOAT fVbargraph17;
-	double fRec20[2];
-	FAUSTFLOAT fVbargraph18;
-	double fRec21[2];
-	FAUSTFLOAT fVbargraph19;
-	double fRec22[2];
-	FAUSTFLOAT fVbargraph20;
-	double fRec23[2];
-	FAUSTFLOAT fVbargraph21;
-	double fRec24[2];
-	FAUSTFLOAT fVbargraph22;
-	double fRec25[2];
-	FAUSTFLOAT fVbargraph23;
-	double fRec26[2];
-	FAUSTFLOAT fVbargraph24;
-	double fRec27[2];
-	FAUSTFLOAT fVbargraph25;
-	double fRec28[2];
-	FAUSTFLOAT fVbargraph26;
-	double fRec29[2];
-	FAUSTFLOAT fVbargraph27;
-	double fRec30[2];
-	FAUSTFLOAT fVbargraph28;
-	double fRec31[2];
-	FAUSTFLOAT fVbargraph29;
-	double fRec32[2];
-	FAUSTFLOAT fVbargraph30;
-	double fRec33[2];
-	FAUSTFLOAT fVbargraph31;
-	double fRec0[2];
-	FAUSTFLOAT fVbargraph32;
 	double fConst1;
 	double fConst2;
 	double fConst3;
@@ -714,10 +651,6 @@ class mydsp : public dsp {
 	double fConst10;
 	double fConst11;
 	double fConst12;
-	double fRec34[2];
-	FAUSTFLOAT fVbargraph33;
-	double fRec35[2];
-	FAUSTFLOAT fVbargraph34;
 	double fConst13;
 	double fConst14;
 	double fConst15;
@@ -726,8 +659,6 @@ class mydsp : public dsp {
 	double fConst18;
 	double fConst19;
 	double fConst20;
-	double fRec36[2];
-	FAUSTFLOAT fVbargraph35;
 	double fConst21;
 	double fConst22;
 	double fConst23;
@@ -736,8 +667,6 @@ class mydsp : public dsp {
 	double fConst26;
 	double fConst27;
 	double fConst28;
-	double fRec37[2];
-	FAUSTFLOAT fVbargraph36;
 	double fConst29;
 	double fConst30;
 	double fConst31;
@@ -762,10 +691,6 @@ class mydsp : public dsp {
 	double fConst50;
 	double fConst51;
 	double fConst52;
-	double fRec38[2];
-	FAUSTFLOAT fVbargraph37;
-	double fRec39[2];
-	FAUSTFLOAT fVbargraph38;
 	double fConst53;
 	double fConst54;
 	double fConst55;
@@ -784,8 +709,6 @@ class mydsp : public dsp {
 	double fConst68;
 	double fConst69;
 	double fConst70;
-	double fRec40[2];
-	FAUSTFLOAT fVbargraph39;
 	double fConst71;
 	double fConst72;
 	double fConst73;
@@ -795,8 +718,6 @@ class mydsp : public dsp {
 	double fConst77;
 	double fConst78;
 	double fConst79;
-	double fRec41[2];
-	FAUSTFLOAT fVbargraph40;
 	double fConst80;
 	double fConst81;
 	double fConst82;
@@ -808,8 +729,6 @@ class mydsp : public dsp {
 	double fConst88;
 	double fConst89;
 	double fConst90;
-	double fRec42[2];
-	FAUSTFLOAT fVbargraph41;
 	double fConst91;
 	double fConst92;
 	double fConst93;
@@ -821,8 +740,6 @@ class mydsp : public dsp {
 	double fConst99;
 	double fConst100;
 	double fConst101;
-	double fRec43[2];
-	FAUSTFLOAT fVbargraph42;
 	double fConst102;
 	double fConst103;
 	double fConst104;
@@ -855,10 +772,6 @@ class mydsp : public dsp {
 	double fConst131;
 	double fConst132;
 	double fConst133;
-	double fRec44[2];
-	FAUSTFLOAT fVbargraph43;
-	double fRec45[2];
-	FAUSTFLOAT fVbargraph44;
 	double fConst134;
 	double fConst135;
 	double fConst136;
@@ -886,8 +799,6 @@ class mydsp : public dsp {
 	double fConst158;
 	double fConst159;
 	double fConst160;
-	double fRec46[2];
-	FAUSTFLOAT fVbargraph45;
 	double fConst161;
 	double fConst162;
 	double fConst163;
@@ -908,8 +819,6 @@ class mydsp : public dsp {
 	double fConst178;
 	double fConst179;
 	double fConst180;
-	double fRec47[2];
-	FAUSTFLOAT fVbargraph46;
 	double fConst181;
 	double fConst182;
 	double fConst183;
@@ -918,8 +827,6 @@ class mydsp : public dsp {
 	double fConst186;
 	double fConst187;
 	double fConst188;
-	double fRec48[2];
-	FAUSTFLOAT fVbargraph47;
 	double fConst189;
 	double fConst190;
 	double fConst191;
@@ -928,8 +835,6 @@ class mydsp : public dsp {
 	double fConst194;
 	double fConst195;
 	double fConst196;
-	double fRec49[2];
-	FAUSTFLOAT fVbargraph48;
 	double fConst197;
 	double fConst198;
 	double fConst199;
@@ -952,8 +857,6 @@ class mydsp : public dsp {
 	double fConst216;
 	double fConst217;
 	double fConst218;
-	double fRec50[2];
-	FAUSTFLOAT fVbargraph49;
 	double fConst219;
 	double fConst220;
 	double fConst221;
@@ -974,8 +877,6 @@ class mydsp : public dsp {
 	double fConst236;
 	double fConst237;
 	double fConst238;
-	double fRec51[2];
-	FAUSTFLOAT fVbargraph50;
 	double fConst239;
 	double fConst240;
 	double fConst241;
@@ -999,10 +900,6 @@ class mydsp : public dsp {
 	double fConst259;
 	double fConst260;
 	double fConst261;
-	double fRec52[2];
-	FAUSTFLOAT fVbargraph51;
-	double fRec53[2];
-	FAUSTFLOAT fVbargraph52;
 	double fConst262;
 	double fConst263;
 	double fConst264;
@@ -1020,8 +917,6 @@ class mydsp : public dsp {
 	double fConst276;
 	double fConst277;
 	double fConst278;
-	double fRec54[2];
-	FAUSTFLOAT fVbargraph53;
 	double fConst279;
 	double fConst280;
 	double fConst281;
@@ -1046,8 +941,6 @@ class mydsp : public dsp {
 	double fConst300;
 	double fConst301;
 	double fConst302;
-	double fRec55[2];
-	FAUSTFLOAT fVbargraph54;
 	double fConst303;
 	double fConst304;
 	double fConst305;
@@ -1066,16 +959,12 @@ class mydsp : public dsp {
 	double fConst318;
 	double fConst319;
 	double fConst320;
-	double fRec56[2];
-	FAUSTFLOAT fVbargraph55;
 	double fConst321;
 	double fConst322;
 	double fConst323;
 	double fConst324;
 	double fConst325;
 	double fConst326;
-	double fRec57[2];
-	FAUSTFLOAT fVbargraph56;
 	
  public:
 	
@@ -1378,7 +1267,6 @@ class mydsp : public dsp {
 	
 	virtual void instanceConstants(int samplingFreq) {
 		fSamplingFreq = samplingFreq;
-		fConst0 = (80.0 / min(192000.0, max(1.0, double(fSamplingFreq))));
 		fConst1 = double(tgamma(1.0));
 		fConst2 = double(tgamma(3.0));
 		fConst3 = double(tgamma(1.5));
@@ -1718,234 +1606,6 @@ class mydsp : public dsp {
 			fRec1[l0] = 0.0;
 			
 		}
-		for (int l1 = 0; (l1 < 2); l1 = (l1 + 1)) {
-			fRec2[l1] = 0.0;
-			
-		}
-		for (int l2 = 0; (l2 < 2); l2 = (l2 + 1)) {
-			fRec3[l2] = 0.0;
-			
-		}
-		for (int l3 = 0; (l3 < 2); l3 = (l3 + 1)) {
-			fRec4[l3] = 0.0;
-			
-		}
-		for (int l4 = 0; (l4 < 2); l4 = (l4 + 1)) {
-			fRec5[l4] = 0.0;
-			
-		}
-		for (int l5 = 0; (l5 < 2); l5 = (l5 + 1)) {
-			fRec6[l5] = 0.0;
-			
-		}
-		for (int l6 = 0; (l6 < 2); l6 = (l6 + 1)) {
-			fRec7[l6] = 0.0;
-			
-		}
-		for (int l7 = 0; (l7 < 2); l7 = (l7 + 1)) {
-			fRec8[l7] = 0.0;
-			
-		}
-		for (int l8 = 0; (l8 < 2); l8 = (l8 + 1)) {
-			fRec9[l8] = 0.0;
-			
-		}
-		for (int l9 = 0; (l9 < 2); l9 = (l9 + 1)) {
-			fRec10[l9] = 0.0;
-			
-		}
-		for (int l10 = 0; (l10 < 2); l10 = (l10 + 1)) {
-			fRec11[l10] = 0.0;
-			
-		}
-		for (int l11 = 0; (l11 < 2); l11 = (l11 + 1)) {
-			fRec12[l11] = 0.0;
-			
-		}
-		for (int l12 = 0; (l12 < 2); l12 = (l12 + 1)) {
-			fRec13[l12] = 0.0;
-			
-		}
-		for (int l13 = 0; (l13 < 2); l13 = (l13 + 1)) {
-			fRec14[l13] = 0.0;
-			
-		}
-		for (int l14 = 0; (l14 < 2); l14 = (l14 + 1)) {
-			fRec15[l14] = 0.0;
-			
-		}
-		for (int l15 = 0; (l15 < 2); l15 = (l15 + 1)) {
-			fRec16[l15] = 0.0;
-			
-		}
-		for (int l16 = 0; (l16 < 2); l16 = (l16 + 1)) {
-			fRec17[l16] = 0.0;
-			
-		}
-		for (int l17 = 0; (l17 < 2); l17 = (l17 + 1)) {
-			fRec18[l17] = 0.0;
-			
-		}
-		for (int l18 = 0; (l18 < 2); l18 = (l18 + 1)) {
-			fRec19[l18] = 0.0;
-			
-		}
-		for (int l19 = 0; (l19 < 2); l19 = (l19 + 1)) {
-			fRec20[l19] = 0.0;
-			
-		}
-		for (int l20 = 0; (l20 < 2); l20 = (l20 + 1)) {
-			fRec21[l20] = 0.0;
-			
-		}
-		for (int l21 = 0; (l21 < 2); l21 = (l21 + 1)) {
-			fRec22[l21] = 0.0;
-			
-		}
-		for (int l22 = 0; (l22 < 2); l22 = (l22 + 1)) {
-			fRec23[l22] = 0.0;
-			
-		}
-		for (int l23 = 0; (l23 < 2); l23 = (l23 + 1)) {
-			fRec24[l23] = 0.0;
-			
-		}
-		for (int l24 = 0; (l24 < 2); l24 = (l24 + 1)) {
-			fRec25[l24] = 0.0;
-			
-		}
-		for (int l25 = 0; (l25 < 2); l25 = (l25 + 1)) {
-			fRec26[l25] = 0.0;
-			
-		}
-		for (int l26 = 0; (l26 < 2); l26 = (l26 + 1)) {
-			fRec27[l26] = 0.0;
-			
-		}
-		for (int l27 = 0; (l27 < 2); l27 = (l27 + 1)) {
-			fRec28[l27] = 0.0;
-			
-		}
-		for (int l28 = 0; (l28 < 2); l28 = (l28 + 1)) {
-			fRec29[l28] = 0.0;
-			
-		}
-		for (int l29 = 0; (l29 < 2); l29 = (l29 + 1)) {
-			fRec30[l29] = 0.0;
-			
-		}
-		for (int l30 = 0; (l30 < 2); l30 = (l30 + 1)) {
-			fRec31[l30] = 0.0;
-			
-		}
-		for (int l31 = 0; (l31 < 2); l31 = (l31 + 1)) {
-			fRec32[l31] = 0.0;
-			
-		}
-		for (int l32 = 0; (l32 < 2); l32 = (l32 + 1)) {
-			fRec33[l32] = 0.0;
-			
-		}
-		for (int l33 = 0; (l33 < 2); l33 = (l33 + 1)) {
-			fRec0[l33] = 0.0;
-			
-		}
-		for (int l34 = 0; (l34 < 2); l34 = (l34 + 1)) {
-			fRec34[l34] = 0.0;
-			
-		}
-		for (int l35 = 0; (l35 < 2); l35 = (l35 + 1)) {
-			fRec35[l35] = 0.0;
-			
-		}
-		for (int l36 = 0; (l36 < 2); l36 = (l36 + 1)) {
-			fRec36[l36] = 0.0;
-			
-		}
-		for (int l37 = 0; (l37 < 2); l37 = (l37 + 1)) {
-			fRec37[l37] = 0.0;
-			
-		}
-		for (int l38 = 0; (l38 < 2); l38 = (l38 + 1)) {
-			fRec38[l38] = 0.0;
-			
-		}
-		for (int l39 = 0; (l39 < 2); l39 = (l39 + 1)) {
-			fRec39[l39] = 0.0;
-			
-		}
-		for (int l40 = 0; (l40 < 2); l40 = (l40 + 1)) {
-			fRec40[l40] = 0.0;
-			
-		}
-		for (int l41 = 0; (l41 < 2); l41 = (l41 + 1)) {
-			fRec41[l41] = 0.0;
-			
-		}
-		for (int l42 = 0; (l42 < 2); l42 = (l42 + 1)) {
-			fRec42[l42] = 0.0;
-			
-		}
-		for (int l43 = 0; (l43 < 2); l43 = (l43 + 1)) {
-			fRec43[l43] = 0.0;
-			
-		}
-		for (int l44 = 0; (l44 < 2); l44 = (l44 + 1)) {
-			fRec44[l44] = 0.0;
-			
-		}
-		for (int l45 = 0; (l45 < 2); l45 = (l45 + 1)) {
-			fRec45[l45] = 0.0;
-			
-		}
-		for (int l46 = 0; (l46 < 2); l46 = (l46 + 1)) {
-			fRec46[l46] = 0.0;
-			
-		}
-		for (int l47 = 0; (l47 < 2); l47 = (l47 + 1)) {
-			fRec47[l47] = 0.0;
-			
-		}
-		for (int l48 = 0; (l48 < 2); l48 = (l48 + 1)) {
-			fRec48[l48] = 0.0;
-			
-		}
-		for (int l49 = 0; (l49 < 2); l49 = (l49 + 1)) {
-			fRec49[l49] = 0.0;
-			
-		}
-		for (int l50 = 0; (l50 < 2); l50 = (l50 + 1)) {
-			fRec50[l50] = 0.0;
-			
-		}
-		for (int l51 = 0; (l51 < 2); l51 = (l51 + 1)) {
-			fRec51[l51] = 0.0;
-			
-		}
-		for (int l52 = 0; (l52 < 2); l52 = (l52 + 1)) {
-			fRec52[l52] = 0.0;
-			
-		}
-		for (int l53 = 0; (l53 < 2); l53 = (l53 + 1)) {
-			fRec53[l53] = 0.0;
-			
-		}
-		for (int l54 = 0; (l54 < 2); l54 = (l54 + 1)) {
-			fRec54[l54] = 0.0;
-			
-		}
-		for (int l55 = 0; (l55 < 2); l55 = (l55 + 1)) {
-			fRec55[l55] = 0.0;
-			
-		}
-		for (int l56 = 0; (l56 < 2); l56 = (l56 + 1)) {
-			fRec56[l56] = 0.0;
-			
-		}
-		for (int l57 = 0; (l57 < 2); l57 = (l57 + 1)) {
-			fRec57[l57] = 0.0;
-			
-		}
 		
 	}
 	
@@ -1972,244 +1632,130 @@ class mydsp : public dsp {
 		ui_interface->declare(0, "0", "");
 		ui_interface->openHorizontalBox("Inputs");
 		ui_interface->openVerticalBox("1");
-		ui_interface->declare(&fVbargraph30, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x31a29c0", &fVbargraph30, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("2");
-		ui_interface->declare(&fVbargraph31, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x31a7510", &fVbargraph31, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("3");
-		ui_interface->declare(&fVbargraph29, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x319de70", &fVbargraph29, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("4");
-		ui_interface->declare(&fVbargraph28, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x3199320", &fVbargraph28, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("5");
-		ui_interface->declare(&fVbargraph27, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x31947d0", &fVbargraph27, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("6");
-		ui_interface->declare(&fVbargraph26, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x318fc80", &fVbargraph26, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("7");
-		ui_interface->declare(&fVbargraph25, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x318b130", &fVbargraph25, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("8");
-		ui_interface->declare(&fVbargraph24, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x31865e0", &fVbargraph24, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("9");
-		ui_interface->declare(&fVbargraph23, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x3181a90", &fVbargraph23, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("10");
-		ui_interface->declare(&fVbargraph22, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x317cf40", &fVbargraph22, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("11");
-		ui_interface->declare(&fVbargraph21, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x31783f0", &fVbargraph21, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("12");
-		ui_interface->declare(&fVbargraph20, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x31738a0", &fVbargraph20, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("13");
-		ui_interface->declare(&fVbargraph19, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x316ed50", &fVbargraph19, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("14");
-		ui_interface->declare(&fVbargraph18, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x316a200", &fVbargraph18, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("15");
-		ui_interface->declare(&fVbargraph17, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x31656b0", &fVbargraph17, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("16");
-		ui_interface->declare(&fVbargraph16, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x3160b60", &fVbargraph16, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("17");
-		ui_interface->declare(&fVbargraph15, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x315c010", &fVbargraph15, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("18");
-		ui_interface->declare(&fVbargraph14, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x31574c0", &fVbargraph14, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("19");
-		ui_interface->declare(&fVbargraph13, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x3152970", &fVbargraph13, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("20");
-		ui_interface->declare(&fVbargraph12, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x314de20", &fVbargraph12, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("21");
-		ui_interface->declare(&fVbargraph11, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x31492d0", &fVbargraph11, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("22");
-		ui_interface->declare(&fVbargraph10, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x3144780", &fVbargraph10, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("23");
-		ui_interface->declare(&fVbargraph9, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x313fc30", &fVbargraph9, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("24");
-		ui_interface->declare(&fVbargraph8, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x313b0e0", &fVbargraph8, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("25");
-		ui_interface->declare(&fVbargraph7, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x3136590", &fVbargraph7, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("26");
-		ui_interface->declare(&fVbargraph6, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x3131a40", &fVbargraph6, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("27");
-		ui_interface->declare(&fVbargraph5, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x312cef0", &fVbargraph5, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("28");
-		ui_interface->declare(&fVbargraph4, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x31283a0", &fVbargraph4, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("29");
-		ui_interface->declare(&fVbargraph3, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x3123850", &fVbargraph3, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("30");
-		ui_interface->declare(&fVbargraph2, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x311ed00", &fVbargraph2, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("31");
-		ui_interface->declare(&fVbargraph1, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x311a1b0", &fVbargraph1, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("32");
-		ui_interface->declare(&fVbargraph0, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x3115570", &fVbargraph0, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->closeBox();
 		ui_interface->declare(0, "1", "");
 		ui_interface->openHorizontalBox("Outputs");
 		ui_interface->openHorizontalBox("0");
 		ui_interface->openVerticalBox("0");
-		ui_interface->declare(&fVbargraph32, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x31af220", &fVbargraph32, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->closeBox();
 		ui_interface->openHorizontalBox("1");
 		ui_interface->openVerticalBox("1");
-		ui_interface->declare(&fVbargraph33, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x31c1ee0", &fVbargraph33, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("2");
-		ui_interface->declare(&fVbargraph34, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x31cb700", &fVbargraph34, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("3");
-		ui_interface->declare(&fVbargraph35, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x31db580", &fVbargraph35, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->closeBox();
 		ui_interface->openHorizontalBox("2");
 		ui_interface->openVerticalBox("4");
-		ui_interface->declare(&fVbargraph36, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x31e9ce0", &fVbargraph36, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("5");
-		ui_interface->declare(&fVbargraph37, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x31fece0", &fVbargraph37, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("6");
-		ui_interface->declare(&fVbargraph38, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x3209cb0", &fVbargraph38, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("7");
-		ui_interface->declare(&fVbargraph39, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x321b7f0", &fVbargraph39, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("8");
-		ui_interface->declare(&fVbargraph40, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x322e1d0", &fVbargraph40, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->closeBox();
 		ui_interface->openHorizontalBox("3");
 		ui_interface->openVerticalBox("9");
-		ui_interface->declare(&fVbargraph41, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x3240850", &fVbargraph41, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("10");
-		ui_interface->declare(&fVbargraph42, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x324c970", &fVbargraph42, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("11");
-		ui_interface->declare(&fVbargraph43, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x3268170", &fVbargraph43, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("12");
-		ui_interface->declare(&fVbargraph44, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x326ee40", &fVbargraph44, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("13");
-		ui_interface->declare(&fVbargraph45, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x3287a10", &fVbargraph45, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("14");
-		ui_interface->declare(&fVbargraph46, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x329cc50", &fVbargraph46, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("15");
-		ui_interface->declare(&fVbargraph47, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x32acff0", &fVbargraph47, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->closeBox();
 		ui_interface->openHorizontalBox("4");
 		ui_interface->openVerticalBox("16");
-		ui_interface->declare(&fVbargraph48, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x32bc6a0", &fVbargraph48, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("17");
-		ui_interface->declare(&fVbargraph49, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x32d07d0", &fVbargraph49, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("18");
-		ui_interface->declare(&fVbargraph50, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x32e3190", &fVbargraph50, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("19");
-		ui_interface->declare(&fVbargraph51, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x32f8290", &fVbargraph51, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("20");
-		ui_interface->declare(&fVbargraph52, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x32ff6b0", &fVbargraph52, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("21");
-		ui_interface->declare(&fVbargraph53, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x3311740", &fVbargraph53, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("22");
-		ui_interface->declare(&fVbargraph54, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x332d620", &fVbargraph54, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("23");
-		ui_interface->declare(&fVbargraph55, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x333f6a0", &fVbargraph55, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("24");
-		ui_interface->declare(&fVbargraph56, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x3350900", &fVbargraph56, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->closeBox();
 		ui_interface->declare(&fHslider0, "1", "");
@@ -2283,108 +1829,40 @@ class mydsp : public dsp {
 		for (int i = 0; (i < count); i = (i + 1)) {
 			fRec1[0] = (fSlow0 + (0.999 * fRec1[1]));
 			double fTemp0 = double(input31[i]);
-			fRec2[0] = max((fRec2[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp0))))));
-			fVbargraph0 = FAUSTFLOAT(fRec2[0]);
 			double fTemp1 = double(input30[i]);
-			fRec3[0] = max((fRec3[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp1))))));
-			fVbargraph1 = FAUSTFLOAT(fRec3[0]);
 			double fTemp2 = double(input29[i]);
-			fRec4[0] = max((fRec4[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp2))))));
-			fVbargraph2 = FAUSTFLOAT(fRec4[0]);
 			double fTemp3 = double(input28[i]);
-			fRec5[0] = max((fRec5[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp3))))));
-			fVbargraph3 = FAUSTFLOAT(fRec5[0]);
 			double fTemp4 = double(input27[i]);
-			fRec6[0] = max((fRec6[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp4))))));
-			fVbargraph4 = FAUSTFLOAT(fRec6[0]);
 			double fTemp5 = double(input26[i]);
-			fRec7[0] = max((fRec7[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp5))))));
-			fVbargraph5 = FAUSTFLOAT(fRec7[0]);
 			double fTemp6 = double(input25[i]);
-			fRec8[0] = max((fRec8[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp6))))));
-			fVbargraph6 = FAUSTFLOAT(fRec8[0]);
 			double fTemp7 = double(input24[i]);
-			fRec9[0] = max((fRec9[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp7))))));
-			fVbargraph7 = FAUSTFLOAT(fRec9[0]);
 			double fTemp8 = double(input23[i]);
-			fRec10[0] = max((fRec10[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp8))))));
-			fVbargraph8 = FAUSTFLOAT(fRec10[0]);
 			double fTemp9 = double(input22[i]);
-			fRec11[0] = max((fRec11[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp9))))));
-			fVbargraph9 = FAUSTFLOAT(fRec11[0]);
 			double fTemp10 = double(input21[i]);
-			fRec12[0] = max((fRec12[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp10))))));
-			fVbargraph10 = FAUSTFLOAT(fRec12[0]);
 			double fTemp11 = double(input20[i]);
-			fRec13[0] = max((fRec13[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp11))))));
-			fVbargraph11 = FAUSTFLOAT(fRec13[0]);
 			double fTemp12 = double(input19[i]);
-			fRec14[0] = max((fRec14[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp12))))));
-			fVbargraph12 = FAUSTFLOAT(fRec14[0]);
 			double fTemp13 = double(input18[i]);
-			fRec15[0] = max((fRec15[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp13))))));
-			fVbargraph13 = FAUSTFLOAT(fRec15[0]);
 			double fTemp14 = double(input17[i]);
-			fRec16[0] = max((fRec16[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp14))))));
-			fVbargraph14 = FAUSTFLOAT(fRec16[0]);
 			double fTemp15 = double(input16[i]);
-			fRec17[0] = max((fRec17[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp15))))));
-			fVbargraph15 = FAUSTFLOAT(fRec17[0]);
 			double fTemp16 = double(input15[i]);
-			fRec18[0] = max((fRec18[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp16))))));
-			fVbargraph16 = FAUSTFLOAT(fRec18[0]);
 			double fTemp17 = double(input14[i]);
-			fRec19[0] = max((fRec19[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp17))))));
-			fVbargraph17 = FAUSTFLOAT(fRec19[0]);
 			double fTemp18 = double(input13[i]);
-			fRec20[0] = max((fRec20[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp18))))));
-			fVbargraph18 = FAUSTFLOAT(fRec20[0]);
 			double fTemp19 = double(input12[i]);
-			fRec21[0] = max((fRec21[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp19))))));
-			fVbargraph19 = FAUSTFLOAT(fRec21[0]);
 			double fTemp20 = double(input11[i]);
-			fRec22[0] = max((fRec22[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp20))))));
-			fVbargraph20 = FAUSTFLOAT(fRec22[0]);
 			double fTemp21 = double(input10[i]);
-			fRec23[0] = max((fRec23[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp21))))));
-			fVbargraph21 = FAUSTFLOAT(fRec23[0]);
 			double fTemp22 = double(input9[i]);
-			fRec24[0] = max((fRec24[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp22))))));
-			fVbargraph22 = FAUSTFLOAT(fRec24[0]);
 			double fTemp23 = double(input8[i]);
-			fRec25[0] = max((fRec25[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp23))))));
-			fVbargraph23 = FAUSTFLOAT(fRec25[0]);
 			double fTemp24 = double(input7[i]);
-			fRec26[0] = max((fRec26[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp24))))));
-			fVbargraph24 = FAUSTFLOAT(fRec26[0]);
 			double fTemp25 = double(input6[i]);
-			fRec27[0] = max((fRec27[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp25))))));
-			fVbargraph25 = FAUSTFLOAT(fRec27[0]);
 			double fTemp26 = double(input5[i]);
-			fRec28[0] = max((fRec28[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp26))))));
-			fVbargraph26 = FAUSTFLOAT(fRec28[0]);
 			double fTemp27 = double(input4[i]);
-			fRec29[0] = max((fRec29[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp27))))));
-			fVbargraph27 = FAUSTFLOAT(fRec29[0]);
 			double fTemp28 = double(input3[i]);
-			fRec30[0] = max((fRec30[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp28))))));
-			fVbargraph28 = FAUSTFLOAT(fRec30[0]);
 			double fTemp29 = double(input2[i]);
-			fRec31[0] = max((fRec31[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp29))))));
-			fVbargraph29 = FAUSTFLOAT(fRec31[0]);
 			double fTemp30 = double(input0[i]);
-			fRec32[0] = max((fRec32[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp30))))));
-			fVbargraph30 = FAUSTFLOAT(fRec32[0]);
 			double fTemp31 = double(input1[i]);
-			fRec33[0] = max((fRec33[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp31))))));
-			fVbargraph31 = FAUSTFLOAT(fRec33[0]);
 			double fTemp32 = (0.03125 * (fRec1[0] * (fTemp0 + (fTemp1 + (fTemp2 + (fTemp3 + (fTemp4 + (fTemp5 + (fTemp6 + (fTemp7 + (fTemp8 + (fTemp9 + (fTemp10 + (fTemp11 + (fTemp12 + (fTemp13 + (fTemp14 + (fTemp15 + (fTemp16 + (fTemp17 + (fTemp18 + (fTemp19 + (fTemp20 + (fTemp21 + (fTemp22 + (fTemp23 + (fTemp24 + (fTemp25 + (fTemp26 + (fTemp27 + (fTemp28 + (fTemp29 + (fTemp30 + fTemp31)))))))))))))))))))))))))))))))));
-			fRec0[0] = max((fRec0[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp32))))));
-			fVbargraph32 = FAUSTFLOAT(fRec0[0]);
 			output0[i] = FAUSTFLOAT(fTemp32);
 			double fTemp33 = (fRec1[0] * ((fConst4 * ((((((((((((0.026217046093473896 * fTemp31) + (0.02879117912208189 * fTemp26)) + (0.046585106402240353 * fTemp25)) + (0.02879117912208189 * fTemp24)) + (0.017793927259118766 * fTemp19)) + (0.04242007166358315 * fTemp18)) + (0.04242007166358315 * fTemp17)) + (0.017793927259118766 * fTemp16)) + (0.026217046080314912 * fTemp12)) + (0.028791179127546258 * fTemp6)) + (0.046585106394941164 * fTemp5)) + (0.028791179127546258 * fTemp4))) + (0.03125 * ((((((((((((fConst5 * fTemp28) + (fConst6 * fTemp22)) + (fConst7 * fTemp21)) + (fConst6 * fTemp20)) + (fConst8 * fTemp14)) + (fConst9 * fTemp10)) + (fConst10 * fTemp9)) + (fConst9 * fTemp8)) + (fConst11 * fTemp3)) + (fConst12 * fTemp2)) + (fConst12 * fTemp1)) + (fConst11 * fTemp0)))));
-			fRec34[0] = max((fRec34[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp33))))));
-			fVbargraph33 = FAUSTFLOAT(fRec34[0]);
 			output1[i] = FAUSTFLOAT(fTemp33);
 			double fTemp34 = (fTemp4 - (fTemp6 + (fTemp8 - (fTemp10 + (fTemp20 - (fTemp22 - (fTemp26 - fTemp24)))))));
 			double fTemp35 = (fTemp13 - (fTemp15 + (fTemp30 - fTemp29)));
@@ -2392,20 +1870,12 @@ class mydsp : public dsp {
 			double fTemp37 = (fTemp1 - (fTemp2 + (fTemp18 - fTemp17)));
 			double fTemp38 = (fTemp0 - (fTemp3 + (fTemp19 - fTemp16)));
 			double fTemp39 = (fRec1[0] * ((0.031250000001308703 * fTemp34) - ((((0.019313562147752456 * fTemp35) + (0.046042825614321402 * fTemp36)) + (0.028456031166074459 * fTemp37)) + (0.050563562154587252 * fTemp38))));
-			fRec35[0] = max((fRec35[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp39))))));
-			fVbargraph34 = FAUSTFLOAT(fRec35[0]);
 			output2[i] = FAUSTFLOAT(fTemp39);
 			double fTemp40 = (fRec1[0] * ((fConst4 * ((((((((((((0.04658510639681137 * fTemp30) + (0.04242007166358315 * fTemp31)) + (0.04658510639681137 * fTemp29)) + (0.042420071656253222 * fTemp28)) + (0.026217046089015403 * fTemp27)) + (0.028791179121934959 * fTemp26)) + (0.017793927259118766 * fTemp25)) + (0.028791179121934959 * fTemp24)) + (0.026217046089015403 * fTemp23)) + (0.028791179128280928 * fTemp22)) + (0.017793927250752708 * fTemp21)) + (0.028791179128280928 * fTemp20))) + (0.03125 * ((((((((((((fConst13 * fTemp15) + (fConst14 * fTemp14)) + (fConst13 * fTemp13)) + (fConst15 * fTemp12)) + (fConst16 * fTemp11)) + (fConst17 * fTemp10)) + (fConst18 * fTemp9)) + (fConst17 * fTemp8)) + (fConst16 * fTemp7)) + (fConst19 * fTemp6)) + (fConst20 * fTemp5)) + (fConst19 * fTemp4)))));
-			fRec36[0] = max((fRec36[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp40))))));
-			fVbargraph35 = FAUSTFLOAT(fRec36[0]);
 			output3[i] = FAUSTFLOAT(fTemp40);
 			double fTemp41 = (fRec1[0] * ((fConst23 * ((((((((0.089206205807902131 * fTemp31) + (0.066490380064120932 * fTemp26)) + (0.066490380019538955 * fTemp25)) + (0.066490380064120932 * fTemp24)) + (0.089206205764209553 * fTemp14)) + (0.066490380064120919 * fTemp10)) + (0.066490380107227617 * fTemp9)) + (0.066490380064120919 * fTemp8))) + (0.03125 * ((((((((fConst24 * fTemp28) + (fConst25 * fTemp22)) + (fConst26 * fTemp21)) + (fConst25 * fTemp20)) + (fConst27 * fTemp12)) + (fConst25 * fTemp6)) + (fConst28 * fTemp5)) + (fConst25 * fTemp4)))));
-			fRec37[0] = max((fRec37[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp41))))));
-			fVbargraph36 = FAUSTFLOAT(fRec37[0]);
 			output4[i] = FAUSTFLOAT(fTemp41);
 			double fTemp42 = (fRec1[0] * ((fConst31 * ((((((((fConst32 * fTemp26) + (fConst34 * fTemp24)) + (fConst35 * fTemp19)) + (fConst36 * fTemp18)) + (fConst38 * fTemp17)) + (fConst40 * fTemp16)) + (fConst41 * fTemp6)) + (fConst42 * fTemp4))) + (0.03125 * ((((((((fConst44 * fTemp22) + (fConst46 * fTemp20)) + (fConst47 * fTemp10)) + (fConst48 * fTemp8)) + (fConst49 * fTemp3)) + (fConst50 * fTemp2)) + (fConst51 * fTemp1)) + (fConst52 * fTemp0)))));
-			fRec38[0] = max((fRec38[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp42))))));
-			fVbargraph37 = FAUSTFLOAT(fRec38[0]);
 			output5[i] = FAUSTFLOAT(fTemp42);
 			double fTemp43 = (fTemp7 + (fTemp11 + (fTemp27 + fTemp23)));
 			double fTemp44 = (fTemp4 + (fTemp6 + (fTemp8 + (fTemp10 + (fTemp20 + (fTemp22 + (fTemp26 + fTemp24)))))));
@@ -2415,139 +1885,44 @@ class mydsp : public dsp {
 			double fTemp48 = (fTemp5 + (fTemp9 + (fTemp12 + (fTemp14 + (fTemp21 + (fTemp25 + (fTemp31 + fTemp28)))))));
 			double fTemp49 = (fTemp1 + (fTemp2 + (fTemp18 + fTemp17)));
 			double fTemp50 = (fRec1[0] * ((((0.040906781083793552 * fTemp43) + (2.9263569544132831e-12 * fTemp44)) + (0.056531781096479002 * fTemp45)) - (((0.021593218926725055 * fTemp47) + (0.034938562148434216 * fTemp48)) + (0.0059682189255058898 * fTemp49))));
-			fRec39[0] = max((fRec39[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp50))))));
-			fVbargraph38 = FAUSTFLOAT(fRec39[0]);
 			output6[i] = FAUSTFLOAT(fTemp50);
 			double fTemp51 = (fRec1[0] * ((fConst31 * ((((((((fConst53 * fTemp30) + (fConst55 * fTemp29)) + (fConst56 * fTemp27)) + (fConst57 * fTemp26)) + (fConst58 * fTemp24)) + (fConst60 * fTemp23)) + (fConst61 * fTemp22)) + (fConst62 * fTemp20))) + (0.03125 * ((((((((fConst63 * fTemp15) + (fConst64 * fTemp13)) + (fConst65 * fTemp11)) + (fConst66 * fTemp10)) + (fConst67 * fTemp8)) + (fConst68 * fTemp7)) + (fConst69 * fTemp6)) + (fConst70 * fTemp4)))));
-			fRec40[0] = max((fRec40[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp51))))));
-			fVbargraph39 = FAUSTFLOAT(fRec40[0]);
 			output7[i] = FAUSTFLOAT(fTemp51);
 			double fTemp52 = (fRec1[0] * ((fConst23 * ((((((((((((((0.087037037470924977 * fTemp30) + (0.044603102903292141 * fTemp31)) + (0.087037037470924977 * fTemp29)) + (0.044603102853410466 * fTemp28)) + (0.027566233589157149 * fTemp27)) + (0.027566233589157149 * fTemp23)) + (2.8971462571211461e-11 * fTemp22)) + (2.8971462571211461e-11 * fTemp20)) + (0.087037037470924977 * fTemp15)) + (0.044603102990677254 * fTemp14)) + (0.087037037470924977 * fTemp13)) + (0.044603102958636814 * fTemp12)) + (0.027566233589157149 * fTemp11)) + (0.027566233589157149 * fTemp7))) + (0.03125 * ((((((((((((((((((fConst71 * fTemp26) + (fConst72 * fTemp25)) + (fConst71 * fTemp24)) + (fConst73 * fTemp21)) + (fConst74 * fTemp19)) + (fConst75 * fTemp18)) + (fConst75 * fTemp17)) + (fConst74 * fTemp16)) + (fConst76 * fTemp10)) + (fConst77 * fTemp9)) + (fConst76 * fTemp8)) + (fConst78 * fTemp6)) + (fConst79 * fTemp5)) + (fConst78 * fTemp4)) + (fConst74 * fTemp3)) + (fConst75 * fTemp2)) + (fConst75 * fTemp1)) + (fConst74 * fTemp0)))));
-			fRec41[0] = max((fRec41[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp52))))));
-			fVbargraph40 = FAUSTFLOAT(fRec41[0]);
 			output8[i] = FAUSTFLOAT(fTemp52);
 			double fTemp53 = (fRec1[0] * ((0.03125 * ((((((((((((fConst83 * fTemp28) + (fConst84 * fTemp25)) + (fConst85 * fTemp22)) + (fConst85 * fTemp20)) + (fConst86 * fTemp19)) + (fConst87 * fTemp18)) + (fConst87 * fTemp17)) + (fConst86 * fTemp16)) + (fConst88 * fTemp14)) + (fConst89 * fTemp10)) + (fConst89 * fTemp8)) + (fConst90 * fTemp5))) + (fConst82 * ((((((((((((0.19866513994759175 * fTemp31) + (0.076776477654886113 * fTemp26)) + (0.076776477654886113 * fTemp24)) + (0.09143948039011067 * fTemp21)) + (0.19866513996426247 * fTemp12)) + (0.09143947998092801 * fTemp9)) + (0.076776477611171123 * fTemp6)) + (0.076776477611171123 * fTemp4)) + (0.0090622338777363986 * fTemp3)) + (0.12278180886679166 * fTemp2)) + (0.12278180886679166 * fTemp1)) + (0.0090622338777363986 * fTemp0)))));
-			fRec42[0] = max((fRec42[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp53))))));
-			fVbargraph41 = FAUSTFLOAT(fRec42[0]);
 			output9[i] = FAUSTFLOAT(fTemp53);
 			double fTemp54 = (fRec1[0] * ((fConst92 * ((((fConst93 * fTemp26) + (fConst95 * fTemp24)) + (fConst96 * fTemp10)) + (fConst97 * fTemp8))) + (0.03125 * ((((fConst99 * fTemp22) + (fConst101 * fTemp20)) + (fConst99 * fTemp6)) + (fConst101 * fTemp4)))));
-			fRec43[0] = max((fRec43[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp54))))));
-			fVbargraph42 = FAUSTFLOAT(fRec43[0]);
 			output10[i] = FAUSTFLOAT(fTemp54);
 			double fTemp55 = (fRec1[0] * ((fConst102 * ((((((((((((fConst103 * fTemp26) + (fConst105 * fTemp31)) + (fConst106 * fTemp25)) + (fConst108 * fTemp24)) + (fConst109 * fTemp19)) + (fConst110 * fTemp18)) + (fConst112 * fTemp17)) + (fConst114 * fTemp16)) + (fConst115 * fTemp12)) + (fConst116 * fTemp6)) + (fConst117 * fTemp5)) + (fConst118 * fTemp4))) + (0.03125 * ((((((((((((fConst120 * fTemp28) + (fConst122 * fTemp22)) + (fConst123 * fTemp21)) + (fConst125 * fTemp20)) + (fConst126 * fTemp14)) + (fConst127 * fTemp10)) + (fConst128 * fTemp9)) + (fConst129 * fTemp8)) + (fConst130 * fTemp3)) + (fConst131 * fTemp2)) + (fConst132 * fTemp1)) + (fConst133 * fTemp0)))));
-			fRec44[0] = max((fRec44[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp55))))));
-			fVbargraph43 = FAUSTFLOAT(fRec44[0]);
 			output11[i] = FAUSTFLOAT(fTemp55);
 			double fTemp56 = (fRec1[0] * (((0.034862310657899916 * fTemp35) + (0.035165788928874113 * fTemp37)) - (((0.021733652816759153 * fTemp36) + (0.031823442324083143 * fTemp34)) + (0.052652155785676891 * fTemp38))));
-			fRec45[0] = max((fRec45[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp56))))));
-			fVbargraph44 = FAUSTFLOAT(fRec45[0]);
 			output12[i] = FAUSTFLOAT(fTemp56);
 			double fTemp57 = (fRec1[0] * ((fConst102 * ((((((((((((fConst134 * fTemp31) + (fConst136 * fTemp30)) + (fConst138 * fTemp29)) + (fConst139 * fTemp28)) + (fConst140 * fTemp27)) + (fConst141 * fTemp26)) + (fConst142 * fTemp25)) + (fConst143 * fTemp24)) + (fConst145 * fTemp23)) + (fConst146 * fTemp22)) + (fConst147 * fTemp21)) + (fConst148 * fTemp20))) + (0.03125 * ((((((((((((fConst149 * fTemp15) + (fConst150 * fTemp14)) + (fConst151 * fTemp13)) + (fConst152 * fTemp12)) + (fConst153 * fTemp11)) + (fConst154 * fTemp10)) + (fConst155 * fTemp9)) + (fConst156 * fTemp8)) + (fConst157 * fTemp7)) + (fConst158 * fTemp6)) + (fConst159 * fTemp5)) + (fConst160 * fTemp4)))));
-			fRec46[0] = max((fRec46[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp57))))));
-			fVbargraph45 = FAUSTFLOAT(fRec46[0]);
 			output13[i] = FAUSTFLOAT(fTemp57);
 			double fTemp58 = (fRec1[0] * ((fConst92 * ((((((((((fConst161 * fTemp30) + (fConst163 * fTemp29)) + (fConst164 * fTemp27)) + (fConst166 * fTemp23)) + (fConst167 * fTemp22)) + (fConst168 * fTemp20)) + (fConst161 * fTemp15)) + (fConst163 * fTemp13)) + (fConst164 * fTemp11)) + (fConst166 * fTemp7))) + (0.03125 * ((((((((((((((fConst169 * fTemp26) + (fConst170 * fTemp24)) + (fConst171 * fTemp19)) + (fConst172 * fTemp18)) + (fConst174 * fTemp17)) + (fConst176 * fTemp16)) + (fConst177 * fTemp10)) + (fConst178 * fTemp8)) + (fConst179 * fTemp6)) + (fConst180 * fTemp4)) + (fConst171 * fTemp3)) + (fConst172 * fTemp2)) + (fConst174 * fTemp1)) + (fConst176 * fTemp0)))));
-			fRec47[0] = max((fRec47[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp58))))));
-			fVbargraph46 = FAUSTFLOAT(fRec47[0]);
 			output14[i] = FAUSTFLOAT(fTemp58);
 			double fTemp59 = (fRec1[0] * ((0.03125 * ((((((((((((fConst181 * fTemp31) + (fConst182 * fTemp28)) + (fConst183 * fTemp26)) + (fConst184 * fTemp25)) + (fConst183 * fTemp24)) + (fConst185 * fTemp22)) + (fConst186 * fTemp21)) + (fConst185 * fTemp20)) + (fConst187 * fTemp15)) + (fConst187 * fTemp13)) + (fConst188 * fTemp11)) + (fConst188 * fTemp7))) + (fConst82 * (((((((((((0.028984853278736192 * fTemp27) + (0.16261518922351803 * fTemp46)) + (0.028984853278736192 * fTemp23)) + (0.017913624203916748 * fTemp14)) + (0.017913624310949439 * fTemp12)) + (0.076776477658412487 * fTemp10)) + (0.17727819176027068 * fTemp9)) + (0.076776477658412487 * fTemp8)) + (0.07677647769977651 * fTemp6)) + (0.17727819171100689 * fTemp5)) + (0.07677647769977651 * fTemp4)))));
-			fRec48[0] = max((fRec48[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp59))))));
-			fVbargraph47 = FAUSTFLOAT(fRec48[0]);
 			output15[i] = FAUSTFLOAT(fTemp59);
 			double fTemp60 = (fRec1[0] * ((0.03125 * ((((((((((fConst190 * fTemp28) + (fConst191 * fTemp26)) + (fConst192 * fTemp25)) + (fConst191 * fTemp24)) + (fConst193 * fTemp22)) + (fConst193 * fTemp20)) + (fConst194 * fTemp12)) + (fConst195 * fTemp10)) + (fConst196 * fTemp9)) + (fConst195 * fTemp8))) + (fConst189 * ((((((0.31915382431831724 * fTemp31) + (0.39647202572339707 * fTemp21)) + (0.31915382478727489 * fTemp14)) + (1.3641692798607456e-10 * fTemp6)) + (0.39647202582797197 * fTemp5)) + (1.3641692798607456e-10 * fTemp4)))));
-			fRec49[0] = max((fRec49[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp60))))));
-			fVbargraph48 = FAUSTFLOAT(fRec49[0]);
 			output16[i] = FAUSTFLOAT(fTemp60);
 			double fTemp61 = (fRec1[0] * ((0.03125 * ((((((((fConst200 * fTemp22) + (fConst202 * fTemp20)) + (fConst203 * fTemp19)) + (fConst204 * fTemp18)) + (fConst206 * fTemp17)) + (fConst208 * fTemp16)) + (fConst209 * fTemp10)) + (fConst210 * fTemp8))) + (fConst197 * ((((((((fConst211 * fTemp26) + (fConst212 * fTemp24)) + (fConst213 * fTemp6)) + (fConst214 * fTemp4)) + (fConst215 * fTemp3)) + (fConst216 * fTemp2)) + (fConst217 * fTemp1)) + (fConst218 * fTemp0)))));
-			fRec50[0] = max((fRec50[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp61))))));
-			fVbargraph49 = FAUSTFLOAT(fRec50[0]);
 			output17[i] = FAUSTFLOAT(fTemp61);
 			double fTemp62 = (fRec1[0] * ((fConst219 * ((((((((fConst220 * fTemp26) + (fConst222 * fTemp31)) + (fConst223 * fTemp25)) + (fConst225 * fTemp24)) + (fConst226 * fTemp14)) + (fConst227 * fTemp10)) + (fConst228 * fTemp9)) + (fConst229 * fTemp8))) + (0.03125 * ((((((((fConst231 * fTemp28) + (fConst233 * fTemp22)) + (fConst234 * fTemp21)) + (fConst236 * fTemp20)) + (fConst237 * fTemp12)) + (fConst233 * fTemp6)) + (fConst238 * fTemp5)) + (fConst236 * fTemp4)))));
-			fRec51[0] = max((fRec51[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp62))))));
-			fVbargraph50 = FAUSTFLOAT(fRec51[0]);
 			output18[i] = FAUSTFLOAT(fTemp62);
 			double fTemp63 = (fRec1[0] * ((fConst239 * (((((((fConst240 * fTemp19) + (0.010416666666693247 * ((fConst241 * fTemp26) + (fConst242 * fTemp24)))) + (fConst244 * fTemp18)) + (fConst246 * fTemp17)) + (fConst248 * fTemp16)) + (fConst249 * fTemp6)) + (fConst250 * fTemp4))) + (0.03125 * ((((((((fConst252 * fTemp22) + (fConst254 * fTemp20)) + (fConst255 * fTemp10)) + (fConst256 * fTemp8)) + (fConst258 * fTemp3)) + (fConst259 * fTemp2)) + (fConst260 * fTemp1)) + (fConst261 * fTemp0)))));
-			fRec52[0] = max((fRec52[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp63))))));
-			fVbargraph51 = FAUSTFLOAT(fRec52[0]);
 			output19[i] = FAUSTFLOAT(fTemp63);
 			double fTemp64 = (fRec1[0] * (((0.03515625 * fTemp48) + (0.040716809753480042 * fTemp45)) - (((0.036458333335514514 * fTemp44) + ((0.0029563930072167557 * fTemp47) + (0.0044761641722250133 * fTemp43))) + (0.030680085805992734 * fTemp49))));
-			fRec53[0] = max((fRec53[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp64))))));
-			fVbargraph52 = FAUSTFLOAT(fRec53[0]);
 			output20[i] = FAUSTFLOAT(fTemp64);
 			double fTemp65 = (fRec1[0] * ((fConst239 * (((((((fConst262 * fTemp27) + (0.01473139127471974 * ((fConst263 * fTemp30) + (fConst264 * fTemp29)))) + (fConst265 * fTemp26)) + (fConst266 * fTemp24)) + (fConst268 * fTemp23)) + (fConst269 * fTemp22)) + (fConst270 * fTemp20))) + (0.03125 * ((((((((fConst271 * fTemp15) + (fConst272 * fTemp13)) + (fConst273 * fTemp11)) + (fConst274 * fTemp10)) + (fConst275 * fTemp8)) + (fConst276 * fTemp7)) + (fConst277 * fTemp6)) + (fConst278 * fTemp4)))));
-			fRec54[0] = max((fRec54[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp65))))));
-			fVbargraph53 = FAUSTFLOAT(fRec54[0]);
 			output21[i] = FAUSTFLOAT(fTemp65);
 			double fTemp66 = (fRec1[0] * ((fConst219 * ((((((((((((((fConst279 * fTemp31) + (fConst280 * fTemp30)) + (fConst281 * fTemp29)) + (fConst282 * fTemp28)) + (fConst283 * fTemp27)) + (fConst284 * fTemp23)) + (fConst285 * fTemp22)) + (fConst286 * fTemp20)) + (fConst280 * fTemp15)) + (fConst287 * fTemp14)) + (fConst281 * fTemp13)) + (fConst288 * fTemp12)) + (fConst283 * fTemp11)) + (fConst284 * fTemp7))) + (0.03125 * ((((((((((((((((((fConst289 * fTemp26) + (fConst290 * fTemp25)) + (fConst291 * fTemp24)) + (fConst292 * fTemp21)) + (fConst293 * fTemp19)) + (fConst294 * fTemp18)) + (fConst295 * fTemp17)) + (fConst296 * fTemp16)) + (fConst297 * fTemp10)) + (fConst298 * fTemp9)) + (fConst299 * fTemp8)) + (fConst300 * fTemp6)) + (fConst301 * fTemp5)) + (fConst302 * fTemp4)) + (fConst293 * fTemp3)) + (fConst294 * fTemp2)) + (fConst295 * fTemp1)) + (fConst296 * fTemp0)))));
-			fRec55[0] = max((fRec55[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp66))))));
-			fVbargraph54 = FAUSTFLOAT(fRec55[0]);
 			output22[i] = FAUSTFLOAT(fTemp66);
 			double fTemp67 = (fRec1[0] * ((0.03125 * ((((((((fConst303 * fTemp26) + (fConst304 * fTemp24)) + (fConst305 * fTemp22)) + (fConst306 * fTemp20)) + (fConst307 * fTemp15)) + (fConst309 * fTemp13)) + (fConst310 * fTemp11)) + (fConst312 * fTemp7))) + (fConst197 * ((((((((fConst313 * fTemp30) + (fConst314 * fTemp29)) + (fConst315 * fTemp27)) + (fConst316 * fTemp23)) + (fConst317 * fTemp10)) + (fConst318 * fTemp8)) + (fConst319 * fTemp6)) + (fConst320 * fTemp4)))));
-			fRec56[0] = max((fRec56[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp67))))));
-			fVbargraph55 = FAUSTFLOAT(fRec56[0]);
 			output23[i] = FAUSTFLOAT(fTemp67);
 			double fTemp68 = (fRec1[0] * ((0.03125 * ((((((((((((fConst321 * fTemp31) + (fConst322 * fTemp28)) + (fConst323 * fTemp26)) + (fConst323 * fTemp24)) + (fConst324 * fTemp22)) + (fConst324 * fTemp20)) + (fConst325 * fTemp14)) + (fConst326 * fTemp12)) + (fConst323 * fTemp10)) + (fConst323 * fTemp8)) + (fConst323 * fTemp6)) + (fConst323 * fTemp4))) + (fConst189 * (((((((((((((((((((0.030476478292642641 * fTemp27) + (0.30382122984176912 * fTemp46)) + (0.044326920549846299 * fTemp25)) + (0.030476478292642641 * fTemp23)) + (0.0443269208346505 * fTemp21)) + (0.0064672104551386778 * fTemp19)) + (0.20888888992654256 * fTemp18)) + (0.20888888992654256 * fTemp17)) + (0.0064672104551386778 * fTemp16)) + (0.30382122984176912 * fTemp15)) + (0.30382122984176912 * fTemp13)) + (0.030476478292642641 * fTemp11)) + (0.044326919614500547 * fTemp9)) + (0.030476478292642641 * fTemp7)) + (0.044326919899304089 * fTemp5)) + (0.0064672104551386778 * fTemp3)) + (0.20888888992654256 * fTemp2)) + (0.20888888992654256 * fTemp1)) + (0.0064672104551386778 * fTemp0)))));
-			fRec57[0] = max((fRec57[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp68))))));
-			fVbargraph56 = FAUSTFLOAT(fRec57[0]);
 			output24[i] = FAUSTFLOAT(fTemp68);
 			fRec1[1] = fRec1[0];
-			fRec2[1] = fRec2[0];
-			fRec3[1] = fRec3[0];
-			fRec4[1] = fRec4[0];
-			fRec5[1] = fRec5[0];
-			fRec6[1] = fRec6[0];
-			fRec7[1] = fRec7[0];
-			fRec8[1] = fRec8[0];
-			fRec9[1] = fRec9[0];
-			fRec10[1] = fRec10[0];
-			fRec11[1] = fRec11[0];
-			fRec12[1] = fRec12[0];
-			fRec13[1] = fRec13[0];
-			fRec14[1] = fRec14[0];
-			fRec15[1] = fRec15[0];
-			fRec16[1] = fRec16[0];
-			fRec17[1] = fRec17[0];
-			fRec18[1] = fRec18[0];
-			fRec19[1] = fRec19[0];
-			fRec20[1] = fRec20[0];
-			fRec21[1] = fRec21[0];
-			fRec22[1] = fRec22[0];
-			fRec23[1] = fRec23[0];
-			fRec24[1] = fRec24[0];
-			fRec25[1] = fRec25[0];
-			fRec26[1] = fRec26[0];
-			fRec27[1] = fRec27[0];
-			fRec28[1] = fRec28[0];
-			fRec29[1] = fRec29[0];
-			fRec30[1] = fRec30[0];
-			fRec31[1] = fRec31[0];
-			fRec32[1] = fRec32[0];
-			fRec33[1] = fRec33[0];
-			fRec0[1] = fRec0[0];
-			fRec34[1] = fRec34[0];
-			fRec35[1] = fRec35[0];
-			fRec36[1] = fRec36[0];
-			fRec37[1] = fRec37[0];
-			fRec38[1] = fRec38[0];
-			fRec39[1] = fRec39[0];
-			fRec40[1] = fRec40[0];
-			fRec41[1] = fRec41[0];
-			fRec42[1] = fRec42[0];
-			fRec43[1] = fRec43[0];
-			fRec44[1] = fRec44[0];
-			fRec45[1] = fRec45[0];
-			fRec46[1] = fRec46[0];
-			fRec47[1] = fRec47[0];
-			fRec48[1] = fRec48[0];
-			fRec49[1] = fRec49[0];
-			fRec50[1] = fRec50[0];
-			fRec51[1] = fRec51[0];
-			fRec52[1] = fRec52[0];
-			fRec53[1] = fRec53[0];
-			fRec54[1] = fRec54[0];
-			fRec55[1] = fRec55[0];
-			fRec56[1] = fRec56[0];
-			fRec57[1] = fRec57[0];
 			
 		}
 		
@@ -2558,17 +1933,24 @@ class mydsp : public dsp {
 
 //----------------------------------------------------------------------------
 // SuperCollider/Faust interface
+// Input handling patched by patch_wrapper.py
 //----------------------------------------------------------------------------
 
 struct Faust : public Unit
 {
     // Faust dsp instance
     FAUSTCLASS*  mDSP;
-    // Buffers for control to audio rate conversion
+    // Input buffers passed to compute() when some audio inputs are not
+    // audio rate.  The mNumCopies control rate inputs listed in
+    // mCopyInputs are interpolated into copies, the others are used
+    // in place.
     float**     mInBufCopy;
     float*      mInBufValue;
-    // Controls
+    int*        mCopyInputs;
+    int         mNumCopies;
+    // Controls, the first mNumDynamicControls are not scalar rate
     size_t      mNumControls;
+    size_t      mNumDynamicControls;
     // NOTE: This needs to be the last field!
     //
     // The unit allocates additional memory according to the number
@@ -2678,15 +2060,42 @@ inline static void copyBuffer(float* dst, int n, float* src)
 }
 
 inline static void Faust_updateControls(Faust* unit)
+{
+    // Scalar rate controls are set in the constructor, the others are
+    // only updated when their input changed.
+    Control* controls = unit->mControls;
+    size_t numControls = unit->mNumDynamicControls;
+    for (size_t i = 0; i < numControls; ++i) {
+        Control* control = controls + i;
+        float value = IN0(control->input);
+        if (value != control->lastValue) {
+            control->lastValue = value;
+            control->update(value);
+        }
+    }
+}
+
+// Set every control from its input, and move the controls that are not
+// scalar rate to the front of mControls.
+static void Faust_initControls(Faust* unit)
 {
     Control* controls = unit->mControls;
     size_t numControls = unit->mNumControls;
+    size_t numDynamic = 0;
     int curControl = unit->mDSP->getNumInputs();
-    for (int i = 0; i < numControls; ++i) {
-        float value = IN0(curControl);
-        (controls++)->update(value);
-        curControl++;
+    for (size_t i = 0; i < numControls; ++i) {
+        Control* control = controls + i;
+        control->input = curControl + (int)i;
+        control->lastValue = IN0(control->input);
+        control->update(control->lastValue);
+        if (INRATE(control->input) != calc_ScalarRate) {
+            Control tmp = controls[numDynamic];
+            controls[numDynamic] = *control;
+            *control = tmp;
+            numDynamic++;
+        }
     }
+    unit->mNumDynamicControls = numDynamic;
 }
 
 void Faust_next(Faust* unit, int inNumSamples)
@@ -2701,18 +2110,13 @@ void Faust_next_copy(Faust* unit, int inNumSamples)
 {
     // update controls
     Faust_updateControls(unit);
-    // Copy buffers
-    for (int i = 0; i < unit->getNumAudioInputs(); ++i) {
-        float* b = unit->mInBufCopy[i];
-        if (INRATE(i) == calc_FullRate) {
-            // Audio rate: copy buffer
-            copyBuffer(b, inNumSamples, unit->mInBuf[i]);
-        } else {
-            // Control rate: linearly interpolate input
-            float v1 = IN0(i);
-            fillBuffer(b, inNumSamples, unit->mInBufValue[i], v1);
-            unit->mInBufValue[i] = v1;
-        }
+    // Control rate: linearly interpolate input, the audio rate buffers
+    // are used in place
+    for (int k = 0; k < unit->mNumCopies; ++k) {
+        int i = unit->mCopyInputs[k];
+        float v1 = IN0(i);
+        fillBuffer(unit->mInBufCopy[i], inNumSamples, unit->mInBufValue[k], v1);
+        unit->mInBufValue[k] = v1;
     }
     // dsp computation
     unit->mDSP->compute(inNumSamples, unit->mInBufCopy, unit->mOutBuf);
@@ -2725,6 +2129,12 @@ void Faust_next_clear(Faust* unit, int inNumSamples)
 
 void Faust_Ctor(Faust* unit)  // module constructor
 {
+    unit->mInBufCopy  = 0;
+    unit->mInBufValue = 0;
+    unit->mCopyInputs = 0;
+    unit->mNumCopies  = 0;
+    SETCALC(Faust_next_clear);
+
     // allocate dsp
     unit->mDSP = new(RTAlloc(unit->mWorld, sizeof(FAUSTCLASS))) FAUSTCLASS();
     if (!unit->mDSP) {
@@ -2734,14 +2144,12 @@ void Faust_Ctor(Faust* unit)  // module constructor
     {
         // init dsp
         unit->mDSP->instanceInit((int)SAMPLERATE);
-     
+
         // allocate controls
         unit->mNumControls = g_numControls;
         ControlAllocator ca(unit->mControls);
         unit->mDSP->buildUserInterface(&ca);
-        unit->mInBufCopy  = 0;
-        unit->mInBufValue = 0;
-     
+
         // check input/output channel configuration
         const size_t numInputs = unit->mDSP->getNumInputs() + unit->mNumControls;
         const size_t numOutputs = unit->mDSP->getNumOutputs();
@@ -2749,41 +2157,48 @@ void Faust_Ctor(Faust* unit)  // module constructor
         bool channelsValid = (numInputs == unit->mNumInputs) && (numOutputs == unit->mNumOutputs);
 
         if (channelsValid) {
-            bool rateValid = true;
-            for (int i = 0; i < unit->getNumAudioInputs(); ++i) {
+            Faust_initControls(unit);
+
+            const int numAudioInputs = unit->getNumAudioInputs();
+            int numCopies = 0;
+            for (int i = 0; i < numAudioInputs; ++i) {
                 if (INRATE(i) != calc_FullRate) {
-                    rateValid = false;
-                    break;
+                    numCopies++;
                 }
             }
-            if (rateValid) {
+            if (numCopies == 0) {
                 SETCALC(Faust_next);
             } else {
-                unit->mInBufCopy = (float**)RTAlloc(unit->mWorld, unit->getNumAudioInputs()*sizeof(float*));
-                if (!unit->mInBufCopy) {
+                // One block holds the buffer pointers of all audio inputs,
+                // then for each input that is not audio rate its
+                // interpolator state, buffer and index.
+                char* mem = (char*)RTAlloc(unit->mWorld,
+                                           numAudioInputs*sizeof(float*)
+                                           + numCopies*((BUFLENGTH + 1)*sizeof(float) + sizeof(int)));
+                if (!mem) {
                     Print("Faust[%s]: RT memory allocation failed, try increasing the real-time memory size in the server options\n", g_unitName);
                     goto end;
                 }
-                // Allocate memory for input buffer copies (numInputs * bufLength)
-                // and linear interpolation state (numInputs)
-                // = numInputs * (bufLength + 1)
-                unit->mInBufValue = (float*)RTAlloc(unit->mWorld, unit->getNumAudioInputs()*sizeof(float));
-                if (!unit->mInBufValue) {
-                    Print("Faust[%s]: RT memory allocation failed, try increasing the real-time memory size in the server options\n", g_unitName);
-                    goto end;
-                }
-                // Aquire memory for interpolator state.
-                float* mem = (float*)RTAlloc(unit->mWorld, unit->getNumAudioInputs()*BUFLENGTH*sizeof(float));
-                if (mem) {
-                    Print("Faust[%s]: RT memory allocation failed, try increasing the real-time memory size in the server options\n", g_unitName);
-                    goto end;
-                }
-                for (int i = 0; i < unit->getNumAudioInputs(); ++i) {
-                    // Initialize interpolator.
-                    unit->mInBufValue[i] = IN0(i);
-                    // Aquire buffer memory.
-                    unit->mInBufCopy[i] = mem;
-                    mem += BUFLENGTH;
+                unit->mInBufCopy  = (float**)mem;
+                unit->mInBufValue = (float*)(unit->mInBufCopy + numAudioInputs);
+                float* buffer     = unit->mInBufValue + numCopies;
+                unit->mCopyInputs = (int*)(buffer + numCopies*BUFLENGTH);
+                for (int i = 0; i < numAudioInputs; ++i) {
+                    if (INRATE(i) == calc_FullRate) {
+                        // Audio rate: use the buffer in place
+                        unit->mInBufCopy[i] = unit->mInBuf[i];
+                        continue;
+                    }
+                    unit->mInBufCopy[i] = buffer;
+                    if (INRATE(i) == calc_ScalarRate) {
+                        // Scalar rate: fill once
+                        fillBuffer(buffer, BUFLENGTH, IN0(i));
+                    } else {
+                        // Initialize interpolator.
+                        unit->mInBufValue[unit->mNumCopies] = IN0(i);
+                        unit->mCopyInputs[unit->mNumCopies++] = i;
+                    }
+                    buffer += BUFLENGTH;
                 }
                 SETCALC(Faust_next_copy);
             }
@@ -2791,9 +2206,13 @@ void Faust_Ctor(Faust* unit)  // module constructor
             Print("Faust[%s]:\n", g_unitName);
             Print("    Inputs:   %d\n"
                   "    Outputs:  %d\n"
-                  "    Callback: %s\n",
-                  numInputs, numOutputs,
-                  unit->mCalcFunc == (UnitCalcFunc)Faust_next ? "zero-copy" : "copy");
+                  "    Callback: %s\n"
+                  "    Interpolated inputs: %d of %d\n"
+                  "    Controls updated per block: %d of %d\n",
+                  (int)numInputs, (int)numOutputs,
+                  unit->mCalcFunc == (UnitCalcFunc)Faust_next ? "zero-copy" : "copy",
+                  unit->mNumCopies, numAudioInputs,
+                  (int)unit->mNumDynamicControls, (int)unit->mNumControls);
     #endif
         } else {
             Print("Faust[%s]:\n", g_unitName);
@@ -2803,10 +2222,9 @@ void Faust_Ctor(Faust* unit)  // module constructor
                   numInputs, unit->mNumInputs,
                   numOutputs, unit->mNumOutputs);
             Print("    Generating silence ...\n");
-            SETCALC(Faust_next_clear);
         }
     }
-    
+
 end:
     // Fix for https://github.com/grame-cncm/faust/issues/13
     ClearUnitOutputs(unit, 1);
@@ -2814,19 +2232,15 @@ end:
 
 void Faust_Dtor(Faust* unit)  // module destructor
 {
-    if (unit->mInBufValue) {
-        RTFree(unit->mWorld, unit->mInBufValue);
-    }
     if (unit->mInBufCopy) {
-        if (unit->mInBufCopy[0]) {
-            RTFree(unit->mWorld, unit->mInBufCopy[0]);
-        }
         RTFree(unit->mWorld, unit->mInBufCopy);
     }
-    
+
     // delete dsp
-    unit->mDSP->~FAUSTCLASS();
-    RTFree(unit->mWorld, unit->mDSP);
+    if (unit->mDSP) {
+        unit->mDSP->~FAUSTCLASS();
+        RTFree(unit->mWorld, unit->mDSP);
+    }
 }
 
 #ifdef SC_API_EXPORT
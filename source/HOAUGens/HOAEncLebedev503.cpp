@@ -5,6 +5,7 @@ license: "GPL"
 name: "HOAEncLebedev503"
 version: "1.0"
 Code generated with Faust 2.5.21 (https://faust.grame.fr)
+VU meters stripped by strip_meters.py
 Compilation options: cpp, -double -ftz 0
 ------------------------------------------------------------ */
 
@@ -535,6 +536,9 @@ struct Control
     UpdateFunction updateFunction;
     FAUSTFLOAT* zone;
     FAUSTFLOAT min, max;
+    // Unit input of the control and its value at the last update
+    int input;
+    float lastValue;
 
     inline void update(FAUSTFLOAT value)
     {
@@ -633,11 +637,8 @@ class mydsp : public dsp {
  private:
 	
 	int fSamplingFreq;
-	double fConst0;
 	FAUSTFLOAT fHslider0;
 	double fRec1[2];
-	double fRec0[2];
-	FAUSTFLOAT fVbargraph0;
 	double fConst1;
 	double fConst2;
 	double fConst3;
@@ -654,15 +655,9 @@ class mydsp : public dsp {
 	double fConst14;
 	double fConst15;
 	double fConst16;
-	double fRec2[2];
-	FAUSTFLOAT fVbargraph1;
-	double fRec3[2];
-	FAUSTFLOAT fVbargraph2;
 	double fConst17;
 	double fConst18;
 	double fConst19;
-	double fRec4[2];
-	FAUSTFLOAT fVbargraph3;
 	double fConst20;
 	double fConst21;
 	double fConst22;
@@ -674,8 +669,6 @@ class mydsp : public dsp {
 	double fConst28;
 	double fConst29;
 	double fConst30;
-	double fRec5[2];
-	FAUSTFLOAT fVbargraph4;
 	double fConst31;
 	double fConst32;
 	double fConst33;
@@ -719,10 +712,6 @@ class mydsp : public dsp {
 	double fConst71;
 	double fConst72;
 	double fConst73;
-	double fRec6[2];
-	FAUSTFLOAT fVbargraph5;
-	double fRec7[2];
-	FAUSTFLOAT fVbargraph6;
 	double fConst74;
 	double fConst75;
 	double fConst76;
@@ -743,8 +732,6 @@ class mydsp : public dsp {
 	double fConst91;
 	double fConst92;
 	double fConst93;
-	double fRec8[2];
-	FAUSTFLOAT fVbargraph7;
 	double fConst94;
 	double fConst95;
 	double fConst96;
@@ -757,8 +744,6 @@ class mydsp : public dsp {
 	double fConst103;
 	double fConst104;
 	double fConst105;
-	double fRec9[2];
-	FAUSTFLOAT fVbargraph8;
 	double fConst106;
 	double fConst107;
 	double fConst108;
@@ -772,8 +757,6 @@ class mydsp : public dsp {
 	double fConst116;
 	double fConst117;
 	double fConst118;
-	double fRec10[2];
-	FAUSTFLOAT fVbargraph9;
 	double fConst119;
 	double fConst120;
 	double fConst121;
@@ -808,8 +791,6 @@ class mydsp : public dsp {
 	double fConst150;
 	double fConst151;
 	double fConst152;
-	double fRec11[2];
-	FAUSTFLOAT fVbargraph10;
 	double fConst153;
 	double fConst154;
 	double fConst155;
@@ -863,10 +844,6 @@ class mydsp : public dsp {
 	double fConst203;
 	double fConst204;
 	double fConst205;
-	double fRec12[2];
-	FAUSTFLOAT fVbargraph11;
-	double fRec13[2];
-	FAUSTFLOAT fVbargraph12;
 	double fConst206;
 	double fConst207;
 	double fConst208;
@@ -888,8 +865,6 @@ class mydsp : public dsp {
 	double fConst224;
 	double fConst225;
 	double fConst226;
-	double fRec14[2];
-	FAUSTFLOAT fVbargraph13;
 	double fConst227;
 	double fConst228;
 	double fConst229;
@@ -922,8 +897,6 @@ class mydsp : public dsp {
 	double fConst256;
 	double fConst257;
 	double fConst258;
-	double fRec15[2];
-	FAUSTFLOAT fVbargraph14;
 	double fConst259;
 	double fConst260;
 	double fConst261;
@@ -934,8 +907,6 @@ class mydsp : public dsp {
 	double fConst266;
 	double fConst267;
 	double fConst268;
-	double fRec16[2];
-	FAUSTFLOAT fVbargraph15;
 	
  public:
 	
@@ -1274,7 +1245,6 @@ class mydsp : public dsp {
 	
 	virtual void instanceConstants(int samplingFreq) {
 		fSamplingFreq = samplingFreq;
-		fConst0 = (80.0 / min(192000.0, max(1.0, double(fSamplingFreq))));
 		fConst1 = double(tgamma(1.0));
 		fConst2 = double(tgamma(3.0));
 		fConst3 = double(tgamma(1.5));
@@ -1556,70 +1526,6 @@ class mydsp : public dsp {
 			fRec1[l0] = 0.0;
 			
 		}
-		for (int l1 = 0; (l1 < 2); l1 = (l1 + 1)) {
-			fRec0[l1] = 0.0;
-			
-		}
-		for (int l2 = 0; (l2 < 2); l2 = (l2 + 1)) {
-			fRec2[l2] = 0.0;
-			
-		}
-		for (int l3 = 0; (l3 < 2); l3 = (l3 + 1)) {
-			fRec3[l3] = 0.0;
-			
-		}
-		for (int l4 = 0; (l4 < 2); l4 = (l4 + 1)) {
-			fRec4[l4] = 0.0;
-			
-		}
-		for (int l5 = 0; (l5 < 2); l5 = (l5 + 1)) {
-			fRec5[l5] = 0.0;
-			
-		}
-		for (int l6 = 0; (l6 < 2); l6 = (l6 + 1)) {
-			fRec6[l6] = 0.0;
-			
-		}
-		for (int l7 = 0; (l7 < 2); l7 = (l7 + 1)) {
-			fRec7[l7] = 0.0;
-			
-		}
-		for (int l8 = 0; (l8 < 2); l8 = (l8 + 1)) {
-			fRec8[l8] = 0.0;
-			
-		}
-		for (int l9 = 0; (l9 < 2); l9 = (l9 + 1)) {
-			fRec9[l9] = 0.0;
-			
-		}
-		for (int l10 = 0; (l10 < 2); l10 = (l10 + 1)) {
-			fRec10[l10] = 0.0;
-			
-		}
-		for (int l11 = 0; (l11 < 2); l11 = (l11 + 1)) {
-			fRec11[l11] = 0.0;
-			
-		}
-		for (int l12 = 0; (l12 < 2); l12 = (l12 + 1)) {
-			fRec12[l12] = 0.0;
-			
-		}
-		for (int l13 = 0; (l13 < 2); l13 = (l13 + 1)) {
-			fRec13[l13] = 0.0;
-			
-		}
-		for (int l14 = 0; (l14 < 2); l14 = (l14 + 1)) {
-			fRec14[l14] = 0.0;
-			
-		}
-		for (int l15 = 0; (l15 < 2); l15 = (l15 + 1)) {
-			fRec15[l15] = 0.0;
-			
-		}
-		for (int l16 = 0; (l16 < 2); l16 = (l16 + 1)) {
-			fRec16[l16] = 0.0;
-			
-		}
 		
 	}
 	
@@ -1646,74 +1552,42 @@ class mydsp : public dsp {
 		ui_interface->openHorizontalBox("Outputs");
 		ui_interface->openHorizontalBox("0");
 		ui_interface->openVerticalBox("0");
-		ui_interface->declare(&fVbargraph0, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x3120680", &fVbargraph0, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->closeBox();
 		ui_interface->openHorizontalBox("1");
 		ui_interface->openVerticalBox("1");
-		ui_interface->declare(&fVbargraph1, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x313a2e0", &fVbargraph1, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("2");
-		ui_interface->declare(&fVbargraph2, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x3144d00", &fVbargraph2, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("3");
-		ui_interface->declare(&fVbargraph3, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x3156a90", &fVbargraph3, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->closeBox();
 		ui_interface->openHorizontalBox("2");
 		ui_interface->openVerticalBox("4");
-		ui_interface->declare(&fVbargraph4, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x316b870", &fVbargraph4, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("5");
-		ui_interface->declare(&fVbargraph5, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x318e350", &fVbargraph5, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("6");
-		ui_interface->declare(&fVbargraph6, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x3198580", &fVbargraph6, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("7");
-		ui_interface->declare(&fVbargraph7, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x31af490", &fVbargraph7, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("8");
-		ui_interface->declare(&fVbargraph8, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x31c73f0", &fVbargraph8, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->closeBox();
 		ui_interface->openHorizontalBox("3");
 		ui_interface->openVerticalBox("9");
-		ui_interface->declare(&fVbargraph9, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x31e0790", &fVbargraph9, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("10");
-		ui_interface->declare(&fVbargraph10, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x31fd850", &fVbargraph10, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("11");
-		ui_interface->declare(&fVbargraph11, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x32269d0", &fVbargraph11, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("12");
-		ui_interface->declare(&fVbargraph12, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x322d780", &fVbargraph12, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("13");
-		ui_interface->declare(&fVbargraph13, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x3245c80", &fVbargraph13, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("14");
-		ui_interface->declare(&fVbargraph14, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x3263d60", &fVbargraph14, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("15");
-		ui_interface->declare(&fVbargraph15, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x3279ec0", &fVbargraph15, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->closeBox();
 		ui_interface->declare(&fHslider0, "1", "");
@@ -1850,12 +1724,8 @@ class mydsp : public dsp {
 			double fTemp53 = double(input48[i]);
 			double fTemp54 = double(input49[i]);
 			double fTemp55 = (fRec1[0] * ((((0.012698412698412698 * (((((fTemp0 + fTemp1) + fTemp2) + fTemp3) + fTemp4) + fTemp5)) + (0.022574955908289243 * ((((((((fTemp10 + fTemp11) + fTemp12) + fTemp13) + fTemp14) + fTemp15) + fTemp16) + fTemp17) + fTemp18))) + (0.021093750000000001 * fTemp28)) + (0.02017333553791887 * ((((((((((((((((((((fTemp34 + fTemp35) + fTemp36) + fTemp37) + fTemp38) + fTemp39) + fTemp40) + fTemp41) + fTemp42) + fTemp43) + fTemp44) + fTemp45) + fTemp46) + fTemp47) + fTemp48) + fTemp49) + fTemp50) + fTemp51) + fTemp52) + fTemp53) + fTemp54))));
-			fRec0[0] = max((fRec0[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp55))))));
-			fVbargraph0 = FAUSTFLOAT(fRec0[0]);
 			output0[i] = FAUSTFLOAT(fTemp55);
 			double fTemp56 = (fRec1[0] * (((((fConst5 * fTemp4) + (0.022574955908289243 * ((((fConst6 * fTemp9) + (fConst7 * fTemp13)) + (fConst8 * fTemp14)) + (fConst6 * fTemp18)))) + (0.021093750000000001 * ((((fConst9 * fTemp21) + (fConst10 * fTemp22)) + (fConst9 * fTemp26)) + (fConst10 * fTemp27)))) + (fConst4 * (((((((((((((((((((((0.02026373487753309 * fTemp2) + (0.025473109945013343 * fTemp7)) + (0.025473109945013336 * fTemp11)) + (0.025473109945013343 * fTemp12)) + (0.025473109945013343 * fTemp16)) + (0.019434045907762619 * fTemp19)) + (0.019434045907762623 * fTemp20)) + (0.019434045907762619 * fTemp24)) + (0.019434045907762623 * fTemp25)) + (0.0097062489627452973 * fTemp29)) + (0.0097062489627452973 * fTemp30)) + (0.0097062489627453199 * fTemp35)) + (0.029118746888235923 * fTemp36)) + (0.029118746888235927 * fTemp37)) + (0.0097062489627453216 * fTemp38)) + (0.0097062489627453199 * fTemp43)) + (0.029118746888235923 * fTemp44)) + (0.029118746888235927 * fTemp45)) + (0.0097062489627453216 * fTemp46)) + (0.0097062489627452973 * fTemp51)) + (0.0097062489627452973 * fTemp52)))) + (0.02017333553791887 * ((((((((((((fConst11 * fTemp32) + (fConst12 * fTemp33)) + (fConst13 * fTemp39)) + (fConst14 * fTemp40)) + (fConst15 * fTemp41)) + (fConst16 * fTemp42)) + (fConst13 * fTemp47)) + (fConst14 * fTemp48)) + (fConst15 * fTemp49)) + (fConst16 * fTemp50)) + (fConst11 * fTemp53)) + (fConst12 * fTemp54)))));
-			fRec2[0] = max((fRec2[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp56))))));
-			fVbargraph1 = FAUSTFLOAT(fRec2[0]);
 			output1[i] = FAUSTFLOAT(fTemp56);
 			double fTemp57 = (fTemp0 - fTemp5);
 			double fTemp58 = ((((fTemp10 - fTemp15) - fTemp16) - fTemp17) - fTemp18);
@@ -1864,82 +1734,38 @@ class mydsp : public dsp {
 			double fTemp61 = ((((((((fTemp60 - fTemp43) - fTemp44) - fTemp45) - fTemp46) - fTemp47) - fTemp48) - fTemp49) - fTemp50);
 			double fTemp62 = ((((fTemp34 - fTemp51) - fTemp52) - fTemp53) - fTemp54);
 			double fTemp63 = (fRec1[0] * (((((0.021994295969128601 * fTemp57) + (0.027648561470568499 * fTemp58)) + (0.021093750000000001 * fTemp59)) + (0.010535180889746075 * fTemp61)) + (0.031605542669238249 * fTemp62)));
-			fRec3[0] = max((fRec3[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp63))))));
-			fVbargraph2 = FAUSTFLOAT(fRec3[0]);
 			output2[i] = FAUSTFLOAT(fTemp63);
 			double fTemp64 = (fRec1[0] * ((fConst4 * (((((((((((((((((((((0.02026373487753309 * fTemp1) + (0.025473109945013343 * fTemp6)) + (0.025473109945013343 * fTemp11)) + (0.025473109945013332 * fTemp14)) + (0.025473109945013343 * fTemp15)) + (0.019434045907762623 * fTemp19)) + (0.019434045907762616 * fTemp22)) + (0.019434045907762623 * fTemp24)) + (0.019434045907762616 * fTemp27)) + (0.0097062489627452956 * fTemp29)) + (0.0097062489627452939 * fTemp33)) + (0.029118746888235916 * fTemp35)) + (0.0097062489627453077 * fTemp36)) + (0.0097062489627453008 * fTemp41)) + (0.029118746888235913 * fTemp42)) + (0.029118746888235916 * fTemp43)) + (0.0097062489627453077 * fTemp44)) + (0.0097062489627453008 * fTemp49)) + (0.029118746888235913 * fTemp50)) + (0.0097062489627452956 * fTemp51)) + (0.0097062489627452939 * fTemp54))) + ((((fConst5 * fTemp3) + (0.022574955908289243 * ((((fConst6 * fTemp8) + (fConst7 * fTemp12)) + (fConst8 * fTemp13)) + (fConst6 * fTemp17)))) + (0.021093750000000001 * ((((fConst9 * fTemp20) + (fConst10 * fTemp21)) + (fConst9 * fTemp25)) + (fConst10 * fTemp26)))) + (0.02017333553791887 * ((((((((((((fConst11 * fTemp30) + (fConst12 * fTemp32)) + (fConst17 * fTemp37)) + (fConst18 * fTemp38)) + (fConst14 * fTemp39)) + (fConst19 * fTemp40)) + (fConst17 * fTemp45)) + (fConst18 * fTemp46)) + (fConst14 * fTemp47)) + (fConst19 * fTemp48)) + (fConst11 * fTemp52)) + (fConst12 * fTemp53))))));
-			fRec4[0] = max((fRec4[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp64))))));
-			fVbargraph3 = FAUSTFLOAT(fRec4[0]);
 			output3[i] = FAUSTFLOAT(fTemp64);
 			double fTemp65 = (fTemp30 + fTemp33);
 			double fTemp66 = (fTemp20 + fTemp22);
 			double fTemp67 = (fRec1[0] * ((0.02017333553791887 * (((((((((((fConst23 * fTemp65) + (fConst24 * fTemp37)) + (fConst25 * fTemp38)) + (fConst26 * fTemp41)) + (fConst27 * fTemp42)) + (fConst24 * fTemp45)) + (fConst25 * fTemp46)) + (fConst26 * fTemp49)) + (fConst27 * fTemp50)) + (fConst23 * fTemp52)) + (fConst23 * fTemp54))) + (((fConst29 * (fTemp12 + fTemp14)) + (fConst30 * ((fTemp66 + fTemp25) + fTemp27))) + (fConst22 * ((((((((((((((((((0.072048835120117657 * fTemp11) + (0.072048835120117671 * fTemp13)) + (0.044881006545161167 * fTemp19)) + (0.044881006545161174 * fTemp21)) + (0.044881006545161167 * fTemp24)) + (0.044881006545161174 * fTemp26)) + (0.011706176702255417 * fTemp29)) + (0.011706176702255421 * fTemp32)) + (0.035118530106766375 * fTemp35)) + (0.035118530106766334 * fTemp36)) + (0.035118530106766362 * fTemp39)) + (0.035118530106766348 * fTemp40)) + (0.035118530106766375 * fTemp43)) + (0.035118530106766334 * fTemp44)) + (0.035118530106766362 * fTemp47)) + (0.035118530106766348 * fTemp48)) + (0.011706176702255417 * fTemp51)) + (0.011706176702255421 * fTemp53))))));
-			fRec5[0] = max((fRec5[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp67))))));
-			fVbargraph4 = FAUSTFLOAT(fRec5[0]);
 			output4[i] = FAUSTFLOAT(fTemp67);
 			double fTemp68 = (fConst45 * fTemp19);
 			double fTemp69 = (fRec1[0] * ((((0.022574955908289243 * ((fConst34 * fTemp9) + (fConst36 * fTemp18))) + (0.021093750000000001 * ((((fConst37 * fTemp21) + (fConst38 * fTemp22)) + (fConst41 * fTemp26)) + (fConst42 * fTemp27)))) + (fConst32 * ((((((((((((((((((fConst43 * fTemp7) + (fConst44 * fTemp16)) + fTemp68) + (fConst45 * fTemp20)) + (fConst46 * fTemp24)) + (fConst47 * fTemp25)) + (fConst48 * fTemp29)) + (fConst48 * fTemp30)) + (fConst49 * fTemp35)) + (fConst50 * fTemp36)) + (fConst51 * fTemp37)) + (fConst52 * fTemp38)) + (fConst54 * fTemp43)) + (fConst55 * fTemp44)) + (fConst56 * fTemp45)) + (fConst57 * fTemp46)) + (fConst59 * fTemp51)) + (fConst59 * fTemp52)))) + (0.02017333553791887 * ((((((((((((fConst60 * fTemp32) + (fConst61 * fTemp33)) + (fConst62 * fTemp39)) + (fConst63 * fTemp40)) + (fConst64 * fTemp41)) + (fConst65 * fTemp42)) + (fConst67 * fTemp47)) + (fConst68 * fTemp48)) + (fConst69 * fTemp49)) + (fConst70 * fTemp50)) + (fConst72 * fTemp53)) + (fConst73 * fTemp54)))));
-			fRec6[0] = max((fRec6[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp69))))));
-			fVbargraph5 = FAUSTFLOAT(fRec6[0]);
 			output5[i] = FAUSTFLOAT(fTemp69);
 			double fTemp70 = (fRec1[0] * ((((0.01261978399999881 * ((((fTemp10 + fTemp15) + fTemp16) + fTemp17) + fTemp18)) + ((0.028394513999997331 * (fTemp0 + fTemp5)) + (5.236595479505967e-18 * fTemp28))) + (0.032806508796871948 * ((((fTemp34 + fTemp51) + fTemp52) + fTemp53) + fTemp54))) - (((0.014197256999998666 * (((fTemp1 + fTemp2) + fTemp3) + fTemp4)) + (0.025239567999997631 * (((fTemp11 + fTemp12) + fTemp13) + fTemp14))) + (0.01640325439843596 * ((((((((fTemp60 + fTemp43) + fTemp44) + fTemp45) + fTemp46) + fTemp47) + fTemp48) + fTemp49) + fTemp50)))));
-			fRec7[0] = max((fRec7[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp70))))));
-			fVbargraph6 = FAUSTFLOAT(fRec7[0]);
 			output6[i] = FAUSTFLOAT(fTemp70);
 			double fTemp71 = (fRec1[0] * ((fConst32 * ((((((((((((((((fTemp68 + ((fConst43 * fTemp6) + (fConst44 * fTemp15))) + (fConst74 * fTemp22)) + (fConst47 * fTemp24)) + (fConst75 * fTemp27)) + (fConst76 * fTemp29)) + (fConst77 * fTemp33)) + (fConst78 * fTemp35)) + (fConst79 * fTemp36)) + (fConst80 * fTemp41)) + (fConst81 * fTemp42)) + (fConst82 * fTemp43)) + (fConst83 * fTemp44)) + (fConst84 * fTemp49)) + (fConst85 * fTemp50)) + (fConst86 * fTemp51)) + (fConst87 * fTemp54))) + (((0.022574955908289243 * ((fConst34 * fTemp8) + (fConst36 * fTemp17))) + (0.021093750000000001 * ((((fConst37 * fTemp20) + (fConst38 * fTemp21)) + (fConst41 * fTemp25)) + (fConst42 * fTemp26)))) + (0.02017333553791887 * ((((((((((((fConst60 * fTemp30) + (fConst61 * fTemp32)) + (fConst88 * fTemp37)) + (fConst89 * fTemp38)) + (fConst63 * fTemp39)) + (fConst90 * fTemp40)) + (fConst91 * fTemp45)) + (fConst92 * fTemp46)) + (fConst68 * fTemp47)) + (fConst93 * fTemp48)) + (fConst72 * fTemp52)) + (fConst73 * fTemp53))))));
-			fRec8[0] = max((fRec8[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp71))))));
-			fVbargraph7 = FAUSTFLOAT(fRec8[0]);
 			output7[i] = FAUSTFLOAT(fTemp71);
 			double fTemp72 = (fTemp7 + fTemp9);
 			double fTemp73 = (fRec1[0] * ((0.02017333553791887 * (((((((((((((fConst94 * fTemp33) + (fConst95 * fTemp31)) + (fConst96 * fTemp36)) + (fConst97 * fTemp37)) + (fConst98 * fTemp40)) + (fConst99 * fTemp41)) + (fConst96 * fTemp44)) + (fConst97 * fTemp45)) + (fConst98 * fTemp48)) + (fConst99 * fTemp49)) + (fConst95 * fTemp51)) + (fConst95 * fTemp52)) + (fConst94 * fTemp54))) + ((((fConst100 * (fTemp2 + fTemp4)) + (0.022574955908289243 * (((((fConst101 * fTemp72) + (fConst102 * fTemp12)) + (fConst103 * fTemp14)) + (fConst101 * fTemp16)) + (fConst101 * fTemp18)))) + (0.021093750000000001 * ((((fConst104 * fTemp20) + (fConst105 * fTemp22)) + (fConst104 * fTemp25)) + (fConst105 * fTemp27)))) + (fConst22 * (((((((((((((((((((((0.04052746975506618 * (fTemp1 + fTemp3)) + (0.036024417560058836 * fTemp6)) + (0.036024417560058836 * fTemp8)) + (1.5998055129555246e-17 * fTemp11)) + (3.1996110259110492e-17 * fTemp13)) + (0.036024417560058836 * fTemp15)) + (0.036024417560058836 * fTemp17)) + (9.9655853669580557e-18 * fTemp19)) + (1.9931170733916111e-17 * fTemp21)) + (9.9655853669580557e-18 * fTemp24)) + (1.9931170733916111e-17 * fTemp26)) + (5.19858676206982e-18 * fTemp32)) + (0.046824706809021746 * fTemp35)) + (0.046824706809021746 * fTemp38)) + (0.046824706809021774 * fTemp39)) + (0.046824706809021698 * fTemp42)) + (0.046824706809021746 * fTemp43)) + (0.046824706809021746 * fTemp46)) + (0.046824706809021774 * fTemp47)) + (0.046824706809021698 * fTemp50)) + (5.19858676206982e-18 * fTemp53))))));
-			fRec9[0] = max((fRec9[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp73))))));
-			fVbargraph8 = FAUSTFLOAT(fRec9[0]);
 			output8[i] = FAUSTFLOAT(fTemp73);
 			double fTemp74 = (fRec1[0] * (((((fConst107 * fTemp2) + (0.022574955908289243 * ((((fConst108 * fTemp7) + (fConst109 * fTemp13)) + (fConst110 * fTemp14)) + (fConst108 * fTemp16)))) + (0.021093750000000001 * ((((fConst111 * fTemp21) + (fConst112 * fTemp22)) + (fConst111 * fTemp26)) + (fConst112 * fTemp27)))) + (fConst106 * (((((((((((((((((((((0.081054939510132359 * fTemp4) + (0.050946219890026692 * fTemp9)) + (0.10189243978005338 * fTemp11)) + (0.1018924397800533 * fTemp12)) + (0.050946219890026692 * fTemp18)) + (0.051824122420700336 * fTemp19)) + (0.051824122420700287 * fTemp20)) + (0.051824122420700336 * fTemp24)) + (0.051824122420700287 * fTemp25)) + (0.0070590901547238332 * fTemp29)) + (0.0070590901547238332 * fTemp30)) + (0.091768172011410243 * fTemp35)) + (0.091768172011410271 * fTemp38)) + (0.063531811392514695 * fTemp40)) + (0.063531811392514792 * fTemp41)) + (0.091768172011410243 * fTemp43)) + (0.091768172011410271 * fTemp46)) + (0.063531811392514695 * fTemp48)) + (0.063531811392514792 * fTemp49)) + (0.0070590901547238332 * fTemp51)) + (0.0070590901547238332 * fTemp52)))) + (0.02017333553791887 * ((((((((((((fConst113 * fTemp32) + (fConst114 * fTemp33)) + (fConst115 * fTemp36)) + (fConst116 * fTemp37)) + (fConst117 * fTemp39)) + (fConst118 * fTemp42)) + (fConst115 * fTemp44)) + (fConst116 * fTemp45)) + (fConst117 * fTemp47)) + (fConst118 * fTemp50)) + (fConst113 * fTemp53)) + (fConst114 * fTemp54)))));
-			fRec10[0] = max((fRec10[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp74))))));
-			fVbargraph9 = FAUSTFLOAT(fRec10[0]);
 			output9[i] = FAUSTFLOAT(fTemp74);
 			double fTemp75 = (fRec1[0] * ((0.02017333553791887 * (((((((((((fConst121 * fTemp65) + (fConst122 * fTemp37)) + (fConst123 * fTemp38)) + (fConst124 * fTemp41)) + (fConst125 * fTemp42)) + (fConst128 * fTemp45)) + (fConst129 * fTemp46)) + (fConst130 * fTemp49)) + (fConst131 * fTemp50)) + (fConst134 * fTemp52)) + (fConst134 * fTemp54))) + ((0.021093750000000001 * (((fConst135 * fTemp66) + (fConst138 * fTemp25)) + (fConst138 * fTemp27))) + (fConst119 * (((((((((((((((fConst21 * ((0.12956030605175081 * fTemp19) + (0.12956030605175084 * fTemp21))) + (fConst139 * fTemp24)) + (fConst140 * fTemp26)) + (fConst141 * fTemp29)) + (fConst142 * fTemp32)) + (fConst143 * fTemp35)) + (fConst144 * fTemp36)) + (fConst145 * fTemp39)) + (fConst146 * fTemp40)) + (fConst147 * fTemp43)) + (fConst148 * fTemp44)) + (fConst149 * fTemp47)) + (fConst150 * fTemp48)) + (fConst151 * fTemp51)) + (fConst152 * fTemp53))))));
-			fRec11[0] = max((fRec11[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp75))))));
-			fVbargraph10 = FAUSTFLOAT(fRec11[0]);
 			output10[i] = FAUSTFLOAT(fTemp75);
 			double fTemp76 = (fRec1[0] * (((((fConst156 * fTemp4) + (0.022574955908289243 * ((((fConst158 * fTemp9) + (fConst159 * fTemp13)) + (fConst160 * fTemp14)) + (fConst162 * fTemp18)))) + (0.021093750000000001 * ((((fConst163 * fTemp21) + (fConst164 * fTemp22)) + (fConst167 * fTemp26)) + (fConst168 * fTemp27)))) + (fConst153 * (((((((((((((((((((((fConst169 * fTemp7) + (fConst170 * fTemp2)) + (fConst171 * fTemp11)) + (fConst172 * fTemp12)) + (fConst173 * fTemp16)) + (fConst174 * fTemp19)) + (fConst175 * fTemp20)) + (fConst176 * fTemp24)) + (fConst177 * fTemp25)) + (fConst178 * fTemp29)) + (fConst178 * fTemp30)) + (fConst180 * fTemp35)) + (fConst181 * fTemp36)) + (fConst182 * fTemp37)) + (fConst183 * fTemp38)) + (fConst185 * fTemp43)) + (fConst186 * fTemp44)) + (fConst187 * fTemp45)) + (fConst188 * fTemp46)) + (fConst190 * fTemp51)) + (fConst190 * fTemp52)))) + (0.02017333553791887 * ((((((((((((fConst191 * fTemp32) + (fConst192 * fTemp33)) + (fConst194 * fTemp39)) + (fConst195 * fTemp40)) + (fConst196 * fTemp41)) + (fConst197 * fTemp42)) + (fConst199 * fTemp47)) + (fConst200 * fTemp48)) + (fConst201 * fTemp49)) + (fConst202 * fTemp50)) + (fConst204 * fTemp53)) + (fConst205 * fTemp54)))));
-			fRec12[0] = max((fRec12[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp76))))));
-			fVbargraph11 = FAUSTFLOAT(fRec12[0]);
 			output11[i] = FAUSTFLOAT(fTemp76);
 			double fTemp77 = (fRec1[0] * (((0.033596842045264641 * fTemp57) + (0.026333598483989317 * fTemp62)) - (((0.010558468816293317 * fTemp58) + (0.021480823570105497 * fTemp59)) + (0.020481687709769415 * fTemp61))));
-			fRec13[0] = max((fRec13[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp77))))));
-			fVbargraph12 = FAUSTFLOAT(fRec13[0]);
 			output12[i] = FAUSTFLOAT(fTemp77);
 			double fTemp78 = (fRec1[0] * ((fConst153 * (((((((((((((((((((((fConst169 * fTemp6) + (fConst170 * fTemp1)) + (fConst172 * fTemp11)) + (fConst206 * fTemp14)) + (fConst173 * fTemp15)) + (fConst175 * fTemp19)) + (fConst207 * fTemp22)) + (fConst177 * fTemp24)) + (fConst208 * fTemp27)) + (fConst209 * fTemp29)) + (fConst210 * fTemp33)) + (fConst211 * fTemp35)) + (fConst212 * fTemp36)) + (fConst213 * fTemp41)) + (fConst214 * fTemp42)) + (fConst215 * fTemp43)) + (fConst216 * fTemp44)) + (fConst217 * fTemp49)) + (fConst218 * fTemp50)) + (fConst219 * fTemp51)) + (fConst220 * fTemp54))) + ((((fConst156 * fTemp3) + (0.022574955908289243 * ((((fConst158 * fTemp8) + (fConst159 * fTemp12)) + (fConst160 * fTemp13)) + (fConst162 * fTemp17)))) + (0.021093750000000001 * ((((fConst163 * fTemp20) + (fConst164 * fTemp21)) + (fConst167 * fTemp25)) + (fConst168 * fTemp26)))) + (0.02017333553791887 * ((((((((((((fConst191 * fTemp30) + (fConst192 * fTemp32)) + (fConst221 * fTemp37)) + (fConst222 * fTemp38)) + (fConst195 * fTemp39)) + (fConst223 * fTemp40)) + (fConst224 * fTemp45)) + (fConst225 * fTemp46)) + (fConst200 * fTemp47)) + (fConst226 * fTemp48)) + (fConst204 * fTemp52)) + (fConst205 * fTemp53))))));
-			fRec14[0] = max((fRec14[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp78))))));
-			fVbargraph13 = FAUSTFLOAT(fRec14[0]);
 			output13[i] = FAUSTFLOAT(fTemp78);
 			double fTemp79 = (fRec1[0] * ((0.02017333553791887 * (((((((((((((fConst227 * fTemp31) + (fConst228 * fTemp33)) + (fConst229 * fTemp36)) + (fConst230 * fTemp37)) + (fConst231 * fTemp40)) + (fConst232 * fTemp41)) + (fConst233 * fTemp44)) + (fConst233 * fTemp45)) + (fConst234 * fTemp48)) + (fConst235 * fTemp49)) + (fConst236 * fTemp51)) + (fConst236 * fTemp52)) + (fConst237 * fTemp54))) + (((0.022574955908289243 * (((fConst238 * fTemp72) + (fConst240 * fTemp16)) + (fConst240 * fTemp18))) + (0.021093750000000001 * ((((fConst241 * fTemp20) + (fConst242 * fTemp22)) + (fConst243 * fTemp25)) + (fConst244 * fTemp27)))) + (fConst119 * (((((((((((((((((fConst245 * (fTemp6 + fTemp8)) + (fConst246 * fTemp15)) + (fConst246 * fTemp17)) + (fConst247 * fTemp19)) + (fConst248 * fTemp21)) + (fConst249 * fTemp24)) + (fConst250 * fTemp26)) + (fConst251 * fTemp32)) + (fConst252 * fTemp35)) + (fConst252 * fTemp38)) + (fConst253 * fTemp39)) + (fConst254 * fTemp42)) + (fConst255 * fTemp43)) + (fConst255 * fTemp46)) + (fConst256 * fTemp47)) + (fConst257 * fTemp50)) + (fConst258 * fTemp53))))));
-			fRec15[0] = max((fRec15[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp79))))));
-			fVbargraph14 = FAUSTFLOAT(fRec15[0]);
 			output14[i] = FAUSTFLOAT(fTemp79);
 			double fTemp80 = (fRec1[0] * ((0.02017333553791887 * ((((((((((((fConst259 * fTemp29) + (fConst260 * fTemp33)) + (fConst261 * fTemp36)) + (fConst262 * fTemp38)) + (fConst263 * fTemp39)) + (fConst264 * fTemp41)) + (fConst261 * fTemp44)) + (fConst262 * fTemp46)) + (fConst263 * fTemp47)) + (fConst264 * fTemp49)) + (fConst259 * fTemp51)) + (fConst260 * fTemp54))) + ((((fConst107 * fTemp3) + (0.022574955908289243 * ((((fConst108 * fTemp8) + (fConst265 * fTemp11)) + (fConst266 * fTemp14)) + (fConst108 * fTemp17)))) + (0.021093750000000001 * ((((fConst267 * fTemp19) + (fConst268 * fTemp22)) + (fConst267 * fTemp24)) + (fConst268 * fTemp27)))) + (fConst106 * (((((((((((((((((((((0.081054939510132359 * fTemp1) + (0.050946219890026692 * fTemp6)) + (0.10189243978005338 * fTemp12)) + (0.10189243978005329 * fTemp13)) + (0.050946219890026692 * fTemp15)) + (0.051824122420700336 * fTemp20)) + (0.051824122420700267 * fTemp21)) + (0.051824122420700336 * fTemp25)) + (0.051824122420700267 * fTemp26)) + (0.0070590901547238384 * fTemp30)) + (0.0070590901547238306 * fTemp32)) + (0.063531811392514598 * fTemp35)) + (0.09176817201141016 * fTemp37)) + (0.091768172011410187 * fTemp40)) + (0.063531811392514445 * fTemp42)) + (0.063531811392514598 * fTemp43)) + (0.09176817201141016 * fTemp45)) + (0.091768172011410187 * fTemp48)) + (0.063531811392514445 * fTemp50)) + (0.0070590901547238384 * fTemp52)) + (0.0070590901547238306 * fTemp53))))));
-			fRec16[0] = max((fRec16[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp80))))));
-			fVbargraph15 = FAUSTFLOAT(fRec16[0]);
 			output15[i] = FAUSTFLOAT(fTemp80);
 			fRec1[1] = fRec1[0];
-			fRec0[1] = fRec0[0];
-			fRec2[1] = fRec2[0];
-			fRec3[1] = fRec3[0];
-			fRec4[1] = fRec4[0];
-			fRec5[1] = fRec5[0];
-			fRec6[1] = fRec6[0];
-			fRec7[1] = fRec7[0];
-			fRec8[1] = fRec8[0];
-			fRec9[1] = fRec9[0];
-			fRec10[1] = fRec10[0];
-			fRec11[1] = fRec11[0];
-			fRec12[1] = fRec12[0];
-			fRec13[1] = fRec13[0];
-			fRec14[1] = fRec14[0];
-			fRec15[1] = fRec15[0];
-			fRec16[1] = fRec16[0];
 			
 		}
 		
@@ -1950,17 +1776,24 @@ class mydsp : public dsp {
 
 //----------------------------------------------------------------------------
 // SuperCollider/Faust interface
+// Input handling patched by patch_wrapper.py
 //----------------------------------------------------------------------------
 
 struct Faust : public Unit
 {
     // Faust dsp instance
     FAUSTCLASS*  mDSP;
-    // Buffers for control to audio rate conversion
+    // Input buffers passed to compute() when some audio inputs are not
+    // audio rate.  The mNumCopies control rate inputs listed in
+    // mCopyInputs are interpolated into copies, the others are used
+    // in place.
     float**     mInBufCopy;
     float*      mInBufValue;
-    // Controls
+    int*        mCopyInputs;
+    int         mNumCopies;
+    // Controls, the first mNumDynamicControls are not scalar rate
     size_t      mNumControls;
+    size_t      mNumDynamicControls;
     // NOTE: This needs to be the last field!
     //
     // The unit allocates additional memory according to the number
@@ -2070,15 +1903,42 @@ inline static void copyBuffer(float* dst, int n, float* src)
 }
 
 inline static void Faust_updateControls(Faust* unit)
+{
+    // Scalar rate controls are set in the constructor, the others are
+    // only updated when their input changed.
+    Control* controls = unit->mControls;
+    size_t numControls = unit->mNumDynamicControls;
+    for (size_t i = 0; i < numControls; ++i) {
+        Control* control = controls + i;
+        float value = IN0(control->input);
+        if (value != control->lastValue) {
+            control->lastValue = value;
+            control->update(value);
+        }
+    }
+}
+
+// Set every control from its input, and move the controls that are not
+// scalar rate to the front of mControls.
+static void Faust_initControls(Faust* unit)
 {
     Control* controls = unit->mControls;
     size_t numControls = unit->mNumControls;
+    size_t numDynamic = 0;
     int curControl = unit->mDSP->getNumInputs();
-    for (int i = 0; i < numControls; ++i) {
-        float value = IN0(curControl);
-        (controls++)->update(value);
-        curControl++;
+    for (size_t i = 0; i < numControls; ++i) {
+        Control* control = controls + i;
+        control->input = curControl + (int)i;
+        control->lastValue = IN0(control->input);
+        control->update(control->lastValue);
+        if (INRATE(control->input) != calc_ScalarRate) {
+            Control tmp = controls[numDynamic];
+            controls[numDynamic] = *control;
+            *control = tmp;
+            numDynamic++;
+        }
     }
+    unit->mNumDynamicControls = numDynamic;
 }
 
 void Faust_next(Faust* unit, int inNumSamples)
@@ -2093,18 +1953,13 @@ void Faust_next_copy(Faust* unit, int inNumSamples)
 {
     // update controls
     Faust_updateControls(unit);
-    // Copy buffers
-    for (int i = 0; i < unit->getNumAudioInputs(); ++i) {
-        float* b = unit->mInBufCopy[i];
-        if (INRATE(i) == calc_FullRate) {
-            // Audio rate: copy buffer
-            copyBuffer(b, inNumSamples, unit->mInBuf[i]);
-        } else {
-            // Control rate: linearly interpolate input
-            float v1 = IN0(i);
-            fillBuffer(b, inNumSamples, unit->mInBufValue[i], v1);
-            unit->mInBufValue[i] = v1;
-        }
+    // Control rate: linearly interpolate input, the audio rate buffers
+    // are used in place
+    for (int k = 0; k < unit->mNumCopies; ++k) {
+        int i = unit->mCopyInputs[k];
+        float v1 = IN0(i);
+        fillBuffer(unit->mInBufCopy[i], inNumSamples, unit->mInBufValue[k], v1);
+        unit->mInBufValue[k] = v1;
     }
     // dsp computation
     unit->mDSP->compute(inNumSamples, unit->mInBufCopy, unit->mOutBuf);
@@ -2117,6 +1972,12 @@ void Faust_next_clear(Faust* unit, int inNumSamples)
 
 void Faust_Ctor(Faust* unit)  // module constructor
 {
+    unit->mInBufCopy  = 0;
+    unit->mInBufValue = 0;
+    unit->mCopyInputs = 0;
+    unit->mNumCopies  = 0;
+    SETCALC(Faust_next_clear);
+
     // allocate dsp
     unit->mDSP = new(RTAlloc(unit->mWorld, sizeof(FAUSTCLASS))) FAUSTCLASS();
     if (!unit->mDSP) {
@@ -2126,14 +1987,12 @@ void Faust_Ctor(Faust* unit)  // module constructor
     {
         // init dsp
         unit->mDSP->instanceInit((int)SAMPLERATE);
-     
+
         // allocate controls
         unit->mNumControls = g_numControls;
         ControlAllocator ca(unit->mControls);
         unit->mDSP->buildUserInterface(&ca);
-        unit->mInBufCopy  = 0;
-        unit->mInBufValue = 0;
-     
+
         // check input/output channel configuration
         const size_t numInputs = unit->mDSP->getNumInputs() + unit->mNumControls;
         const size_t numOutputs = unit->mDSP->getNumOutputs();
@@ -2141,41 +2000,48 @@ void Faust_Ctor(Faust* unit)  // module constructor
         bool channelsValid = (numInputs == unit->mNumInputs) && (numOutputs == unit->mNumOutputs);
 
         if (channelsValid) {
-            bool rateValid = true;
-            for (int i = 0; i < unit->getNumAudioInputs(); ++i) {
+            Faust_initControls(unit);
+
+            const int numAudioInputs = unit->getNumAudioInputs();
+            int numCopies = 0;
+            for (int i = 0; i < numAudioInputs; ++i) {
                 if (INRATE(i) != calc_FullRate) {
-                    rateValid = false;
-                    break;
+                    numCopies++;
                 }
             }
-            if (rateValid) {
+            if (numCopies == 0) {
                 SETCALC(Faust_next);
             } else {
-                unit->mInBufCopy = (float**)RTAlloc(unit->mWorld, unit->getNumAudioInputs()*sizeof(float*));
-                if (!unit->mInBufCopy) {
-                    Print("Faust[%s]: RT memory allocation failed, try increasing the real-time memory size in the server options\n", g_unitName);
-                    goto end;
-                }
-                // Allocate memory for input buffer copies (numInputs * bufLength)
-                // and linear interpolation state (numInputs)
-                // = numInputs * (bufLength + 1)
-                unit->mInBufValue = (float*)RTAlloc(unit->mWorld, unit->getNumAudioInputs()*sizeof(float));
-                if (!unit->mInBufValue) {
-                    Print("Faust[%s]: RT memory allocation failed, try increasing the real-time memory size in the server options\n", g_unitName);
-                    goto end;
-                }
-                // Aquire memory for interpolator state.
-                float* mem = (float*)RTAlloc(unit->mWorld, unit->getNumAudioInputs()*BUFLENGTH*sizeof(float));
-                if (mem) {
+                // One block holds the buffer pointers of all audio inputs,
+                // then for each input that is not audio rate its
+                // interpolator state, buffer and index.
+                char* mem = (char*)RTAlloc(unit->mWorld,
+                                           numAudioInputs*sizeof(float*)
+                                           + numCopies*((BUFLENGTH + 1)*sizeof(float) + sizeof(int)));
+                if (!mem) {
                     Print("Faust[%s]: RT memory allocation failed, try increasing the real-time memory size in the server options\n", g_unitName);
                     goto end;
                 }
-                for (int i = 0; i < unit->getNumAudioInputs(); ++i) {
-                    // Initialize interpolator.
-                    unit->mInBufValue[i] = IN0(i);
-                    // Aquire buffer memory.
-                    unit->mInBufCopy[i] = mem;
-                    mem += BUFLENGTH;
+                unit->mInBufCopy  = (float**)mem;
+                unit->mInBufValue = (float*)(unit->mInBufCopy + numAudioInputs);
+                float* buffer     = unit->mInBufValue + numCopies;
+                unit->mCopyInputs = (int*)(buffer + numCopies*BUFLENGTH);
+                for (int i = 0; i < numAudioInputs; ++i) {
+                    if (INRATE(i) == calc_FullRate) {
+                        // Audio rate: use the buffer in place
+                        unit->mInBufCopy[i] = unit->mInBuf[i];
+                        continue;
+                    }
+                    unit->mInBufCopy[i] = buffer;
+                    if (INRATE(i) == calc_ScalarRate) {
+                        // Scalar rate: fill once
+                        fillBuffer(buffer, BUFLENGTH, IN0(i));
+                    } else {
+                        // Initialize interpolator.
+                        unit->mInBufValue[unit->mNumCopies] = IN0(i);
+                        unit->mCopyInputs[unit->mNumCopies++] = i;
+                    }
+                    buffer += BUFLENGTH;
                 }
                 SETCALC(Faust_next_copy);
             }
@@ -2183,9 +2049,13 @@ void Faust_Ctor(Faust* unit)  // module constructor
             Print("Faust[%s]:\n", g_unitName);
             Print("    Inputs:   %d\n"
                   "    Outputs:  %d\n"
-                  "    Callback: %s\n",
-                  numInputs, numOutputs,
-                  unit->mCalcFunc == (UnitCalcFunc)Faust_next ? "zero-copy" : "copy");
+                  "    Callback: %s\n"
+                  "    Interpolated inputs: %d of %d\n"
+                  "    Controls updated per block: %d of %d\n",
+                  (int)numInputs, (int)numOutputs,
+                  unit->mCalcFunc == (UnitCalcFunc)Faust_next ? "zero-copy" : "copy",
+                  unit->mNumCopies, numAudioInputs,
+                  (int)unit->mNumDynamicControls, (int)unit->mNumControls);
     #endif
         } else {
             Print("Faust[%s]:\n", g_unitName);
@@ -2195,10 +2065,9 @@ void Faust_Ctor(Faust* unit)  // module constructor
                   numInputs, unit->mNumInputs,
                   numOutputs, unit->mNumOutputs);
             Print("    Generating silence ...\n");
-            SETCALC(Faust_next_clear);
         }
     }
-    
+
 end:
     // Fix for https://github.com/grame-cncm/faust/issues/13
     ClearUnitOutputs(unit, 1);
@@ -2206,19 +2075,15 @@ end:
 
 void Faust_Dtor(Faust* unit)  // module destructor
 {
-    if (unit->mInBufValue) {
-        RTFree(unit->mWorld, unit->mInBufValue);
-    }
     if (unit->mInBufCopy) {
-        if (unit->mInBufCopy[0]) {
-            RTFree(unit->mWorld, unit->mInBufCopy[0]);
-        }
         RTFree(unit->mWorld, unit->mInBufCopy);
     }
-    
+
     // delete dsp
-    unit->mDSP->~FAUSTCLASS();
-    RTFree(unit->mWorld, unit->mDSP);
+    if (unit->mDSP) {
+        unit->mDSP->~FAUSTCLASS();
+        RTFree(unit->mWorld, unit->mDSP);
+    }
 }
 
 #ifdef SC_API_EXPORT
@@ -5,6 +5,7 @@ license: "GPL"
 name: "HOAEncLebedev505"
 version: "1.0"
 Code generated with Faust 2.5.21 (https://faust.grame.fr)
+VU meters stripped by strip_meters.py
 Compilation options: cpp, -double -ftz 0
 ------------------------------------------------------------ */
 
@@ -535,6 +536,9 @@ struct Control
     UpdateFunction updateFunction;
     FAUSTFLOAT* zone;
     FAUSTFLOAT min, max;
+    // Unit input of the control and its value at the last update
+    int input;
+    float lastValue;
 
     inline void update(FAUSTFLOAT value)
     {
@@ -633,11 +637,8 @@ class mydsp : public dsp {
  private:
 	
 	int fSamplingFreq;
-	double fConst0;
 	FAUSTFLOAT fHslider0;
 	double fRec1[2];
-	double fRec0[2];
-	FAUSTFLOAT fVbargraph0;
 	double fConst1;
 	double fConst2;
 	double fConst3;
@@ -654,15 +655,9 @@ class mydsp : public dsp {
 	double fConst14;
 	double fConst15;
 	double fConst16;
-	double fRec2[2];
-	FAUSTFLOAT fVbargraph1;
-	double fRec3[2];
-	FAUSTFLOAT fVbargraph2;
 	double fConst17;
 	double fConst18;
 	double fConst19;
-	double fRec4[2];
-	FAUSTFLOAT fVbargraph3;
 	double fConst20;
 	double fConst21;
 	double fConst22;
@@ -674,8 +669,6 @@ class mydsp : public dsp {
 	double fConst28;
 	double fConst29;
 	double fConst30;
-	double fRec5[2];
-	FAUSTFLOAT fVbargraph4;
 	double fConst31;
 	double fConst32;
 	double fConst33;
@@ -720,10 +713,6 @@ class mydsp : public dsp {
 	double fConst72;
 	double fConst73;
 	double fConst74;
-	double fRec6[2];
-	FAUSTFLOAT fVbargraph5;
-	double fRec7[2];
-	FAUSTFLOAT fVbargraph6;
 	double fConst75;
 	double fConst76;
 	double fConst77;
@@ -744,8 +733,6 @@ class mydsp : public dsp {
 	double fConst92;
 	double fConst93;
 	double fConst94;
-	double fRec8[2];
-	FAUSTFLOAT fVbargraph7;
 	double fConst95;
 	double fConst96;
 	double fConst97;
@@ -758,8 +745,6 @@ class mydsp : public dsp {
 	double fConst104;
 	double fConst105;
 	double fConst106;
-	double fRec9[2];
-	FAUSTFLOAT fVbargraph8;
 	double fConst107;
 	double fConst108;
 	double fConst109;
@@ -775,8 +760,6 @@ class mydsp : public dsp {
 	double fConst119;
 	double fConst120;
 	double fConst121;
-	double fRec10[2];
-	FAUSTFLOAT fVbargraph9;
 	double fConst122;
 	double fConst123;
 	double fConst124;
@@ -812,8 +795,6 @@ class mydsp : public dsp {
 	double fConst154;
 	double fConst155;
 	double fConst156;
-	double fRec11[2];
-	FAUSTFLOAT fVbargraph10;
 	double fConst157;
 	double fConst158;
 	double fConst159;
@@ -867,10 +848,6 @@ class mydsp : public dsp {
 	double fConst207;
 	double fConst208;
 	double fConst209;
-	double fRec12[2];
-	FAUSTFLOAT fVbargraph11;
-	double fRec13[2];
-	FAUSTFLOAT fVbargraph12;
 	double fConst210;
 	double fConst211;
 	double fConst212;
@@ -892,8 +869,6 @@ class mydsp : public dsp {
 	double fConst228;
 	double fConst229;
 	double fConst230;
-	double fRec14[2];
-	FAUSTFLOAT fVbargraph13;
 	double fConst231;
 	double fConst232;
 	double fConst233;
@@ -926,8 +901,6 @@ class mydsp : public dsp {
 	double fConst260;
 	double fConst261;
 	double fConst262;
-	double fRec15[2];
-	FAUSTFLOAT fVbargraph14;
 	double fConst263;
 	double fConst264;
 	double fConst265;
@@ -938,8 +911,6 @@ class mydsp : public dsp {
 	double fConst270;
 	double fConst271;
 	double fConst272;
-	double fRec16[2];
-	FAUSTFLOAT fVbargraph15;
 	double fConst273;
 	double fConst274;
 	double fConst275;
@@ -948,8 +919,6 @@ class mydsp : public dsp {
 	double fConst278;
 	double fConst279;
 	double fConst280;
-	double fRec17[2];
-	FAUSTFLOAT fVbargraph16;
 	double fConst281;
 	double fConst282;
 	double fConst283;
@@ -994,8 +963,6 @@ class mydsp : public dsp {
 	double fConst322;
 	double fConst323;
 	double fConst324;
-	double fRec18[2];
-	FAUSTFLOAT fVbargraph17;
 	double fConst325;
 	double fConst326;
 	double fConst327;
@@ -1038,8 +1005,6 @@ class mydsp : public dsp {
 	double fConst364;
 	double fConst365;
 	double fConst366;
-	double fRec19[2];
-	FAUSTFLOAT fVbargraph18;
 	double fConst367;
 	double fConst368;
 	double fConst369;
@@ -1087,10 +1052,6 @@ class mydsp : public dsp {
 	double fConst411;
 	double fConst412;
 	double fConst413;
-	double fRec20[2];
-	FAUSTFLOAT fVbargraph19;
-	double fRec21[2];
-	FAUSTFLOAT fVbargraph20;
 	double fConst414;
 	double fConst415;
 	double fConst416;
@@ -1109,8 +1070,6 @@ class mydsp : public dsp {
 	double fConst429;
 	double fConst430;
 	double fConst431;
-	double fRec22[2];
-	FAUSTFLOAT fVbargraph21;
 	double fConst432;
 	double fConst433;
 	double fConst434;
@@ -1148,8 +1107,6 @@ class mydsp : public dsp {
 	double fConst466;
 	double fConst467;
 	double fConst468;
-	double fRec23[2];
-	FAUSTFLOAT fVbargraph22;
 	double fConst469;
 	double fConst470;
 	double fConst471;
@@ -1180,15 +1137,11 @@ class mydsp : public dsp {
 	double fConst496;
 	double fConst497;
 	double fConst498;
-	double fRec24[2];
-	FAUSTFLOAT fVbargraph23;
 	double fConst499;
 	double fConst500;
 	double fConst501;
 	double fConst502;
 	double fConst503;
-	double fRec25[2];
-	FAUSTFLOAT fVbargraph24;
 	double fConst504;
 	double fConst505;
 	double fConst506;
@@ -1201,8 +1154,6 @@ class mydsp : public dsp {
 	double fConst513;
 	double fConst514;
 	double fConst515;
-	double fRec26[2];
-	FAUSTFLOAT fVbargraph25;
 	double fConst516;
 	double fConst517;
 	double fConst518;
@@ -1234,8 +1185,6 @@ class mydsp : public dsp {
 	double fConst544;
 	double fConst545;
 	double fConst546;
-	double fRec27[2];
-	FAUSTFLOAT fVbargraph26;
 	double fConst547;
 	double fConst548;
 	double fConst549;
@@ -1289,8 +1238,6 @@ class mydsp : public dsp {
 	double fConst597;
 	double fConst598;
 	double fConst599;
-	double fRec28[2];
-	FAUSTFLOAT fVbargraph27;
 	double fConst600;
 	double fConst601;
 	double fConst602;
@@ -1327,8 +1274,6 @@ class mydsp : public dsp {
 	double fConst633;
 	double fConst634;
 	double fConst635;
-	double fRec29[2];
-	FAUSTFLOAT fVbargraph28;
 	double fConst636;
 	double fConst637;
 	double fConst638;
@@ -1385,10 +1330,6 @@ class mydsp : public dsp {
 	double fConst689;
 	double fConst690;
 	double fConst691;
-	double fRec30[2];
-	FAUSTFLOAT fVbargraph29;
-	double fRec31[2];
-	FAUSTFLOAT fVbargraph30;
 	double fConst692;
 	double fConst693;
 	double fConst694;
@@ -1409,8 +1350,6 @@ class mydsp : public dsp {
 	double fConst709;
 	double fConst710;
 	double fConst711;
-	double fRec32[2];
-	FAUSTFLOAT fVbargraph31;
 	double fConst712;
 	double fConst713;
 	double fConst714;
@@ -1444,8 +1383,6 @@ class mydsp : public dsp {
 	double fConst742;
 	double fConst743;
 	double fConst744;
-	double fRec33[2];
-	FAUSTFLOAT fVbargraph32;
 	double fConst745;
 	double fConst746;
 	double fConst747;
@@ -1479,8 +1416,6 @@ class mydsp : public dsp {
 	double fConst775;
 	double fConst776;
 	double fConst777;
-	double fRec34[2];
-	FAUSTFLOAT fVbargraph33;
 	double fConst778;
 	double fConst779;
 	double fConst780;
@@ -1504,8 +1439,6 @@ class mydsp : public dsp {
 	double fConst798;
 	double fConst799;
 	double fConst800;
-	double fRec35[2];
-	FAUSTFLOAT fVbargraph34;
 	double fConst801;
 	double fConst802;
 	double fConst803;
@@ -1515,8 +1448,6 @@ class mydsp : public dsp {
 	double fConst807;
 	double fConst808;
 	double fConst809;
-	double fRec36[2];
-	FAUSTFLOAT fVbargraph35;
 	
  public:
 	
@@ -1935,7 +1866,6 @@ class mydsp : public dsp {
 	
 	virtual void instanceConstants(int samplingFreq) {
 		fSamplingFreq = samplingFreq;
-		fConst0 = (80.0 / min(192000.0, max(1.0, double(fSamplingFreq))));
 		fConst1 = double(tgamma(1.0));
 		fConst2 = double(tgamma(3.0));
 		fConst3 = double(tgamma(1.5));
@@ -2758,150 +2688,6 @@ class mydsp : public dsp {
 			fRec1[l0] = 0.0;
 			
 		}
-		for (int l1 = 0; (l1 < 2); l1 = (l1 + 1)) {
-			fRec0[l1] = 0.0;
-			
-		}
-		for (int l2 = 0; (l2 < 2); l2 = (l2 + 1)) {
-			fRec2[l2] = 0.0;
-			
-		}
-		for (int l3 = 0; (l3 < 2); l3 = (l3 + 1)) {
-			fRec3[l3] = 0.0;
-			
-		}
-		for (int l4 = 0; (l4 < 2); l4 = (l4 + 1)) {
-			fRec4[l4] = 0.0;
-			
-		}
-		for (int l5 = 0; (l5 < 2); l5 = (l5 + 1)) {
-			fRec5[l5] = 0.0;
-			
-		}
-		for (int l6 = 0; (l6 < 2); l6 = (l6 + 1)) {
-			fRec6[l6] = 0.0;
-			
-		}
-		for (int l7 = 0; (l7 < 2); l7 = (l7 + 1)) {
-			fRec7[l7] = 0.0;
-			
-		}
-		for (int l8 = 0; (l8 < 2); l8 = (l8 + 1)) {
-			fRec8[l8] = 0.0;
-			
-		}
-		for (int l9 = 0; (l9 < 2); l9 = (l9 + 1)) {
-			fRec9[l9] = 0.0;
-			
-		}
-		for (int l10 = 0; (l10 < 2); l10 = (l10 + 1)) {
-			fRec10[l10] = 0.0;
-			
-		}
-		for (int l11 = 0; (l11 < 2); l11 = (l11 + 1)) {
-			fRec11[l11] = 0.0;
-			
-		}
-		for (int l12 = 0; (l12 < 2); l12 = (l12 + 1)) {
-			fRec12[l12] = 0.0;
-			
-		}
-		for (int l13 = 0; (l13 < 2); l13 = (l13 + 1)) {
-			fRec13[l13] = 0.0;
-			
-		}
-		for (int l14 = 0; (l14 < 2); l14 = (l14 + 1)) {
-			fRec14[l14] = 0.0;
-			
-		}
-		for (int l15 = 0; (l15 < 2); l15 = (l15 + 1)) {
-			fRec15[l15] = 0.0;
-			
-		}
-		for (int l16 = 0; (l16 < 2); l16 = (l16 + 1)) {
-			fRec16[l16] = 0.0;
-			
-		}
-		for (int l17 = 0; (l17 < 2); l17 = (l17 + 1)) {
-			fRec17[l17] = 0.0;
-			
-		}
-		for (int l18 = 0; (l18 < 2); l18 = (l18 + 1)) {
-			fRec18[l18] = 0.0;
-			
-		}
-		for (int l19 = 0; (l19 < 2); l19 = (l19 + 1)) {
-			fRec19[l19] = 0.0;
-			
-		}
-		for (int l20 = 0; (l20 < 2); l20 = (l20 + 1)) {
-			fRec20[l20] = 0.0;
-			
-		}
-		for (int l21 = 0; (l21 < 2); l21 = (l21 + 1)) {
-			fRec21[l21] = 0.0;
-			
-		}
-		for (int l22 = 0; (l22 < 2); l22 = (l22 + 1)) {
-			fRec22[l22] = 0.0;
-			
-		}
-		for (int l23 = 0; (l23 < 2); l23 = (l23 + 1)) {
-			fRec23[l23] = 0.0;
-			
-		}
-		for (int l24 = 0; (l24 < 2); l24 = (l24 + 1)) {
-			fRec24[l24] = 0.0;
-			
-		}
-		for (int l25 = 0; (l25 < 2); l25 = (l25 + 1)) {
-			fRec25[l25] = 0.0;
-			
-		}
-		for (int l26 = 0; (l26 < 2); l26 = (l26 + 1)) {
-			fRec26[l26] = 0.0;
-			
-		}
-		for (int l27 = 0; (l27 < 2); l27 = (l27 + 1)) {
-			fRec27[l27] = 0.0;
-			
-		}
-		for (int l28 = 0; (l28 < 2); l28 = (l28 + 1)) {
-			fRec28[l28] = 0.0;
-			
-		}
-		for (int l29 = 0; (l29 < 2); l29 = (l29 + 1)) {
-			fRec29[l29] = 0.0;
-			
-		}
-		for (int l30 = 0; (l30 < 2); l30 = (l30 + 1)) {
-			fRec30[l30] = 0.0;
-			
-		}
-		for (int l31 = 0; (l31 < 2); l31 = (l31 + 1)) {
-			fRec31[l31] = 0.0;
-			
-		}
-		for (int l32 = 0; (l32 < 2); l32 = (l32 + 1)) {
-			fRec32[l32] = 0.0;
-			
-		}
-		for (int l33 = 0; (l33 < 2); l33 = (l33 + 1)) {
-			fRec33[l33] = 0.0;
-			
-		}
-		for (int l34 = 0; (l34 < 2); l34 = (l34 + 1)) {
-			fRec34[l34] = 0.0;
-			
-		}
-		for (int l35 = 0; (l35 < 2); l35 = (l35 + 1)) {
-			fRec35[l35] = 0.0;
-			
-		}
-		for (int l36 = 0; (l36 < 2); l36 = (l36 + 1)) {
-			fRec36[l36] = 0.0;
-			
-		}
 		
 	}
 	
@@ -2928,158 +2714,86 @@ class mydsp : public dsp {
 		ui_interface->openHorizontalBox("Outputs");
 		ui_interface->openHorizontalBox("0");
 		ui_interface->openVerticalBox("0");
-		ui_interface->declare(&fVbargraph0, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x30fc670", &fVbargraph0, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->closeBox();
 		ui_interface->openHorizontalBox("1");
 		ui_interface->openVerticalBox("1");
-		ui_interface->declare(&fVbargraph1, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x31162d0", &fVbargraph1, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("2");
-		ui_interface->declare(&fVbargraph2, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x3120cf0", &fVbargraph2, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("3");
-		ui_interface->declare(&fVbargraph3, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x3132a80", &fVbargraph3, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->closeBox();
 		ui_interface->openHorizontalBox("2");
 		ui_interface->openVerticalBox("4");
-		ui_interface->declare(&fVbargraph4, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x3147a70", &fVbargraph4, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("5");
-		ui_interface->declare(&fVbargraph5, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x316a850", &fVbargraph5, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("6");
-		ui_interface->declare(&fVbargraph6, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x31756e0", &fVbargraph6, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("7");
-		ui_interface->declare(&fVbargraph7, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x318c5f0", &fVbargraph7, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("8");
-		ui_interface->declare(&fVbargraph8, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x31a4970", &fVbargraph8, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->closeBox();
 		ui_interface->openHorizontalBox("3");
 		ui_interface->openVerticalBox("9");
-		ui_interface->declare(&fVbargraph9, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x31be310", &fVbargraph9, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("10");
-		ui_interface->declare(&fVbargraph10, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x31db6d0", &fVbargraph10, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("11");
-		ui_interface->declare(&fVbargraph11, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x3204850", &fVbargraph11, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("12");
-		ui_interface->declare(&fVbargraph12, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x320b600", &fVbargraph12, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("13");
-		ui_interface->declare(&fVbargraph13, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x3223b00", &fVbargraph13, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("14");
-		ui_interface->declare(&fVbargraph14, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x3241df0", &fVbargraph14, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("15");
-		ui_interface->declare(&fVbargraph15, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x3257f50", &fVbargraph15, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->closeBox();
 		ui_interface->openHorizontalBox("4");
 		ui_interface->openVerticalBox("16");
-		ui_interface->declare(&fVbargraph16, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x326c650", &fVbargraph16, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("17");
-		ui_interface->declare(&fVbargraph17, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x328f9d0", &fVbargraph17, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("18");
-		ui_interface->declare(&fVbargraph18, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x32b06f0", &fVbargraph18, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("19");
-		ui_interface->declare(&fVbargraph19, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x32d4b10", &fVbargraph19, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("20");
-		ui_interface->declare(&fVbargraph20, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x32dc5a0", &fVbargraph20, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("21");
-		ui_interface->declare(&fVbargraph21, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x32f21d0", &fVbargraph21, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("22");
-		ui_interface->declare(&fVbargraph22, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x3312e80", &fVbargraph22, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("23");
-		ui_interface->declare(&fVbargraph23, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x332fe10", &fVbargraph23, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("24");
-		ui_interface->declare(&fVbargraph24, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x3342830", &fVbargraph24, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->closeBox();
 		ui_interface->openHorizontalBox("5");
 		ui_interface->openVerticalBox("25");
-		ui_interface->declare(&fVbargraph25, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x335b630", &fVbargraph25, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("26");
-		ui_interface->declare(&fVbargraph26, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x3377ed0", &fVbargraph26, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("27");
-		ui_interface->declare(&fVbargraph27, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x33a0ca0", &fVbargraph27, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("28");
-		ui_interface->declare(&fVbargraph28, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x33be810", &fVbargraph28, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("29");
-		ui_interface->declare(&fVbargraph29, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x33e82f0", &fVbargraph29, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("30");
-		ui_interface->declare(&fVbargraph30, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x33ef420", &fVbargraph30, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("31");
-		ui_interface->declare(&fVbargraph31, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x3407420", &fVbargraph31, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("32");
-		ui_interface->declare(&fVbargraph32, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x3425700", &fVbargraph32, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("33");
-		ui_interface->declare(&fVbargraph33, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x3444540", &fVbargraph33, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("34");
-		ui_interface->declare(&fVbargraph34, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x345c940", &fVbargraph34, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("35");
-		ui_interface->declare(&fVbargraph35, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x3472180", &fVbargraph35, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->closeBox();
 		ui_interface->declare(&fHslider0, "1", "");
@@ -3236,12 +2950,8 @@ class mydsp : public dsp {
 			double fTemp53 = double(input48[i]);
 			double fTemp54 = double(input49[i]);
 			double fTemp55 = (fRec1[0] * ((((0.012698412698412698 * (((((fTemp0 + fTemp1) + fTemp2) + fTemp3) + fTemp4) + fTemp5)) + (0.022574955908289243 * ((((((((fTemp10 + fTemp11) + fTemp12) + fTemp13) + fTemp14) + fTemp15) + fTemp16) + fTemp17) + fTemp18))) + (0.021093750000000001 * fTemp28)) + (0.02017333553791887 * ((((((((((((((((((((fTemp34 + fTemp35) + fTemp36) + fTemp37) + fTemp38) + fTemp39) + fTemp40) + fTemp41) + fTemp42) + fTemp43) + fTemp44) + fTemp45) + fTemp46) + fTemp47) + fTemp48) + fTemp49) + fTemp50) + fTemp51) + fTemp52) + fTemp53) + fTemp54))));
-			fRec0[0] = max((fRec0[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp55))))));
-			fVbargraph0 = FAUSTFLOAT(fRec0[0]);
 			output0[i] = FAUSTFLOAT(fTemp55);
 			double fTemp56 = (fRec1[0] * (((((fConst5 * fTemp4) + (0.022574955908289243 * ((((fConst6 * fTemp9) + (fConst7 * fTemp13)) + (fConst8 * fTemp14)) + (fConst6 * fTemp18)))) + (0.021093750000000001 * ((((fConst9 * fTemp21) + (fConst10 * fTemp22)) + (fConst9 * fTemp26)) + (fConst10 * fTemp27)))) + (fConst4 * (((((((((((((((((((((0.02026373487753309 * fTemp2) + (0.025473109945013343 * fTemp7)) + (0.025473109945013336 * fTemp11)) + (0.025473109945013343 * fTemp12)) + (0.025473109945013343 * fTemp16)) + (0.019434045907762619 * fTemp19)) + (0.019434045907762623 * fTemp20)) + (0.019434045907762619 * fTemp24)) + (0.019434045907762623 * fTemp25)) + (0.0097062489627452973 * fTemp29)) + (0.0097062489627452973 * fTemp30)) + (0.0097062489627453199 * fTemp35)) + (0.029118746888235923 * fTemp36)) + (0.029118746888235927 * fTemp37)) + (0.0097062489627453216 * fTemp38)) + (0.0097062489627453199 * fTemp43)) + (0.029118746888235923 * fTemp44)) + (0.029118746888235927 * fTemp45)) + (0.0097062489627453216 * fTemp46)) + (0.0097062489627452973 * fTemp51)) + (0.0097062489627452973 * fTemp52)))) + (0.02017333553791887 * ((((((((((((fConst11 * fTemp32) + (fConst12 * fTemp33)) + (fConst13 * fTemp39)) + (fConst14 * fTemp40)) + (fConst15 * fTemp41)) + (fConst16 * fTemp42)) + (fConst13 * fTemp47)) + (fConst14 * fTemp48)) + (fConst15 * fTemp49)) + (fConst16 * fTemp50)) + (fConst11 * fTemp53)) + (fConst12 * fTemp54)))));
-			fRec2[0] = max((fRec2[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp56))))));
-			fVbargraph1 = FAUSTFLOAT(fRec2[0]);
 			output1[i] = FAUSTFLOAT(fTemp56);
 			double fTemp57 = (fTemp0 - fTemp5);
 			double fTemp58 = ((((fTemp10 - fTemp15) - fTemp16) - fTemp17) - fTemp18);
@@ -3250,24 +2960,16 @@ class mydsp : public dsp {
 			double fTemp61 = ((((((((fTemp60 - fTemp43) - fTemp44) - fTemp45) - fTemp46) - fTemp47) - fTemp48) - fTemp49) - fTemp50);
 			double fTemp62 = ((((fTemp34 - fTemp51) - fTemp52) - fTemp53) - fTemp54);
 			double fTemp63 = (fRec1[0] * (((((0.021994295969128601 * fTemp57) + (0.027648561470568499 * fTemp58)) + (0.021093750000000001 * fTemp59)) + (0.010535180889746075 * fTemp61)) + (0.031605542669238249 * fTemp62)));
-			fRec3[0] = max((fRec3[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp63))))));
-			fVbargraph2 = FAUSTFLOAT(fRec3[0]);
 			output2[i] = FAUSTFLOAT(fTemp63);
 			double fTemp64 = (fRec1[0] * ((fConst4 * (((((((((((((((((((((0.02026373487753309 * fTemp1) + (0.025473109945013343 * fTemp6)) + (0.025473109945013343 * fTemp11)) + (0.025473109945013332 * fTemp14)) + (0.025473109945013343 * fTemp15)) + (0.019434045907762623 * fTemp19)) + (0.019434045907762616 * fTemp22)) + (0.019434045907762623 * fTemp24)) + (0.019434045907762616 * fTemp27)) + (0.0097062489627452956 * fTemp29)) + (0.0097062489627452939 * fTemp33)) + (0.029118746888235916 * fTemp35)) + (0.0097062489627453077 * fTemp36)) + (0.0097062489627453008 * fTemp41)) + (0.029118746888235913 * fTemp42)) + (0.029118746888235916 * fTemp43)) + (0.0097062489627453077 * fTemp44)) + (0.0097062489627453008 * fTemp49)) + (0.029118746888235913 * fTemp50)) + (0.0097062489627452956 * fTemp51)) + (0.0097062489627452939 * fTemp54))) + ((((fConst5 * fTemp3) + (0.022574955908289243 * ((((fConst6 * fTemp8) + (fConst7 * fTemp12)) + (fConst8 * fTemp13)) + (fConst6 * fTemp17)))) + (0.021093750000000001 * ((((fConst9 * fTemp20) + (fConst10 * fTemp21)) + (fConst9 * fTemp25)) + (fConst10 * fTemp26)))) + (0.02017333553791887 * ((((((((((((fConst11 * fTemp30) + (fConst12 * fTemp32)) + (fConst17 * fTemp37)) + (fConst18 * fTemp38)) + (fConst14 * fTemp39)) + (fConst19 * fTemp40)) + (fConst17 * fTemp45)) + (fConst18 * fTemp46)) + (fConst14 * fTemp47)) + (fConst19 * fTemp48)) + (fConst11 * fTemp52)) + (fConst12 * fTemp53))))));
-			fRec4[0] = max((fRec4[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp64))))));
-			fVbargraph3 = FAUSTFLOAT(fRec4[0]);
 			output3[i] = FAUSTFLOAT(fTemp64);
 			double fTemp65 = (fTemp30 + fTemp33);
 			double fTemp66 = (fTemp12 + fTemp14);
 			double fTemp67 = (fTemp20 + fTemp22);
 			double fTemp68 = (fRec1[0] * ((0.02017333553791887 * (((((((((((fConst23 * fTemp65) + (fConst24 * fTemp37)) + (fConst25 * fTemp38)) + (fConst26 * fTemp41)) + (fConst27 * fTemp42)) + (fConst24 * fTemp45)) + (fConst25 * fTemp46)) + (fConst26 * fTemp49)) + (fConst27 * fTemp50)) + (fConst23 * fTemp52)) + (fConst23 * fTemp54))) + (((fConst29 * fTemp66) + (fConst30 * ((fTemp67 + fTemp25) + fTemp27))) + (fConst22 * ((((((((((((((((((0.072048835120117657 * fTemp11) + (0.072048835120117671 * fTemp13)) + (0.044881006545161167 * fTemp19)) + (0.044881006545161174 * fTemp21)) + (0.044881006545161167 * fTemp24)) + (0.044881006545161174 * fTemp26)) + (0.011706176702255417 * fTemp29)) + (0.011706176702255421 * fTemp32)) + (0.035118530106766375 * fTemp35)) + (0.035118530106766334 * fTemp36)) + (0.035118530106766362 * fTemp39)) + (0.035118530106766348 * fTemp40)) + (0.035118530106766375 * fTemp43)) + (0.035118530106766334 * fTemp44)) + (0.035118530106766362 * fTemp47)) + (0.035118530106766348 * fTemp48)) + (0.011706176702255417 * fTemp51)) + (0.011706176702255421 * fTemp53))))));
-			fRec5[0] = max((fRec5[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp68))))));
-			fVbargraph4 = FAUSTFLOAT(fRec5[0]);
 			output4[i] = FAUSTFLOAT(fTemp68);
 			double fTemp69 = (fConst46 * fTemp19);
 			double fTemp70 = (fRec1[0] * ((((0.022574955908289243 * ((fConst35 * fTemp9) + (fConst37 * fTemp18))) + (0.021093750000000001 * ((((fConst38 * fTemp21) + (fConst39 * fTemp22)) + (fConst42 * fTemp26)) + (fConst43 * fTemp27)))) + (fConst33 * ((((((((((((((((((fConst44 * fTemp7) + (fConst45 * fTemp16)) + fTemp69) + (fConst46 * fTemp20)) + (fConst47 * fTemp24)) + (fConst48 * fTemp25)) + (fConst49 * fTemp29)) + (fConst49 * fTemp30)) + (fConst50 * fTemp35)) + (fConst51 * fTemp36)) + (fConst52 * fTemp37)) + (fConst53 * fTemp38)) + (fConst55 * fTemp43)) + (fConst56 * fTemp44)) + (fConst57 * fTemp45)) + (fConst58 * fTemp46)) + (fConst60 * fTemp51)) + (fConst60 * fTemp52)))) + (0.02017333553791887 * ((((((((((((fConst61 * fTemp32) + (fConst62 * fTemp33)) + (fConst63 * fTemp39)) + (fConst64 * fTemp40)) + (fConst65 * fTemp41)) + (fConst66 * fTemp42)) + (fConst68 * fTemp47)) + (fConst69 * fTemp48)) + (fConst70 * fTemp49)) + (fConst71 * fTemp50)) + (fConst73 * fTemp53)) + (fConst74 * fTemp54)))));
-			fRec6[0] = max((fRec6[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp70))))));
-			fVbargraph5 = FAUSTFLOAT(fRec6[0]);
 			output5[i] = FAUSTFLOAT(fTemp70);
 			double fTemp71 = ((((fTemp10 + fTemp15) + fTemp16) + fTemp17) + fTemp18);
 			double fTemp72 = (fTemp0 + fTemp5);
@@ -3276,166 +2978,70 @@ class mydsp : public dsp {
 			double fTemp75 = (((fTemp11 + fTemp12) + fTemp13) + fTemp14);
 			double fTemp76 = ((((((((fTemp60 + fTemp43) + fTemp44) + fTemp45) + fTemp46) + fTemp47) + fTemp48) + fTemp49) + fTemp50);
 			double fTemp77 = (fRec1[0] * ((((0.01261978399999881 * fTemp71) + ((0.028394513999997331 * fTemp72) + (5.236595479505967e-18 * fTemp28))) + (0.032806508796871948 * fTemp73)) - (((0.014197256999998666 * fTemp74) + (0.025239567999997631 * fTemp75)) + (0.01640325439843596 * fTemp76))));
-			fRec7[0] = max((fRec7[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp77))))));
-			fVbargraph6 = FAUSTFLOAT(fRec7[0]);
 			output6[i] = FAUSTFLOAT(fTemp77);
 			double fTemp78 = (fRec1[0] * ((fConst33 * ((((((((((((((((fTemp69 + ((fConst44 * fTemp6) + (fConst45 * fTemp15))) + (fConst75 * fTemp22)) + (fConst48 * fTemp24)) + (fConst76 * fTemp27)) + (fConst77 * fTemp29)) + (fConst78 * fTemp33)) + (fConst79 * fTemp35)) + (fConst80 * fTemp36)) + (fConst81 * fTemp41)) + (fConst82 * fTemp42)) + (fConst83 * fTemp43)) + (fConst84 * fTemp44)) + (fConst85 * fTemp49)) + (fConst86 * fTemp50)) + (fConst87 * fTemp51)) + (fConst88 * fTemp54))) + (((0.022574955908289243 * ((fConst35 * fTemp8) + (fConst37 * fTemp17))) + (0.021093750000000001 * ((((fConst38 * fTemp20) + (fConst39 * fTemp21)) + (fConst42 * fTemp25)) + (fConst43 * fTemp26)))) + (0.02017333553791887 * ((((((((((((fConst61 * fTemp30) + (fConst62 * fTemp32)) + (fConst89 * fTemp37)) + (fConst90 * fTemp38)) + (fConst64 * fTemp39)) + (fConst91 * fTemp40)) + (fConst92 * fTemp45)) + (fConst93 * fTemp46)) + (fConst69 * fTemp47)) + (fConst94 * fTemp48)) + (fConst73 * fTemp52)) + (fConst74 * fTemp53))))));
-			fRec8[0] = max((fRec8[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp78))))));
-			fVbargraph7 = FAUSTFLOAT(fRec8[0]);
 			output7[i] = FAUSTFLOAT(fTemp78);
 			double fTemp79 = (fTemp2 + fTemp4);
 			double fTemp80 = (fTemp7 + fTemp9);
 			double fTemp81 = (fTemp1 + fTemp3);
 			double fTemp82 = (fRec1[0] * ((0.02017333553791887 * (((((((((((((fConst95 * fTemp31) + (fConst96 * fTemp33)) + (fConst97 * fTemp36)) + (fConst98 * fTemp37)) + (fConst99 * fTemp40)) + (fConst100 * fTemp41)) + (fConst97 * fTemp44)) + (fConst98 * fTemp45)) + (fConst99 * fTemp48)) + (fConst100 * fTemp49)) + (fConst95 * fTemp51)) + (fConst95 * fTemp52)) + (fConst96 * fTemp54))) + ((((fConst101 * fTemp79) + (0.022574955908289243 * (((((fConst102 * fTemp80) + (fConst103 * fTemp12)) + (fConst104 * fTemp14)) + (fConst102 * fTemp16)) + (fConst102 * fTemp18)))) + (0.021093750000000001 * ((((fConst105 * fTemp20) + (fConst106 * fTemp22)) + (fConst105 * fTemp25)) + (fConst106 * fTemp27)))) + (fConst22 * (((((((((((((((((((((0.04052746975506618 * fTemp81) + (0.036024417560058836 * fTemp6)) + (0.036024417560058836 * fTemp8)) + (1.5998055129555246e-17 * fTemp11)) + (3.1996110259110492e-17 * fTemp13)) + (0.036024417560058836 * fTemp15)) + (0.036024417560058836 * fTemp17)) + (9.9655853669580557e-18 * fTemp19)) + (1.9931170733916111e-17 * fTemp21)) + (9.9655853669580557e-18 * fTemp24)) + (1.9931170733916111e-17 * fTemp26)) + (5.19858676206982e-18 * fTemp32)) + (0.046824706809021746 * fTemp35)) + (0.046824706809021746 * fTemp38)) + (0.046824706809021774 * fTemp39)) + (0.046824706809021698 * fTemp42)) + (0.046824706809021746 * fTemp43)) + (0.046824706809021746 * fTemp46)) + (0.046824706809021774 * fTemp47)) + (0.046824706809021698 * fTemp50)) + (5.19858676206982e-18 * fTemp53))))));
-			fRec9[0] = max((fRec9[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp82))))));
-			fVbargraph8 = FAUSTFLOAT(fRec9[0]);
 			output8[i] = FAUSTFLOAT(fTemp82);
 			double fTemp83 = (fRec1[0] * (((((fConst110 * fTemp2) + (0.022574955908289243 * ((((fConst111 * fTemp7) + (fConst112 * fTemp13)) + (fConst113 * fTemp14)) + (fConst111 * fTemp16)))) + (0.021093750000000001 * ((((fConst114 * fTemp21) + (fConst115 * fTemp22)) + (fConst114 * fTemp26)) + (fConst115 * fTemp27)))) + (fConst109 * (((((((((((((((((((((0.081054939510132359 * fTemp4) + (0.050946219890026692 * fTemp9)) + (0.10189243978005338 * fTemp11)) + (0.1018924397800533 * fTemp12)) + (0.050946219890026692 * fTemp18)) + (0.051824122420700336 * fTemp19)) + (0.051824122420700287 * fTemp20)) + (0.051824122420700336 * fTemp24)) + (0.051824122420700287 * fTemp25)) + (0.0070590901547238332 * fTemp29)) + (0.0070590901547238332 * fTemp30)) + (0.091768172011410243 * fTemp35)) + (0.091768172011410271 * fTemp38)) + (0.063531811392514695 * fTemp40)) + (0.063531811392514792 * fTemp41)) + (0.091768172011410243 * fTemp43)) + (0.091768172011410271 * fTemp46)) + (0.063531811392514695 * fTemp48)) + (0.063531811392514792 * fTemp49)) + (0.0070590901547238332 * fTemp51)) + (0.0070590901547238332 * fTemp52)))) + (0.02017333553791887 * ((((((((((((fConst116 * fTemp32) + (fConst117 * fTemp33)) + (fConst118 * fTemp36)) + (fConst119 * fTemp37)) + (fConst120 * fTemp39)) + (fConst121 * fTemp42)) + (fConst118 * fTemp44)) + (fConst119 * fTemp45)) + (fConst120 * fTemp47)) + (fConst121 * fTemp50)) + (fConst116 * fTemp53)) + (fConst117 * fTemp54)))));
-			fRec10[0] = max((fRec10[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp83))))));
-			fVbargraph9 = FAUSTFLOAT(fRec10[0]);
 			output9[i] = FAUSTFLOAT(fTemp83);
 			double fTemp84 = (fRec1[0] * ((0.02017333553791887 * (((((((((fConst125 * fTemp41) + (((fConst126 * fTemp65) + (fConst127 * fTemp37)) + (fConst128 * fTemp38))) + (fConst129 * fTemp42)) + (fConst132 * fTemp45)) + (fConst133 * fTemp46)) + (fConst134 * fTemp49)) + (fConst135 * fTemp50)) + (fConst138 * fTemp52)) + (fConst138 * fTemp54))) + ((0.021093750000000001 * (((fConst139 * fTemp67) + (fConst142 * fTemp25)) + (fConst142 * fTemp27))) + (fConst123 * (((((((((((((((fConst21 * ((0.12956030605175081 * fTemp19) + (0.12956030605175084 * fTemp21))) + (fConst143 * fTemp24)) + (fConst144 * fTemp26)) + (fConst145 * fTemp29)) + (fConst146 * fTemp32)) + (fConst147 * fTemp35)) + (fConst148 * fTemp36)) + (fConst149 * fTemp39)) + (fConst150 * fTemp40)) + (fConst151 * fTemp43)) + (fConst152 * fTemp44)) + (fConst153 * fTemp47)) + (fConst154 * fTemp48)) + (fConst155 * fTemp51)) + (fConst156 * fTemp53))))));
-			fRec11[0] = max((fRec11[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp84))))));
-			fVbargraph10 = FAUSTFLOAT(fRec11[0]);
 			output10[i] = FAUSTFLOAT(fTemp84);
 			double fTemp85 = (fRec1[0] * (((((fConst160 * fTemp4) + (0.022574955908289243 * ((((fConst162 * fTemp9) + (fConst163 * fTemp13)) + (fConst164 * fTemp14)) + (fConst166 * fTemp18)))) + (0.021093750000000001 * ((((fConst167 * fTemp21) + (fConst168 * fTemp22)) + (fConst171 * fTemp26)) + (fConst172 * fTemp27)))) + (fConst157 * (((((((((((((((((((((fConst173 * fTemp7) + (fConst174 * fTemp2)) + (fConst175 * fTemp11)) + (fConst176 * fTemp12)) + (fConst177 * fTemp16)) + (fConst178 * fTemp19)) + (fConst179 * fTemp20)) + (fConst180 * fTemp24)) + (fConst181 * fTemp25)) + (fConst182 * fTemp29)) + (fConst182 * fTemp30)) + (fConst184 * fTemp35)) + (fConst185 * fTemp36)) + (fConst186 * fTemp37)) + (fConst187 * fTemp38)) + (fConst189 * fTemp43)) + (fConst190 * fTemp44)) + (fConst191 * fTemp45)) + (fConst192 * fTemp46)) + (fConst194 * fTemp51)) + (fConst194 * fTemp52)))) + (0.02017333553791887 * ((((((((((((fConst195 * fTemp32) + (fConst196 * fTemp33)) + (fConst198 * fTemp39)) + (fConst199 * fTemp40)) + (fConst200 * fTemp41)) + (fConst201 * fTemp42)) + (fConst203 * fTemp47)) + (fConst204 * fTemp48)) + (fConst205 * fTemp49)) + (fConst206 * fTemp50)) + (fConst208 * fTemp53)) + (fConst209 * fTemp54)))));
-			fRec12[0] = max((fRec12[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp85))))));
-			fVbargraph11 = FAUSTFLOAT(fRec12[0]);
 			output11[i] = FAUSTFLOAT(fTemp85);
 			double fTemp86 = (fRec1[0] * (((0.033596842045264641 * fTemp57) + (0.026333598483989317 * fTemp62)) - (((0.010558468816293317 * fTemp58) + (0.021480823570105497 * fTemp59)) + (0.020481687709769415 * fTemp61))));
-			fRec13[0] = max((fRec13[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp86))))));
-			fVbargraph12 = FAUSTFLOAT(fRec13[0]);
 			output12[i] = FAUSTFLOAT(fTemp86);
 			double fTemp87 = (fRec1[0] * ((fConst157 * (((((((((((((((((((((fConst173 * fTemp6) + (fConst174 * fTemp1)) + (fConst176 * fTemp11)) + (fConst210 * fTemp14)) + (fConst177 * fTemp15)) + (fConst179 * fTemp19)) + (fConst211 * fTemp22)) + (fConst181 * fTemp24)) + (fConst212 * fTemp27)) + (fConst213 * fTemp29)) + (fConst214 * fTemp33)) + (fConst215 * fTemp35)) + (fConst216 * fTemp36)) + (fConst217 * fTemp41)) + (fConst218 * fTemp42)) + (fConst219 * fTemp43)) + (fConst220 * fTemp44)) + (fConst221 * fTemp49)) + (fConst222 * fTemp50)) + (fConst223 * fTemp51)) + (fConst224 * fTemp54))) + ((((fConst160 * fTemp3) + (0.022574955908289243 * ((((fConst162 * fTemp8) + (fConst163 * fTemp12)) + (fConst164 * fTemp13)) + (fConst166 * fTemp17)))) + (0.021093750000000001 * ((((fConst167 * fTemp20) + (fConst168 * fTemp21)) + (fConst171 * fTemp25)) + (fConst172 * fTemp26)))) + (0.02017333553791887 * ((((((((((((fConst195 * fTemp30) + (fConst196 * fTemp32)) + (fConst225 * fTemp37)) + (fConst226 * fTemp38)) + (fConst199 * fTemp39)) + (fConst227 * fTemp40)) + (fConst228 * fTemp45)) + (fConst229 * fTemp46)) + (fConst204 * fTemp47)) + (fConst230 * fTemp48)) + (fConst208 * fTemp52)) + (fConst209 * fTemp53))))));
-			fRec14[0] = max((fRec14[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp87))))));
-			fVbargraph13 = FAUSTFLOAT(fRec14[0]);
 			output13[i] = FAUSTFLOAT(fTemp87);
 			double fTemp88 = (fTemp6 + fTemp8);
 			double fTemp89 = (fRec1[0] * ((0.02017333553791887 * (((((((((((((fConst231 * fTemp31) + (fConst232 * fTemp33)) + (fConst233 * fTemp36)) + (fConst234 * fTemp37)) + (fConst235 * fTemp40)) + (fConst236 * fTemp41)) + (fConst237 * fTemp44)) + (fConst237 * fTemp45)) + (fConst238 * fTemp48)) + (fConst239 * fTemp49)) + (fConst240 * fTemp51)) + (fConst240 * fTemp52)) + (fConst241 * fTemp54))) + (((0.022574955908289243 * (((fConst242 * fTemp80) + (fConst244 * fTemp16)) + (fConst244 * fTemp18))) + (0.021093750000000001 * ((((fConst245 * fTemp20) + (fConst246 * fTemp22)) + (fConst247 * fTemp25)) + (fConst248 * fTemp27)))) + (fConst123 * (((((((((((((((((fConst249 * fTemp88) + (fConst250 * fTemp15)) + (fConst250 * fTemp17)) + (fConst251 * fTemp19)) + (fConst252 * fTemp21)) + (fConst253 * fTemp24)) + (fConst254 * fTemp26)) + (fConst255 * fTemp32)) + (fConst256 * fTemp35)) + (fConst256 * fTemp38)) + (fConst257 * fTemp39)) + (fConst258 * fTemp42)) + (fConst259 * fTemp43)) + (fConst259 * fTemp46)) + (fConst260 * fTemp47)) + (fConst261 * fTemp50)) + (fConst262 * fTemp53))))));
-			fRec15[0] = max((fRec15[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp89))))));
-			fVbargraph14 = FAUSTFLOAT(fRec15[0]);
 			output14[i] = FAUSTFLOAT(fTemp89);
 			double fTemp90 = (fRec1[0] * ((0.02017333553791887 * ((((((((((((fConst263 * fTemp29) + (fConst264 * fTemp33)) + (fConst265 * fTemp36)) + (fConst266 * fTemp38)) + (fConst267 * fTemp39)) + (fConst268 * fTemp41)) + (fConst265 * fTemp44)) + (fConst266 * fTemp46)) + (fConst267 * fTemp47)) + (fConst268 * fTemp49)) + (fConst263 * fTemp51)) + (fConst264 * fTemp54))) + ((((fConst110 * fTemp3) + (0.022574955908289243 * ((((fConst111 * fTemp8) + (fConst269 * fTemp11)) + (fConst270 * fTemp14)) + (fConst111 * fTemp17)))) + (0.021093750000000001 * ((((fConst271 * fTemp19) + (fConst272 * fTemp22)) + (fConst271 * fTemp24)) + (fConst272 * fTemp27)))) + (fConst109 * (((((((((((((((((((((0.081054939510132359 * fTemp1) + (0.050946219890026692 * fTemp6)) + (0.10189243978005338 * fTemp12)) + (0.10189243978005329 * fTemp13)) + (0.050946219890026692 * fTemp15)) + (0.051824122420700336 * fTemp20)) + (0.051824122420700267 * fTemp21)) + (0.051824122420700336 * fTemp25)) + (0.051824122420700267 * fTemp26)) + (0.0070590901547238384 * fTemp30)) + (0.0070590901547238306 * fTemp32)) + (0.063531811392514598 * fTemp35)) + (0.09176817201141016 * fTemp37)) + (0.091768172011410187 * fTemp40)) + (0.063531811392514445 * fTemp42)) + (0.063531811392514598 * fTemp43)) + (0.09176817201141016 * fTemp45)) + (0.091768172011410187 * fTemp48)) + (0.063531811392514445 * fTemp50)) + (0.0070590901547238384 * fTemp52)) + (0.0070590901547238306 * fTemp53))))));
-			fRec16[0] = max((fRec16[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp90))))));
-			fVbargraph15 = FAUSTFLOAT(fRec16[0]);
 			output15[i] = FAUSTFLOAT(fTemp90);
 			double fTemp91 = (fRec1[0] * ((0.02017333553791887 * ((((((((((fConst276 * fTemp29) + (fConst277 * fTemp36)) + (fConst278 * fTemp38)) + (fConst279 * fTemp40)) + (fConst280 * fTemp42)) + (fConst277 * fTemp44)) + (fConst278 * fTemp46)) + (fConst279 * fTemp48)) + (fConst280 * fTemp50)) + (fConst276 * fTemp51))) + (fConst275 * ((((((((((((((((((((((((((1.3574799921485692e-16 * fTemp11) + (1.3574799921485695e-16 * fTemp12)) + (2.7149599842971385e-16 * fTemp13)) + (2.714959984297139e-16 * fTemp14)) + (5.6373863931755746e-17 * fTemp19)) + (5.6373863931755758e-17 * fTemp20)) + (1.1274772786351149e-16 * fTemp21)) + (1.1274772786351152e-16 * fTemp22)) + (5.6373863931755746e-17 * fTemp24)) + (5.6373863931755758e-17 * fTemp25)) + (1.1274772786351149e-16 * fTemp26)) + (1.1274772786351152e-16 * fTemp27)) + (4.0101337658685596e-18 * fTemp30)) + (8.0202675317371177e-18 * fTemp32)) + (8.0202675317371192e-18 * fTemp33)) + (0.20432599334845877 * fTemp35)) + (0.20432599334845869 * fTemp37)) + (0.20432599334845877 * fTemp39)) + (0.20432599334845863 * fTemp41)) + (0.20432599334845877 * fTemp43)) + (0.20432599334845869 * fTemp45)) + (0.20432599334845877 * fTemp47)) + (0.20432599334845863 * fTemp49)) + (4.0101337658685596e-18 * fTemp52)) + (8.0202675317371177e-18 * fTemp53)) + (8.0202675317371192e-18 * fTemp54)))));
-			fRec17[0] = max((fRec17[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp91))))));
-			fVbargraph16 = FAUSTFLOAT(fRec17[0]);
 			output16[i] = FAUSTFLOAT(fTemp91);
 			double fTemp92 = (fRec1[0] * ((((0.022574955908289243 * ((fConst284 * fTemp7) + (fConst286 * fTemp16))) + (0.021093750000000001 * ((((fConst287 * fTemp21) + (fConst288 * fTemp22)) + (fConst291 * fTemp26)) + (fConst292 * fTemp27)))) + (fConst282 * ((((((((((((((((((fConst293 * fTemp9) + (fConst294 * fTemp18)) + (fConst295 * fTemp19)) + (fConst296 * fTemp20)) + (fConst297 * fTemp24)) + (fConst298 * fTemp25)) + (fConst299 * fTemp29)) + (fConst299 * fTemp30)) + (fConst300 * fTemp35)) + (fConst301 * fTemp38)) + (fConst302 * fTemp40)) + (fConst303 * fTemp41)) + (fConst305 * fTemp43)) + (fConst306 * fTemp46)) + (fConst307 * fTemp48)) + (fConst308 * fTemp49)) + (fConst310 * fTemp51)) + (fConst310 * fTemp52)))) + (0.02017333553791887 * ((((((((((((fConst311 * fTemp32) + (fConst312 * fTemp33)) + (fConst313 * fTemp36)) + (fConst314 * fTemp37)) + (fConst315 * fTemp39)) + (fConst316 * fTemp42)) + (fConst318 * fTemp44)) + (fConst319 * fTemp45)) + (fConst320 * fTemp47)) + (fConst321 * fTemp50)) + (fConst323 * fTemp53)) + (fConst324 * fTemp54)))));
-			fRec18[0] = max((fRec18[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp92))))));
-			fVbargraph17 = FAUSTFLOAT(fRec18[0]);
 			output17[i] = FAUSTFLOAT(fTemp92);
 			double fTemp93 = (fRec1[0] * ((0.02017333553791887 * (((((((((((fConst327 * fTemp65) + (fConst330 * fTemp37)) + (fConst331 * fTemp38)) + (fConst332 * fTemp41)) + (fConst333 * fTemp42)) + (fConst336 * fTemp45)) + (fConst337 * fTemp46)) + (fConst338 * fTemp49)) + (fConst339 * fTemp50)) + (fConst342 * fTemp52)) + (fConst342 * fTemp54))) + (((fConst346 * fTemp66) + (0.021093750000000001 * (((fConst347 * fTemp67) + (fConst350 * fTemp25)) + (fConst350 * fTemp27)))) + (fConst325 * (((((((((((((((((fConst343 * ((0.015962904407738641 * fTemp11) + (0.015962904407738645 * fTemp13))) + (fConst351 * fTemp19)) + (fConst352 * fTemp21)) + (fConst353 * fTemp24)) + (fConst354 * fTemp26)) + (fConst355 * fTemp29)) + (fConst356 * fTemp32)) + (fConst357 * fTemp35)) + (fConst358 * fTemp36)) + (fConst359 * fTemp39)) + (fConst360 * fTemp40)) + (fConst361 * fTemp43)) + (fConst362 * fTemp44)) + (fConst363 * fTemp47)) + (fConst364 * fTemp48)) + (fConst365 * fTemp51)) + (fConst366 * fTemp53))))));
-			fRec19[0] = max((fRec19[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp93))))));
-			fVbargraph18 = FAUSTFLOAT(fRec19[0]);
 			output18[i] = FAUSTFLOAT(fTemp93);
 			double fTemp94 = (fRec1[0] * ((((0.022574955908289243 * ((fConst369 * fTemp9) + (fConst371 * fTemp18))) + (0.021093750000000001 * ((((fConst374 * fTemp21) + (fConst375 * fTemp22)) + (fConst378 * fTemp26)) + (fConst379 * fTemp27)))) + (fConst367 * ((((((((((((((((((fConst380 * fTemp7) + (fConst381 * fTemp16)) + (fConst382 * fTemp19)) + (fConst383 * fTemp20)) + (fConst384 * fTemp24)) + (fConst385 * fTemp25)) + (fConst386 * fTemp29)) + (fConst386 * fTemp30)) + (fConst388 * fTemp35)) + (fConst389 * fTemp36)) + (fConst390 * fTemp37)) + (fConst391 * fTemp38)) + (fConst393 * fTemp43)) + (fConst394 * fTemp44)) + (fConst395 * fTemp45)) + (fConst396 * fTemp46)) + (fConst398 * fTemp51)) + (fConst398 * fTemp52)))) + (0.02017333553791887 * ((((((((fConst400 * fTemp42) + (((((fConst401 * fTemp32) + (fConst402 * fTemp33)) + (fConst403 * fTemp39)) + (fConst404 * fTemp40)) + (fConst405 * fTemp41))) + (fConst407 * fTemp47)) + (fConst408 * fTemp48)) + (fConst409 * fTemp49)) + (fConst410 * fTemp50)) + (fConst412 * fTemp53)) + (fConst413 * fTemp54)))));
-			fRec20[0] = max((fRec20[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp94))))));
-			fVbargraph19 = FAUSTFLOAT(fRec20[0]);
 			output19[i] = FAUSTFLOAT(fTemp94);
 			double fTemp95 = (fRec1[0] * ((((((0.014285714285714285 * fTemp74) + (0.038095238095238099 * fTemp72)) + (0.025396825396825397 * fTemp75)) + (0.0042514054232804339 * fTemp76)) + (0.0142547123015874 * fTemp73)) - ((0.027513227513227514 * fTemp71) + (0.024609375000000006 * fTemp28))));
-			fRec21[0] = max((fRec21[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp95))))));
-			fVbargraph20 = FAUSTFLOAT(fRec21[0]);
 			output20[i] = FAUSTFLOAT(fTemp95);
 			double fTemp96 = (fRec1[0] * ((fConst367 * ((((((((((((((((((fConst380 * fTemp6) + (fConst381 * fTemp15)) + (fConst383 * fTemp19)) + (fConst414 * fTemp22)) + (fConst385 * fTemp24)) + (fConst415 * fTemp27)) + (fConst416 * fTemp29)) + (fConst417 * fTemp33)) + (fConst389 * fTemp35)) + (fConst418 * fTemp36)) + (fConst419 * fTemp41)) + (fConst420 * fTemp42)) + (fConst394 * fTemp43)) + (fConst421 * fTemp44)) + (fConst422 * fTemp49)) + (fConst423 * fTemp50)) + (fConst424 * fTemp51)) + (fConst425 * fTemp54))) + (((0.022574955908289243 * ((fConst369 * fTemp8) + (fConst371 * fTemp17))) + (0.021093750000000001 * ((((fConst374 * fTemp20) + (fConst375 * fTemp21)) + (fConst378 * fTemp25)) + (fConst379 * fTemp26)))) + (0.02017333553791887 * ((((((((((((fConst401 * fTemp30) + (fConst402 * fTemp32)) + (fConst426 * fTemp37)) + (fConst427 * fTemp38)) + (fConst404 * fTemp39)) + (fConst428 * fTemp40)) + (fConst429 * fTemp45)) + (fConst430 * fTemp46)) + (fConst408 * fTemp47)) + (fConst431 * fTemp48)) + (fConst412 * fTemp52)) + (fConst413 * fTemp53))))));
-			fRec22[0] = max((fRec22[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp96))))));
-			fVbargraph21 = FAUSTFLOAT(fRec22[0]);
 			output21[i] = FAUSTFLOAT(fTemp96);
 			double fTemp97 = (fRec1[0] * ((0.02017333553791887 * (((((((((((((fConst432 * fTemp31) + (fConst433 * fTemp33)) + (fConst434 * fTemp36)) + (fConst434 * fTemp37)) + (fConst435 * fTemp40)) + (fConst436 * fTemp41)) + (fConst437 * fTemp44)) + (fConst437 * fTemp45)) + (fConst438 * fTemp48)) + (fConst439 * fTemp49)) + (fConst440 * fTemp51)) + (fConst440 * fTemp52)) + (fConst441 * fTemp54))) + ((((fConst442 * fTemp79) + (0.022574955908289243 * (((((fConst443 * fTemp80) + (fConst444 * fTemp12)) + (fConst445 * fTemp14)) + (fConst447 * fTemp16)) + (fConst447 * fTemp18)))) + (0.021093750000000001 * ((((fConst448 * fTemp20) + (fConst449 * fTemp22)) + (fConst450 * fTemp25)) + (fConst451 * fTemp27)))) + (fConst325 * (((((((((((((((((((((fConst452 * fTemp81) + (fConst453 * fTemp6)) + (fConst453 * fTemp8)) + (fConst454 * fTemp11)) + (fConst455 * fTemp13)) + (fConst456 * fTemp15)) + (fConst456 * fTemp17)) + (fConst457 * fTemp19)) + (fConst458 * fTemp21)) + (fConst459 * fTemp24)) + (fConst460 * fTemp26)) + (fConst461 * fTemp32)) + (fConst462 * fTemp35)) + (fConst462 * fTemp38)) + (fConst463 * fTemp39)) + (fConst464 * fTemp42)) + (fConst465 * fTemp43)) + (fConst465 * fTemp46)) + (fConst466 * fTemp47)) + (fConst467 * fTemp50)) + (fConst468 * fTemp53))))));
-			fRec23[0] = max((fRec23[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp97))))));
-			fVbargraph22 = FAUSTFLOAT(fRec23[0]);
 			output22[i] = FAUSTFLOAT(fTemp97);
 			double fTemp98 = (fRec1[0] * ((0.02017333553791887 * ((((((((((((fConst469 * fTemp29) + (fConst470 * fTemp33)) + (fConst471 * fTemp36)) + (fConst472 * fTemp38)) + (fConst473 * fTemp39)) + (fConst474 * fTemp41)) + (fConst475 * fTemp44)) + (fConst476 * fTemp46)) + (fConst477 * fTemp47)) + (fConst478 * fTemp49)) + (fConst479 * fTemp51)) + (fConst480 * fTemp54))) + (((0.022574955908289243 * ((fConst284 * fTemp8) + (fConst286 * fTemp17))) + (0.021093750000000001 * ((((fConst481 * fTemp19) + (fConst482 * fTemp22)) + (fConst483 * fTemp24)) + (fConst484 * fTemp27)))) + (fConst282 * ((((((((((((((((((fConst293 * fTemp6) + (fConst294 * fTemp15)) + (fConst295 * fTemp20)) + (fConst485 * fTemp21)) + (fConst297 * fTemp25)) + (fConst486 * fTemp26)) + (fConst487 * fTemp30)) + (fConst488 * fTemp32)) + (fConst489 * fTemp35)) + (fConst490 * fTemp37)) + (fConst491 * fTemp40)) + (fConst492 * fTemp42)) + (fConst493 * fTemp43)) + (fConst494 * fTemp45)) + (fConst495 * fTemp48)) + (fConst496 * fTemp50)) + (fConst497 * fTemp52)) + (fConst498 * fTemp53))))));
-			fRec24[0] = max((fRec24[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp98))))));
-			fVbargraph23 = FAUSTFLOAT(fRec24[0]);
 			output23[i] = FAUSTFLOAT(fTemp98);
 			double fTemp99 = (fRec1[0] * ((((0.022574955908289243 * ((((fConst499 * fTemp11) + (fConst500 * fTemp12)) + (fConst500 * fTemp13)) + (fConst500 * fTemp14))) + (0.021093750000000001 * ((((((((fConst501 * fTemp19) + (fConst502 * fTemp20)) + (fConst502 * fTemp21)) + (fConst502 * fTemp22)) + (fConst501 * fTemp24)) + (fConst502 * fTemp25)) + (fConst502 * fTemp26)) + (fConst502 * fTemp27)))) + (fConst275 * (((((((((((((((((((((((((0.16210987902026472 * fTemp74) + (0.072048835120117685 * fTemp6)) + (0.072048835120117685 * fTemp7)) + (0.072048835120117685 * fTemp8)) + (0.072048835120117685 * fTemp9)) + (0.072048835120117685 * fTemp15)) + (0.072048835120117685 * fTemp16)) + (0.072048835120117685 * fTemp17)) + (0.072048835120117685 * fTemp18)) + (0.059595081393300019 * fTemp35)) + (0.059595081393300449 * fTemp36)) + (0.059595081393300539 * fTemp37)) + (0.059595081393300019 * fTemp38)) + (0.059595081393300352 * fTemp39)) + (0.059595081393300338 * fTemp40)) + (0.059595081393300636 * fTemp41)) + (0.059595081393299554 * fTemp42)) + (0.059595081393300019 * fTemp43)) + (0.059595081393300449 * fTemp44)) + (0.059595081393300539 * fTemp45)) + (0.059595081393300019 * fTemp46)) + (0.059595081393300352 * fTemp47)) + (0.059595081393300338 * fTemp48)) + (0.059595081393300636 * fTemp49)) + (0.059595081393299554 * fTemp50)))) + (fConst503 * fTemp73)));
-			fRec25[0] = max((fRec25[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp99))))));
-			fVbargraph24 = FAUSTFLOAT(fRec25[0]);
 			output24[i] = FAUSTFLOAT(fTemp99);
 			double fTemp100 = (fRec1[0] * (((((fConst505 * fTemp4) + (0.022574955908289243 * ((((fConst506 * fTemp9) + (fConst507 * fTemp11)) + (fConst508 * fTemp12)) + (fConst506 * fTemp18)))) + (0.021093750000000001 * ((((fConst509 * fTemp19) + (fConst510 * fTemp20)) + (fConst509 * fTemp24)) + (fConst510 * fTemp25)))) + (0.02017333553791887 * (((((((((((fConst511 * fTemp31) + (fConst512 * fTemp36)) + (fConst513 * fTemp37)) + (fConst514 * fTemp39)) + (fConst515 * fTemp42)) + (fConst512 * fTemp44)) + (fConst513 * fTemp45)) + (fConst514 * fTemp47)) + (fConst515 * fTemp50)) + (fConst511 * fTemp51)) + (fConst511 * fTemp52)))) + (fConst504 * (((((((((((((((((((((0.32421975804052944 * fTemp2) + (0.10189243978005341 * fTemp7)) + (0.40756975912021298 * fTemp13)) + (0.40756975912021387 * fTemp14)) + (0.10189243978005341 * fTemp16)) + (0.13819765978853399 * fTemp21)) + (0.13819765978853429 * fTemp22)) + (0.13819765978853399 * fTemp26)) + (0.13819765978853429 * fTemp27)) + (0.0051338837488900469 * fTemp32)) + (0.0051338837488900581 * fTemp33)) + (0.40557681616231633 * fTemp35)) + (0.40557681616231639 * fTemp38)) + (0.015401651246670513 * fTemp40)) + (0.015401651246669784 * fTemp41)) + (0.40557681616231633 * fTemp43)) + (0.40557681616231639 * fTemp46)) + (0.015401651246670513 * fTemp48)) + (0.015401651246669784 * fTemp49)) + (0.0051338837488900469 * fTemp53)) + (0.0051338837488900581 * fTemp54)))));
-			fRec26[0] = max((fRec26[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp100))))));
-			fVbargraph25 = FAUSTFLOAT(fRec26[0]);
 			output25[i] = FAUSTFLOAT(fTemp100);
 			double fTemp101 = (fRec1[0] * ((0.02017333553791887 * ((((((((((fConst518 * fTemp29) + (fConst519 * fTemp36)) + (fConst520 * fTemp38)) + (fConst521 * fTemp40)) + (fConst522 * fTemp42)) + (fConst525 * fTemp44)) + (fConst526 * fTemp46)) + (fConst527 * fTemp48)) + (fConst528 * fTemp50)) + (fConst531 * fTemp51))) + (fConst516 * (((((((((((((((((((fConst274 * ((((2.9292718964632671e-16 * fTemp19) + (2.9292718964632676e-16 * fTemp20)) + (5.8585437929265342e-16 * fTemp21)) + (5.8585437929265352e-16 * fTemp22))) + (fConst533 * fTemp24)) + (fConst533 * fTemp25)) + (fConst534 * fTemp26)) + (fConst534 * fTemp27)) + (fConst535 * fTemp30)) + (fConst536 * fTemp32)) + (fConst537 * fTemp33)) + (fConst538 * fTemp35)) + (fConst539 * fTemp37)) + (fConst538 * fTemp39)) + (fConst540 * fTemp41)) + (fConst541 * fTemp43)) + (fConst542 * fTemp45)) + (fConst541 * fTemp47)) + (fConst543 * fTemp49)) + (fConst544 * fTemp52)) + (fConst545 * fTemp53)) + (fConst546 * fTemp54)))));
-			fRec27[0] = max((fRec27[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp101))))));
-			fVbargraph26 = FAUSTFLOAT(fRec27[0]);
 			output26[i] = FAUSTFLOAT(fTemp101);
 			double fTemp102 = (fRec1[0] * (((((fConst550 * fTemp2) + (0.022574955908289243 * ((((fConst552 * fTemp7) + (fConst553 * fTemp13)) + (fConst554 * fTemp14)) + (fConst556 * fTemp16)))) + (0.021093750000000001 * ((((fConst557 * fTemp21) + (fConst558 * fTemp22)) + (fConst561 * fTemp26)) + (fConst562 * fTemp27)))) + (fConst547 * (((((((((((((((((((((fConst563 * fTemp9) + (fConst564 * fTemp4)) + (fConst565 * fTemp11)) + (fConst566 * fTemp12)) + (fConst567 * fTemp18)) + (fConst568 * fTemp19)) + (fConst569 * fTemp20)) + (fConst570 * fTemp24)) + (fConst571 * fTemp25)) + (fConst572 * fTemp29)) + (fConst572 * fTemp30)) + (fConst574 * fTemp35)) + (fConst575 * fTemp38)) + (fConst576 * fTemp40)) + (fConst577 * fTemp41)) + (fConst579 * fTemp43)) + (fConst580 * fTemp46)) + (fConst581 * fTemp48)) + (fConst582 * fTemp49)) + (fConst584 * fTemp51)) + (fConst584 * fTemp52)))) + (0.02017333553791887 * ((((((((((((fConst585 * fTemp32) + (fConst586 * fTemp33)) + (fConst588 * fTemp36)) + (fConst589 * fTemp37)) + (fConst590 * fTemp39)) + (fConst591 * fTemp42)) + (fConst593 * fTemp44)) + (fConst594 * fTemp45)) + (fConst595 * fTemp47)) + (fConst596 * fTemp50)) + (fConst598 * fTemp53)) + (fConst599 * fTemp54)))));
-			fRec28[0] = max((fRec28[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp102))))));
-			fVbargraph27 = FAUSTFLOAT(fRec28[0]);
 			output27[i] = FAUSTFLOAT(fTemp102);
 			double fTemp103 = (fRec1[0] * ((0.02017333553791887 * (((((((((((fConst602 * fTemp65) + (fConst605 * fTemp37)) + (fConst606 * fTemp38)) + (fConst607 * fTemp41)) + (fConst608 * fTemp42)) + (fConst611 * fTemp45)) + (fConst612 * fTemp46)) + (fConst613 * fTemp49)) + (fConst614 * fTemp50)) + (fConst617 * fTemp52)) + (fConst617 * fTemp54))) + ((0.021093750000000001 * (((fConst618 * fTemp67) + (fConst621 * fTemp25)) + (fConst621 * fTemp27))) + (fConst600 * (((((((((((((((fConst21 * ((1.0598124096115483e-16 * fTemp19) + (1.0598124096115484e-16 * fTemp21))) + (fConst622 * fTemp24)) + (fConst623 * fTemp26)) + (fConst624 * fTemp29)) + (fConst625 * fTemp32)) + (fConst626 * fTemp35)) + (fConst627 * fTemp36)) + (fConst628 * fTemp39)) + (fConst629 * fTemp40)) + (fConst630 * fTemp43)) + (fConst631 * fTemp44)) + (fConst632 * fTemp47)) + (fConst633 * fTemp48)) + (fConst634 * fTemp51)) + (fConst635 * fTemp53))))));
-			fRec29[0] = max((fRec29[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp103))))));
-			fVbargraph28 = FAUSTFLOAT(fRec29[0]);
 			output28[i] = FAUSTFLOAT(fTemp103);
 			double fTemp104 = (fRec1[0] * (((((fConst639 * fTemp4) + (0.022574955908289243 * ((((fConst641 * fTemp9) + (fConst642 * fTemp13)) + (fConst643 * fTemp14)) + (fConst645 * fTemp18)))) + (0.021093750000000001 * ((((fConst648 * fTemp21) + (fConst649 * fTemp22)) + (fConst652 * fTemp26)) + (fConst653 * fTemp27)))) + (fConst636 * (((((((((((((((((((((fConst654 * fTemp2) + (fConst655 * fTemp7)) + (fConst656 * fTemp11)) + (fConst657 * fTemp12)) + (fConst658 * fTemp16)) + (fConst659 * fTemp19)) + (fConst660 * fTemp20)) + (fConst661 * fTemp24)) + (fConst662 * fTemp25)) + (fConst663 * fTemp29)) + (fConst663 * fTemp30)) + (fConst665 * fTemp35)) + (fConst666 * fTemp36)) + (fConst667 * fTemp37)) + (fConst668 * fTemp38)) + (fConst670 * fTemp43)) + (fConst671 * fTemp44)) + (fConst672 * fTemp45)) + (fConst673 * fTemp46)) + (fConst675 * fTemp51)) + (fConst675 * fTemp52)))) + (0.02017333553791887 * ((((((((((((fConst677 * fTemp32) + (fConst678 * fTemp33)) + (fConst680 * fTemp39)) + (fConst681 * fTemp40)) + (fConst682 * fTemp41)) + (fConst683 * fTemp42)) + (fConst685 * fTemp47)) + (fConst686 * fTemp48)) + (fConst687 * fTemp49)) + (fConst688 * fTemp50)) + (fConst690 * fTemp53)) + (fConst691 * fTemp54)))));
-			fRec30[0] = max((fRec30[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp104))))));
-			fVbargraph29 = FAUSTFLOAT(fRec30[0]);
 			output29[i] = FAUSTFLOAT(fTemp104);
 			double fTemp105 = (fRec1[0] * (((0.042115870353719366 * fTemp57) + (0.02309096671075838 * fTemp61)) - (((0.028125949882539081 * fTemp58) + (0.006731909351411762 * fTemp59)) + (0.0007502480158728946 * fTemp62))));
-			fRec31[0] = max((fRec31[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp105))))));
-			fVbargraph30 = FAUSTFLOAT(fRec31[0]);
 			output30[i] = FAUSTFLOAT(fTemp105);
 			double fTemp106 = (fRec1[0] * ((fConst636 * (((((((((((((((((((((fConst654 * fTemp1) + (fConst655 * fTemp6)) + (fConst657 * fTemp11)) + (fConst692 * fTemp14)) + (fConst658 * fTemp15)) + (fConst660 * fTemp19)) + (fConst693 * fTemp22)) + (fConst662 * fTemp24)) + (fConst694 * fTemp27)) + (fConst695 * fTemp29)) + (fConst695 * fTemp33)) + (fConst696 * fTemp35)) + (fConst697 * fTemp36)) + (fConst698 * fTemp41)) + (fConst699 * fTemp42)) + (fConst700 * fTemp43)) + (fConst701 * fTemp44)) + (fConst702 * fTemp49)) + (fConst703 * fTemp50)) + (fConst704 * fTemp51)) + (fConst705 * fTemp54))) + ((((fConst639 * fTemp3) + (0.022574955908289243 * ((((fConst641 * fTemp8) + (fConst642 * fTemp12)) + (fConst643 * fTemp13)) + (fConst645 * fTemp17)))) + (0.021093750000000001 * ((((fConst648 * fTemp20) + (fConst649 * fTemp21)) + (fConst652 * fTemp25)) + (fConst653 * fTemp26)))) + (0.02017333553791887 * ((((((((((((fConst677 * fTemp30) + (fConst678 * fTemp32)) + (fConst706 * fTemp37)) + (fConst707 * fTemp38)) + (fConst681 * fTemp39)) + (fConst708 * fTemp40)) + (fConst709 * fTemp45)) + (fConst710 * fTemp46)) + (fConst686 * fTemp47)) + (fConst711 * fTemp48)) + (fConst690 * fTemp52)) + (fConst691 * fTemp53))))));
-			fRec32[0] = max((fRec32[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp106))))));
-			fVbargraph31 = FAUSTFLOAT(fRec32[0]);
 			output31[i] = FAUSTFLOAT(fTemp106);
 			double fTemp107 = (fRec1[0] * ((0.02017333553791887 * (((((((((((((fConst712 * fTemp31) + (fConst713 * fTemp33)) + (fConst714 * fTemp36)) + (fConst715 * fTemp37)) + (fConst716 * fTemp40)) + (fConst717 * fTemp41)) + (fConst718 * fTemp44)) + (fConst719 * fTemp45)) + (fConst720 * fTemp48)) + (fConst721 * fTemp49)) + (fConst722 * fTemp51)) + (fConst722 * fTemp52)) + (fConst723 * fTemp54))) + (((0.022574955908289243 * (((fConst724 * fTemp80) + (fConst726 * fTemp16)) + (fConst726 * fTemp18))) + (0.021093750000000001 * ((((fConst727 * fTemp20) + (fConst728 * fTemp22)) + (fConst729 * fTemp25)) + (fConst730 * fTemp27)))) + (fConst600 * (((((((((((((((((fConst731 * fTemp88) + (fConst732 * fTemp15)) + (fConst732 * fTemp17)) + (fConst733 * fTemp19)) + (fConst734 * fTemp21)) + (fConst735 * fTemp24)) + (fConst736 * fTemp26)) + (fConst737 * fTemp32)) + (fConst738 * fTemp35)) + (fConst738 * fTemp38)) + (fConst739 * fTemp39)) + (fConst740 * fTemp42)) + (fConst741 * fTemp43)) + (fConst741 * fTemp46)) + (fConst742 * fTemp47)) + (fConst743 * fTemp50)) + (fConst744 * fTemp53))))));
-			fRec33[0] = max((fRec33[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp107))))));
-			fVbargraph32 = FAUSTFLOAT(fRec33[0]);
 			output32[i] = FAUSTFLOAT(fTemp107);
 			double fTemp108 = (fRec1[0] * ((0.02017333553791887 * ((((((((((((fConst745 * fTemp29) + (fConst746 * fTemp33)) + (fConst747 * fTemp36)) + (fConst748 * fTemp38)) + (fConst749 * fTemp39)) + (fConst750 * fTemp41)) + (fConst751 * fTemp44)) + (fConst752 * fTemp46)) + (fConst753 * fTemp47)) + (fConst754 * fTemp49)) + (fConst755 * fTemp51)) + (fConst756 * fTemp54))) + ((((fConst550 * fTemp3) + (0.022574955908289243 * ((((fConst552 * fTemp8) + (fConst757 * fTemp11)) + (fConst758 * fTemp14)) + (fConst556 * fTemp17)))) + (0.021093750000000001 * ((((fConst759 * fTemp19) + (fConst760 * fTemp22)) + (fConst761 * fTemp24)) + (fConst762 * fTemp27)))) + (fConst547 * (((((((((((((((((((((fConst563 * fTemp6) + (fConst564 * fTemp1)) + (fConst565 * fTemp12)) + (fConst763 * fTemp13)) + (fConst567 * fTemp15)) + (fConst568 * fTemp20)) + (fConst764 * fTemp21)) + (fConst570 * fTemp25)) + (fConst765 * fTemp26)) + (fConst766 * fTemp30)) + (fConst767 * fTemp32)) + (fConst768 * fTemp35)) + (fConst769 * fTemp37)) + (fConst770 * fTemp40)) + (fConst771 * fTemp42)) + (fConst772 * fTemp43)) + (fConst773 * fTemp45)) + (fConst774 * fTemp48)) + (fConst775 * fTemp50)) + (fConst776 * fTemp52)) + (fConst777 * fTemp53))))));
-			fRec34[0] = max((fRec34[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp108))))));
-			fVbargraph33 = FAUSTFLOAT(fRec34[0]);
 			output33[i] = FAUSTFLOAT(fTemp108);
 			double fTemp109 = (fRec1[0] * (((0.021093750000000001 * ((((((((fConst778 * fTemp19) + (fConst779 * fTemp20)) + (fConst779 * fTemp21)) + (fConst779 * fTemp22)) + (fConst781 * fTemp24)) + (fConst782 * fTemp25)) + (fConst782 * fTemp26)) + (fConst782 * fTemp27))) + (fConst516 * (((((((((((((((((((((fConst783 * fTemp10) + (fConst784 * fTemp15)) + (fConst784 * fTemp16)) + (fConst784 * fTemp17)) + (fConst784 * fTemp18)) + (fConst785 * fTemp35)) + (fConst786 * fTemp36)) + (fConst787 * fTemp37)) + (fConst785 * fTemp38)) + (fConst788 * fTemp39)) + (fConst789 * fTemp40)) + (fConst790 * fTemp41)) + (fConst791 * fTemp42)) + (fConst792 * fTemp43)) + (fConst793 * fTemp44)) + (fConst794 * fTemp45)) + (fConst792 * fTemp46)) + (fConst795 * fTemp47)) + (fConst796 * fTemp48)) + (fConst797 * fTemp49)) + (fConst798 * fTemp50)))) + (0.02017333553791887 * (((((fConst799 * fTemp34) + (fConst800 * fTemp51)) + (fConst800 * fTemp52)) + (fConst800 * fTemp53)) + (fConst800 * fTemp54)))));
-			fRec35[0] = max((fRec35[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp109))))));
-			fVbargraph34 = FAUSTFLOAT(fRec35[0]);
 			output34[i] = FAUSTFLOAT(fTemp109);
 			double fTemp110 = (fRec1[0] * ((0.02017333553791887 * ((((((((((((fConst801 * fTemp29) + (fConst802 * fTemp33)) + (fConst803 * fTemp35)) + (fConst804 * fTemp37)) + (fConst804 * fTemp40)) + (fConst805 * fTemp42)) + (fConst803 * fTemp43)) + (fConst804 * fTemp45)) + (fConst804 * fTemp48)) + (fConst805 * fTemp50)) + (fConst801 * fTemp51)) + (fConst802 * fTemp54))) + ((((fConst505 * fTemp3) + (0.022574955908289243 * ((((fConst506 * fTemp8) + (fConst806 * fTemp11)) + (fConst807 * fTemp14)) + (fConst506 * fTemp17)))) + (0.021093750000000001 * ((((fConst808 * fTemp19) + (fConst809 * fTemp22)) + (fConst808 * fTemp24)) + (fConst809 * fTemp27)))) + (fConst504 * (((((((((((((((((((((0.32421975804052944 * fTemp1) + (0.10189243978005341 * fTemp6)) + (0.4075697591202132 * fTemp12)) + (0.40756975912021387 * fTemp13)) + (0.10189243978005341 * fTemp15)) + (0.13819765978853404 * fTemp20)) + (0.13819765978853429 * fTemp21)) + (0.13819765978853404 * fTemp25)) + (0.13819765978853429 * fTemp26)) + (0.0051338837488900495 * fTemp30)) + (0.0051338837488900581 * fTemp32)) + (0.40557681616231639 * fTemp36)) + (0.015401651246671252 * fTemp38)) + (0.01540165124667044 * fTemp39)) + (0.40557681616231639 * fTemp41)) + (0.40557681616231639 * fTemp44)) + (0.015401651246671252 * fTemp46)) + (0.01540165124667044 * fTemp47)) + (0.40557681616231639 * fTemp49)) + (0.0051338837488900495 * fTemp52)) + (0.0051338837488900581 * fTemp53))))));
-			fRec36[0] = max((fRec36[1] - fConst0), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp110))))));
-			fVbargraph35 = FAUSTFLOAT(fRec36[0]);
 			output35[i] = FAUSTFLOAT(fTemp110);
 			fRec1[1] = fRec1[0];
-			fRec0[1] = fRec0[0];
-			fRec2[1] = fRec2[0];
-			fRec3[1] = fRec3[0];
-			fRec4[1] = fRec4[0];
-			fRec5[1] = fRec5[0];
-			fRec6[1] = fRec6[0];
-			fRec7[1] = fRec7[0];
-			fRec8[1] = fRec8[0];
-			fRec9[1] = fRec9[0];
-			fRec10[1] = fRec10[0];
-			fRec11[1] = fRec11[0];
-			fRec12[1] = fRec12[0];
-			fRec13[1] = fRec13[0];
-			fRec14[1] = fRec14[0];
-			fRec15[1] = fRec15[0];
-			fRec16[1] = fRec16[0];
-			fRec17[1] = fRec17[0];
-			fRec18[1] = fRec18[0];
-			fRec19[1] = fRec19[0];
-			fRec20[1] = fRec20[0];
-			fRec21[1] = fRec21[0];
-			fRec22[1] = fRec22[0];
-			fRec23[1] = fRec23[0];
-			fRec24[1] = fRec24[0];
-			fRec25[1] = fRec25[0];
-			fRec26[1] = fRec26[0];
-			fRec27[1] = fRec27[0];
-			fRec28[1] = fRec28[0];
-			fRec29[1] = fRec29[0];
-			fRec30[1] = fRec30[0];
-			fRec31[1] = fRec31[0];
-			fRec32[1] = fRec32[0];
-			fRec33[1] = fRec33[0];
-			fRec34[1] = fRec34[0];
-			fRec35[1] = fRec35[0];
-			fRec36[1] = fRec36[0];
 			
 		}
 		
@@ -3446,17 +3052,24 @@ class mydsp : public dsp {
 
 //----------------------------------------------------------------------------
 // SuperCollider/Faust interface
+// Input handling patched by patch_wrapper.py
 //----------------------------------------------------------------------------
 
 struct Faust : public Unit
 {
     // Faust dsp instance
     FAUSTCLASS*  mDSP;
-    // Buffers for control to audio rate conversion
+    // Input buffers passed to compute() when some audio inputs are not
+    // audio rate.  The mNumCopies control rate inputs listed in
+    // mCopyInputs are interpolated into copies, the others are used
+    // in place.
     float**     mInBufCopy;
     float*      mInBufValue;
-    // Controls
+    int*        mCopyInputs;
+    int         mNumCopies;
+    // Controls, the first mNumDynamicControls are not scalar rate
     size_t      mNumControls;
+    size_t      mNumDynamicControls;
     // NOTE: This needs to be the last field!
     //
     // The unit allocates additional memory according to the number
@@ -3566,15 +3179,42 @@ inline static void copyBuffer(float* dst, int n, float* src)
 }
 
 inline static void Faust_updateControls(Faust* unit)
+{
+    // Scalar rate controls are set in the constructor, the others are
+    // only updated when their input changed.
+    Control* controls = unit->mControls;
+    size_t numControls = unit->mNumDynamicControls;
+    for (size_t i = 0; i < numControls; ++i) {
+        Control* control = controls + i;
+        float value = IN0(control->input);
+        if (value != control->lastValue) {
+            control->lastValue = value;
+            control->update(value);
+        }
+    }
+}
+
+// Set every control from its input, and move the controls that are not
+// scalar rate to the front of mControls.
+static void Faust_initControls(Faust* unit)
 {
     Control* controls = unit->mControls;
     size_t numControls = unit->mNumControls;
+    size_t numDynamic = 0;
     int curControl = unit->mDSP->getNumInputs();
-    for (int i = 0; i < numControls; ++i) {
-        float value = IN0(curControl);
-        (controls++)->update(value);
-        curControl++;
+    for (size_t i = 0; i < numControls; ++i) {
+        Control* control = controls + i;
+        control->input = curControl + (int)i;
+        control->lastValue = IN0(control->input);
+        control->update(control->lastValue);
+        if (INRATE(control->input) != calc_ScalarRate) {
+            Control tmp = controls[numDynamic];
+            controls[numDynamic] = *control;
+            *control = tmp;
+            numDynamic++;
+        }
     }
+    unit->mNumDynamicControls = numDynamic;
 }
 
 void Faust_next(Faust* unit, int inNumSamples)
@@ -3589,18 +3229,13 @@ void Faust_next_copy(Faust* unit, int inNumSamples)
 {
     // update controls
     Faust_updateControls(unit);
-    // Copy buffers
-    for (int i = 0; i < unit->getNumAudioInputs(); ++i) {
-        float* b = unit->mInBufCopy[i];
-        if (INRATE(i) == calc_FullRate) {
-            // Audio rate: copy buffer
-            copyBuffer(b, inNumSamples, unit->mInBuf[i]);
-        } else {
-            // Control rate: linearly interpolate input
-            float v1 = IN0(i);
-            fillBuffer(b, inNumSamples, unit->mInBufValue[i], v1);
-            unit->mInBufValue[i] = v1;
-        }
+    // Control rate: linearly interpolate input, the audio rate buffers
+    // are used in place
+    for (int k = 0; k < unit->mNumCopies; ++k) {
+        int i = unit->mCopyInputs[k];
+        float v1 = IN0(i);
+        fillBuffer(unit->mInBufCopy[i], inNumSamples, unit->mInBufValue[k], v1);
+        unit->mInBufValue[k] = v1;
     }
     // dsp computation
     unit->mDSP->compute(inNumSamples, unit->mInBufCopy, unit->mOutBuf);
@@ -3613,6 +3248,12 @@ void Faust_next_clear(Faust* unit, int inNumSamples)
 
 void Faust_Ctor(Faust* unit)  // module constructor
 {
+    unit->mInBufCopy  = 0;
+    unit->mInBufValue = 0;
+    unit->mCopyInputs = 0;
+    unit->mNumCopies  = 0;
+    SETCALC(Faust_next_clear);
+
     // allocate dsp
     unit->mDSP = new(RTAlloc(unit->mWorld, sizeof(FAUSTCLASS))) FAUSTCLASS();
     if (!unit->mDSP) {
@@ -3622,14 +3263,12 @@ void Faust_Ctor(Faust* unit)  // module constructor
     {
         // init dsp
         unit->mDSP->instanceInit((int)SAMPLERATE);
-     
+
         // allocate controls
         unit->mNumControls = g_numControls;
         ControlAllocator ca(unit->mControls);
         unit->mDSP->buildUserInterface(&ca);
-        unit->mInBufCopy  = 0;
-        unit->mInBufValue = 0;
-     
+
         // check input/output channel configuration
         const size_t numInputs = unit->mDSP->getNumInputs() + unit->mNumControls;
         const size_t numOutputs = unit->mDSP->getNumOutputs();
@@ -3637,41 +3276,48 @@ void Faust_Ctor(Faust* unit)  // module constructor
         bool channelsValid = (numInputs == unit->mNumInputs) && (numOutputs == unit->mNumOutputs);
 
         if (channelsValid) {
-            bool rateValid = true;
-            for (int i = 0; i < unit->getNumAudioInputs(); ++i) {
+            Faust_initControls(unit);
+
+            const int numAudioInputs = unit->getNumAudioInputs();
+            int numCopies = 0;
+            for (int i = 0; i < numAudioInputs; ++i) {
                 if (INRATE(i) != calc_FullRate) {
-                    rateValid = false;
-                    break;
+                    numCopies++;
                 }
             }
-            if (rateValid) {
+            if (numCopies == 0) {
                 SETCALC(Faust_next);
             } else {
-                unit->mInBufCopy = (float**)RTAlloc(unit->mWorld, unit->getNumAudioInputs()*sizeof(float*));
-                if (!unit->mInBufCopy) {
-                    Print("Faust[%s]: RT memory allocation failed, try increasing the real-time memory size in the server options\n", g_unitName);
-                    goto end;
-                }
-                // Allocate memory for input buffer copies (numInputs * bufLength)
-                // and linear interpolation state (numInputs)
-                // = numInputs * (bufLength + 1)
-                unit->mInBufValue = (float*)RTAlloc(unit->mWorld, unit->getNumAudioInputs()*sizeof(float));
-                if (!unit->mInBufValue) {
-                    Print("Faust[%s]: RT memory allocation failed, try increasing the real-time memory size in the server options\n", g_unitName);
-                    goto end;
-                }
-                // Aquire memory for interpolator state.
-                float* mem = (float*)RTAlloc(unit->mWorld, unit->getNumAudioInputs()*BUFLENGTH*sizeof(float));
-                if (mem) {
+                // One block holds the buffer pointers of all audio inputs,
+                // then for each input that is not audio rate its
+                // interpolator state, buffer and index.
+                char* mem = (char*)RTAlloc(unit->mWorld,
+                                           numAudioInputs*sizeof(float*)
+                                           + numCopies*((BUFLENGTH + 1)*sizeof(float) + sizeof(int)));
+                if (!mem) {
                     Print("Faust[%s]: RT memory allocation failed, try increasing the real-time memory size in the server options\n", g_unitName);
                     goto end;
                 }
-                for (int i = 0; i < unit->getNumAudioInputs(); ++i) {
-                    // Initialize interpolator.
-                    unit->mInBufValue[i] = IN0(i);
-                    // Aquire buffer memory.
-                    unit->mInBufCopy[i] = mem;
-                    mem += BUFLENGTH;
+                unit->mInBufCopy  = (float**)mem;
+                unit->mInBufValue = (float*)(unit->mInBufCopy + numAudioInputs);
+                float* buffer     = unit->mInBufValue + numCopies;
+                unit->mCopyInputs = (int*)(buffer + numCopies*BUFLENGTH);
+                for (int i = 0; i < numAudioInputs; ++i) {
+                    if (INRATE(i) == calc_FullRate) {
+                        // Audio rate: use the buffer in place
+                        unit->mInBufCopy[i] = unit->mInBuf[i];
+                        continue;
+                    }
+                    unit->mInBufCopy[i] = buffer;
+                    if (INRATE(i) == calc_ScalarRate) {
+                        // Scalar rate: fill once
+                        fillBuffer(buffer, BUFLENGTH, IN0(i));
+                    } else {
+                        // Initialize interpolator.
+                        unit->mInBufValue[unit->mNumCopies] = IN0(i);
+                        unit->mCopyInputs[unit->mNumCopies++] = i;
+                    }
+                    buffer += BUFLENGTH;
                 }
                 SETCALC(Faust_next_copy);
             }
@@ -3679,9 +3325,13 @@ void Faust_Ctor(Faust* unit)  // module constructor
             Print("Faust[%s]:\n", g_unitName);
             Print("    Inputs:   %d\n"
                   "    Outputs:  %d\n"
-                  "    Callback: %s\n",
-                  numInputs, numOutputs,
-                  unit->mCalcFunc == (UnitCalcFunc)Faust_next ? "zero-copy" : "copy");
+                  "    Callback: %s\n"
+                  "    Interpolated inputs: %d of %d\n"
+                  "    Controls updated per block: %d of %d\n",
+                  (int)numInputs, (int)numOutputs,
+                  unit->mCalcFunc == (UnitCalcFunc)Faust_next ? "zero-copy" : "copy",
+                  unit->mNumCopies, numAudioInputs,
+                  (int)unit->mNumDynamicControls, (int)unit->mNumControls);
     #endif
         } else {
             Print("Faust[%s]:\n", g_unitName);
@@ -3691,10 +3341,9 @@ void Faust_Ctor(Faust* unit)  // module constructor
                   numInputs, unit->mNumInputs,
                   numOutputs, unit->mNumOutputs);
             Print("    Generating silence ...\n");
-            SETCALC(Faust_next_clear);
         }
     }
-    
+
 end:
     // Fix for https://github.com/grame-cncm/faust/issues/13
     ClearUnitOutputs(unit, 1);
@@ -3702,19 +3351,15 @@ end:
 
 void Faust_Dtor(Faust* unit)  // module destructor
 {
-    if (unit->mInBufValue) {
-        RTFree(unit->mWorld, unit->mInBufValue);
-    }
     if (unit->mInBufCopy) {
-        if (unit->mInBufCopy[0]) {
-            RTFree(unit->mWorld, unit->mInBufCopy[0]);
-        }
         RTFree(unit->mWorld, unit->mInBufCopy);
     }
-    
+
     // delete dsp
-    unit->mDSP->~FAUSTCLASS();
-    RTFree(unit->mWorld, unit->mDSP);
+    if (unit->mDSP) {
+        unit->mDSP->~FAUSTCLASS();
+        RTFree(unit->mWorld, unit->mDSP);
+    }
 }
 
 #ifdef SC_API_EXPORT
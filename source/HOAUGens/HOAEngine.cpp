@@ -0,0 +1,878 @@
+/*
+    HOAEngine - order-generic HOA transforms
+
+    Replaces the Faust generated HOAAzimuthRotator1..10, HOARotator1..4,
+    HOAConverterAcnN3d2AcnSn3d1..10, HOAMirror1..10, HOAEncoder1..5,
+    HOADecLebedev061, HOADecLebedev261..263 and HOADecLebedev501..505 with
+    one implementation per family, specialised for each order at compile
+    time, and extends HOARotator to orders 5..10.  HOAMultiEncoder1..10
+    encode any number of sources into one set of outputs.
+    The UGen names, inputs and outputs are unchanged, except for the
+    optional interpolate input of HOAAzimuthRotator.
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "SC_PlugIn.h"
+#include "HOAEngine.hpp"
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+static InterfaceTable* ft;
+
+using hoa::Layout;
+
+//////////////////////////////////////////////////////////////////////////////
+// shared helpers
+
+static void HOA_next_clear(Unit* unit, int inNumSamples)
+{
+    ClearUnitOutputs(unit, inNumSamples);
+}
+
+// The sclang classes only accept audio rate signals for an audio rate unit,
+// which lets the transforms read the input buffers directly.
+static bool HOA_checkUnit(Unit* unit, const char* name, int numSignals, int numControls, int numOutputs)
+{
+    if (unit->mNumInputs != (uint32)(numSignals + numControls) || unit->mNumOutputs != (uint32)numOutputs) {
+        Print("%s: Input/Output channel mismatch, generating silence ...\n", name);
+        return false;
+    }
+    if (unit->mCalcRate == calc_FullRate) {
+        for (int i = 0; i < numSignals; ++i) {
+            if (INRATE(i) != calc_FullRate) {
+                Print("%s: input %d is not audio rate, generating silence ...\n", name, i);
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static bool HOA_checkChannels(Unit* unit, const char* name, int numChannels, int numControls)
+{
+    return HOA_checkUnit(unit, name, numChannels, numControls, numChannels);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// HOAAzimuthRotator
+
+// With interpolate set, the rotation coefficients are ramped linearly from
+// the previous block's azimuth to the current one, so that head tracking at
+// control rate does not zip.  Otherwise they change at block boundaries,
+// like the Faust generated rotators.  SynthDefs built before the
+// interpolate input was added have one input less and always step.
+template <int Order>
+struct HOAAzimuthRotator : public Unit
+{
+    float m_azimuth;
+    float m_cos[Order + 1];
+    float m_sin[Order + 1];
+};
+
+template <int Order>
+void HOAAzimuthRotator_next(HOAAzimuthRotator<Order>* unit, int inNumSamples)
+{
+    const int numChannels = Layout<Order>::numChannels;
+    float azimuth = sc_clip(IN0(numChannels), (float)-pi, (float)pi);
+    bool interpolate = unit->mNumInputs > (uint32)(numChannels + 1) && IN0(numChannels + 1) > 0.f;
+
+    float* cosm = unit->m_cos;
+    float* sinm = unit->m_sin;
+    bool ramp = false;
+    float cosTarget[Order + 1], sinTarget[Order + 1];
+    if (azimuth != unit->m_azimuth) {
+        unit->m_azimuth = azimuth;
+        if (interpolate) {
+            hoa::azimuthLadder(cosTarget, sinTarget, azimuth, Order);
+            ramp = true;
+        } else {
+            hoa::azimuthLadder(cosm, sinm, azimuth, Order);
+        }
+    }
+
+    hoa::copyChannel(OUT(0), IN(0), inNumSamples);
+    float rampScale = 1.f / inNumSamples;
+    for (int n = 1; n <= Order; ++n) {
+        hoa::copyChannel(OUT(hoa::acn(n, 0)), IN(hoa::acn(n, 0)), inNumSamples);
+        for (int m = 1; m <= n; ++m) {
+            int neg = hoa::acn(n, -m);
+            int pos = hoa::acn(n, m);
+            if (ramp)
+                hoa::rotatePairRamp(OUT(neg), OUT(pos), IN(neg), IN(pos),
+                                    cosm[m], (cosTarget[m] - cosm[m]) * rampScale,
+                                    sinm[m], (sinTarget[m] - sinm[m]) * rampScale, inNumSamples);
+            else
+                hoa::rotatePair(OUT(neg), OUT(pos), IN(neg), IN(pos), cosm[m], sinm[m], inNumSamples);
+        }
+    }
+
+    if (ramp) {
+        for (int m = 1; m <= Order; ++m) {
+            cosm[m] = cosTarget[m];
+            sinm[m] = sinTarget[m];
+        }
+    }
+}
+
+template <int Order>
+void HOAAzimuthRotator_Ctor(HOAAzimuthRotator<Order>* unit)
+{
+    const int numChannels = Layout<Order>::numChannels;
+    // the interpolate input is optional
+    int numControls = unit->mNumInputs == (uint32)(numChannels + 2) ? 2 : 1;
+    if (!HOA_checkChannels(unit, "HOAAzimuthRotator", numChannels, numControls)) {
+        SETCALC(HOA_next_clear);
+        HOA_next_clear(unit, 1);
+        return;
+    }
+    unit->m_azimuth = sc_clip(IN0(numChannels), (float)-pi, (float)pi);
+    hoa::azimuthLadder(unit->m_cos, unit->m_sin, unit->m_azimuth, Order);
+    SETCALC(HOAAzimuthRotator_next<Order>);
+    HOAAzimuthRotator_next<Order>(unit, 1);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// HOARotator
+
+// Yaw, pitch and roll rotation of the full sound field.  The rotation matrix
+// is rebuilt only when an angle changes, and the coefficients are then
+// crossfaded from the old matrix to the new one across the block.
+template <int Order>
+struct HOARotator : public Unit
+{
+    float m_yaw, m_pitch, m_roll;
+    float m_matrix[hoa::RotationLayout<Order>::numCoefficients];
+    float m_target[hoa::RotationLayout<Order>::numCoefficients];
+};
+
+// The degree 1 block, in the yaw/pitch/roll convention of the ambitools
+// rotator (the rotation of the ACN 1..3 = y, z, x components).
+static void HOARotator_firstDegree(double r1[3][3], double yaw, double pitch, double roll)
+{
+    double cy = cos(yaw), sy = sin(yaw);
+    double cp = cos(pitch), sp = sin(pitch);
+    double cr = cos(roll), sr = sin(roll);
+
+    r1[0][0] = cy * cr - sp * sy * sr;
+    r1[0][1] = -cp * sr;
+    r1[0][2] = cy * sp * sr + sy * cr;
+    r1[1][0] = cy * sr + sp * sy * cr;
+    r1[1][1] = cp * cr;
+    r1[1][2] = sy * sr - cy * sp * cr;
+    r1[2][0] = -sy * cp;
+    r1[2][1] = sp;
+    r1[2][2] = cy * cp;
+}
+
+static hoa::RotationWeights gRotationWeights[hoa::RotationLayout<hoa::kMaxOrder>::numCoefficients];
+
+template <int Order>
+static void HOARotator_matrix(float* matrix, double yaw, double pitch, double roll)
+{
+    double r1[3][3];
+    HOARotator_firstDegree(r1, yaw, pitch, roll);
+    hoa::RotationRecurrence(r1, gRotationWeights).compute(matrix, Order);
+}
+
+template <int Order>
+void HOARotator_next(HOARotator<Order>* unit, int inNumSamples)
+{
+    const int numChannels = Layout<Order>::numChannels;
+    const int numCoefficients = hoa::RotationLayout<Order>::numCoefficients;
+    // inputs in the order of the Faust generated rotators
+    float pitch = sc_clip(IN0(numChannels), (float)-pi, (float)pi);
+    float roll = sc_clip(IN0(numChannels + 1), (float)-pi, (float)pi);
+    float yaw = sc_clip(IN0(numChannels + 2), (float)-pi, (float)pi);
+
+    const float* target = 0;
+    if (yaw != unit->m_yaw || pitch != unit->m_pitch || roll != unit->m_roll) {
+        unit->m_yaw = yaw;
+        unit->m_pitch = pitch;
+        unit->m_roll = roll;
+        HOARotator_matrix<Order>(unit->m_target, yaw, pitch, roll);
+        target = unit->m_target;
+    }
+
+    hoa::copyChannel(OUT(0), IN(0), inNumSamples);
+    for (int n = 1; n <= Order; ++n) {
+        int offset = hoa::rotationBlockOffset(n);
+        int first = hoa::acn(n, -n);
+        hoa::rotateDegree(unit->mOutBuf + first, unit->mInBuf + first, unit->m_matrix + offset,
+                          target ? target + offset : 0, 2 * n + 1, inNumSamples);
+    }
+
+    if (target)
+        memcpy(unit->m_matrix, target, numCoefficients * sizeof(float));
+}
+
+template <int Order>
+void HOARotator_Ctor(HOARotator<Order>* unit)
+{
+    const int numChannels = Layout<Order>::numChannels;
+    if (!HOA_checkChannels(unit, "HOARotator", numChannels, 3)) {
+        SETCALC(HOA_next_clear);
+        HOA_next_clear(unit, 1);
+        return;
+    }
+    unit->m_pitch = sc_clip(IN0(numChannels), (float)-pi, (float)pi);
+    unit->m_roll = sc_clip(IN0(numChannels + 1), (float)-pi, (float)pi);
+    unit->m_yaw = sc_clip(IN0(numChannels + 2), (float)-pi, (float)pi);
+    HOARotator_matrix<Order>(unit->m_matrix, unit->m_yaw, unit->m_pitch, unit->m_roll);
+    SETCALC(HOARotator_next<Order>);
+    HOARotator_next<Order>(unit, 1);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// HOAMultiEncoder
+
+// Encodes K mono sources into one set of outputs.  The inputs are the K
+// sources, followed by K gains (dB), K radii, K azimuths, K elevations and
+// the speaker radius.  Each source is encoded as a plane wave like
+// HOAEncoder in its default mode, with its level scaled by
+// speaker radius / radius; there are no near-field filters.
+//
+// The gains are smoothed per sample like in HOAEncoder.  The spherical
+// harmonics are only recomputed for the sources that moved, and are then
+// ramped across the block.
+enum {
+    kMultiEncoderGain,
+    kMultiEncoderRadius,
+    kMultiEncoderAzimuth,
+    kMultiEncoderElevation,
+    kMultiEncoderNumControls
+};
+
+template <int Order>
+struct HOAMultiEncoder : public Unit
+{
+    int m_numSources;
+    float* m_coefs;        // [channel][source]
+    float* m_targets;      // [channel][source]
+    float* m_ramp;         // [source]
+    float** m_signals;     // [source][bufLength], with the gain applied
+    float* m_azimuth;      // [source]
+    float* m_elevation;    // [source]
+    float* m_gain;         // [source], smoothing state
+};
+
+template <int Order>
+static void HOAMultiEncoder_direction(HOAMultiEncoder<Order>* unit, int source, float* coefs)
+{
+    const int numChannels = Layout<Order>::numChannels;
+    int numSources = unit->m_numSources;
+    float y[numChannels];
+    hoa::sphericalHarmonics(y, unit->m_azimuth[source], unit->m_elevation[source], Order);
+    for (int k = 0; k < numChannels; ++k)
+        coefs[k * numSources + source] = y[k];
+}
+
+template <int Order>
+static void HOAMultiEncoder_readDirection(HOAMultiEncoder<Order>* unit, int source, float* azimuth, float* elevation)
+{
+    int numSources = unit->m_numSources;
+    *azimuth = sc_clip(IN0(numSources * (1 + kMultiEncoderAzimuth) + source), (float)-pi, (float)pi);
+    *elevation = sc_clip(IN0(numSources * (1 + kMultiEncoderElevation) + source), (float)-pi2, (float)pi2);
+}
+
+template <int Order>
+void HOAMultiEncoder_next(HOAMultiEncoder<Order>* unit, int inNumSamples)
+{
+    const int numChannels = Layout<Order>::numChannels;
+    int numSources = unit->m_numSources;
+    float speakerRadius = sc_clip(IN0(numSources * (1 + kMultiEncoderNumControls)), 0.5f, 10.f);
+
+    bool moved = false;
+    for (int s = 0; s < numSources; ++s) {
+        float azimuth, elevation;
+        HOAMultiEncoder_readDirection(unit, s, &azimuth, &elevation);
+        if (azimuth != unit->m_azimuth[s] || elevation != unit->m_elevation[s]) {
+            if (!moved) {
+                memcpy(unit->m_targets, unit->m_coefs, numChannels * numSources * sizeof(float));
+                moved = true;
+            }
+            unit->m_azimuth[s] = azimuth;
+            unit->m_elevation[s] = elevation;
+            HOAMultiEncoder_direction(unit, s, unit->m_targets);
+        }
+
+        float gain = sc_clip(IN0(numSources * (1 + kMultiEncoderGain) + s), -20.f, 20.f);
+        float radius = sc_clip(IN0(numSources * (1 + kMultiEncoderRadius) + s), 0.5f, 50.f);
+        float target = 0.001f * powf(10.f, 0.05f * gain) * speakerRadius / radius;
+        float state = unit->m_gain[s];
+        const float* in = IN(s);
+        float* signal = unit->m_signals[s];
+        for (int i = 0; i < inNumSamples; ++i) {
+            state = target + 0.999f * state;
+            signal[i] = state * in[i];
+        }
+        unit->m_gain[s] = state;
+    }
+
+    const float* const* signals = unit->m_signals;
+    float* ramp = unit->m_ramp;
+    float rampScale = 1.f / inNumSamples;
+    for (int k = 0; k < numChannels; ++k) {
+        const float* coefs = unit->m_coefs + k * numSources;
+        if (moved) {
+            const float* targets = unit->m_targets + k * numSources;
+            for (int s = 0; s < numSources; ++s)
+                ramp[s] = (targets[s] - coefs[s]) * rampScale;
+            hoa::mixRow<true>(OUT(k), signals, coefs, ramp, numSources, inNumSamples);
+        } else {
+            hoa::mixRow<false>(OUT(k), signals, coefs, ramp, numSources, inNumSamples);
+        }
+    }
+
+    if (moved)
+        memcpy(unit->m_coefs, unit->m_targets, numChannels * numSources * sizeof(float));
+}
+
+template <int Order>
+void HOAMultiEncoder_Ctor(HOAMultiEncoder<Order>* unit)
+{
+    const int numChannels = Layout<Order>::numChannels;
+    unit->m_coefs = 0;
+
+    int numSources = ((int)unit->mNumInputs - 1) / (1 + kMultiEncoderNumControls);
+    if (numSources < 1 || unit->mNumInputs != (uint32)(numSources * (1 + kMultiEncoderNumControls) + 1)
+        || unit->mNumOutputs != (uint32)numChannels) {
+        Print("HOAMultiEncoder: Input/Output channel mismatch, generating silence ...\n");
+        SETCALC(HOA_next_clear);
+        HOA_next_clear(unit, 1);
+        return;
+    }
+    if (unit->mCalcRate == calc_FullRate) {
+        for (int s = 0; s < numSources; ++s) {
+            if (INRATE(s) != calc_FullRate) {
+                Print("HOAMultiEncoder: input %d is not audio rate, generating silence ...\n", s);
+                SETCALC(HOA_next_clear);
+                HOA_next_clear(unit, 1);
+                return;
+            }
+        }
+    }
+    unit->m_numSources = numSources;
+
+    // one allocation for all per-source state
+    int bufLength = BUFLENGTH;
+    size_t numFloats = 2 * numChannels * numSources + 4 * numSources + numSources * bufLength;
+    char* memory = (char*)RTAlloc(unit->mWorld, numSources * sizeof(float*) + numFloats * sizeof(float));
+    if (!memory) {
+        Print("HOAMultiEncoder: RT memory allocation failed, generating silence ...\n");
+        SETCALC(HOA_next_clear);
+        HOA_next_clear(unit, 1);
+        return;
+    }
+    unit->m_signals = (float**)memory;
+    float* floats = (float*)(memory + numSources * sizeof(float*));
+    unit->m_coefs = floats;
+    unit->m_targets = unit->m_coefs + numChannels * numSources;
+    unit->m_ramp = unit->m_targets + numChannels * numSources;
+    unit->m_azimuth = unit->m_ramp + numSources;
+    unit->m_elevation = unit->m_azimuth + numSources;
+    unit->m_gain = unit->m_elevation + numSources;
+    float* signals = unit->m_gain + numSources;
+    for (int s = 0; s < numSources; ++s) {
+        unit->m_signals[s] = signals + s * bufLength;
+        HOAMultiEncoder_readDirection(unit, s, unit->m_azimuth + s, unit->m_elevation + s);
+        HOAMultiEncoder_direction(unit, s, unit->m_coefs);
+        // the gains fade in from 0 like HOAEncoder
+        unit->m_gain[s] = 0.f;
+    }
+
+    // like the Faust wrapper, do not advance the gain smoothing here
+    SETCALC(HOAMultiEncoder_next<Order>);
+    ClearUnitOutputs(unit, 1);
+}
+
+template <int Order>
+void HOAMultiEncoder_Dtor(HOAMultiEncoder<Order>* unit)
+{
+    if (unit->m_coefs)
+        RTFree(unit->mWorld, unit->m_signals);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// HOAEncoder
+
+// One source, encoded as a plane wave or, with the spherical wave input set
+// to 1, as a point source at its radius.  The near-field filters of the
+// point source are compensated for speakers at the speaker radius, and its
+// level is scaled by speaker radius / radius; values in between mix the
+// two like the Faust generated encoders, whose inputs these are.
+//
+// Each degree goes through its near-field filter once, and the outputs of
+// the degree are the filtered signal scaled by the spherical harmonics.  For
+// a plane wave the filters are skipped once their state has decayed.
+enum {
+    kEncoderGain = 1,
+    kEncoderRadius,
+    kEncoderAzimuth,
+    kEncoderElevation,
+    kEncoderSphericalWave,
+    kEncoderSpeakerRadius,
+    kEncoderNumInputs
+};
+
+// the ambitools encoders and decoders go up to order 5
+const int kMaxEncoderOrder = 5;
+
+static hoa::NearFieldFactors gNearFieldFactors[hoa::kMaxOrder + 1];
+
+template <int Order>
+struct HOAEncoder : public Unit
+{
+    double m_sampleRate;
+    hoa::GainSmoother m_gain;
+    float m_azimuth, m_elevation;
+    float m_radius, m_speakerRadius;
+    double m_sh[Layout<Order>::numChannels];
+    hoa::NearFieldSection m_sections[hoa::NearFieldLayout<Order>::numSections];
+    hoa::NearFieldState m_states[hoa::NearFieldLayout<Order>::numSections];
+    bool m_nearField; // the filters have state to play out
+    double* m_signal; // [bufLength], the source with the gain applied
+    double* m_filtered[Order]; // [bufLength] each, the source filtered for degrees 1..Order
+};
+
+template <int Order>
+static void HOAEncoder_sections(HOAEncoder<Order>* unit)
+{
+    for (int n = 1; n <= Order; ++n)
+        hoa::nearFieldSections(unit->m_sections + hoa::nearFieldOffset(n), gNearFieldFactors[n], unit->m_sampleRate,
+                               unit->m_radius, unit->m_speakerRadius);
+}
+
+template <int Order>
+void HOAEncoder_next(HOAEncoder<Order>* unit, int inNumSamples)
+{
+    const int numStates = hoa::NearFieldLayout<Order>::numSections;
+    float gain = sc_clip(IN0(kEncoderGain), -20.f, 20.f);
+    float radius = sc_clip(IN0(kEncoderRadius), 0.5f, 50.f);
+    float azimuth = sc_clip(IN0(kEncoderAzimuth), (float)-pi, (float)pi);
+    float elevation = sc_clip(IN0(kEncoderElevation), (float)-pi2, (float)pi2);
+    // the Faust checkbox is not clipped
+    double sphericalWave = IN0(kEncoderSphericalWave);
+    float speakerRadius = sc_clip(IN0(kEncoderSpeakerRadius), 0.5f, 10.f);
+
+    if (azimuth != unit->m_azimuth || elevation != unit->m_elevation) {
+        unit->m_azimuth = azimuth;
+        unit->m_elevation = elevation;
+        hoa::sphericalHarmonics(unit->m_sh, azimuth, elevation, Order);
+    }
+    if (radius != unit->m_radius || speakerRadius != unit->m_speakerRadius) {
+        unit->m_radius = radius;
+        unit->m_speakerRadius = speakerRadius;
+        HOAEncoder_sections(unit);
+    }
+
+    double* signal = unit->m_signal;
+    const float* in = IN(0);
+    hoa::smoothGain(signal, gain, &unit->m_gain, inNumSamples);
+    for (int i = 0; i < inNumSamples; ++i)
+        signal[i] *= in[i];
+
+    double sourceGain = sphericalWave * speakerRadius / radius;
+    double direct = 1. - sphericalWave;
+    hoa::scaleSignal(OUT(0), signal, sourceGain + direct, inNumSamples);
+
+    if (sphericalWave != 0.)
+        unit->m_nearField = true;
+    if (unit->m_nearField) {
+        // the filters of all degrees run side by side
+        const double* inputs[Order];
+        const hoa::NearFieldSection* sections[Order];
+        hoa::NearFieldState* states[Order];
+        int numSections[Order];
+        for (int n = 1; n <= Order; ++n) {
+            inputs[n - 1] = signal;
+            sections[n - 1] = unit->m_sections + hoa::nearFieldOffset(n);
+            states[n - 1] = unit->m_states + hoa::nearFieldOffset(n);
+            numSections[n - 1] = (n + 1) / 2;
+        }
+        hoa::nearField(unit->m_filtered, inputs, Order, sourceGain, direct, sections, states, numSections,
+                       inNumSamples);
+    }
+    for (int n = 1; n <= Order; ++n) {
+        const double* degree = unit->m_nearField ? unit->m_filtered[n - 1] : signal;
+        for (int k = hoa::acn(n, -n); k <= hoa::acn(n, n); ++k)
+            hoa::scaleSignal(OUT(k), degree, unit->m_sh[k], inNumSamples);
+    }
+
+    if (sphericalWave == 0. && unit->m_nearField && hoa::nearFieldSettled(unit->m_states, numStates)) {
+        memset(unit->m_states, 0, sizeof(unit->m_states));
+        unit->m_nearField = false;
+    }
+}
+
+template <int Order>
+void HOAEncoder_Ctor(HOAEncoder<Order>* unit)
+{
+    unit->m_signal = 0;
+    if (!HOA_checkUnit(unit, "HOAEncoder", 1, kEncoderNumInputs - 1, Layout<Order>::numChannels)) {
+        SETCALC(HOA_next_clear);
+        HOA_next_clear(unit, 1);
+        return;
+    }
+    unit->m_signal = (double*)RTAlloc(unit->mWorld, (1 + Order) * BUFLENGTH * sizeof(double));
+    if (!unit->m_signal) {
+        Print("HOAEncoder: RT memory allocation failed, generating silence ...\n");
+        SETCALC(HOA_next_clear);
+        HOA_next_clear(unit, 1);
+        return;
+    }
+    for (int n = 1; n <= Order; ++n)
+        unit->m_filtered[n - 1] = unit->m_signal + n * BUFLENGTH;
+
+    // the Faust constants of the filters use the rate of the unit
+    unit->m_sampleRate = sc_clip(SAMPLERATE, 1., 192000.);
+    hoa::initGainSmoother(&unit->m_gain, sc_clip(IN0(kEncoderGain), -20.f, 20.f));
+    unit->m_azimuth = sc_clip(IN0(kEncoderAzimuth), (float)-pi, (float)pi);
+    unit->m_elevation = sc_clip(IN0(kEncoderElevation), (float)-pi2, (float)pi2);
+    hoa::sphericalHarmonics(unit->m_sh, unit->m_azimuth, unit->m_elevation, Order);
+    unit->m_radius = sc_clip(IN0(kEncoderRadius), 0.5f, 50.f);
+    unit->m_speakerRadius = sc_clip(IN0(kEncoderSpeakerRadius), 0.5f, 10.f);
+    HOAEncoder_sections(unit);
+    memset(unit->m_states, 0, sizeof(unit->m_states));
+    unit->m_nearField = false;
+
+    // like the Faust wrapper, do not advance the gain smoothing here
+    SETCALC(HOAEncoder_next<Order>);
+    ClearUnitOutputs(unit, 1);
+}
+
+template <int Order>
+void HOAEncoder_Dtor(HOAEncoder<Order>* unit)
+{
+    if (unit->m_signal)
+        RTFree(unit->mWorld, unit->m_signal);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// HOADecLebedev
+
+// Decodes to the speakers of a Lebedev grid (see HOAEngine.hpp) with the
+// inputs gain, outputs gain, near-field compensation and speakers radius
+// controls of the Faust generated decoders.  With the compensation set to
+// 1, each input first goes through the near-field compensation filter of
+// its degree for speakers at the speakers radius.
+//
+// The outputs gain is applied to the inputs of the decoding matrix, there
+// are fewer of them than outputs.
+enum {
+    kDecoderInputsGain,
+    kDecoderOutputsGain,
+    kDecoderCompensation,
+    kDecoderSpeakersRadius,
+    kDecoderNumControls
+};
+
+// the decoding matrices, filled at load
+template <int Order, int NumPoints>
+struct HOADecLebedevMatrix
+{
+    static float coefs[NumPoints * Layout<Order>::numChannels];
+};
+
+template <int Order, int NumPoints>
+float HOADecLebedevMatrix<Order, NumPoints>::coefs[NumPoints * Layout<Order>::numChannels];
+
+template <int Order, int NumPoints>
+struct HOADecLebedev : public Unit
+{
+    double m_sampleRate;
+    hoa::GainSmoother m_inputsGain, m_outputsGain;
+    float m_speakersRadius;
+    hoa::NearFieldSection m_sections[hoa::NearFieldLayout<Order>::numSections];
+    hoa::NearFieldState m_states[Layout<Order>::numChannels][(Order + 1) / 2];
+    bool m_nearField; // the filters have state to play out
+    double* m_inputsGains; // [bufLength]
+    double* m_outputsGains; // [bufLength]
+    double* m_signals[2 * Order + 1]; // [bufLength] each, the channels of one degree
+    double* m_filtered[2 * Order + 1]; // [bufLength] each
+    float* m_decoderInputs[Layout<Order>::numChannels]; // [bufLength] each
+};
+
+template <int Order, int NumPoints>
+static void HOADecLebedev_sections(HOADecLebedev<Order, NumPoints>* unit)
+{
+    for (int n = 1; n <= Order; ++n)
+        hoa::nearFieldSections(unit->m_sections + hoa::nearFieldOffset(n), gNearFieldFactors[n], unit->m_sampleRate,
+                               0., unit->m_speakersRadius);
+}
+
+template <int Order, int NumPoints>
+void HOADecLebedev_next(HOADecLebedev<Order, NumPoints>* unit, int inNumSamples)
+{
+    const int numChannels = Layout<Order>::numChannels;
+    float inputsGain = sc_clip(IN0(numChannels + kDecoderInputsGain), -10.f, 60.f);
+    float outputsGain = sc_clip(IN0(numChannels + kDecoderOutputsGain), -10.f, 60.f);
+    // the Faust checkbox is not clipped
+    double compensation = IN0(numChannels + kDecoderCompensation);
+    float speakersRadius = sc_clip(IN0(numChannels + kDecoderSpeakersRadius), 0.5f, 10.f);
+
+    if (speakersRadius != unit->m_speakersRadius) {
+        unit->m_speakersRadius = speakersRadius;
+        HOADecLebedev_sections(unit);
+    }
+
+    const double* inputsGains = unit->m_inputsGains;
+    const double* outputsGains = unit->m_outputsGains;
+    hoa::smoothGain(unit->m_inputsGains, inputsGain, &unit->m_inputsGain, inNumSamples);
+    hoa::smoothGain(unit->m_outputsGains, outputsGain, &unit->m_outputsGain, inNumSamples);
+
+    double sourceGain = compensation * speakersRadius;
+    double direct = 1. - compensation;
+    if (compensation != 0.)
+        unit->m_nearField = true;
+
+    for (int n = 0; n <= Order; ++n) {
+        int first = hoa::acn(n, -n);
+        int count = 2 * n + 1;
+        if (n == 0 || !unit->m_nearField) {
+            double gain = n == 0 ? sourceGain + direct : 1.;
+            for (int k = first; k < first + count; ++k) {
+                const float* in = IN(k);
+                float* decoderInput = unit->m_decoderInputs[k];
+                for (int i = 0; i < inNumSamples; ++i)
+                    decoderInput[i] = gain * (inputsGains[i] * in[i]) * outputsGains[i];
+            }
+            continue;
+        }
+
+        // the channels of a degree share the filter sections and go through them together
+        const hoa::NearFieldSection* sections[2 * Order + 1];
+        hoa::NearFieldState* states[2 * Order + 1];
+        int numSections[2 * Order + 1];
+        for (int c = 0; c < count; ++c) {
+            const float* in = IN(first + c);
+            double* signal = unit->m_signals[c];
+            for (int i = 0; i < inNumSamples; ++i)
+                signal[i] = inputsGains[i] * in[i];
+            sections[c] = unit->m_sections + hoa::nearFieldOffset(n);
+            states[c] = unit->m_states[first + c];
+            numSections[c] = (n + 1) / 2;
+        }
+        hoa::nearField(unit->m_filtered, unit->m_signals, count, sourceGain, direct, sections, states, numSections,
+                       inNumSamples);
+        for (int c = 0; c < count; ++c) {
+            const double* filtered = unit->m_filtered[c];
+            float* decoderInput = unit->m_decoderInputs[first + c];
+            for (int i = 0; i < inNumSamples; ++i)
+                decoderInput[i] = filtered[i] * outputsGains[i];
+        }
+    }
+
+    hoa::mixMatrix(unit->mOutBuf, unit->m_decoderInputs, HOADecLebedevMatrix<Order, NumPoints>::coefs, NumPoints,
+                   numChannels, inNumSamples);
+
+    if (compensation == 0. && unit->m_nearField
+        && hoa::nearFieldSettled(unit->m_states[0], numChannels * ((Order + 1) / 2))) {
+        memset(unit->m_states, 0, sizeof(unit->m_states));
+        unit->m_nearField = false;
+    }
+}
+
+template <int Order, int NumPoints>
+void HOADecLebedev_Ctor(HOADecLebedev<Order, NumPoints>* unit)
+{
+    const int numChannels = Layout<Order>::numChannels;
+    unit->m_inputsGains = 0;
+    if (!HOA_checkUnit(unit, "HOADecLebedev", numChannels, kDecoderNumControls, NumPoints)) {
+        SETCALC(HOA_next_clear);
+        HOA_next_clear(unit, 1);
+        return;
+    }
+
+    // one allocation for the gains, the filter buffers and the decoder inputs
+    int bufLength = BUFLENGTH;
+    const int numSignals = 2 * Order + 1;
+    char* memory = (char*)RTAlloc(unit->mWorld, (2 + 2 * numSignals) * bufLength * sizeof(double)
+                                      + numChannels * bufLength * sizeof(float));
+    if (!memory) {
+        Print("HOADecLebedev: RT memory allocation failed, generating silence ...\n");
+        SETCALC(HOA_next_clear);
+        HOA_next_clear(unit, 1);
+        return;
+    }
+    unit->m_inputsGains = (double*)memory;
+    unit->m_outputsGains = unit->m_inputsGains + bufLength;
+    double* signals = unit->m_outputsGains + bufLength;
+    for (int c = 0; c < numSignals; ++c) {
+        unit->m_signals[c] = signals + c * bufLength;
+        unit->m_filtered[c] = signals + (numSignals + c) * bufLength;
+    }
+    float* decoderInputs = (float*)(signals + 2 * numSignals * bufLength);
+    for (int k = 0; k < numChannels; ++k)
+        unit->m_decoderInputs[k] = decoderInputs + k * bufLength;
+
+    unit->m_sampleRate = sc_clip(SAMPLERATE, 1., 192000.);
+    hoa::initGainSmoother(&unit->m_inputsGain, sc_clip(IN0(numChannels + kDecoderInputsGain), -10.f, 60.f));
+    hoa::initGainSmoother(&unit->m_outputsGain, sc_clip(IN0(numChannels + kDecoderOutputsGain), -10.f, 60.f));
+    unit->m_speakersRadius = sc_clip(IN0(numChannels + kDecoderSpeakersRadius), 0.5f, 10.f);
+    HOADecLebedev_sections(unit);
+    memset(unit->m_states, 0, sizeof(unit->m_states));
+    unit->m_nearField = false;
+
+    // like the Faust wrapper, do not advance the gain smoothing here
+    SETCALC((HOADecLebedev_next<Order, NumPoints>));
+    ClearUnitOutputs(unit, 1);
+}
+
+template <int Order, int NumPoints>
+void HOADecLebedev_Dtor(HOADecLebedev<Order, NumPoints>* unit)
+{
+    if (unit->m_inputsGains)
+        RTFree(unit->mWorld, unit->m_inputsGains);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// HOAConverterAcnN3d2AcnSn3d
+
+template <int Order>
+void HOAConverterAcnN3d2AcnSn3d_next(Unit* unit, int inNumSamples)
+{
+    hoa::copyChannel(OUT(0), IN(0), inNumSamples);
+    for (int n = 1; n <= Order; ++n) {
+        for (int k = hoa::acn(n, -n); k <= hoa::acn(n, n); ++k)
+            hoa::scaleChannel(OUT(k), IN(k), hoa::kN3dToSn3d[n], inNumSamples);
+    }
+}
+
+template <int Order>
+void HOAConverterAcnN3d2AcnSn3d_Ctor(Unit* unit)
+{
+    if (!HOA_checkChannels(unit, "HOAConverterAcnN3d2AcnSn3d", Layout<Order>::numChannels, 0)) {
+        SETCALC(HOA_next_clear);
+        HOA_next_clear(unit, 1);
+        return;
+    }
+    SETCALC(HOAConverterAcnN3d2AcnSn3d_next<Order>);
+    HOAConverterAcnN3d2AcnSn3d_next<Order>(unit, 1);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// HOAMirror
+
+template <int Order>
+void HOAMirror_next(Unit* unit, int inNumSamples)
+{
+    const int numChannels = Layout<Order>::numChannels;
+    // the Faust checkboxes are only active for a value of exactly 1
+    bool frontBack = IN0(numChannels) == 1.f;
+    bool leftRight = IN0(numChannels + 1) == 1.f;
+    bool upDown = IN0(numChannels + 2) == 1.f;
+
+    for (int n = 0; n <= Order; ++n) {
+        for (int m = -n; m <= n; ++m) {
+            int k = hoa::acn(n, m);
+            float sign = hoa::mirrorSign(n, m, frontBack, leftRight, upDown);
+            if (sign > 0.f)
+                hoa::copyChannel(OUT(k), IN(k), inNumSamples);
+            else
+                hoa::scaleChannel(OUT(k), IN(k), -1.f, inNumSamples);
+        }
+    }
+}
+
+template <int Order>
+void HOAMirror_Ctor(Unit* unit)
+{
+    if (!HOA_checkChannels(unit, "HOAMirror", Layout<Order>::numChannels, 3)) {
+        SETCALC(HOA_next_clear);
+        HOA_next_clear(unit, 1);
+        return;
+    }
+    SETCALC(HOAMirror_next<Order>);
+    HOAMirror_next<Order>(unit, 1);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+static void HOA_defineUnit(const char* family, int order, size_t size, UnitCtorFunc ctor, UnitDtorFunc dtor = 0)
+{
+    char name[64];
+    snprintf(name, sizeof(name), "%s%d", family, order);
+    (*ft->fDefineUnit)(name, size, ctor, dtor, kUnitDef_CantAliasInputsToOutputs);
+}
+
+template <int Order>
+struct HOA_defineOrders
+{
+    static void run()
+    {
+        HOA_defineOrders<Order - 1>::run();
+        HOA_defineUnit("HOAAzimuthRotator", Order, sizeof(HOAAzimuthRotator<Order>),
+                       (UnitCtorFunc)&HOAAzimuthRotator_Ctor<Order>);
+        HOA_defineUnit("HOARotator", Order, sizeof(HOARotator<Order>), (UnitCtorFunc)&HOARotator_Ctor<Order>);
+        HOA_defineUnit("HOAMultiEncoder", Order, sizeof(HOAMultiEncoder<Order>),
+                       (UnitCtorFunc)&HOAMultiEncoder_Ctor<Order>, (UnitDtorFunc)&HOAMultiEncoder_Dtor<Order>);
+        HOA_defineUnit("HOAConverterAcnN3d2AcnSn3d", Order, sizeof(Unit),
+                       (UnitCtorFunc)&HOAConverterAcnN3d2AcnSn3d_Ctor<Order>);
+        HOA_defineUnit("HOAMirror", Order, sizeof(Unit), (UnitCtorFunc)&HOAMirror_Ctor<Order>);
+    }
+};
+
+template <>
+struct HOA_defineOrders<0>
+{
+    static void run() {}
+};
+
+template <int Order>
+struct HOA_defineEncoders
+{
+    static void run()
+    {
+        HOA_defineEncoders<Order - 1>::run();
+        HOA_defineUnit("HOAEncoder", Order, sizeof(HOAEncoder<Order>), (UnitCtorFunc)&HOAEncoder_Ctor<Order>,
+                       (UnitDtorFunc)&HOAEncoder_Dtor<Order>);
+    }
+};
+
+template <>
+struct HOA_defineEncoders<0>
+{
+    static void run() {}
+};
+
+// HOADecLebedev<NumPoints><Order>
+template <int Order, int NumPoints>
+static void HOA_defineLebedevDecoder(const char* family)
+{
+    hoa::lebedevDecoder(HOADecLebedevMatrix<Order, NumPoints>::coefs, NumPoints, Order);
+    HOA_defineUnit(family, Order, sizeof(HOADecLebedev<Order, NumPoints>),
+                   (UnitCtorFunc)&HOADecLebedev_Ctor<Order, NumPoints>,
+                   (UnitDtorFunc)&HOADecLebedev_Dtor<Order, NumPoints>);
+}
+
+PluginLoad(HOAEngine)
+{
+    ft = inTable;
+    hoa::initRotationWeights(gRotationWeights);
+    hoa::initNearFieldFactors(gNearFieldFactors);
+    HOA_defineOrders<hoa::kMaxOrder>::run();
+    HOA_defineEncoders<kMaxEncoderOrder>::run();
+    HOA_defineLebedevDecoder<1, 6>("HOADecLebedev06");
+    HOA_defineLebedevDecoder<1, 26>("HOADecLebedev26");
+    HOA_defineLebedevDecoder<2, 26>("HOADecLebedev26");
+    HOA_defineLebedevDecoder<3, 26>("HOADecLebedev26");
+    HOA_defineLebedevDecoder<1, 50>("HOADecLebedev50");
+    HOA_defineLebedevDecoder<2, 50>("HOADecLebedev50");
+    HOA_defineLebedevDecoder<3, 50>("HOADecLebedev50");
+    HOA_defineLebedevDecoder<4, 50>("HOADecLebedev50");
+    HOA_defineLebedevDecoder<5, 50>("HOADecLebedev50");
+}
@@ -0,0 +1,850 @@
+/*
+    HOAEngine - order-generic building blocks for the HOAUGens
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program; if not, see <http://www.gnu.org/licenses/>.
+*/
+
+/*
+    The generated Faust UGens spell out every channel of every order in a
+    separate, fully unrolled compute().  The transforms that only depend on
+    the spherical harmonic layout are expressed here once, as templates on
+    the ambisonic order, so that each order is still specialised at compile
+    time but shares one implementation.
+
+    Channels are in ACN order: channel n*(n+1)+m holds degree n, index m,
+    with -n <= m <= n.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <math.h>
+#include <complex>
+
+#ifdef NOVA_SIMD
+#    include "simd_memory.hpp"
+#    include "simd_binary_arithmetic.hpp"
+#endif
+
+// Input and output buffers never overlap (the units are defined with
+// kUnitDef_CantAliasInputsToOutputs), which lets the sample loops below
+// vectorize without a runtime alias check per channel pair.
+#if defined(__clang__)
+#    define HOA_NOALIAS_LOOP _Pragma("clang loop vectorize(assume_safety)")
+#elif defined(__GNUC__)
+#    define HOA_NOALIAS_LOOP _Pragma("GCC ivdep")
+#else
+#    define HOA_NOALIAS_LOOP
+#endif
+
+namespace hoa {
+
+const int kMaxOrder = 10;
+
+template <int Order>
+struct Layout
+{
+    enum {
+        order = Order,
+        numChannels = (Order + 1) * (Order + 1)
+    };
+};
+
+inline int acn(int n, int m) { return n * (n + 1) + m; }
+
+// 1 / sqrt(2n + 1), the gain of degree n from N3D to SN3D normalisation
+const float kN3dToSn3d[kMaxOrder + 1] = { 1.000000000f, 0.577350269f, 0.447213595f, 0.377964473f,
+                                          0.333333333f, 0.301511345f, 0.277350098f, 0.258198890f,
+                                          0.242535625f, 0.229415734f, 0.218217890f };
+
+// out = gain * in.  With nova-simd, blocks of a multiple of 16 samples go
+// through its kernels like in VBAP, which are vectorized at any
+// optimisation level; the loops below only are from -O3 on.
+inline void scaleChannel(float* out, const float* in, float gain, int numSamples)
+{
+#ifdef NOVA_SIMD
+    if (!(numSamples & 15)) {
+        nova::times_vec_simd(out, in, gain, numSamples);
+        return;
+    }
+#endif
+    HOA_NOALIAS_LOOP
+    for (int i = 0; i < numSamples; ++i)
+        out[i] = gain * in[i];
+}
+
+inline void copyChannel(float* out, const float* in, int numSamples)
+{
+#ifdef NOVA_SIMD
+    if (!(numSamples & 15)) {
+        nova::copyvec_simd(out, in, numSamples);
+        return;
+    }
+#endif
+    HOA_NOALIAS_LOOP
+    for (int i = 0; i < numSamples; ++i)
+        out[i] = in[i];
+}
+
+// out = gain * in, from a signal that is processed in double precision
+inline void scaleSignal(float* out, const double* in, double gain, int numSamples)
+{
+    HOA_NOALIAS_LOOP
+    for (int i = 0; i < numSamples; ++i)
+        out[i] = gain * in[i];
+}
+
+// The gain smoother of the ambitools UGens, a one pole lowpass on the
+// linear gain: g = 0.001 * 10^(dB / 20) + 0.999 * g per sample, starting
+// from g = 0.  The target is only recomputed when the gain control moves.
+struct GainSmoother
+{
+    float decibels;
+    double target; // (1 - pole) * 10^(dB / 20)
+    double state;
+};
+
+const double kGainPole = 0.999;
+
+inline void setGainTarget(GainSmoother* smoother, float decibels)
+{
+    smoother->decibels = decibels;
+    smoother->target = (1. - kGainPole) * pow(10., 0.05 * decibels);
+}
+
+inline void initGainSmoother(GainSmoother* smoother, float decibels)
+{
+    setGainTarget(smoother, decibels);
+    smoother->state = 0.;
+}
+
+// Writes the gains of the block to out.  Past the first four samples it
+// steps by four, g(i) = (1 + p + p^2 + p^3) t + p^4 g(i - 4), which keeps four
+// independent recurrences in flight instead of one.
+inline void smoothGain(double* out, float decibels, GainSmoother* smoother, int numSamples)
+{
+    if (decibels != smoother->decibels)
+        setGainTarget(smoother, decibels);
+    const double pole = kGainPole;
+    double target = smoother->target;
+    double state = smoother->state;
+    int head = numSamples < 4 ? numSamples : 4;
+    for (int i = 0; i < head; ++i) {
+        state = target + pole * state;
+        out[i] = state;
+    }
+    double pole4 = pole * pole * pole * pole;
+    double target4 = (1. + pole + pole * pole + pole * pole * pole) * target;
+    for (int i = 4; i < numSamples; ++i)
+        out[i] = target4 + pole4 * out[i - 4];
+    smoother->state = out[numSamples - 1];
+}
+
+// Rotate the (n,-m) / (n,m) pair of a degree about the z axis by m*theta,
+// with c = cos(m*theta), s = sin(m*theta).
+inline void rotatePair(float* outNeg, float* outPos, const float* inNeg, const float* inPos,
+                       float c, float s, int numSamples)
+{
+    HOA_NOALIAS_LOOP
+    for (int i = 0; i < numSamples; ++i) {
+        float neg = inNeg[i];
+        float pos = inPos[i];
+        outNeg[i] = c * neg + s * pos;
+        outPos[i] = c * pos - s * neg;
+    }
+}
+
+// rotatePair with the coefficients ramped linearly from (c0, s0) to
+// (c0 + numSamples * dc, s0 + numSamples * ds) across the block.
+inline void rotatePairRamp(float* outNeg, float* outPos, const float* inNeg, const float* inPos,
+                           float c0, float dc, float s0, float ds, int numSamples)
+{
+    HOA_NOALIAS_LOOP
+    for (int i = 0; i < numSamples; ++i) {
+        float c = c0 + (i + 1) * dc;
+        float s = s0 + (i + 1) * ds;
+        float neg = inNeg[i];
+        float pos = inPos[i];
+        outNeg[i] = c * neg + s * pos;
+        outPos[i] = c * pos - s * neg;
+    }
+}
+
+// cos(m*theta) and sin(m*theta) for m = 1..order with one cos/sin call,
+// by the Chebyshev recurrence x(m) = 2 cos(theta) x(m-1) - x(m-2).
+inline void azimuthLadder(float* cosm, float* sinm, double theta, int order)
+{
+    double c1 = cos(theta);
+    double s1 = sin(theta);
+    double twoC1 = 2. * c1;
+    double cPrev = 1., sPrev = 0.;
+    double c = c1, s = s1;
+    for (int m = 1; m <= order; ++m) {
+        cosm[m] = c;
+        sinm[m] = s;
+        double cNext = twoC1 * c - cPrev;
+        double sNext = twoC1 * s - sPrev;
+        cPrev = c;
+        sPrev = s;
+        c = cNext;
+        s = sNext;
+    }
+}
+
+// Real spherical harmonics of degrees 0..order in the direction (azimuth,
+// elevation), N3D normalised and without Condon-Shortley phase like the
+// ambitools encoders, into y[acn(n, m)].
+template <typename T>
+inline void sphericalHarmonics(T* y, double azimuth, double elevation, int order)
+{
+    double x = sin(elevation);
+    double c = cos(elevation);
+
+    // cos(m * azimuth), sin(m * azimuth)
+    double cosm[kMaxOrder + 1], sinm[kMaxOrder + 1];
+    cosm[0] = 1.;
+    sinm[0] = 0.;
+    for (int m = 1; m <= order; ++m) {
+        cosm[m] = cos(m * azimuth);
+        sinm[m] = sin(m * azimuth);
+    }
+
+    // associated Legendre functions P(n, m)(x) by the recurrence over n for each m
+    double pmm = 1.;
+    for (int m = 0; m <= order; ++m) {
+        if (m > 0)
+            pmm *= (2 * m - 1) * c;
+        double p2 = 0.;
+        double p1 = pmm;
+        for (int n = m; n <= order; ++n) {
+            double p;
+            if (n == m)
+                p = pmm;
+            else if (n == m + 1)
+                p = x * (2 * m + 1) * pmm;
+            else
+                p = ((2 * n - 1) * x * p1 - (n + m - 1) * p2) / (n - m);
+            if (n > m) {
+                p2 = p1;
+                p1 = p;
+            }
+
+            // sqrt((2n+1) (2 - delta(m)) (n-m)! / (n+m)!)
+            double ratio = 1.;
+            for (int k = n - m + 1; k <= n + m; ++k)
+                ratio /= k;
+            double norm = sqrt((2 * n + 1) * (m == 0 ? 1. : 2.) * ratio);
+
+            if (m == 0) {
+                y[acn(n, 0)] = norm * p;
+            } else {
+                y[acn(n, m)] = norm * p * cosm[m];
+                y[acn(n, -m)] = norm * p * sinm[m];
+            }
+        }
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// Rotation of the spherical harmonics
+//
+// A rotation only mixes the channels of the same degree, so the rotation
+// matrix is stored as one (2n+1) x (2n+1) block per degree n >= 1, row major
+// with rows and columns indexed by m = -n..n.  For order 10 these are 1770
+// coefficients instead of 121 x 121.
+
+template <int Order>
+struct RotationLayout
+{
+    enum {
+        // sum of (2n+1)^2 for n = 1..Order
+        numCoefficients = (Order + 1) * (2 * Order + 1) * (2 * Order + 3) / 3 - 1
+    };
+};
+
+inline int rotationBlockOffset(int n) { return n * (4 * n * n - 1) / 3 - 1; }
+
+// The weights of the U, V and W terms of the recurrence below only depend on
+// the degree and indices, not on the rotation.
+struct RotationWeights
+{
+    double u, v, w;
+};
+
+// Fills the weights for degrees 2..kMaxOrder, in the block layout above.
+inline void initRotationWeights(RotationWeights* weights)
+{
+    for (int n = 2; n <= kMaxOrder; ++n) {
+        int size = 2 * n + 1;
+        RotationWeights* block = weights + rotationBlockOffset(n);
+        for (int m = -n; m <= n; ++m) {
+            for (int k = -n; k <= n; ++k) {
+                int absm = m < 0 ? -m : m;
+                int absk = k < 0 ? -k : k;
+                double denom = absk < n ? (double)((n + k) * (n - k)) : (double)(2 * n * (2 * n - 1));
+                double delta = m == 0 ? 1. : 0.;
+                RotationWeights& weight = block[(m + n) * size + (k + n)];
+                weight.u = sqrt((n + m) * (n - m) / denom);
+                weight.v = 0.5 * sqrt((1. + delta) * (n + absm - 1) * (n + absm) / denom) * (1. - 2. * delta);
+                weight.w = -0.5 * sqrt((n - absm - 1) * (n - absm) / denom) * (1. - delta);
+            }
+        }
+    }
+}
+
+// Ivanic & Ruedenberg, "Rotation Matrices for Real Spherical Harmonics.
+// Direct Determination by Recursion", J. Phys. Chem. 100 (1996) and its
+// 1998 correction: builds the block of degree n from the block of degree
+// n-1 and the degree 1 block.
+class RotationRecurrence
+{
+public:
+    // r1[i+1][j+1] is the degree 1 block, i.e. the rotation of the
+    // (y, z, x) components.
+    RotationRecurrence(const double r1[3][3], const RotationWeights* weights):
+        mWeights(weights)
+    {
+        for (int i = 0; i < 3; ++i)
+            for (int j = 0; j < 3; ++j)
+                mR1[i][j] = r1[i][j];
+    }
+
+    // Fills the degree 1..order blocks of a rotation matrix laid out as
+    // described above.
+    void compute(float* blocks, int order)
+    {
+        mDegree = 1;
+        for (int i = 0; i < 3; ++i)
+            for (int j = 0; j < 3; ++j) {
+                mPrev[i * kMaxSize + j] = mR1[i][j];
+                blocks[i * 3 + j] = mR1[i][j];
+            }
+
+        for (int n = 2; n <= order; ++n) {
+            int size = 2 * n + 1;
+            float* block = blocks + rotationBlockOffset(n);
+            const RotationWeights* weights = mWeights + rotationBlockOffset(n);
+            for (int m = -n; m <= n; ++m) {
+                for (int k = -n; k <= n; ++k) {
+                    const RotationWeights& weight = weights[(m + n) * size + (k + n)];
+                    double value = 0.;
+                    if (weight.u != 0.)
+                        value += weight.u * U(n, m, k);
+                    if (weight.v != 0.)
+                        value += weight.v * V(n, m, k);
+                    if (weight.w != 0.)
+                        value += weight.w * W(n, m, k);
+                    mCurrent[(m + n) * kMaxSize + (k + n)] = value;
+                    block[(m + n) * size + (k + n)] = value;
+                }
+            }
+            for (int i = 0; i < size; ++i)
+                for (int j = 0; j < size; ++j)
+                    mPrev[i * kMaxSize + j] = mCurrent[i * kMaxSize + j];
+            mDegree = n;
+        }
+    }
+
+private:
+    enum { kMaxSize = 2 * kMaxOrder + 1 };
+
+    double r1(int i, int j) const { return mR1[i + 1][j + 1]; }
+    double prev(int m, int k) const { return mPrev[(m + mDegree) * kMaxSize + (k + mDegree)]; }
+
+    double P(int i, int n, int a, int b) const
+    {
+        if (b == n)
+            return r1(i, 1) * prev(a, n - 1) - r1(i, -1) * prev(a, -n + 1);
+        if (b == -n)
+            return r1(i, 1) * prev(a, -n + 1) + r1(i, -1) * prev(a, n - 1);
+        return r1(i, 0) * prev(a, b);
+    }
+
+    double U(int n, int m, int k) const { return P(0, n, m, k); }
+
+    double V(int n, int m, int k) const
+    {
+        if (m == 0)
+            return P(1, n, 1, k) + P(-1, n, -1, k);
+        if (m > 0) {
+            if (m == 1)
+                return sqrt(2.) * P(1, n, 0, k);
+            return P(1, n, m - 1, k) - P(-1, n, -m + 1, k);
+        }
+        if (m == -1)
+            return sqrt(2.) * P(-1, n, 0, k);
+        return P(1, n, m + 1, k) + P(-1, n, -m - 1, k);
+    }
+
+    double W(int n, int m, int k) const
+    {
+        if (m > 0)
+            return P(1, n, m + 1, k) + P(-1, n, -m - 1, k);
+        return P(1, n, m - 1, k) - P(-1, n, -m + 1, k);
+    }
+
+    const RotationWeights* mWeights;
+    double mR1[3][3];
+    double mPrev[kMaxSize * kMaxSize];
+    double mCurrent[kMaxSize * kMaxSize];
+    int mDegree;
+};
+
+// One row of a matrix applied to a set of signals: o = sum over the columns
+// of c * x, accumulated four columns at a time to save loads and stores of
+// the output.  With Ramp, each coefficient moves linearly by dc per sample.
+template <bool Ramp>
+inline void mixRow(float* o, const float* const* x, const float* c, const float* dc, int size, int numSamples)
+{
+    // the first one to four columns initialise the output, so that the rest come in fours
+    int col = (size - 1) % 4 + 1;
+    switch (col) {
+    case 1:
+        HOA_NOALIAS_LOOP
+        for (int i = 0; i < numSamples; ++i) {
+            float t = Ramp ? i + 1 : 0;
+            o[i] = (c[0] + t * dc[0]) * x[0][i];
+        }
+        break;
+    case 2:
+        HOA_NOALIAS_LOOP
+        for (int i = 0; i < numSamples; ++i) {
+            float t = Ramp ? i + 1 : 0;
+            o[i] = (c[0] + t * dc[0]) * x[0][i] + (c[1] + t * dc[1]) * x[1][i];
+        }
+        break;
+    case 3:
+        HOA_NOALIAS_LOOP
+        for (int i = 0; i < numSamples; ++i) {
+            float t = Ramp ? i + 1 : 0;
+            o[i] = (c[0] + t * dc[0]) * x[0][i] + (c[1] + t * dc[1]) * x[1][i] + (c[2] + t * dc[2]) * x[2][i];
+        }
+        break;
+    default:
+        HOA_NOALIAS_LOOP
+        for (int i = 0; i < numSamples; ++i) {
+            float t = Ramp ? i + 1 : 0;
+            o[i] = (c[0] + t * dc[0]) * x[0][i] + (c[1] + t * dc[1]) * x[1][i]
+                + (c[2] + t * dc[2]) * x[2][i] + (c[3] + t * dc[3]) * x[3][i];
+        }
+        break;
+    }
+    for (; col < size; col += 4) {
+        const float* x0 = x[col];
+        const float* x1 = x[col + 1];
+        const float* x2 = x[col + 2];
+        const float* x3 = x[col + 3];
+        const float* cc = c + col;
+        const float* dd = dc + col;
+        HOA_NOALIAS_LOOP
+        for (int i = 0; i < numSamples; ++i) {
+            float t = Ramp ? i + 1 : 0;
+            o[i] += (cc[0] + t * dd[0]) * x0[i] + (cc[1] + t * dd[1]) * x1[i]
+                + (cc[2] + t * dd[2]) * x2[i] + (cc[3] + t * dd[3]) * x3[i];
+        }
+    }
+}
+
+// out = matrix * in for the 2n+1 channels of degree n, with the matrix
+// coefficients ramped linearly from matrix to target across the block when
+// target is given.
+inline void rotateDegree(float** out, const float* const* in, const float* matrix, const float* target,
+                         int size, int numSamples)
+{
+    float dc[2 * kMaxOrder + 1] = { 0.f };
+    float rampScale = 1.f / numSamples;
+    for (int row = 0; row < size; ++row) {
+        const float* c = matrix + row * size;
+        if (target) {
+            for (int col = 0; col < size; ++col)
+                dc[col] = (target[row * size + col] - c[col]) * rampScale;
+            mixRow<true>(out[row], in, c, dc, size, numSamples);
+        } else {
+            mixRow<false>(out[row], in, c, dc, size, numSamples);
+        }
+    }
+}
+
+// out = matrix * in for a numRows x numColumns matrix, row major.  The block
+// is processed kMixBlockSize samples at a time, so that the inputs of a
+// slice stay in the L1 cache while every output row is accumulated from
+// them, whatever the server block size.
+const int kMixBlockSize = 64;
+const int kMaxMixColumns = (kMaxOrder + 1) * (kMaxOrder + 1);
+
+inline void mixMatrix(float* const* out, const float* const* in, const float* matrix, int numRows, int numColumns,
+                      int numSamples)
+{
+    const float* x[kMaxMixColumns];
+    float dc[kMaxMixColumns] = { 0.f };
+    for (int start = 0; start < numSamples; start += kMixBlockSize) {
+        int count = numSamples - start < kMixBlockSize ? numSamples - start : kMixBlockSize;
+        for (int col = 0; col < numColumns; ++col)
+            x[col] = in[col] + start;
+        for (int row = 0; row < numRows; ++row)
+            mixRow<false>(out[row] + start, x, matrix + row * numColumns, dc, numColumns, count);
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+
+// Sign of channel (n,m) when the sound field is mirrored along x (front-back),
+// y (left-right) or z (up-down).
+inline float mirrorSign(int n, int m, bool frontBack, bool leftRight, bool upDown)
+{
+    int absm = m < 0 ? -m : m;
+    bool flip = false;
+    if (frontBack && ((m < 0) == (absm % 2 == 0)) && m != 0)
+        flip = !flip;
+    if (leftRight && m < 0)
+        flip = !flip;
+    if (upDown && ((n + absm) % 2))
+        flip = !flip;
+    return flip ? -1.f : 1.f;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// Near-field filters
+//
+// A point source at distance r weights degree n of the sound field by the
+// reverse Bessel polynomial theta_n(q) = sum (n+k)! / ((n-k)! k! 2^k) q^k
+// of q = c / (r s).  Like the NF and NFC filters of the ambitools, theta_n
+// is factored into first and second order sections, and each section is
+// discretised by mapping 1/s to T/2 (1 + z^-1) / (1 - z^-1).  That is
+// q -> u (1 + 2A), with u = c T / (2r) and the integrator
+// A = z^-1 / (1 - z^-1), so a factor 1 + p1 q + p2 q^2 becomes
+// k (1 + a1 A + a2 A^2) with k = 1 + p1 u + p2 u^2.
+
+const double kSpeedOfSound = 340.;
+
+// 1 + p1 q + p2 q^2, with p2 = 0 for the first order factor of an odd degree
+struct NearFieldFactor
+{
+    double p1, p2;
+};
+
+struct NearFieldFactors
+{
+    int numSections;
+    NearFieldFactor sections[(kMaxOrder + 1) / 2];
+};
+
+// Sections of the degrees 1..Order, and the first section of degree n.
+template <int Order>
+struct NearFieldLayout
+{
+    enum {
+        // sum of (n+1)/2 for n = 1..Order
+        numSections = (Order + 1) * (Order + 1) / 4
+    };
+};
+
+inline int nearFieldOffset(int n) { return n * n / 4; }
+
+// Factors theta_n for the degrees 1..kMaxOrder into factors[n], from its
+// roots found by the Durand-Kerner iteration.
+inline void initNearFieldFactors(NearFieldFactors* factors)
+{
+    typedef std::complex<double> complex;
+    for (int n = 1; n <= kMaxOrder; ++n) {
+        // (n+k)! / ((n-k)! k! 2^k), integers that are exact in double
+        double coefs[kMaxOrder + 1];
+        coefs[0] = 1.;
+        for (int k = 1; k <= n; ++k)
+            coefs[k] = coefs[k - 1] * (n + k) * (n - k + 1) / (2 * k);
+
+        // start on a circle with the radius of the geometric mean of the roots
+        complex roots[kMaxOrder];
+        double radius = pow(coefs[0] / coefs[n], 1. / n);
+        double twoPi = 8. * atan(1.);
+        for (int i = 0; i < n; ++i)
+            roots[i] = std::polar(radius, twoPi * i / n + 0.4);
+        for (int iteration = 0; iteration < 500; ++iteration) {
+            for (int i = 0; i < n; ++i) {
+                complex value = coefs[n];
+                for (int k = n - 1; k >= 0; --k)
+                    value = value * roots[i] + coefs[k];
+                complex denom = coefs[n];
+                for (int j = 0; j < n; ++j)
+                    if (j != i)
+                        denom *= roots[i] - roots[j];
+                roots[i] -= value / denom;
+            }
+        }
+
+        // conjugate pairs (1 - q/z)(1 - q/conj(z)) first, then the real root
+        NearFieldFactors& factor = factors[n];
+        factor.numSections = 0;
+        for (int i = 0; i < n; ++i) {
+            complex inverse = 1. / roots[i];
+            if (roots[i].imag() > 1e-9 * std::abs(roots[i])) {
+                NearFieldFactor& section = factor.sections[factor.numSections++];
+                section.p1 = -2. * inverse.real();
+                section.p2 = std::norm(inverse);
+            }
+        }
+        // the sections are not interchangeable while the radius moves, so
+        // keep the ambitools order: the least damped pair goes first
+        for (int i = 1; i < factor.numSections; ++i)
+            for (int j = i; j > 0 && factor.sections[j].p1 < factor.sections[j - 1].p1; --j)
+                std::swap(factor.sections[j], factor.sections[j - 1]);
+        if (n % 2) {
+            for (int i = 0; i < n; ++i) {
+                if (fabs(roots[i].imag()) <= 1e-9 * std::abs(roots[i])) {
+                    NearFieldFactor& section = factor.sections[factor.numSections++];
+                    section.p1 = -1. / roots[i].real();
+                    section.p2 = 0.;
+                    break;
+                }
+            }
+        }
+    }
+}
+
+// One section in the integrator form of the ambitools filters:
+// w = gain * in - a1 s1 - a2 s2, out = w + b1 s1 + b2 s2, with s1 = A w and
+// s2 = A s1.  a1, a2 come from the speaker radius (NFC) and b1, b2 from the
+// source radius (NF), they are 0 for a plane wave.
+struct NearFieldSection
+{
+    double gain;
+    double a1, a2;
+    double b1, b2;
+};
+
+struct NearFieldState
+{
+    double w, s1, s2;
+};
+
+// Returns k, and a1, a2 of a factor at u
+inline double nearFieldFactor(const NearFieldFactor& factor, double u, double* a1, double* a2)
+{
+    double k = 1. + factor.p1 * u + factor.p2 * u * u;
+    *a1 = (2. * factor.p1 * u + 4. * factor.p2 * u * u) / k;
+    *a2 = 4. * factor.p2 * u * u / k;
+    return k;
+}
+
+// The sections of theta_n(c / (r s)) / theta_n(c / (R s)) for a source at
+// distance r played by speakers at distance R, or of the near-field
+// compensation 1 / theta_n(c / (R s)) alone for r = 0.
+inline void nearFieldSections(NearFieldSection* sections, const NearFieldFactors& factors, double sampleRate,
+                              double sourceRadius, double speakerRadius)
+{
+    double uSource = sourceRadius > 0. ? kSpeedOfSound / (2. * sampleRate * sourceRadius) : 0.;
+    double uSpeaker = kSpeedOfSound / (2. * sampleRate * speakerRadius);
+    for (int s = 0; s < factors.numSections; ++s) {
+        NearFieldSection& section = sections[s];
+        double kSpeaker = nearFieldFactor(factors.sections[s], uSpeaker, &section.a1, &section.a2);
+        double kSource = nearFieldFactor(factors.sections[s], uSource, &section.b1, &section.b2);
+        section.gain = kSource / kSpeaker;
+    }
+}
+
+// The sample loop of nearFieldStage, without the s2 terms when all the
+// sections are first order and without the b terms for the near-field
+// compensation alone.
+template <int NumChannels, bool SecondOrder, bool SourceTerms>
+inline void nearFieldLoop(double* const* out, const double* const* in, const double* g, const double* a1,
+                          const double* a2, const double* b1, const double* b2, const double* secondOrder, double* w,
+                          double* s1, double* s2, int numSamples)
+{
+    for (int i = 0; i < numSamples; ++i) {
+        for (int c = 0; c < NumChannels; ++c) {
+            if (SecondOrder)
+                s2[c] += secondOrder[c] * s1[c];
+            s1[c] += w[c];
+            double y = g[c] * in[c][i] - a1[c] * s1[c];
+            if (SecondOrder)
+                y -= a2[c] * s2[c];
+            w[c] = y;
+            if (SourceTerms) {
+                y += b1[c] * s1[c];
+                if (SecondOrder)
+                    y += b2[c] * s2[c];
+            }
+            out[c][i] = y;
+        }
+    }
+}
+
+// One section of several cascades side by side, each channel c with its
+// own section and state.  The channels are interleaved in the sample loop so
+// that their recurrences overlap instead of each one waiting on its previous
+// sample, NumChannels at a time to keep the states in registers.  A first
+// order section has a2 = b2 = 0, and its s2 is held at 0 rather than left to
+// integrate the DC component of s1.
+template <int NumChannels>
+inline void nearFieldStage(double* const* out, const double* const* in, double gain,
+                           const NearFieldSection* const* sections, NearFieldState* const* states, int numSamples)
+{
+    double g[NumChannels], a1[NumChannels], a2[NumChannels], b1[NumChannels], b2[NumChannels];
+    double secondOrder[NumChannels];
+    double w[NumChannels], s1[NumChannels], s2[NumChannels];
+    bool anySecondOrder = false;
+    bool sourceTerms = false;
+    for (int c = 0; c < NumChannels; ++c) {
+        const NearFieldSection& section = *sections[c];
+        g[c] = gain * section.gain;
+        a1[c] = section.a1;
+        a2[c] = section.a2;
+        b1[c] = section.b1;
+        b2[c] = section.b2;
+        secondOrder[c] = section.a2 != 0. ? 1. : 0.;
+        anySecondOrder = anySecondOrder || section.a2 != 0.;
+        sourceTerms = sourceTerms || section.b1 != 0. || section.b2 != 0.;
+        w[c] = states[c]->w;
+        s1[c] = states[c]->s1;
+        s2[c] = states[c]->s2;
+    }
+    if (anySecondOrder) {
+        if (sourceTerms)
+            nearFieldLoop<NumChannels, true, true>(out, in, g, a1, a2, b1, b2, secondOrder, w, s1, s2, numSamples);
+        else
+            nearFieldLoop<NumChannels, true, false>(out, in, g, a1, a2, b1, b2, secondOrder, w, s1, s2, numSamples);
+    } else {
+        if (sourceTerms)
+            nearFieldLoop<NumChannels, false, true>(out, in, g, a1, a2, b1, b2, secondOrder, w, s1, s2, numSamples);
+        else
+            nearFieldLoop<NumChannels, false, false>(out, in, g, a1, a2, b1, b2, secondOrder, w, s1, s2, numSamples);
+    }
+    for (int c = 0; c < NumChannels; ++c) {
+        states[c]->w = w[c];
+        states[c]->s1 = s1[c];
+        states[c]->s2 = s2[c];
+    }
+}
+
+const int kMaxNearFieldChannels = 2 * kMaxOrder + 1;
+
+// out[c] = gain * H(in[c]) + direct * in[c], with H the cascade of the
+// numSections[c] sections at sections[c] and their states at states[c].  The
+// channels must come in ascending number of sections, each stage runs the
+// channels that still have a section left together.  The signal stays in
+// double precision, the integrators of the sections have their poles close
+// to z = 1.
+inline void nearField(double* const* out, const double* const* in, int numChannels, double gain, double direct,
+                      const NearFieldSection* const* sections, NearFieldState* const* states, const int* numSections,
+                      int numSamples)
+{
+    const NearFieldSection* stageSections[kMaxNearFieldChannels];
+    NearFieldState* stageStates[kMaxNearFieldChannels];
+    int c = 0;
+    for (int s = 0; s < numSections[numChannels - 1]; ++s) {
+        while (numSections[c] <= s)
+            ++c;
+        for (int k = c; k < numChannels; ++k) {
+            stageSections[k] = sections[k] + s;
+            stageStates[k] = states[k] + s;
+        }
+        const double* const* x = s == 0 ? in : out;
+        double g = s == 0 ? gain : 1.;
+        int k = c;
+        for (; k + 4 <= numChannels; k += 4)
+            nearFieldStage<4>(out + k, x + k, g, stageSections + k, stageStates + k, numSamples);
+        switch (numChannels - k) {
+        case 1:
+            nearFieldStage<1>(out + k, x + k, g, stageSections + k, stageStates + k, numSamples);
+            break;
+        case 2:
+            nearFieldStage<2>(out + k, x + k, g, stageSections + k, stageStates + k, numSamples);
+            break;
+        case 3:
+            nearFieldStage<3>(out + k, x + k, g, stageSections + k, stageStates + k, numSamples);
+            break;
+        }
+    }
+    if (direct != 0.) {
+        for (int k = 0; k < numChannels; ++k) {
+            for (int i = 0; i < numSamples; ++i)
+                out[k][i] += direct * in[k][i];
+        }
+    }
+}
+
+// True when the filter state has decayed below anything audible, and it can
+// be cleared and skipped while its input is 0.
+inline bool nearFieldSettled(const NearFieldState* states, int numStates)
+{
+    for (int s = 0; s < numStates; ++s) {
+        if (fabs(states[s].w) > 1e-20 || fabs(states[s].s1) > 1e-20 || fabs(states[s].s2) > 1e-20)
+            return false;
+    }
+    return true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// Lebedev grids
+//
+// The speaker layouts of the ambitools decoders: the 50 point grid in the
+// order of the decoder outputs, its first 6 and 26 points are the smaller
+// grids.  Directions are given unnormalised, with the quadrature weight of
+// each group of points in each grid (the weights of a grid sum to 1).
+
+const int kLebedevMaxPoints = 50;
+
+static const signed char kLebedevDirections[kLebedevMaxPoints][3] = {
+    // axes
+    { 0, 0, 1 }, { 1, 0, 0 }, { 0, 1, 0 }, { -1, 0, 0 }, { 0, -1, 0 }, { 0, 0, -1 },
+    // edges
+    { 1, 0, 1 }, { 0, 1, 1 }, { -1, 0, 1 }, { 0, -1, 1 },
+    { 1, 1, 0 }, { -1, 1, 0 }, { -1, -1, 0 }, { 1, -1, 0 },
+    { 1, 0, -1 }, { 0, 1, -1 }, { -1, 0, -1 }, { 0, -1, -1 },
+    // corners
+    { 1, 1, 1 }, { -1, 1, 1 }, { -1, -1, 1 }, { 1, -1, 1 },
+    { 1, 1, -1 }, { -1, 1, -1 }, { -1, -1, -1 }, { 1, -1, -1 },
+    // (1, 1, 3) / sqrt(11)
+    { 1, 1, 3 }, { -1, 1, 3 }, { -1, -1, 3 }, { 1, -1, 3 },
+    { 3, 1, 1 }, { 1, 3, 1 }, { -1, 3, 1 }, { -3, 1, 1 }, { -3, -1, 1 }, { -1, -3, 1 }, { 1, -3, 1 }, { 3, -1, 1 },
+    { 3, 1, -1 }, { 1, 3, -1 }, { -1, 3, -1 }, { -3, 1, -1 }, { -3, -1, -1 }, { -1, -3, -1 }, { 1, -3, -1 }, { 3, -1, -1 },
+    { 1, 1, -3 }, { -1, 1, -3 }, { -1, -1, -3 }, { 1, -1, -3 }
+};
+
+// Weight of point j of the grid of numPoints points (6, 26 or 50)
+inline double lebedevWeight(int numPoints, int j)
+{
+    int group = j < 6 ? 0 : j < 18 ? 1 : j < 26 ? 2 : 3;
+    switch (numPoints) {
+    case 6:
+        return 1. / 6.;
+    case 26: {
+        static const double weights[] = { 1. / 21., 4. / 105., 9. / 280. };
+        return weights[group];
+    }
+    default: {
+        static const double weights[] = { 4. / 315., 64. / 2835., 27. / 1280., 14641. / 725760. };
+        return weights[group];
+    }
+    }
+}
+
+// The decoding matrix of a Lebedev grid, matrix[j * numChannels + acn] =
+// weight(j) * Y(acn) in the direction of point j.
+inline void lebedevDecoder(float* matrix, int numPoints, int order)
+{
+    int numChannels = (order + 1) * (order + 1);
+    double sh[(kMaxOrder + 1) * (kMaxOrder + 1)];
+    for (int j = 0; j < numPoints; ++j) {
+        double x = kLebedevDirections[j][0];
+        double y = kLebedevDirections[j][1];
+        double z = kLebedevDirections[j][2];
+        sphericalHarmonics(sh, atan2(y, x), atan2(z, sqrt(x * x + y * y)), order);
+        double weight = lebedevWeight(numPoints, j);
+        for (int k = 0; k < numChannels; ++k)
+            matrix[j * numChannels + k] = weight * sh[k];
+    }
+}
+
+} // namespace hoa
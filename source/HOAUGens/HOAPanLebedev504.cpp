@@ -5,6 +5,7 @@ license: "GPL"
 name: "HOAPanLebedev504"
 version: "1.0"
 Code generated with Faust 2.5.21 (https://faust.grame.fr)
+VU meters stripped by strip_meters.py
 Compilation options: cpp, -double -ftz 0
 ------------------------------------------------------------ */
 
@@ -535,6 +536,9 @@ struct Control
     UpdateFunction updateFunction;
     FAUSTFLOAT* zone;
     FAUSTFLOAT min, max;
+    // Unit input of the control and its value at the last update
+    int input;
+    float lastValue;
 
     inline void update(FAUSTFLOAT value)
     {
@@ -637,7 +641,6 @@ class mydsp : public dsp {
 	
 	int fSamplingFreq;
 	double fConst0;
-	double fConst1;
 	FAUSTFLOAT fHslider0;
 	FAUSTFLOAT fCheckbox0;
 	double fConst2;
@@ -707,107 +710,7 @@ class mydsp : public dsp {
 	double fRec42[2];
 	double fRec43[2];
 	double fRec38[2];
-	double fRec0[2];
-	FAUSTFLOAT fVbargraph0;
 	FAUSTFLOAT fHslider3;
-	double fRec44[2];
-	FAUSTFLOAT fVbargraph1;
-	double fRec45[2];
-	FAUSTFLOAT fVbargraph2;
-	double fRec46[2];
-	FAUSTFLOAT fVbargraph3;
-	double fRec47[2];
-	FAUSTFLOAT fVbargraph4;
-	double fRec48[2];
-	FAUSTFLOAT fVbargraph5;
-	double fRec49[2];
-	FAUSTFLOAT fVbargraph6;
-	double fRec50[2];
-	FAUSTFLOAT fVbargraph7;
-	double fRec51[2];
-	FAUSTFLOAT fVbargraph8;
-	double fRec52[2];
-	FAUSTFLOAT fVbargraph9;
-	double fRec53[2];
-	FAUSTFLOAT fVbargraph10;
-	double fRec54[2];
-	FAUSTFLOAT fVbargraph11;
-	double fRec55[2];
-	FAUSTFLOAT fVbargraph12;
-	double fRec56[2];
-	FAUSTFLOAT fVbargraph13;
-	double fRec57[2];
-	FAUSTFLOAT fVbargraph14;
-	double fRec58[2];
-	FAUSTFLOAT fVbargraph15;
-	double fRec59[2];
-	FAUSTFLOAT fVbargraph16;
-	double fRec60[2];
-	FAUSTFLOAT fVbargraph17;
-	double fRec61[2];
-	FAUSTFLOAT fVbargraph18;
-	double fRec62[2];
-	FAUSTFLOAT fVbargraph19;
-	double fRec63[2];
-	FAUSTFLOAT fVbargraph20;
-	double fRec64[2];
-	FAUSTFLOAT fVbargraph21;
-	double fRec65[2];
-	FAUSTFLOAT fVbargraph22;
-	double fRec66[2];
-	FAUSTFLOAT fVbargraph23;
-	double fRec67[2];
-	FAUSTFLOAT fVbargraph24;
-	double fRec68[2];
-	FAUSTFLOAT fVbargraph25;
-	double fRec69[2];
-	FAUSTFLOAT fVbargraph26;
-	double fRec70[2];
-	FAUSTFLOAT fVbargraph27;
-	double fRec71[2];
-	FAUSTFLOAT fVbargraph28;
-	double fRec72[2];
-	FAUSTFLOAT fVbargraph29;
-	double fRec73[2];
-	FAUSTFLOAT fVbargraph30;
-	double fRec74[2];
-	FAUSTFLOAT fVbargraph31;
-	double fRec75[2];
-	FAUSTFLOAT fVbargraph32;
-	double fRec76[2];
-	FAUSTFLOAT fVbargraph33;
-	double fRec77[2];
-	FAUSTFLOAT fVbargraph34;
-	double fRec78[2];
-	FAUSTFLOAT fVbargraph35;
-	double fRec79[2];
-	FAUSTFLOAT fVbargraph36;
-	double fRec80[2];
-	FAUSTFLOAT fVbargraph37;
-	double fRec81[2];
-	FAUSTFLOAT fVbargraph38;
-	double fRec82[2];
-	FAUSTFLOAT fVbargraph39;
-	double fRec83[2];
-	FAUSTFLOAT fVbargraph40;
-	double fRec84[2];
-	FAUSTFLOAT fVbargraph41;
-	double fRec85[2];
-	FAUSTFLOAT fVbargraph42;
-	double fRec86[2];
-	FAUSTFLOAT fVbargraph43;
-	double fRec87[2];
-	FAUSTFLOAT fVbargraph44;
-	double fRec88[2];
-	FAUSTFLOAT fVbargraph45;
-	double fRec89[2];
-	FAUSTFLOAT fVbargraph46;
-	double fRec90[2];
-	FAUSTFLOAT fVbargraph47;
-	double fRec91[2];
-	FAUSTFLOAT fVbargraph48;
-	double fRec92[2];
-	FAUSTFLOAT fVbargraph49;
 	
  public:
 	
@@ -1092,7 +995,6 @@ class mydsp : public dsp {
 	virtual void instanceConstants(int samplingFreq) {
 		fSamplingFreq = samplingFreq;
 		fConst0 = min(192000.0, max(1.0, double(fSamplingFreq)));
-		fConst1 = (80.0 / fConst0);
 		fConst2 = (340.0 / fConst0);
 		fConst3 = (170.0 / fConst0);
 		fConst4 = (789.54302057287055 / fConst0);
@@ -1312,206 +1214,6 @@ class mydsp : public dsp {
 			fRec38[l46] = 0.0;
 			
 		}
-		for (int l47 = 0; (l47 < 2); l47 = (l47 + 1)) {
-			fRec0[l47] = 0.0;
-			
-		}
-		for (int l48 = 0; (l48 < 2); l48 = (l48 + 1)) {
-			fRec44[l48] = 0.0;
-			
-		}
-		for (int l49 = 0; (l49 < 2); l49 = (l49 + 1)) {
-			fRec45[l49] = 0.0;
-			
-		}
-		for (int l50 = 0; (l50 < 2); l50 = (l50 + 1)) {
-			fRec46[l50] = 0.0;
-			
-		}
-		for (int l51 = 0; (l51 < 2); l51 = (l51 + 1)) {
-			fRec47[l51] = 0.0;
-			
-		}
-		for (int l52 = 0; (l52 < 2); l52 = (l52 + 1)) {
-			fRec48[l52] = 0.0;
-			
-		}
-		for (int l53 = 0; (l53 < 2); l53 = (l53 + 1)) {
-			fRec49[l53] = 0.0;
-			
-		}
-		for (int l54 = 0; (l54 < 2); l54 = (l54 + 1)) {
-			fRec50[l54] = 0.0;
-			
-		}
-		for (int l55 = 0; (l55 < 2); l55 = (l55 + 1)) {
-			fRec51[l55] = 0.0;
-			
-		}
-		for (int l56 = 0; (l56 < 2); l56 = (l56 + 1)) {
-			fRec52[l56] = 0.0;
-			
-		}
-		for (int l57 = 0; (l57 < 2); l57 = (l57 + 1)) {
-			fRec53[l57] = 0.0;
-			
-		}
-		for (int l58 = 0; (l58 < 2); l58 = (l58 + 1)) {
-			fRec54[l58] = 0.0;
-			
-		}
-		for (int l59 = 0; (l59 < 2); l59 = (l59 + 1)) {
-			fRec55[l59] = 0.0;
-			
-		}
-		for (int l60 = 0; (l60 < 2); l60 = (l60 + 1)) {
-			fRec56[l60] = 0.0;
-			
-		}
-		for (int l61 = 0; (l61 < 2); l61 = (l61 + 1)) {
-			fRec57[l61] = 0.0;
-			
-		}
-		for (int l62 = 0; (l62 < 2); l62 = (l62 + 1)) {
-			fRec58[l62] = 0.0;
-			
-		}
-		for (int l63 = 0; (l63 < 2); l63 = (l63 + 1)) {
-			fRec59[l63] = 0.0;
-			
-		}
-		for (int l64 = 0; (l64 < 2); l64 = (l64 + 1)) {
-			fRec60[l64] = 0.0;
-			
-		}
-		for (int l65 = 0; (l65 < 2); l65 = (l65 + 1)) {
-			fRec61[l65] = 0.0;
-			
-		}
-		for (int l66 = 0; (l66 < 2); l66 = (l66 + 1)) {
-			fRec62[l66] = 0.0;
-			
-		}
-		for (int l67 = 0; (l67 < 2); l67 = (l67 + 1)) {
-			fRec63[l67] = 0.0;
-			
-		}
-		for (int l68 = 0; (l68 < 2); l68 = (l68 + 1)) {
-			fRec64[l68] = 0.0;
-			
-		}
-		for (int l69 = 0; (l69 < 2); l69 = (l69 + 1)) {
-			fRec65[l69] = 0.0;
-			
-		}
-		for (int l70 = 0; (l70 < 2); l70 = (l70 + 1)) {
-			fRec66[l70] = 0.0;
-			
-		}
-		for (int l71 = 0; (l71 < 2); l71 = (l71 + 1)) {
-			fRec67[l71] = 0.0;
-			
-		}
-		for (int l72 = 0; (l72 < 2); l72 = (l72 + 1)) {
-			fRec68[l72] = 0.0;
-			
-		}
-		for (int l73 = 0; (l73 < 2); l73 = (l73 + 1)) {
-			fRec69[l73] = 0.0;
-			
-		}
-		for (int l74 = 0; (l74 < 2); l74 = (l74 + 1)) {
-			fRec70[l74] = 0.0;
-			
-		}
-		for (int l75 = 0; (l75 < 2); l75 = (l75 + 1)) {
-			fRec71[l75] = 0.0;
-			
-		}
-		for (int l76 = 0; (l76 < 2); l76 = (l76 + 1)) {
-			fRec72[l76] = 0.0;
-			
-		}
-		for (int l77 = 0; (l77 < 2); l77 = (l77 + 1)) {
-			fRec73[l77] = 0.0;
-			
-		}
-		for (int l78 = 0; (l78 < 2); l78 = (l78 + 1)) {
-			fRec74[l78] = 0.0;
-			
-		}
-		for (int l79 = 0; (l79 < 2); l79 = (l79 + 1)) {
-			fRec75[l79] = 0.0;
-			
-		}
-		for (int l80 = 0; (l80 < 2); l80 = (l80 + 1)) {
-			fRec76[l80] = 0.0;
-			
-		}
-		for (int l81 = 0; (l81 < 2); l81 = (l81 + 1)) {
-			fRec77[l81] = 0.0;
-			
-		}
-		for (int l82 = 0; (l82 < 2); l82 = (l82 + 1)) {
-			fRec78[l82] = 0.0;
-			
-		}
-		for (int l83 = 0; (l83 < 2); l83 = (l83 + 1)) {
-			fRec79[l83] = 0.0;
-			
-		}
-		for (int l84 = 0; (l84 < 2); l84 = (l84 + 1)) {
-			fRec80[l84] = 0.0;
-			
-		}
-		for (int l85 = 0; (l85 < 2); l85 = (l85 + 1)) {
-			fRec81[l85] = 0.0;
-			
-		}
-		for (int l86 = 0; (l86 < 2); l86 = (l86 + 1)) {
-			fRec82[l86] = 0.0;
-			
-		}
-		for (int l87 = 0; (l87 < 2); l87 = (l87 + 1)) {
-			fRec83[l87] = 0.0;
-			
-		}
-		for (int l88 = 0; (l88 < 2); l88 = (l88 + 1)) {
-			fRec84[l88] = 0.0;
-			
-		}
-		for (int l89 = 0; (l89 < 2); l89 = (l89 + 1)) {
-			fRec85[l89] = 0.0;
-			
-		}
-		for (int l90 = 0; (l90 < 2); l90 = (l90 + 1)) {
-			fRec86[l90] = 0.0;
-			
-		}
-		for (int l91 = 0; (l91 < 2); l91 = (l91 + 1)) {
-			fRec87[l91] = 0.0;
-			
-		}
-		for (int l92 = 0; (l92 < 2); l92 = (l92 + 1)) {
-			fRec88[l92] = 0.0;
-			
-		}
-		for (int l93 = 0; (l93 < 2); l93 = (l93 + 1)) {
-			fRec89[l93] = 0.0;
-			
-		}
-		for (int l94 = 0; (l94 < 2); l94 = (l94 + 1)) {
-			fRec90[l94] = 0.0;
-			
-		}
-		for (int l95 = 0; (l95 < 2); l95 = (l95 + 1)) {
-			fRec91[l95] = 0.0;
-			
-		}
-		for (int l96 = 0; (l96 < 2); l96 = (l96 + 1)) {
-			fRec92[l96] = 0.0;
-			
-		}
 		
 	}
 	
@@ -1572,257 +1274,107 @@ class mydsp : public dsp {
 		ui_interface->declare(0, "~", "");
 		ui_interface->openHorizontalBox("1-25");
 		ui_interface->openVerticalBox("1");
-		ui_interface->declare(&fVbargraph0, "osc", "/output1 -70 6");
-		ui_interface->declare(&fVbargraph0, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x2fbc6c0", &fVbargraph0, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("2");
-		ui_interface->declare(&fVbargraph1, "osc", "/output2 -70 6");
-		ui_interface->declare(&fVbargraph1, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x2fc8520", &fVbargraph1, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("3");
-		ui_interface->declare(&fVbargraph2, "osc", "/output3 -70 6");
-		ui_interface->declare(&fVbargraph2, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x2fd25c0", &fVbargraph2, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("4");
-		ui_interface->declare(&fVbargraph3, "osc", "/output4 -70 6");
-		ui_interface->declare(&fVbargraph3, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x2fdc740", &fVbargraph3, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("5");
-		ui_interface->declare(&fVbargraph4, "osc", "/output5 -70 6");
-		ui_interface->declare(&fVbargraph4, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x2fe69a0", &fVbargraph4, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("6");
-		ui_interface->declare(&fVbargraph5, "osc", "/output6 -70 6");
-		ui_interface->declare(&fVbargraph5, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x2ff02c0", &fVbargraph5, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("7");
-		ui_interface->declare(&fVbargraph6, "osc", "/output7 -70 6");
-		ui_interface->declare(&fVbargraph6, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x2ffa660", &fVbargraph6, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("8");
-		ui_interface->declare(&fVbargraph7, "osc", "/output8 -70 6");
-		ui_interface->declare(&fVbargraph7, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x3004180", &fVbargraph7, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("9");
-		ui_interface->declare(&fVbargraph8, "osc", "/output9 -70 6");
-		ui_interface->declare(&fVbargraph8, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x300dd80", &fVbargraph8, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("10");
-		ui_interface->declare(&fVbargraph9, "osc", "/output10 -70 6");
-		ui_interface->declare(&fVbargraph9, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x3017a60", &fVbargraph9, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("11");
-		ui_interface->declare(&fVbargraph10, "osc", "/output11 -70 6");
-		ui_interface->declare(&fVbargraph10, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x3022200", &fVbargraph10, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("12");
-		ui_interface->declare(&fVbargraph11, "osc", "/output12 -70 6");
-		ui_interface->declare(&fVbargraph11, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x302ca80", &fVbargraph11, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("13");
-		ui_interface->declare(&fVbargraph12, "osc", "/output13 -70 6");
-		ui_interface->declare(&fVbargraph12, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x30373e0", &fVbargraph12, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("14");
-		ui_interface->declare(&fVbargraph13, "osc", "/output14 -70 6");
-		ui_interface->declare(&fVbargraph13, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x3041e20", &fVbargraph13, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("15");
-		ui_interface->declare(&fVbargraph14, "osc", "/output15 -70 6");
-		ui_interface->declare(&fVbargraph14, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x304bb70", &fVbargraph14, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("16");
-		ui_interface->declare(&fVbargraph15, "osc", "/output16 -70 6");
-		ui_interface->declare(&fVbargraph15, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x30559a0", &fVbargraph15, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("17");
-		ui_interface->declare(&fVbargraph16, "osc", "/output17 -70 6");
-		ui_interface->declare(&fVbargraph16, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x305f8b0", &fVbargraph16, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("18");
-		ui_interface->declare(&fVbargraph17, "osc", "/output18 -70 6");
-		ui_interface->declare(&fVbargraph17, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x30698a0", &fVbargraph17, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("19");
-		ui_interface->declare(&fVbargraph18, "osc", "/output19 -70 6");
-		ui_interface->declare(&fVbargraph18, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x30746c0", &fVbargraph18, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("20");
-		ui_interface->declare(&fVbargraph19, "osc", "/output20 -70 6");
-		ui_interface->declare(&fVbargraph19, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x307ec60", &fVbargraph19, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("21");
-		ui_interface->declare(&fVbargraph20, "osc", "/output21 -70 6");
-		ui_interface->declare(&fVbargraph20, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x30892e0", &fVbargraph20, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("22");
-		ui_interface->declare(&fVbargraph21, "osc", "/output22 -70 6");
-		ui_interface->declare(&fVbargraph21, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x3093a40", &fVbargraph21, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("23");
-		ui_interface->declare(&fVbargraph22, "osc", "/output23 -70 6");
-		ui_interface->declare(&fVbargraph22, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x309de90", &fVbargraph22, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("24");
-		ui_interface->declare(&fVbargraph23, "osc", "/output24 -70 6");
-		ui_interface->declare(&fVbargraph23, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x30a83c0", &fVbargraph23, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("25");
-		ui_interface->declare(&fVbargraph24, "osc", "/output25 -70 6");
-		ui_interface->declare(&fVbargraph24, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x30b29d0", &fVbargraph24, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->closeBox();
 		ui_interface->declare(0, "~", "");
 		ui_interface->openHorizontalBox("26-50");
 		ui_interface->openVerticalBox("26");
-		ui_interface->declare(&fVbargraph25, "osc", "/output26 -70 6");
-		ui_interface->declare(&fVbargraph25, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x30bd0c0", &fVbargraph25, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("27");
-		ui_interface->declare(&fVbargraph26, "osc", "/output27 -70 6");
-		ui_interface->declare(&fVbargraph26, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x30c7b90", &fVbargraph26, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("28");
-		ui_interface->declare(&fVbargraph27, "osc", "/output28 -70 6");
-		ui_interface->declare(&fVbargraph27, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x30d1330", &fVbargraph27, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("29");
-		ui_interface->declare(&fVbargraph28, "osc", "/output29 -70 6");
-		ui_interface->declare(&fVbargraph28, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x30dabb0", &fVbargraph28, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("30");
-		ui_interface->declare(&fVbargraph29, "osc", "/output30 -70 6");
-		ui_interface->declare(&fVbargraph29, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x30e4510", &fVbargraph29, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("31");
-		ui_interface->declare(&fVbargraph30, "osc", "/output31 -70 6");
-		ui_interface->declare(&fVbargraph30, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x30ef0b0", &fVbargraph30, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("32");
-		ui_interface->declare(&fVbargraph31, "osc", "/output32 -70 6");
-		ui_interface->declare(&fVbargraph31, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x30f95a0", &fVbargraph31, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("33");
-		ui_interface->declare(&fVbargraph32, "osc", "/output33 -70 6");
-		ui_interface->declare(&fVbargraph32, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x3103b70", &fVbargraph32, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("34");
-		ui_interface->declare(&fVbargraph33, "osc", "/output34 -70 6");
-		ui_interface->declare(&fVbargraph33, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x310e220", &fVbargraph33, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("35");
-		ui_interface->declare(&fVbargraph34, "osc", "/output35 -70 6");
-		ui_interface->declare(&fVbargraph34, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x31189b0", &fVbargraph34, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("36");
-		ui_interface->declare(&fVbargraph35, "osc", "/output36 -70 6");
-		ui_interface->declare(&fVbargraph35, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x3123220", &fVbargraph35, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("37");
-		ui_interface->declare(&fVbargraph36, "osc", "/output37 -70 6");
-		ui_interface->declare(&fVbargraph36, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x312db70", &fVbargraph36, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("38");
-		ui_interface->declare(&fVbargraph37, "osc", "/output38 -70 6");
-		ui_interface->declare(&fVbargraph37, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x31385a0", &fVbargraph37, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("39");
-		ui_interface->declare(&fVbargraph38, "osc", "/output39 -70 6");
-		ui_interface->declare(&fVbargraph38, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x31422f0", &fVbargraph38, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("40");
-		ui_interface->declare(&fVbargraph39, "osc", "/output40 -70 6");
-		ui_interface->declare(&fVbargraph39, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x314c120", &fVbargraph39, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("41");
-		ui_interface->declare(&fVbargraph40, "osc", "/output41 -70 6");
-		ui_interface->declare(&fVbargraph40, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x3156030", &fVbargraph40, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("42");
-		ui_interface->declare(&fVbargraph41, "osc", "/output42 -70 6");
-		ui_interface->declare(&fVbargraph41, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x3160020", &fVbargraph41, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("43");
-		ui_interface->declare(&fVbargraph42, "osc", "/output43 -70 6");
-		ui_interface->declare(&fVbargraph42, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x316a0f0", &fVbargraph42, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("44");
-		ui_interface->declare(&fVbargraph43, "osc", "/output44 -70 6");
-		ui_interface->declare(&fVbargraph43, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x31742a0", &fVbargraph43, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("45");
-		ui_interface->declare(&fVbargraph44, "osc", "/output45 -70 6");
-		ui_interface->declare(&fVbargraph44, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x317e530", &fVbargraph44, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("46");
-		ui_interface->declare(&fVbargraph45, "osc", "/output46 -70 6");
-		ui_interface->declare(&fVbargraph45, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x31888a0", &fVbargraph45, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("47");
-		ui_interface->declare(&fVbargraph46, "osc", "/output47 -70 6");
-		ui_interface->declare(&fVbargraph46, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x3192cf0", &fVbargraph46, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("48");
-		ui_interface->declare(&fVbargraph47, "osc", "/output48 -70 6");
-		ui_interface->declare(&fVbargraph47, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x319d220", &fVbargraph47, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("49");
-		ui_interface->declare(&fVbargraph48, "osc", "/output49 -70 6");
-		ui_interface->declare(&fVbargraph48, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x31a7830", &fVbargraph48, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("50");
-		ui_interface->declare(&fVbargraph49, "osc", "/output50 -70 6");
-		ui_interface->declare(&fVbargraph49, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x31b1f20", &fVbargraph49, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->closeBox();
 		ui_interface->closeBox();
@@ -2383,204 +1935,104 @@ class mydsp : public dsp {
 			fRec38[0] = (fSlow52 * (fRec39[0] - ((fSlow62 * fRec42[0]) + (fSlow61 * fRec43[0]))));
 			double fTemp10 = ((fSlow49 * ((fSlow51 * fTemp9) + (fSlow50 * fRec37[0]))) + (fRec29[0] + fRec38[0]));
 			double fTemp11 = (0.012698412698412698 * (((fSlow1 * (fTemp2 + (fSlow20 * fTemp4))) + (fTemp5 + (fSlow37 * fTemp7))) + (fSlow47 * fTemp10)));
-			fRec0[0] = max((fRec0[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp11))))));
-			fVbargraph0 = FAUSTFLOAT(fRec0[0]);
 			output0[i] = FAUSTFLOAT(fTemp11);
 			double fTemp12 = (0.012698412698412698 * (((fSlow66 * (fTemp2 + (fSlow71 * fTemp4))) + (fTemp5 + (fSlow72 * fTemp7))) + (fSlow73 * fTemp10)));
-			fRec44[0] = max((fRec44[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp12))))));
-			fVbargraph1 = FAUSTFLOAT(fRec44[0]);
 			output1[i] = FAUSTFLOAT(fTemp12);
 			double fTemp13 = (0.012698412698412698 * (((fSlow75 * (fTemp2 + (fSlow79 * fTemp4))) + (fTemp5 + (fSlow80 * fTemp7))) + (fSlow81 * fTemp10)));
-			fRec45[0] = max((fRec45[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp13))))));
-			fVbargraph2 = FAUSTFLOAT(fRec45[0]);
 			output2[i] = FAUSTFLOAT(fTemp13);
 			double fTemp14 = (0.012698412698412698 * (((fSlow83 * (fTemp2 + (fSlow87 * fTemp4))) + (fTemp5 + (fSlow88 * fTemp7))) + (fSlow89 * fTemp10)));
-			fRec46[0] = max((fRec46[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp14))))));
-			fVbargraph3 = FAUSTFLOAT(fRec46[0]);
 			output3[i] = FAUSTFLOAT(fTemp14);
 			double fTemp15 = (0.012698412698412698 * (((fSlow91 * (fTemp2 + (fSlow95 * fTemp4))) + (fTemp5 + (fSlow96 * fTemp7))) + (fSlow97 * fTemp10)));
-			fRec47[0] = max((fRec47[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp15))))));
-			fVbargraph4 = FAUSTFLOAT(fRec47[0]);
 			output4[i] = FAUSTFLOAT(fTemp15);
 			double fTemp16 = (0.012698412698412698 * (((fSlow98 * (fTemp2 + (fSlow102 * fTemp4))) + (fTemp5 + (fSlow103 * fTemp7))) + (fSlow104 * fTemp10)));
-			fRec48[0] = max((fRec48[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp16))))));
-			fVbargraph5 = FAUSTFLOAT(fRec48[0]);
 			output5[i] = FAUSTFLOAT(fTemp16);
 			double fTemp17 = (0.022574955908289243 * (((fSlow107 * (fTemp2 + (fSlow111 * fTemp4))) + (fTemp5 + (fSlow112 * fTemp7))) + (fSlow113 * fTemp10)));
-			fRec49[0] = max((fRec49[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp17))))));
-			fVbargraph6 = FAUSTFLOAT(fRec49[0]);
 			output6[i] = FAUSTFLOAT(fTemp17);
 			double fTemp18 = (0.022574955908289243 * (((fSlow115 * (fTemp2 + (fSlow119 * fTemp4))) + (fTemp5 + (fSlow120 * fTemp7))) + (fSlow121 * fTemp10)));
-			fRec50[0] = max((fRec50[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp18))))));
-			fVbargraph7 = FAUSTFLOAT(fRec50[0]);
 			output7[i] = FAUSTFLOAT(fTemp18);
 			double fTemp19 = (0.022574955908289243 * (((fSlow123 * (fTemp2 + (fSlow127 * fTemp4))) + (fTemp5 + (fSlow128 * fTemp7))) + (fSlow129 * fTemp10)));
-			fRec51[0] = max((fRec51[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp19))))));
-			fVbargraph8 = FAUSTFLOAT(fRec51[0]);
 			output8[i] = FAUSTFLOAT(fTemp19);
 			double fTemp20 = (0.022574955908289243 * ((fSlow135 * fTemp10) + ((fSlow131 * (fTemp2 + (fSlow136 * fTemp4))) + (fTemp5 + (fSlow137 * fTemp7)))));
-			fRec52[0] = max((fRec52[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp20))))));
-			fVbargraph9 = FAUSTFLOAT(fRec52[0]);
 			output9[i] = FAUSTFLOAT(fTemp20);
 			double fTemp21 = (0.022574955908289243 * (((fSlow139 * (fTemp2 + (fSlow143 * fTemp4))) + (fTemp5 + (fSlow144 * fTemp7))) + (fSlow145 * fTemp10)));
-			fRec53[0] = max((fRec53[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp21))))));
-			fVbargraph10 = FAUSTFLOAT(fRec53[0]);
 			output10[i] = FAUSTFLOAT(fTemp21);
 			double fTemp22 = (0.022574955908289243 * (((fSlow147 * (fTemp2 + (fSlow151 * fTemp4))) + (fTemp5 + (fSlow152 * fTemp7))) + (fSlow153 * fTemp10)));
-			fRec54[0] = max((fRec54[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp22))))));
-			fVbargraph11 = FAUSTFLOAT(fRec54[0]);
 			output11[i] = FAUSTFLOAT(fTemp22);
 			double fTemp23 = (0.022574955908289243 * (((fSlow155 * (fTemp2 + (fSlow159 * fTemp4))) + (fTemp5 + (fSlow160 * fTemp7))) + (fSlow161 * fTemp10)));
-			fRec55[0] = max((fRec55[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp23))))));
-			fVbargraph12 = FAUSTFLOAT(fRec55[0]);
 			output12[i] = FAUSTFLOAT(fTemp23);
 			double fTemp24 = (0.022574955908289243 * (((fSlow163 * (fTemp2 + (fSlow167 * fTemp4))) + (fTemp5 + (fSlow168 * fTemp7))) + (fSlow169 * fTemp10)));
-			fRec56[0] = max((fRec56[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp24))))));
-			fVbargraph13 = FAUSTFLOAT(fRec56[0]);
 			output13[i] = FAUSTFLOAT(fTemp24);
 			double fTemp25 = (0.022574955908289243 * (((fSlow170 * (fTemp2 + (fSlow174 * fTemp4))) + (fTemp5 + (fSlow175 * fTemp7))) + (fSlow176 * fTemp10)));
-			fRec57[0] = max((fRec57[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp25))))));
-			fVbargraph14 = FAUSTFLOAT(fRec57[0]);
 			output14[i] = FAUSTFLOAT(fTemp25);
 			double fTemp26 = (0.022574955908289243 * (((fSlow177 * (fTemp2 + (fSlow181 * fTemp4))) + (fTemp5 + (fSlow182 * fTemp7))) + (fSlow183 * fTemp10)));
-			fRec58[0] = max((fRec58[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp26))))));
-			fVbargraph15 = FAUSTFLOAT(fRec58[0]);
 			output15[i] = FAUSTFLOAT(fTemp26);
 			double fTemp27 = (0.022574955908289243 * (((fSlow184 * (fTemp2 + (fSlow188 * fTemp4))) + (fTemp5 + (fSlow189 * fTemp7))) + (fSlow190 * fTemp10)));
-			fRec59[0] = max((fRec59[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp27))))));
-			fVbargraph16 = FAUSTFLOAT(fRec59[0]);
 			output16[i] = FAUSTFLOAT(fTemp27);
 			double fTemp28 = (0.022574955908289243 * (((fSlow191 * (fTemp2 + (fSlow195 * fTemp4))) + (fTemp5 + (fSlow196 * fTemp7))) + (fSlow197 * fTemp10)));
-			fRec60[0] = max((fRec60[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp28))))));
-			fVbargraph17 = FAUSTFLOAT(fRec60[0]);
 			output17[i] = FAUSTFLOAT(fTemp28);
 			double fTemp29 = (0.021093750000000001 * (((fSlow200 * (fTemp2 + (fSlow204 * fTemp4))) + (fTemp5 + (fSlow205 * fTemp7))) + (fSlow206 * fTemp10)));
-			fRec61[0] = max((fRec61[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp29))))));
-			fVbargraph18 = FAUSTFLOAT(fRec61[0]);
 			output18[i] = FAUSTFLOAT(fTemp29);
 			double fTemp30 = (0.021093750000000001 * (((fSlow208 * (fTemp2 + (fSlow212 * fTemp4))) + (fTemp5 + (fSlow213 * fTemp7))) + (fSlow214 * fTemp10)));
-			fRec62[0] = max((fRec62[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp30))))));
-			fVbargraph19 = FAUSTFLOAT(fRec62[0]);
 			output19[i] = FAUSTFLOAT(fTemp30);
 			double fTemp31 = (0.021093750000000001 * (((fSlow216 * (fTemp2 + (fSlow220 * fTemp4))) + (fTemp5 + (fSlow221 * fTemp7))) + (fSlow222 * fTemp10)));
-			fRec63[0] = max((fRec63[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp31))))));
-			fVbargraph20 = FAUSTFLOAT(fRec63[0]);
 			output20[i] = FAUSTFLOAT(fTemp31);
 			double fTemp32 = (0.021093750000000001 * (((fSlow224 * (fTemp2 + (fSlow228 * fTemp4))) + (fTemp5 + (fSlow229 * fTemp7))) + (fSlow230 * fTemp10)));
-			fRec64[0] = max((fRec64[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp32))))));
-			fVbargraph21 = FAUSTFLOAT(fRec64[0]);
 			output21[i] = FAUSTFLOAT(fTemp32);
 			double fTemp33 = (0.021093750000000001 * (((fSlow231 * (fTemp2 + (fSlow235 * fTemp4))) + (fTemp5 + (fSlow236 * fTemp7))) + (fSlow237 * fTemp10)));
-			fRec65[0] = max((fRec65[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp33))))));
-			fVbargraph22 = FAUSTFLOAT(fRec65[0]);
 			output22[i] = FAUSTFLOAT(fTemp33);
 			double fTemp34 = (0.021093750000000001 * (((fSlow238 * (fTemp2 + (fSlow242 * fTemp4))) + (fTemp5 + (fSlow243 * fTemp7))) + (fSlow244 * fTemp10)));
-			fRec66[0] = max((fRec66[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp34))))));
-			fVbargraph23 = FAUSTFLOAT(fRec66[0]);
 			output23[i] = FAUSTFLOAT(fTemp34);
 			double fTemp35 = (0.021093750000000001 * (((fSlow245 * (fTemp2 + (fSlow249 * fTemp4))) + (fTemp5 + (fSlow250 * fTemp7))) + (fSlow251 * fTemp10)));
-			fRec67[0] = max((fRec67[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp35))))));
-			fVbargraph24 = FAUSTFLOAT(fRec67[0]);
 			output24[i] = FAUSTFLOAT(fTemp35);
 			double fTemp36 = (0.021093750000000001 * (((fSlow252 * (fTemp2 + (fSlow256 * fTemp4))) + (fTemp5 + (fSlow257 * fTemp7))) + (fSlow258 * fTemp10)));
-			fRec68[0] = max((fRec68[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp36))))));
-			fVbargraph25 = FAUSTFLOAT(fRec68[0]);
 			output25[i] = FAUSTFLOAT(fTemp36);
 			double fTemp37 = (0.02017333553791887 * (((fSlow261 * (fTemp2 + (fSlow265 * fTemp4))) + (fTemp5 + (fSlow266 * fTemp7))) + (fSlow267 * fTemp10)));
-			fRec69[0] = max((fRec69[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp37))))));
-			fVbargraph26 = FAUSTFLOAT(fRec69[0]);
 			output26[i] = FAUSTFLOAT(fTemp37);
 			double fTemp38 = (0.02017333553791887 * (((fSlow269 * (fTemp2 + (fSlow273 * fTemp4))) + (fTemp5 + (fSlow274 * fTemp7))) + (fSlow275 * fTemp10)));
-			fRec70[0] = max((fRec70[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp38))))));
-			fVbargraph27 = FAUSTFLOAT(fRec70[0]);
 			output27[i] = FAUSTFLOAT(fTemp38);
 			double fTemp39 = (0.02017333553791887 * (((fSlow277 * (fTemp2 + (fSlow281 * fTemp4))) + (fTemp5 + (fSlow282 * fTemp7))) + (fSlow283 * fTemp10)));
-			fRec71[0] = max((fRec71[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp39))))));
-			fVbargraph28 = FAUSTFLOAT(fRec71[0]);
 			output28[i] = FAUSTFLOAT(fTemp39);
 			double fTemp40 = (0.02017333553791887 * (((fSlow285 * (fTemp2 + (fSlow289 * fTemp4))) + (fTemp5 + (fSlow290 * fTemp7))) + (fSlow291 * fTemp10)));
-			fRec72[0] = max((fRec72[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp40))))));
-			fVbargraph29 = FAUSTFLOAT(fRec72[0]);
 			output29[i] = FAUSTFLOAT(fTemp40);
 			double fTemp41 = (0.02017333553791887 * (((fSlow294 * (fTemp2 + (fSlow298 * fTemp4))) + (fTemp5 + (fSlow299 * fTemp7))) + (fSlow300 * fTemp10)));
-			fRec73[0] = max((fRec73[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp41))))));
-			fVbargraph30 = FAUSTFLOAT(fRec73[0]);
 			output30[i] = FAUSTFLOAT(fTemp41);
 			double fTemp42 = (0.02017333553791887 * (((fSlow302 * (fTemp2 + (fSlow306 * fTemp4))) + (fTemp5 + (fSlow307 * fTemp7))) + (fSlow308 * fTemp10)));
-			fRec74[0] = max((fRec74[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp42))))));
-			fVbargraph31 = FAUSTFLOAT(fRec74[0]);
 			output31[i] = FAUSTFLOAT(fTemp42);
 			double fTemp43 = (0.02017333553791887 * (((fSlow310 * (fTemp2 + (fSlow314 * fTemp4))) + (fTemp5 + (fSlow315 * fTemp7))) + (fSlow316 * fTemp10)));
-			fRec75[0] = max((fRec75[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp43))))));
-			fVbargraph32 = FAUSTFLOAT(fRec75[0]);
 			output32[i] = FAUSTFLOAT(fTemp43);
 			double fTemp44 = (0.02017333553791887 * (((fSlow318 * (fTemp2 + (fSlow322 * fTemp4))) + (fTemp5 + (fSlow323 * fTemp7))) + (fSlow324 * fTemp10)));
-			fRec76[0] = max((fRec76[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp44))))));
-			fVbargraph33 = FAUSTFLOAT(fRec76[0]);
 			output33[i] = FAUSTFLOAT(fTemp44);
 			double fTemp45 = (0.02017333553791887 * (((fSlow326 * (fTemp2 + (fSlow330 * fTemp4))) + (fTemp5 + (fSlow331 * fTemp7))) + (fSlow332 * fTemp10)));
-			fRec77[0] = max((fRec77[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp45))))));
-			fVbargraph34 = FAUSTFLOAT(fRec77[0]);
 			output34[i] = FAUSTFLOAT(fTemp45);
 			double fTemp46 = (0.02017333553791887 * (((fSlow334 * (fTemp2 + (fSlow338 * fTemp4))) + (fTemp5 + (fSlow339 * fTemp7))) + (fSlow340 * fTemp10)));
-			fRec78[0] = max((fRec78[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp46))))));
-			fVbargraph35 = FAUSTFLOAT(fRec78[0]);
 			output35[i] = FAUSTFLOAT(fTemp46);
 			double fTemp47 = (0.02017333553791887 * (((fSlow342 * (fTemp2 + (fSlow346 * fTemp4))) + (fTemp5 + (fSlow347 * fTemp7))) + (fSlow348 * fTemp10)));
-			fRec79[0] = max((fRec79[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp47))))));
-			fVbargraph36 = FAUSTFLOAT(fRec79[0]);
 			output36[i] = FAUSTFLOAT(fTemp47);
 			double fTemp48 = (0.02017333553791887 * (((fSlow350 * (fTemp2 + (fSlow354 * fTemp4))) + (fTemp5 + (fSlow355 * fTemp7))) + (fSlow356 * fTemp10)));
-			fRec80[0] = max((fRec80[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp48))))));
-			fVbargraph37 = FAUSTFLOAT(fRec80[0]);
 			output37[i] = FAUSTFLOAT(fTemp48);
 			double fTemp49 = (0.02017333553791887 * (((fSlow357 * (fTemp2 + (fSlow361 * fTemp4))) + (fTemp5 + (fSlow362 * fTemp7))) + (fSlow363 * fTemp10)));
-			fRec81[0] = max((fRec81[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp49))))));
-			fVbargraph38 = FAUSTFLOAT(fRec81[0]);
 			output38[i] = FAUSTFLOAT(fTemp49);
 			double fTemp50 = (0.02017333553791887 * (((fSlow364 * (fTemp2 + (fSlow368 * fTemp4))) + (fTemp5 + (fSlow369 * fTemp7))) + (fSlow370 * fTemp10)));
-			fRec82[0] = max((fRec82[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp50))))));
-			fVbargraph39 = FAUSTFLOAT(fRec82[0]);
 			output39[i] = FAUSTFLOAT(fTemp50);
 			double fTemp51 = (0.02017333553791887 * (((fSlow371 * (fTemp2 + (fSlow375 * fTemp4))) + (fTemp5 + (fSlow376 * fTemp7))) + (fSlow377 * fTemp10)));
-			fRec83[0] = max((fRec83[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp51))))));
-			fVbargraph40 = FAUSTFLOAT(fRec83[0]);
 			output40[i] = FAUSTFLOAT(fTemp51);
 			double fTemp52 = (0.02017333553791887 * (((fSlow378 * (fTemp2 + (fSlow382 * fTemp4))) + (fTemp5 + (fSlow383 * fTemp7))) + (fSlow384 * fTemp10)));
-			fRec84[0] = max((fRec84[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp52))))));
-			fVbargraph41 = FAUSTFLOAT(fRec84[0]);
 			output41[i] = FAUSTFLOAT(fTemp52);
 			double fTemp53 = (0.02017333553791887 * (((fSlow385 * (fTemp2 + (fSlow389 * fTemp4))) + (fTemp5 + (fSlow390 * fTemp7))) + (fSlow391 * fTemp10)));
-			fRec85[0] = max((fRec85[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp53))))));
-			fVbargraph42 = FAUSTFLOAT(fRec85[0]);
 			output42[i] = FAUSTFLOAT(fTemp53);
 			double fTemp54 = (0.02017333553791887 * (((fSlow392 * (fTemp2 + (fSlow396 * fTemp4))) + (fTemp5 + (fSlow397 * fTemp7))) + (fSlow398 * fTemp10)));
-			fRec86[0] = max((fRec86[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp54))))));
-			fVbargraph43 = FAUSTFLOAT(fRec86[0]);
 			output43[i] = FAUSTFLOAT(fTemp54);
 			double fTemp55 = (0.02017333553791887 * (((fSlow399 * (fTemp2 + (fSlow403 * fTemp4))) + (fTemp5 + (fSlow404 * fTemp7))) + (fSlow405 * fTemp10)));
-			fRec87[0] = max((fRec87[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp55))))));
-			fVbargraph44 = FAUSTFLOAT(fRec87[0]);
 			output44[i] = FAUSTFLOAT(fTemp55);
 			double fTemp56 = (0.02017333553791887 * (((fSlow406 * (fTemp2 + (fSlow410 * fTemp4))) + (fTemp5 + (fSlow411 * fTemp7))) + (fSlow412 * fTemp10)));
-			fRec88[0] = max((fRec88[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp56))))));
-			fVbargraph45 = FAUSTFLOAT(fRec88[0]);
 			output45[i] = FAUSTFLOAT(fTemp56);
 			double fTemp57 = (0.02017333553791887 * (((fSlow413 * (fTemp2 + (fSlow417 * fTemp4))) + (fTemp5 + (fSlow418 * fTemp7))) + (fSlow419 * fTemp10)));
-			fRec89[0] = max((fRec89[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp57))))));
-			fVbargraph46 = FAUSTFLOAT(fRec89[0]);
 			output46[i] = FAUSTFLOAT(fTemp57);
 			double fTemp58 = (0.02017333553791887 * (((fSlow420 * (fTemp2 + (fSlow424 * fTemp4))) + (fTemp5 + (fSlow425 * fTemp7))) + (fSlow426 * fTemp10)));
-			fRec90[0] = max((fRec90[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp58))))));
-			fVbargraph47 = FAUSTFLOAT(fRec90[0]);
 			output47[i] = FAUSTFLOAT(fTemp58);
 			double fTemp59 = (0.02017333553791887 * (((fSlow427 * (fTemp2 + (fSlow431 * fTemp4))) + (fTemp5 + (fSlow432 * fTemp7))) + (fSlow433 * fTemp10)));
-			fRec91[0] = max((fRec91[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp59))))));
-			fVbargraph48 = FAUSTFLOAT(fRec91[0]);
 			output48[i] = FAUSTFLOAT(fTemp59);
 			double fTemp60 = (0.02017333553791887 * (((fSlow434 * (fTemp2 + (fSlow438 * fTemp4))) + (fTemp5 + (fSlow439 * fTemp7))) + (fSlow440 * fTemp10)));
-			fRec92[0] = max((fRec92[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp60))))));
-			fVbargraph49 = FAUSTFLOAT(fRec92[0]);
 			output49[i] = FAUSTFLOAT(fTemp60);
 			fRec3[1] = fRec3[0];
 			fRec4[1] = fRec4[0];
@@ -2629,56 +2081,6 @@ class mydsp : public dsp {
 			fRec42[1] = fRec42[0];
 			fRec43[1] = fRec43[0];
 			fRec38[1] = fRec38[0];
-			fRec0[1] = fRec0[0];
-			fRec44[1] = fRec44[0];
-			fRec45[1] = fRec45[0];
-			fRec46[1] = fRec46[0];
-			fRec47[1] = fRec47[0];
-			fRec48[1] = fRec48[0];
-			fRec49[1] = fRec49[0];
-			fRec50[1] = fRec50[0];
-			fRec51[1] = fRec51[0];
-			fRec52[1] = fRec52[0];
-			fRec53[1] = fRec53[0];
-			fRec54[1] = fRec54[0];
-			fRec55[1] = fRec55[0];
-			fRec56[1] = fRec56[0];
-			fRec57[1] = fRec57[0];
-			fRec58[1] = fRec58[0];
-			fRec59[1] = fRec59[0];
-			fRec60[1] = fRec60[0];
-			fRec61[1] = fRec61[0];
-			fRec62[1] = fRec62[0];
-			fRec63[1] = fRec63[0];
-			fRec64[1] = fRec64[0];
-			fRec65[1] = fRec65[0];
-			fRec66[1] = fRec66[0];
-			fRec67[1] = fRec67[0];
-			fRec68[1] = fRec68[0];
-			fRec69[1] = fRec69[0];
-			fRec70[1] = fRec70[0];
-			fRec71[1] = fRec71[0];
-			fRec72[1] = fRec72[0];
-			fRec73[1] = fRec73[0];
-			fRec74[1] = fRec74[0];
-			fRec75[1] = fRec75[0];
-			fRec76[1] = fRec76[0];
-			fRec77[1] = fRec77[0];
-			fRec78[1] = fRec78[0];
-			fRec79[1] = fRec79[0];
-			fRec80[1] = fRec80[0];
-			fRec81[1] = fRec81[0];
-			fRec82[1] = fRec82[0];
-			fRec83[1] = fRec83[0];
-			fRec84[1] = fRec84[0];
-			fRec85[1] = fRec85[0];
-			fRec86[1] = fRec86[0];
-			fRec87[1] = fRec87[0];
-			fRec88[1] = fRec88[0];
-			fRec89[1] = fRec89[0];
-			fRec90[1] = fRec90[0];
-			fRec91[1] = fRec91[0];
-			fRec92[1] = fRec92[0];
 			
 		}
 		
@@ -2689,17 +2091,24 @@ class mydsp : public dsp {
 
 //----------------------------------------------------------------------------
 // SuperCollider/Faust interface
+// Input handling patched by patch_wrapper.py
 //----------------------------------------------------------------------------
 
 struct Faust : public Unit
 {
     // Faust dsp instance
     FAUSTCLASS*  mDSP;
-    // Buffers for control to audio rate conversion
+    // Input buffers passed to compute() when some audio inputs are not
+    // audio rate.  The mNumCopies control rate inputs listed in
+    // mCopyInputs are interpolated into copies, the others are used
+    // in place.
     float**     mInBufCopy;
     float*      mInBufValue;
-    // Controls
+    int*        mCopyInputs;
+    int         mNumCopies;
+    // Controls, the first mNumDynamicControls are not scalar rate
     size_t      mNumControls;
+    size_t      mNumDynamicControls;
     // NOTE: This needs to be the last field!
     //
     // The unit allocates additional memory according to the number
@@ -2809,15 +2218,42 @@ inline static void copyBuffer(float* dst, int n, float* src)
 }
 
 inline static void Faust_updateControls(Faust* unit)
+{
+    // Scalar rate controls are set in the constructor, the others are
+    // only updated when their input changed.
+    Control* controls = unit->mControls;
+    size_t numControls = unit->mNumDynamicControls;
+    for (size_t i = 0; i < numControls; ++i) {
+        Control* control = controls + i;
+        float value = IN0(control->input);
+        if (value != control->lastValue) {
+            control->lastValue = value;
+            control->update(value);
+        }
+    }
+}
+
+// Set every control from its input, and move the controls that are not
+// scalar rate to the front of mControls.
+static void Faust_initControls(Faust* unit)
 {
     Control* controls = unit->mControls;
     size_t numControls = unit->mNumControls;
+    size_t numDynamic = 0;
     int curControl = unit->mDSP->getNumInputs();
-    for (int i = 0; i < numControls; ++i) {
-        float value = IN0(curControl);
-        (controls++)->update(value);
-        curControl++;
+    for (size_t i = 0; i < numControls; ++i) {
+        Control* control = controls + i;
+        control->input = curControl + (int)i;
+        control->lastValue = IN0(control->input);
+        control->update(control->lastValue);
+        if (INRATE(control->input) != calc_ScalarRate) {
+            Control tmp = controls[numDynamic];
+            controls[numDynamic] = *control;
+            *control = tmp;
+            numDynamic++;
+        }
     }
+    unit->mNumDynamicControls = numDynamic;
 }
 
 void Faust_next(Faust* unit, int inNumSamples)
@@ -2832,18 +2268,13 @@ void Faust_next_copy(Faust* unit, int inNumSamples)
 {
     // update controls
     Faust_updateControls(unit);
-    // Copy buffers
-    for (int i = 0; i < unit->getNumAudioInputs(); ++i) {
-        float* b = unit->mInBufCopy[i];
-        if (INRATE(i) == calc_FullRate) {
-            // Audio rate: copy buffer
-            copyBuffer(b, inNumSamples, unit->mInBuf[i]);
-        } else {
-            // Control rate: linearly interpolate input
-            float v1 = IN0(i);
-            fillBuffer(b, inNumSamples, unit->mInBufValue[i], v1);
-            unit->mInBufValue[i] = v1;
-        }
+    // Control rate: linearly interpolate input, the audio rate buffers
+    // are used in place
+    for (int k = 0; k < unit->mNumCopies; ++k) {
+        int i = unit->mCopyInputs[k];
+        float v1 = IN0(i);
+        fillBuffer(unit->mInBufCopy[i], inNumSamples, unit->mInBufValue[k], v1);
+        unit->mInBufValue[k] = v1;
     }
     // dsp computation
     unit->mDSP->compute(inNumSamples, unit->mInBufCopy, unit->mOutBuf);
@@ -2856,6 +2287,12 @@ void Faust_next_clear(Faust* unit, int inNumSamples)
 
 void Faust_Ctor(Faust* unit)  // module constructor
 {
+    unit->mInBufCopy  = 0;
+    unit->mInBufValue = 0;
+    unit->mCopyInputs = 0;
+    unit->mNumCopies  = 0;
+    SETCALC(Faust_next_clear);
+
     // allocate dsp
     unit->mDSP = new(RTAlloc(unit->mWorld, sizeof(FAUSTCLASS))) FAUSTCLASS();
     if (!unit->mDSP) {
@@ -2865,14 +2302,12 @@ void Faust_Ctor(Faust* unit)  // module constructor
     {
         // init dsp
         unit->mDSP->instanceInit((int)SAMPLERATE);
-     
+
         // allocate controls
         unit->mNumControls = g_numControls;
         ControlAllocator ca(unit->mControls);
         unit->mDSP->buildUserInterface(&ca);
-        unit->mInBufCopy  = 0;
-        unit->mInBufValue = 0;
-     
+
         // check input/output channel configuration
         const size_t numInputs = unit->mDSP->getNumInputs() + unit->mNumControls;
         const size_t numOutputs = unit->mDSP->getNumOutputs();
@@ -2880,41 +2315,48 @@ void Faust_Ctor(Faust* unit)  // module constructor
         bool channelsValid = (numInputs == unit->mNumInputs) && (numOutputs == unit->mNumOutputs);
 
         if (channelsValid) {
-            bool rateValid = true;
-            for (int i = 0; i < unit->getNumAudioInputs(); ++i) {
+            Faust_initControls(unit);
+
+            const int numAudioInputs = unit->getNumAudioInputs();
+            int numCopies = 0;
+            for (int i = 0; i < numAudioInputs; ++i) {
                 if (INRATE(i) != calc_FullRate) {
-                    rateValid = false;
-                    break;
+                    numCopies++;
                 }
             }
-            if (rateValid) {
+            if (numCopies == 0) {
                 SETCALC(Faust_next);
             } else {
-                unit->mInBufCopy = (float**)RTAlloc(unit->mWorld, unit->getNumAudioInputs()*sizeof(float*));
-                if (!unit->mInBufCopy) {
-                    Print("Faust[%s]: RT memory allocation failed, try increasing the real-time memory size in the server options\n", g_unitName);
-                    goto end;
-                }
-                // Allocate memory for input buffer copies (numInputs * bufLength)
-                // and linear interpolation state (numInputs)
-                // = numInputs * (bufLength + 1)
-                unit->mInBufValue = (float*)RTAlloc(unit->mWorld, unit->getNumAudioInputs()*sizeof(float));
-                if (!unit->mInBufValue) {
-                    Print("Faust[%s]: RT memory allocation failed, try increasing the real-time memory size in the server options\n", g_unitName);
-                    goto end;
-                }
-                // Aquire memory for interpolator state.
-                float* mem = (float*)RTAlloc(unit->mWorld, unit->getNumAudioInputs()*BUFLENGTH*sizeof(float));
-                if (mem) {
+                // One block holds the buffer pointers of all audio inputs,
+                // then for each input that is not audio rate its
+                // interpolator state, buffer and index.
+                char* mem = (char*)RTAlloc(unit->mWorld,
+                                           numAudioInputs*sizeof(float*)
+                                           + numCopies*((BUFLENGTH + 1)*sizeof(float) + sizeof(int)));
+                if (!mem) {
                     Print("Faust[%s]: RT memory allocation failed, try increasing the real-time memory size in the server options\n", g_unitName);
                     goto end;
                 }
-                for (int i = 0; i < unit->getNumAudioInputs(); ++i) {
-                    // Initialize interpolator.
-                    unit->mInBufValue[i] = IN0(i);
-                    // Aquire buffer memory.
-                    unit->mInBufCopy[i] = mem;
-                    mem += BUFLENGTH;
+                unit->mInBufCopy  = (float**)mem;
+                unit->mInBufValue = (float*)(unit->mInBufCopy + numAudioInputs);
+                float* buffer     = unit->mInBufValue + numCopies;
+                unit->mCopyInputs = (int*)(buffer + numCopies*BUFLENGTH);
+                for (int i = 0; i < numAudioInputs; ++i) {
+                    if (INRATE(i) == calc_FullRate) {
+                        // Audio rate: use the buffer in place
+                        unit->mInBufCopy[i] = unit->mInBuf[i];
+                        continue;
+                    }
+                    unit->mInBufCopy[i] = buffer;
+                    if (INRATE(i) == calc_ScalarRate) {
+                        // Scalar rate: fill once
+                        fillBuffer(buffer, BUFLENGTH, IN0(i));
+                    } else {
+                        // Initialize interpolator.
+                        unit->mInBufValue[unit->mNumCopies] = IN0(i);
+                        unit->mCopyInputs[unit->mNumCopies++] = i;
+                    }
+                    buffer += BUFLENGTH;
                 }
                 SETCALC(Faust_next_copy);
             }
@@ -2922,9 +2364,13 @@ void Faust_Ctor(Faust* unit)  // module constructor
             Print("Faust[%s]:\n", g_unitName);
             Print("    Inputs:   %d\n"
                   "    Outputs:  %d\n"
-                  "    Callback: %s\n",
-                  numInputs, numOutputs,
-                  unit->mCalcFunc == (UnitCalcFunc)Faust_next ? "zero-copy" : "copy");
+                  "    Callback: %s\n"
+                  "    Interpolated inputs: %d of %d\n"
+                  "    Controls updated per block: %d of %d\n",
+                  (int)numInputs, (int)numOutputs,
+                  unit->mCalcFunc == (UnitCalcFunc)Faust_next ? "zero-copy" : "copy",
+                  unit->mNumCopies, numAudioInputs,
+                  (int)unit->mNumDynamicControls, (int)unit->mNumControls);
     #endif
         } else {
             Print("Faust[%s]:\n", g_unitName);
@@ -2934,10 +2380,9 @@ void Faust_Ctor(Faust* unit)  // module constructor
                   numInputs, unit->mNumInputs,
                   numOutputs, unit->mNumOutputs);
             Print("    Generating silence ...\n");
-            SETCALC(Faust_next_clear);
         }
     }
-    
+
 end:
     // Fix for https://github.com/grame-cncm/faust/issues/13
     ClearUnitOutputs(unit, 1);
@@ -2945,19 +2390,15 @@ end:
 
 void Faust_Dtor(Faust* unit)  // module destructor
 {
-    if (unit->mInBufValue) {
-        RTFree(unit->mWorld, unit->mInBufValue);
-    }
     if (unit->mInBufCopy) {
-        if (unit->mInBufCopy[0]) {
-            RTFree(unit->mWorld, unit->mInBufCopy[0]);
-        }
         RTFree(unit->mWorld, unit->mInBufCopy);
     }
-    
+
     // delete dsp
-    unit->mDSP->~FAUSTCLASS();
-    RTFree(unit->mWorld, unit->mDSP);
+    if (unit->mDSP) {
+        unit->mDSP->~FAUSTCLASS();
+        RTFree(unit->mWorld, unit->mDSP);
+    }
 }
 
 #ifdef SC_API_EXPORT
@@ -5,6 +5,7 @@ license: "GPL"
 name: "HOAPanLebedev505"
 version: "1.0"
 Code generated with Faust 2.5.21 (https://faust.grame.fr)
+VU meters stripped by strip_meters.py
 Compilation options: cpp, -double -ftz 0
 ------------------------------------------------------------ */
 
@@ -535,6 +536,9 @@ struct Control
     UpdateFunction updateFunction;
     FAUSTFLOAT* zone;
     FAUSTFLOAT min, max;
+    // Unit input of the control and its value at the last update
+    int input;
+    float lastValue;
 
     inline void update(FAUSTFLOAT value)
     {
@@ -637,7 +641,6 @@ class mydsp : public dsp {
 	
 	int fSamplingFreq;
 	double fConst0;
-	double fConst1;
 	FAUSTFLOAT fHslider0;
 	FAUSTFLOAT fCheckbox0;
 	double fConst2;
@@ -737,107 +740,7 @@ class mydsp : public dsp {
 	double fRec63[2];
 	double fRec64[2];
 	double fRec59[2];
-	double fRec0[2];
-	FAUSTFLOAT fVbargraph0;
 	FAUSTFLOAT fHslider3;
-	double fRec65[2];
-	FAUSTFLOAT fVbargraph1;
-	double fRec66[2];
-	FAUSTFLOAT fVbargraph2;
-	double fRec67[2];
-	FAUSTFLOAT fVbargraph3;
-	double fRec68[2];
-	FAUSTFLOAT fVbargraph4;
-	double fRec69[2];
-	FAUSTFLOAT fVbargraph5;
-	double fRec70[2];
-	FAUSTFLOAT fVbargraph6;
-	double fRec71[2];
-	FAUSTFLOAT fVbargraph7;
-	double fRec72[2];
-	FAUSTFLOAT fVbargraph8;
-	double fRec73[2];
-	FAUSTFLOAT fVbargraph9;
-	double fRec74[2];
-	FAUSTFLOAT fVbargraph10;
-	double fRec75[2];
-	FAUSTFLOAT fVbargraph11;
-	double fRec76[2];
-	FAUSTFLOAT fVbargraph12;
-	double fRec77[2];
-	FAUSTFLOAT fVbargraph13;
-	double fRec78[2];
-	FAUSTFLOAT fVbargraph14;
-	double fRec79[2];
-	FAUSTFLOAT fVbargraph15;
-	double fRec80[2];
-	FAUSTFLOAT fVbargraph16;
-	double fRec81[2];
-	FAUSTFLOAT fVbargraph17;
-	double fRec82[2];
-	FAUSTFLOAT fVbargraph18;
-	double fRec83[2];
-	FAUSTFLOAT fVbargraph19;
-	double fRec84[2];
-	FAUSTFLOAT fVbargraph20;
-	double fRec85[2];
-	FAUSTFLOAT fVbargraph21;
-	double fRec86[2];
-	FAUSTFLOAT fVbargraph22;
-	double fRec87[2];
-	FAUSTFLOAT fVbargraph23;
-	double fRec88[2];
-	FAUSTFLOAT fVbargraph24;
-	double fRec89[2];
-	FAUSTFLOAT fVbargraph25;
-	double fRec90[2];
-	FAUSTFLOAT fVbargraph26;
-	double fRec91[2];
-	FAUSTFLOAT fVbargraph27;
-	double fRec92[2];
-	FAUSTFLOAT fVbargraph28;
-	double fRec93[2];
-	FAUSTFLOAT fVbargraph29;
-	double fRec94[2];
-	FAUSTFLOAT fVbargraph30;
-	double fRec95[2];
-	FAUSTFLOAT fVbargraph31;
-	double fRec96[2];
-	FAUSTFLOAT fVbargraph32;
-	double fRec97[2];
-	FAUSTFLOAT fVbargraph33;
-	double fRec98[2];
-	FAUSTFLOAT fVbargraph34;
-	double fRec99[2];
-	FAUSTFLOAT fVbargraph35;
-	double fRec100[2];
-	FAUSTFLOAT fVbargraph36;
-	double fRec101[2];
-	FAUSTFLOAT fVbargraph37;
-	double fRec102[2];
-	FAUSTFLOAT fVbargraph38;
-	double fRec103[2];
-	FAUSTFLOAT fVbargraph39;
-	double fRec104[2];
-	FAUSTFLOAT fVbargraph40;
-	double fRec105[2];
-	FAUSTFLOAT fVbargraph41;
-	double fRec106[2];
-	FAUSTFLOAT fVbargraph42;
-	double fRec107[2];
-	FAUSTFLOAT fVbargraph43;
-	double fRec108[2];
-	FAUSTFLOAT fVbargraph44;
-	double fRec109[2];
-	FAUSTFLOAT fVbargraph45;
-	double fRec110[2];
-	FAUSTFLOAT fVbargraph46;
-	double fRec111[2];
-	FAUSTFLOAT fVbargraph47;
-	double fRec112[2];
-	FAUSTFLOAT fVbargraph48;
-	double fRec113[2];
-	FAUSTFLOAT fVbargraph49;
 	
  public:
 	
@@ -1122,7 +1025,6 @@ class mydsp : public dsp {
 	virtual void instanceConstants(int samplingFreq) {
 		fSamplingFreq = samplingFreq;
 		fConst0 = min(192000.0, max(1.0, double(fSamplingFreq)));
-		fConst1 = (80.0 / fConst0);
 		fConst2 = (340.0 / fConst0);
 		fConst3 = (170.0 / fConst0);
 		fConst4 = (789.54302057287055 / fConst0);
@@ -1441,206 +1343,6 @@ class mydsp : public dsp {
 			fRec59[l69] = 0.0;
 			
 		}
-		for (int l70 = 0; (l70 < 2); l70 = (l70 + 1)) {
-			fRec0[l70] = 0.0;
-			
-		}
-		for (int l71 = 0; (l71 < 2); l71 = (l71 + 1)) {
-			fRec65[l71] = 0.0;
-			
-		}
-		for (int l72 = 0; (l72 < 2); l72 = (l72 + 1)) {
-			fRec66[l72] = 0.0;
-			
-		}
-		for (int l73 = 0; (l73 < 2); l73 = (l73 + 1)) {
-			fRec67[l73] = 0.0;
-			
-		}
-		for (int l74 = 0; (l74 < 2); l74 = (l74 + 1)) {
-			fRec68[l74] = 0.0;
-			
-		}
-		for (int l75 = 0; (l75 < 2); l75 = (l75 + 1)) {
-			fRec69[l75] = 0.0;
-			
-		}
-		for (int l76 = 0; (l76 < 2); l76 = (l76 + 1)) {
-			fRec70[l76] = 0.0;
-			
-		}
-		for (int l77 = 0; (l77 < 2); l77 = (l77 + 1)) {
-			fRec71[l77] = 0.0;
-			
-		}
-		for (int l78 = 0; (l78 < 2); l78 = (l78 + 1)) {
-			fRec72[l78] = 0.0;
-			
-		}
-		for (int l79 = 0; (l79 < 2); l79 = (l79 + 1)) {
-			fRec73[l79] = 0.0;
-			
-		}
-		for (int l80 = 0; (l80 < 2); l80 = (l80 + 1)) {
-			fRec74[l80] = 0.0;
-			
-		}
-		for (int l81 = 0; (l81 < 2); l81 = (l81 + 1)) {
-			fRec75[l81] = 0.0;
-			
-		}
-		for (int l82 = 0; (l82 < 2); l82 = (l82 + 1)) {
-			fRec76[l82] = 0.0;
-			
-		}
-		for (int l83 = 0; (l83 < 2); l83 = (l83 + 1)) {
-			fRec77[l83] = 0.0;
-			
-		}
-		for (int l84 = 0; (l84 < 2); l84 = (l84 + 1)) {
-			fRec78[l84] = 0.0;
-			
-		}
-		for (int l85 = 0; (l85 < 2); l85 = (l85 + 1)) {
-			fRec79[l85] = 0.0;
-			
-		}
-		for (int l86 = 0; (l86 < 2); l86 = (l86 + 1)) {
-			fRec80[l86] = 0.0;
-			
-		}
-		for (int l87 = 0; (l87 < 2); l87 = (l87 + 1)) {
-			fRec81[l87] = 0.0;
-			
-		}
-		for (int l88 = 0; (l88 < 2); l88 = (l88 + 1)) {
-			fRec82[l88] = 0.0;
-			
-		}
-		for (int l89 = 0; (l89 < 2); l89 = (l89 + 1)) {
-			fRec83[l89] = 0.0;
-			
-		}
-		for (int l90 = 0; (l90 < 2); l90 = (l90 + 1)) {
-			fRec84[l90] = 0.0;
-			
-		}
-		for (int l91 = 0; (l91 < 2); l91 = (l91 + 1)) {
-			fRec85[l91] = 0.0;
-			
-		}
-		for (int l92 = 0; (l92 < 2); l92 = (l92 + 1)) {
-			fRec86[l92] = 0.0;
-			
-		}
-		for (int l93 = 0; (l93 < 2); l93 = (l93 + 1)) {
-			fRec87[l93] = 0.0;
-			
-		}
-		for (int l94 = 0; (l94 < 2); l94 = (l94 + 1)) {
-			fRec88[l94] = 0.0;
-			
-		}
-		for (int l95 = 0; (l95 < 2); l95 = (l95 + 1)) {
-			fRec89[l95] = 0.0;
-			
-		}
-		for (int l96 = 0; (l96 < 2); l96 = (l96 + 1)) {
-			fRec90[l96] = 0.0;
-			
-		}
-		for (int l97 = 0; (l97 < 2); l97 = (l97 + 1)) {
-			fRec91[l97] = 0.0;
-			
-		}
-		for (int l98 = 0; (l98 < 2); l98 = (l98 + 1)) {
-			fRec92[l98] = 0.0;
-			
-		}
-		for (int l99 = 0; (l99 < 2); l99 = (l99 + 1)) {
-			fRec93[l99] = 0.0;
-			
-		}
-		for (int l100 = 0; (l100 < 2); l100 = (l100 + 1)) {
-			fRec94[l100] = 0.0;
-			
-		}
-		for (int l101 = 0; (l101 < 2); l101 = (l101 + 1)) {
-			fRec95[l101] = 0.0;
-			
-		}
-		for (int l102 = 0; (l102 < 2); l102 = (l102 + 1)) {
-			fRec96[l102] = 0.0;
-			
-		}
-		for (int l103 = 0; (l103 < 2); l103 = (l103 + 1)) {
-			fRec97[l103] = 0.0;
-			
-		}
-		for (int l104 = 0; (l104 < 2); l104 = (l104 + 1)) {
-			fRec98[l104] = 0.0;
-			
-		}
-		for (int l105 = 0; (l105 < 2); l105 = (l105 + 1)) {
-			fRec99[l105] = 0.0;
-			
-		}
-		for (int l106 = 0; (l106 < 2); l106 = (l106 + 1)) {
-			fRec100[l106] = 0.0;
-			
-		}
-		for (int l107 = 0; (l107 < 2); l107 = (l107 + 1)) {
-			fRec101[l107] = 0.0;
-			
-		}
-		for (int l108 = 0; (l108 < 2); l108 = (l108 + 1)) {
-			fRec102[l108] = 0.0;
-			
-		}
-		for (int l109 = 0; (l109 < 2); l109 = (l109 + 1)) {
-			fRec103[l109] = 0.0;
-			
-		}
-		for (int l110 = 0; (l110 < 2); l110 = (l110 + 1)) {
-			fRec104[l110] = 0.0;
-			
-		}
-		for (int l111 = 0; (l111 < 2); l111 = (l111 + 1)) {
-			fRec105[l111] = 0.0;
-			
-		}
-		for (int l112 = 0; (l112 < 2); l112 = (l112 + 1)) {
-			fRec106[l112] = 0.0;
-			
-		}
-		for (int l113 = 0; (l113 < 2); l113 = (l113 + 1)) {
-			fRec107[l113] = 0.0;
-			
-		}
-		for (int l114 = 0; (l114 < 2); l114 = (l114 + 1)) {
-			fRec108[l114] = 0.0;
-			
-		}
-		for (int l115 = 0; (l115 < 2); l115 = (l115 + 1)) {
-			fRec109[l115] = 0.0;
-			
-		}
-		for (int l116 = 0; (l116 < 2); l116 = (l116 + 1)) {
-			fRec110[l116] = 0.0;
-			
-		}
-		for (int l117 = 0; (l117 < 2); l117 = (l117 + 1)) {
-			fRec111[l117] = 0.0;
-			
-		}
-		for (int l118 = 0; (l118 < 2); l118 = (l118 + 1)) {
-			fRec112[l118] = 0.0;
-			
-		}
-		for (int l119 = 0; (l119 < 2); l119 = (l119 + 1)) {
-			fRec113[l119] = 0.0;
-			
-		}
 		
 	}
 	
@@ -1702,257 +1404,107 @@ class mydsp : public dsp {
 		ui_interface->declare(0, "~", "");
 		ui_interface->openHorizontalBox("1-25");
 		ui_interface->openVerticalBox("1");
-		ui_interface->declare(&fVbargraph0, "osc", "/output1 -70 6");
-		ui_interface->declare(&fVbargraph0, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x3053950", &fVbargraph0, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("2");
-		ui_interface->declare(&fVbargraph1, "osc", "/output2 -70 6");
-		ui_interface->declare(&fVbargraph1, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x30608f0", &fVbargraph1, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("3");
-		ui_interface->declare(&fVbargraph2, "osc", "/output3 -70 6");
-		ui_interface->declare(&fVbargraph2, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x306bad0", &fVbargraph2, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("4");
-		ui_interface->declare(&fVbargraph3, "osc", "/output4 -70 6");
-		ui_interface->declare(&fVbargraph3, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x3076d90", &fVbargraph3, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("5");
-		ui_interface->declare(&fVbargraph4, "osc", "/output5 -70 6");
-		ui_interface->declare(&fVbargraph4, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x3082130", &fVbargraph4, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("6");
-		ui_interface->declare(&fVbargraph5, "osc", "/output6 -70 6");
-		ui_interface->declare(&fVbargraph5, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x308cb90", &fVbargraph5, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("7");
-		ui_interface->declare(&fVbargraph6, "osc", "/output7 -70 6");
-		ui_interface->declare(&fVbargraph6, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x3098070", &fVbargraph6, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("8");
-		ui_interface->declare(&fVbargraph7, "osc", "/output8 -70 6");
-		ui_interface->declare(&fVbargraph7, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x30a2cd0", &fVbargraph7, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("9");
-		ui_interface->declare(&fVbargraph8, "osc", "/output9 -70 6");
-		ui_interface->declare(&fVbargraph8, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x30ada10", &fVbargraph8, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("10");
-		ui_interface->declare(&fVbargraph9, "osc", "/output10 -70 6");
-		ui_interface->declare(&fVbargraph9, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x30b8830", &fVbargraph9, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("11");
-		ui_interface->declare(&fVbargraph10, "osc", "/output11 -70 6");
-		ui_interface->declare(&fVbargraph10, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x30c4110", &fVbargraph10, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("12");
-		ui_interface->declare(&fVbargraph11, "osc", "/output12 -70 6");
-		ui_interface->declare(&fVbargraph11, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x30cfad0", &fVbargraph11, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("13");
-		ui_interface->declare(&fVbargraph12, "osc", "/output13 -70 6");
-		ui_interface->declare(&fVbargraph12, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x30db570", &fVbargraph12, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("14");
-		ui_interface->declare(&fVbargraph13, "osc", "/output14 -70 6");
-		ui_interface->declare(&fVbargraph13, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x30e70f0", &fVbargraph13, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("15");
-		ui_interface->declare(&fVbargraph14, "osc", "/output15 -70 6");
-		ui_interface->declare(&fVbargraph14, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x30f1f80", &fVbargraph14, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("16");
-		ui_interface->declare(&fVbargraph15, "osc", "/output16 -70 6");
-		ui_interface->declare(&fVbargraph15, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x30fcef0", &fVbargraph15, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("17");
-		ui_interface->declare(&fVbargraph16, "osc", "/output17 -70 6");
-		ui_interface->declare(&fVbargraph16, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x3107f40", &fVbargraph16, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("18");
-		ui_interface->declare(&fVbargraph17, "osc", "/output18 -70 6");
-		ui_interface->declare(&fVbargraph17, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x3113070", &fVbargraph17, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("19");
-		ui_interface->declare(&fVbargraph18, "osc", "/output19 -70 6");
-		ui_interface->declare(&fVbargraph18, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x311efd0", &fVbargraph18, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("20");
-		ui_interface->declare(&fVbargraph19, "osc", "/output20 -70 6");
-		ui_interface->declare(&fVbargraph19, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x312a6b0", &fVbargraph19, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("21");
-		ui_interface->declare(&fVbargraph20, "osc", "/output21 -70 6");
-		ui_interface->declare(&fVbargraph20, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x3135e70", &fVbargraph20, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("22");
-		ui_interface->declare(&fVbargraph21, "osc", "/output22 -70 6");
-		ui_interface->declare(&fVbargraph21, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x3141710", &fVbargraph21, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("23");
-		ui_interface->declare(&fVbargraph22, "osc", "/output23 -70 6");
-		ui_interface->declare(&fVbargraph22, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x314cca0", &fVbargraph22, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("24");
-		ui_interface->declare(&fVbargraph23, "osc", "/output24 -70 6");
-		ui_interface->declare(&fVbargraph23, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x3158310", &fVbargraph23, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("25");
-		ui_interface->declare(&fVbargraph24, "osc", "/output25 -70 6");
-		ui_interface->declare(&fVbargraph24, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x3163a60", &fVbargraph24, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->closeBox();
 		ui_interface->declare(0, "~", "");
 		ui_interface->openHorizontalBox("26-50");
 		ui_interface->openVerticalBox("26");
-		ui_interface->declare(&fVbargraph25, "osc", "/output26 -70 6");
-		ui_interface->declare(&fVbargraph25, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x316f290", &fVbargraph25, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("27");
-		ui_interface->declare(&fVbargraph26, "osc", "/output27 -70 6");
-		ui_interface->declare(&fVbargraph26, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x317aea0", &fVbargraph26, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("28");
-		ui_interface->declare(&fVbargraph27, "osc", "/output28 -70 6");
-		ui_interface->declare(&fVbargraph27, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x3185780", &fVbargraph27, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("29");
-		ui_interface->declare(&fVbargraph28, "osc", "/output29 -70 6");
-		ui_interface->declare(&fVbargraph28, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x3190140", &fVbargraph28, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("30");
-		ui_interface->declare(&fVbargraph29, "osc", "/output30 -70 6");
-		ui_interface->declare(&fVbargraph29, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x319abe0", &fVbargraph29, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("31");
-		ui_interface->declare(&fVbargraph30, "osc", "/output31 -70 6");
-		ui_interface->declare(&fVbargraph30, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x31a68c0", &fVbargraph30, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("32");
-		ui_interface->declare(&fVbargraph31, "osc", "/output32 -70 6");
-		ui_interface->declare(&fVbargraph31, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x31b1ef0", &fVbargraph31, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("33");
-		ui_interface->declare(&fVbargraph32, "osc", "/output33 -70 6");
-		ui_interface->declare(&fVbargraph32, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x31bd600", &fVbargraph32, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("34");
-		ui_interface->declare(&fVbargraph33, "osc", "/output34 -70 6");
-		ui_interface->declare(&fVbargraph33, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x31c8df0", &fVbargraph33, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("35");
-		ui_interface->declare(&fVbargraph34, "osc", "/output35 -70 6");
-		ui_interface->declare(&fVbargraph34, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x31d46c0", &fVbargraph34, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("36");
-		ui_interface->declare(&fVbargraph35, "osc", "/output36 -70 6");
-		ui_interface->declare(&fVbargraph35, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x31e0070", &fVbargraph35, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("37");
-		ui_interface->declare(&fVbargraph36, "osc", "/output37 -70 6");
-		ui_interface->declare(&fVbargraph36, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x31ebb00", &fVbargraph36, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("38");
-		ui_interface->declare(&fVbargraph37, "osc", "/output38 -70 6");
-		ui_interface->declare(&fVbargraph37, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x31f7670", &fVbargraph37, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("39");
-		ui_interface->declare(&fVbargraph38, "osc", "/output39 -70 6");
-		ui_interface->declare(&fVbargraph38, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x3202500", &fVbargraph38, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("40");
-		ui_interface->declare(&fVbargraph39, "osc", "/output40 -70 6");
-		ui_interface->declare(&fVbargraph39, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x320d470", &fVbargraph39, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("41");
-		ui_interface->declare(&fVbargraph40, "osc", "/output41 -70 6");
-		ui_interface->declare(&fVbargraph40, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x32184c0", &fVbargraph40, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("42");
-		ui_interface->declare(&fVbargraph41, "osc", "/output42 -70 6");
-		ui_interface->declare(&fVbargraph41, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x32235f0", &fVbargraph41, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("43");
-		ui_interface->declare(&fVbargraph42, "osc", "/output43 -70 6");
-		ui_interface->declare(&fVbargraph42, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x322e800", &fVbargraph42, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("44");
-		ui_interface->declare(&fVbargraph43, "osc", "/output44 -70 6");
-		ui_interface->declare(&fVbargraph43, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x3239af0", &fVbargraph43, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("45");
-		ui_interface->declare(&fVbargraph44, "osc", "/output45 -70 6");
-		ui_interface->declare(&fVbargraph44, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x3244ec0", &fVbargraph44, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("46");
-		ui_interface->declare(&fVbargraph45, "osc", "/output46 -70 6");
-		ui_interface->declare(&fVbargraph45, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x3250370", &fVbargraph45, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("47");
-		ui_interface->declare(&fVbargraph46, "osc", "/output47 -70 6");
-		ui_interface->declare(&fVbargraph46, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x325b900", &fVbargraph46, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("48");
-		ui_interface->declare(&fVbargraph47, "osc", "/output48 -70 6");
-		ui_interface->declare(&fVbargraph47, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x3266f70", &fVbargraph47, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("49");
-		ui_interface->declare(&fVbargraph48, "osc", "/output49 -70 6");
-		ui_interface->declare(&fVbargraph48, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x32726c0", &fVbargraph48, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->openVerticalBox("50");
-		ui_interface->declare(&fVbargraph49, "osc", "/output50 -70 6");
-		ui_interface->declare(&fVbargraph49, "unit", "dB");
-		ui_interface->addVerticalBargraph("0x327def0", &fVbargraph49, -70.0, 6.0);
 		ui_interface->closeBox();
 		ui_interface->closeBox();
 		ui_interface->closeBox();
@@ -2659,204 +2211,104 @@ class mydsp : public dsp {
 			fRec59[0] = (fSlow74 * (fRec60[0] - ((fSlow84 * fRec63[0]) + (fSlow83 * fRec64[0]))));
 			double fTemp13 = ((fSlow71 * ((fSlow73 * fTemp12) + (fSlow72 * fRec58[0]))) + (fRec50[0] + fRec59[0]));
 			double fTemp14 = (0.012698412698412698 * ((fSlow1 * ((fTemp2 + (fSlow20 * fTemp4)) + (fSlow37 * fTemp7))) + ((fTemp8 + (fSlow59 * fTemp10)) + (fSlow69 * fTemp13))));
-			fRec0[0] = max((fRec0[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp14))))));
-			fVbargraph0 = FAUSTFLOAT(fRec0[0]);
 			output0[i] = FAUSTFLOAT(fTemp14);
 			double fTemp15 = (0.012698412698412698 * ((fSlow88 * ((fTemp2 + (fSlow93 * fTemp4)) + (fSlow95 * fTemp7))) + ((fTemp8 + (fSlow96 * fTemp10)) + (fSlow97 * fTemp13))));
-			fRec65[0] = max((fRec65[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp15))))));
-			fVbargraph1 = FAUSTFLOAT(fRec65[0]);
 			output1[i] = FAUSTFLOAT(fTemp15);
 			double fTemp16 = (0.012698412698412698 * ((fSlow99 * ((fTemp2 + (fSlow103 * fTemp4)) + (fSlow105 * fTemp7))) + ((fTemp8 + (fSlow106 * fTemp10)) + (fSlow107 * fTemp13))));
-			fRec66[0] = max((fRec66[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp16))))));
-			fVbargraph2 = FAUSTFLOAT(fRec66[0]);
 			output2[i] = FAUSTFLOAT(fTemp16);
 			double fTemp17 = (0.012698412698412698 * ((fSlow109 * ((fTemp2 + (fSlow113 * fTemp4)) + (fSlow115 * fTemp7))) + ((fTemp8 + (fSlow116 * fTemp10)) + (fSlow117 * fTemp13))));
-			fRec67[0] = max((fRec67[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp17))))));
-			fVbargraph3 = FAUSTFLOAT(fRec67[0]);
 			output3[i] = FAUSTFLOAT(fTemp17);
 			double fTemp18 = (0.012698412698412698 * ((fSlow119 * ((fTemp2 + (fSlow123 * fTemp4)) + (fSlow125 * fTemp7))) + ((fTemp8 + (fSlow126 * fTemp10)) + (fSlow127 * fTemp13))));
-			fRec68[0] = max((fRec68[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp18))))));
-			fVbargraph4 = FAUSTFLOAT(fRec68[0]);
 			output4[i] = FAUSTFLOAT(fTemp18);
 			double fTemp19 = (0.012698412698412698 * ((fSlow128 * ((fTemp2 + (fSlow132 * fTemp4)) + (fSlow134 * fTemp7))) + ((fTemp8 + (fSlow135 * fTemp10)) + (fSlow136 * fTemp13))));
-			fRec69[0] = max((fRec69[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp19))))));
-			fVbargraph5 = FAUSTFLOAT(fRec69[0]);
 			output5[i] = FAUSTFLOAT(fTemp19);
 			double fTemp20 = (0.022574955908289243 * ((fSlow139 * ((fTemp2 + (fSlow143 * fTemp4)) + (fSlow145 * fTemp7))) + ((fTemp8 + (fSlow146 * fTemp10)) + (fSlow147 * fTemp13))));
-			fRec70[0] = max((fRec70[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp20))))));
-			fVbargraph6 = FAUSTFLOAT(fRec70[0]);
 			output6[i] = FAUSTFLOAT(fTemp20);
 			double fTemp21 = (0.022574955908289243 * ((fSlow149 * ((fTemp2 + (fSlow153 * fTemp4)) + (fSlow155 * fTemp7))) + ((fTemp8 + (fSlow156 * fTemp10)) + (fSlow157 * fTemp13))));
-			fRec71[0] = max((fRec71[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp21))))));
-			fVbargraph7 = FAUSTFLOAT(fRec71[0]);
 			output7[i] = FAUSTFLOAT(fTemp21);
 			double fTemp22 = (0.022574955908289243 * ((fSlow159 * ((fTemp2 + (fSlow163 * fTemp4)) + (fSlow165 * fTemp7))) + ((fTemp8 + (fSlow166 * fTemp10)) + (fSlow167 * fTemp13))));
-			fRec72[0] = max((fRec72[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp22))))));
-			fVbargraph8 = FAUSTFLOAT(fRec72[0]);
 			output8[i] = FAUSTFLOAT(fTemp22);
 			double fTemp23 = (0.022574955908289243 * ((fSlow169 * ((fTemp2 + (fSlow173 * fTemp4)) + (fSlow175 * fTemp7))) + ((fTemp8 + (fSlow176 * fTemp10)) + (fSlow177 * fTemp13))));
-			fRec73[0] = max((fRec73[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp23))))));
-			fVbargraph9 = FAUSTFLOAT(fRec73[0]);
 			output9[i] = FAUSTFLOAT(fTemp23);
 			double fTemp24 = (0.022574955908289243 * ((fSlow179 * ((fTemp2 + (fSlow183 * fTemp4)) + (fSlow185 * fTemp7))) + ((fTemp8 + (fSlow186 * fTemp10)) + (fSlow187 * fTemp13))));
-			fRec74[0] = max((fRec74[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp24))))));
-			fVbargraph10 = FAUSTFLOAT(fRec74[0]);
 			output10[i] = FAUSTFLOAT(fTemp24);
 			double fTemp25 = (0.022574955908289243 * ((fSlow189 * ((fTemp2 + (fSlow193 * fTemp4)) + (fSlow195 * fTemp7))) + ((fTemp8 + (fSlow196 * fTemp10)) + (fSlow197 * fTemp13))));
-			fRec75[0] = max((fRec75[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp25))))));
-			fVbargraph11 = FAUSTFLOAT(fRec75[0]);
 			output11[i] = FAUSTFLOAT(fTemp25);
 			double fTemp26 = (0.022574955908289243 * ((fSlow199 * ((fTemp2 + (fSlow203 * fTemp4)) + (fSlow205 * fTemp7))) + ((fTemp8 + (fSlow206 * fTemp10)) + (fSlow207 * fTemp13))));
-			fRec76[0] = max((fRec76[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp26))))));
-			fVbargraph12 = FAUSTFLOAT(fRec76[0]);
 			output12[i] = FAUSTFLOAT(fTemp26);
 			double fTemp27 = (0.022574955908289243 * ((fSlow209 * ((fTemp2 + (fSlow213 * fTemp4)) + (fSlow215 * fTemp7))) + ((fTemp8 + (fSlow216 * fTemp10)) + (fSlow217 * fTemp13))));
-			fRec77[0] = max((fRec77[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp27))))));
-			fVbargraph13 = FAUSTFLOAT(fRec77[0]);
 			output13[i] = FAUSTFLOAT(fTemp27);
 			double fTemp28 = (0.022574955908289243 * ((fSlow218 * ((fTemp2 + (fSlow222 * fTemp4)) + (fSlow224 * fTemp7))) + ((fTemp8 + (fSlow225 * fTemp10)) + (fSlow226 * fTemp13))));
-			fRec78[0] = max((fRec78[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp28))))));
-			fVbargraph14 = FAUSTFLOAT(fRec78[0]);
 			output14[i] = FAUSTFLOAT(fTemp28);
 			double fTemp29 = (0.022574955908289243 * ((fSlow227 * ((fTemp2 + (fSlow231 * fTemp4)) + (fSlow233 * fTemp7))) + ((fTemp8 + (fSlow234 * fTemp10)) + (fSlow235 * fTemp13))));
-			fRec79[0] = max((fRec79[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp29))))));
-			fVbargraph15 = FAUSTFLOAT(fRec79[0]);
 			output15[i] = FAUSTFLOAT(fTemp29);
 			double fTemp30 = (0.022574955908289243 * ((fSlow236 * ((fTemp2 + (fSlow240 * fTemp4)) + (fSlow242 * fTemp7))) + ((fTemp8 + (fSlow243 * fTemp10)) + (fSlow244 * fTemp13))));
-			fRec80[0] = max((fRec80[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp30))))));
-			fVbargraph16 = FAUSTFLOAT(fRec80[0]);
 			output16[i] = FAUSTFLOAT(fTemp30);
 			double fTemp31 = (0.022574955908289243 * ((fSlow245 * ((fTemp2 + (fSlow249 * fTemp4)) + (fSlow251 * fTemp7))) + ((fTemp8 + (fSlow252 * fTemp10)) + (fSlow253 * fTemp13))));
-			fRec81[0] = max((fRec81[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp31))))));
-			fVbargraph17 = FAUSTFLOAT(fRec81[0]);
 			output17[i] = FAUSTFLOAT(fTemp31);
 			double fTemp32 = (0.021093750000000001 * ((fSlow256 * ((fTemp2 + (fSlow260 * fTemp4)) + (fSlow262 * fTemp7))) + ((fTemp8 + (fSlow263 * fTemp10)) + (fSlow264 * fTemp13))));
-			fRec82[0] = max((fRec82[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp32))))));
-			fVbargraph18 = FAUSTFLOAT(fRec82[0]);
 			output18[i] = FAUSTFLOAT(fTemp32);
 			double fTemp33 = (0.021093750000000001 * ((fSlow266 * ((fTemp2 + (fSlow270 * fTemp4)) + (fSlow272 * fTemp7))) + ((fTemp8 + (fSlow273 * fTemp10)) + (fSlow274 * fTemp13))));
-			fRec83[0] = max((fRec83[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp33))))));
-			fVbargraph19 = FAUSTFLOAT(fRec83[0]);
 			output19[i] = FAUSTFLOAT(fTemp33);
 			double fTemp34 = (0.021093750000000001 * ((fSlow276 * ((fTemp2 + (fSlow280 * fTemp4)) + (fSlow282 * fTemp7))) + ((fTemp8 + (fSlow283 * fTemp10)) + (fSlow284 * fTemp13))));
-			fRec84[0] = max((fRec84[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp34))))));
-			fVbargraph20 = FAUSTFLOAT(fRec84[0]);
 			output20[i] = FAUSTFLOAT(fTemp34);
 			double fTemp35 = (0.021093750000000001 * ((fSlow286 * ((fTemp2 + (fSlow290 * fTemp4)) + (fSlow292 * fTemp7))) + ((fTemp8 + (fSlow293 * fTemp10)) + (fSlow294 * fTemp13))));
-			fRec85[0] = max((fRec85[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp35))))));
-			fVbargraph21 = FAUSTFLOAT(fRec85[0]);
 			output21[i] = FAUSTFLOAT(fTemp35);
 			double fTemp36 = (0.021093750000000001 * ((fSlow295 * ((fTemp2 + (fSlow299 * fTemp4)) + (fSlow301 * fTemp7))) + ((fTemp8 + (fSlow302 * fTemp10)) + (fSlow303 * fTemp13))));
-			fRec86[0] = max((fRec86[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp36))))));
-			fVbargraph22 = FAUSTFLOAT(fRec86[0]);
 			output22[i] = FAUSTFLOAT(fTemp36);
 			double fTemp37 = (0.021093750000000001 * ((fSlow304 * ((fTemp2 + (fSlow308 * fTemp4)) + (fSlow310 * fTemp7))) + ((fTemp8 + (fSlow311 * fTemp10)) + (fSlow312 * fTemp13))));
-			fRec87[0] = max((fRec87[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp37))))));
-			fVbargraph23 = FAUSTFLOAT(fRec87[0]);
 			output23[i] = FAUSTFLOAT(fTemp37);
 			double fTemp38 = (0.021093750000000001 * ((fSlow313 * ((fTemp2 + (fSlow317 * fTemp4)) + (fSlow319 * fTemp7))) + ((fTemp8 + (fSlow320 * fTemp10)) + (fSlow321 * fTemp13))));
-			fRec88[0] = max((fRec88[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp38))))));
-			fVbargraph24 = FAUSTFLOAT(fRec88[0]);
 			output24[i] = FAUSTFLOAT(fTemp38);
 			double fTemp39 = (0.021093750000000001 * ((fSlow322 * ((fTemp2 + (fSlow326 * fTemp4)) + (fSlow328 * fTemp7))) + ((fTemp8 + (fSlow329 * fTemp10)) + (fSlow330 * fTemp13))));
-			fRec89[0] = max((fRec89[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp39))))));
-			fVbargraph25 = FAUSTFLOAT(fRec89[0]);
 			output25[i] = FAUSTFLOAT(fTemp39);
 			double fTemp40 = (0.02017333553791887 * ((fSlow333 * ((fTemp2 + (fSlow337 * fTemp4)) + (fSlow339 * fTemp7))) + ((fTemp8 + (fSlow340 * fTemp10)) + (fSlow341 * fTemp13))));
-			fRec90[0] = max((fRec90[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp40))))));
-			fVbargraph26 = FAUSTFLOAT(fRec90[0]);
 			output26[i] = FAUSTFLOAT(fTemp40);
 			double fTemp41 = (0.02017333553791887 * ((fSlow343 * ((fTemp2 + (fSlow347 * fTemp4)) + (fSlow349 * fTemp7))) + ((fTemp8 + (fSlow350 * fTemp10)) + (fSlow351 * fTemp13))));
-			fRec91[0] = max((fRec91[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp41))))));
-			fVbargraph27 = FAUSTFLOAT(fRec91[0]);
 			output27[i] = FAUSTFLOAT(fTemp41);
 			double fTemp42 = (0.02017333553791887 * ((fSlow353 * ((fTemp2 + (fSlow357 * fTemp4)) + (fSlow359 * fTemp7))) + ((fTemp8 + (fSlow360 * fTemp10)) + (fSlow361 * fTemp13))));
-			fRec92[0] = max((fRec92[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp42))))));
-			fVbargraph28 = FAUSTFLOAT(fRec92[0]);
 			output28[i] = FAUSTFLOAT(fTemp42);
 			double fTemp43 = (0.02017333553791887 * ((fSlow363 * ((fTemp2 + (fSlow367 * fTemp4)) + (fSlow369 * fTemp7))) + ((fTemp8 + (fSlow370 * fTemp10)) + (fSlow371 * fTemp13))));
-			fRec93[0] = max((fRec93[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp43))))));
-			fVbargraph29 = FAUSTFLOAT(fRec93[0]);
 			output29[i] = FAUSTFLOAT(fTemp43);
 			double fTemp44 = (0.02017333553791887 * ((fSlow374 * ((fTemp2 + (fSlow378 * fTemp4)) + (fSlow380 * fTemp7))) + ((fTemp8 + (fSlow381 * fTemp10)) + (fSlow382 * fTemp13))));
-			fRec94[0] = max((fRec94[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp44))))));
-			fVbargraph30 = FAUSTFLOAT(fRec94[0]);
 			output30[i] = FAUSTFLOAT(fTemp44);
 			double fTemp45 = (0.02017333553791887 * ((fSlow384 * ((fTemp2 + (fSlow388 * fTemp4)) + (fSlow390 * fTemp7))) + ((fTemp8 + (fSlow391 * fTemp10)) + (fSlow392 * fTemp13))));
-			fRec95[0] = max((fRec95[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp45))))));
-			fVbargraph31 = FAUSTFLOAT(fRec95[0]);
 			output31[i] = FAUSTFLOAT(fTemp45);
 			double fTemp46 = (0.02017333553791887 * ((fSlow394 * ((fTemp2 + (fSlow398 * fTemp4)) + (fSlow400 * fTemp7))) + ((fTemp8 + (fSlow401 * fTemp10)) + (fSlow402 * fTemp13))));
-			fRec96[0] = max((fRec96[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp46))))));
-			fVbargraph32 = FAUSTFLOAT(fRec96[0]);
 			output32[i] = FAUSTFLOAT(fTemp46);
 			double fTemp47 = (0.02017333553791887 * ((fSlow404 * ((fTemp2 + (fSlow408 * fTemp4)) + (fSlow410 * fTemp7))) + ((fTemp8 + (fSlow411 * fTemp10)) + (fSlow412 * fTemp13))));
-			fRec97[0] = max((fRec97[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp47))))));
-			fVbargraph33 = FAUSTFLOAT(fRec97[0]);
 			output33[i] = FAUSTFLOAT(fTemp47);
 			double fTemp48 = (0.02017333553791887 * ((fSlow414 * ((fTemp2 + (fSlow418 * fTemp4)) + (fSlow420 * fTemp7))) + ((fTemp8 + (fSlow421 * fTemp10)) + (fSlow422 * fTemp13))));
-			fRec98[0] = max((fRec98[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp48))))));
-			fVbargraph34 = FAUSTFLOAT(fRec98[0]);
 			output34[i] = FAUSTFLOAT(fTemp48);
 			double fTemp49 = (0.02017333553791887 * ((fSlow424 * ((fTemp2 + (fSlow428 * fTemp4)) + (fSlow430 * fTemp7))) + ((fTemp8 + (fSlow431 * fTemp10)) + (fSlow432 * fTemp13))));
-			fRec99[0] = max((fRec99[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp49))))));
-			fVbargraph35 = FAUSTFLOAT(fRec99[0]);
 			output35[i] = FAUSTFLOAT(fTemp49);
 			double fTemp50 = (0.02017333553791887 * ((fSlow434 * ((fTemp2 + (fSlow438 * fTemp4)) + (fSlow440 * fTemp7))) + ((fTemp8 + (fSlow441 * fTemp10)) + (fSlow442 * fTemp13))));
-			fRec100[0] = max((fRec100[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp50))))));
-			fVbargraph36 = FAUSTFLOAT(fRec100[0]);
 			output36[i] = FAUSTFLOAT(fTemp50);
 			double fTemp51 = (0.02017333553791887 * ((fSlow444 * ((fTemp2 + (fSlow448 * fTemp4)) + (fSlow450 * fTemp7))) + ((fTemp8 + (fSlow451 * fTemp10)) + (fSlow452 * fTemp13))));
-			fRec101[0] = max((fRec101[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp51))))));
-			fVbargraph37 = FAUSTFLOAT(fRec101[0]);
 			output37[i] = FAUSTFLOAT(fTemp51);
 			double fTemp52 = (0.02017333553791887 * ((fSlow453 * ((fTemp2 + (fSlow457 * fTemp4)) + (fSlow459 * fTemp7))) + ((fTemp8 + (fSlow460 * fTemp10)) + (fSlow461 * fTemp13))));
-			fRec102[0] = max((fRec102[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp52))))));
-			fVbargraph38 = FAUSTFLOAT(fRec102[0]);
 			output38[i] = FAUSTFLOAT(fTemp52);
 			double fTemp53 = (0.02017333553791887 * ((fSlow462 * ((fTemp2 + (fSlow466 * fTemp4)) + (fSlow468 * fTemp7))) + ((fTemp8 + (fSlow469 * fTemp10)) + (fSlow470 * fTemp13))));
-			fRec103[0] = max((fRec103[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp53))))));
-			fVbargraph39 = FAUSTFLOAT(fRec103[0]);
 			output39[i] = FAUSTFLOAT(fTemp53);
 			double fTemp54 = (0.02017333553791887 * ((fSlow471 * ((fTemp2 + (fSlow475 * fTemp4)) + (fSlow477 * fTemp7))) + ((fTemp8 + (fSlow478 * fTemp10)) + (fSlow479 * fTemp13))));
-			fRec104[0] = max((fRec104[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp54))))));
-			fVbargraph40 = FAUSTFLOAT(fRec104[0]);
 			output40[i] = FAUSTFLOAT(fTemp54);
 			double fTemp55 = (0.02017333553791887 * ((fSlow480 * ((fTemp2 + (fSlow484 * fTemp4)) + (fSlow486 * fTemp7))) + ((fTemp8 + (fSlow487 * fTemp10)) + (fSlow488 * fTemp13))));
-			fRec105[0] = max((fRec105[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp55))))));
-			fVbargraph41 = FAUSTFLOAT(fRec105[0]);
 			output41[i] = FAUSTFLOAT(fTemp55);
 			double fTemp56 = (0.02017333553791887 * ((fSlow489 * ((fTemp2 + (fSlow493 * fTemp4)) + (fSlow495 * fTemp7))) + ((fTemp8 + (fSlow496 * fTemp10)) + (fSlow497 * fTemp13))));
-			fRec106[0] = max((fRec106[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp56))))));
-			fVbargraph42 = FAUSTFLOAT(fRec106[0]);
 			output42[i] = FAUSTFLOAT(fTemp56);
 			double fTemp57 = (0.02017333553791887 * ((fSlow498 * ((fTemp2 + (fSlow502 * fTemp4)) + (fSlow504 * fTemp7))) + ((fTemp8 + (fSlow505 * fTemp10)) + (fSlow506 * fTemp13))));
-			fRec107[0] = max((fRec107[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp57))))));
-			fVbargraph43 = FAUSTFLOAT(fRec107[0]);
 			output43[i] = FAUSTFLOAT(fTemp57);
 			double fTemp58 = (0.02017333553791887 * ((fSlow507 * ((fTemp2 + (fSlow511 * fTemp4)) + (fSlow513 * fTemp7))) + ((fTemp8 + (fSlow514 * fTemp10)) + (fSlow515 * fTemp13))));
-			fRec108[0] = max((fRec108[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp58))))));
-			fVbargraph44 = FAUSTFLOAT(fRec108[0]);
 			output44[i] = FAUSTFLOAT(fTemp58);
 			double fTemp59 = (0.02017333553791887 * ((fSlow516 * ((fTemp2 + (fSlow520 * fTemp4)) + (fSlow522 * fTemp7))) + ((fTemp8 + (fSlow523 * fTemp10)) + (fSlow524 * fTemp13))));
-			fRec109[0] = max((fRec109[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp59))))));
-			fVbargraph45 = FAUSTFLOAT(fRec109[0]);
 			output45[i] = FAUSTFLOAT(fTemp59);
 			double fTemp60 = (0.02017333553791887 * ((fSlow525 * ((fTemp2 + (fSlow529 * fTemp4)) + (fSlow531 * fTemp7))) + ((fTemp8 + (fSlow532 * fTemp10)) + (fSlow533 * fTemp13))));
-			fRec110[0] = max((fRec110[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp60))))));
-			fVbargraph46 = FAUSTFLOAT(fRec110[0]);
 			output46[i] = FAUSTFLOAT(fTemp60);
 			double fTemp61 = (0.02017333553791887 * ((fSlow534 * ((fTemp2 + (fSlow538 * fTemp4)) + (fSlow540 * fTemp7))) + ((fTemp8 + (fSlow541 * fTemp10)) + (fSlow542 * fTemp13))));
-			fRec111[0] = max((fRec111[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp61))))));
-			fVbargraph47 = FAUSTFLOAT(fRec111[0]);
 			output47[i] = FAUSTFLOAT(fTemp61);
 			double fTemp62 = (0.02017333553791887 * ((fSlow543 * ((fTemp2 + (fSlow547 * fTemp4)) + (fSlow549 * fTemp7))) + ((fTemp8 + (fSlow550 * fTemp10)) + (fSlow551 * fTemp13))));
-			fRec112[0] = max((fRec112[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp62))))));
-			fVbargraph48 = FAUSTFLOAT(fRec112[0]);
 			output48[i] = FAUSTFLOAT(fTemp62);
 			double fTemp63 = (0.02017333553791887 * ((fSlow552 * ((fTemp2 + (fSlow556 * fTemp4)) + (fSlow558 * fTemp7))) + ((fTemp8 + (fSlow559 * fTemp10)) + (fSlow560 * fTemp13))));
-			fRec113[0] = max((fRec113[1] - fConst1), min(6.0, (20.0 * log10(max(0.00031622776601683794, fabs(fTemp63))))));
-			fVbargraph49 = FAUSTFLOAT(fRec113[0]);
 			output49[i] = FAUSTFLOAT(fTemp63);
 			fRec3[1] = fRec3[0];
 			fRec4[1] = fRec4[0];
@@ -2928,56 +2380,6 @@ class mydsp : public dsp {
 			fRec63[1] = fRec63[0];
 			fRec64[1] = fRec64[0];
 			fRec59[1] = fRec59[0];
-			fRec0[1] = fRec0[0];
-			fRec65[1] = fRec65[0];
-			fRec66[1] = fRec66[0];
-			fRec67[1] = fRec67[0];
-			fRec68[1] = fRec68[0];
-			fRec69[1] = fRec69[0];
-			fRec70[1] = fRec70[0];
-			fRec71[1] = fRec71[0];
-			fRec72[1] = fRec72[0];
-			fRec73[1] = fRec73[0];
-			fRec74[1] = fRec74[0];
-			fRec75[1] = fRec75[0];
-			fRec76[1] = fRec76[0];
-			fRec77[1] = fRec77[0];
-			fRec78[1] = fRec78[0];
-			fRec79[1] = fRec79[0];
-			fRec80[1] = fRec80[0];
-			fRec81[1] = fRec81[0];
-			fRec82[1] = fRec82[0];
-			fRec83[1] = fRec83[0];
-			fRec84[1] = fRec84[0];
-			fRec85[1] = fRec85[0];
-			fRec86[1] = fRec86[0];
-			fRec87[1] = fRec87[0];
-			fRec88[1] = fRec88[0];
-			fRec89[1] = fRec89[0];
-			fRec90[1] = fRec90[0];
-			fRec91[1] = fRec91[0];
-			fRec92[1] = fRec92[0];
-			fRec93[1] = fRec93[0];
-			fRec94[1] = fRec94[0];
-			fRec95[1] = fRec95[0];
-			fRec96[1] = fRec96[0];
-			fRec97[1] = fRec97[0];
-			fRec98[1] = fRec98[0];
-			fRec99[1] = fRec99[0];
-			fRec100[1] = fRec100[0];
-			fRec101[1] = fRec101[0];
-			fRec102[1] = fRec102[0];
-			fRec103[1] = fRec103[0];
-			fRec104[1] = fRec104[0];
-			fRec105[1] = fRec105[0];
-			fRec106[1] = fRec106[0];
-			fRec107[1] = fRec107[0];
-			fRec108[1] = fRec108[0];
-			fRec109[1] = fRec109[0];
-			fRec110[1] = fRec110[0];
-			fRec111[1] = fRec111[0];
-			fRec112[1] = fRec112[0];
-			fRec113[1] = fRec113[0];
 			
 		}
 		
@@ -2988,17 +2390,24 @@ class mydsp : public dsp {
 
 //----------------------------------------------------------------------------
 // SuperCollider/Faust interface
+// Input handling patched by patch_wrapper.py
 //----------------------------------------------------------------------------
 
 struct Faust : public Unit
 {
     // Faust dsp instance
     FAUSTCLASS*  mDSP;
-    // Buffers for control to audio rate conversion
+    // Input buffers passed to compute() when some audio inputs are not
+    // audio rate.  The mNumCopies control rate inputs listed in
+    // mCopyInputs are interpolated into copies, the others are used
+    // in place.
     float**     mInBufCopy;
     float*      mInBufValue;
-    // Controls
+    int*        mCopyInputs;
+    int         mNumCopies;
+    // Controls, the first mNumDynamicControls are not scalar rate
     size_t      mNumControls;
+    size_t      mNumDynamicControls;
     // NOTE: This needs to be the last field!
     //
     // The unit allocates additional memory according to the number
@@ -3108,15 +2517,42 @@ inline static void copyBuffer(float* dst, int n, float* src)
 }
 
 inline static void Faust_updateControls(Faust* unit)
+{
+    // Scalar rate controls are set in the constructor, the others are
+    // only updated when their input changed.
+    Control* controls = unit->mControls;
+    size_t numControls = unit->mNumDynamicControls;
+    for (size_t i = 0; i < numControls; ++i) {
+        Control* control = controls + i;
+        float value = IN0(control->input);
+        if (value != control->lastValue) {
+            control->lastValue = value;
+            control->update(value);
+        }
+    }
+}
+
+// Set every control from its input, and move the controls that are not
+// scalar rate to the front of mControls.
+static void Faust_initControls(Faust* unit)
 {
     Control* controls = unit->mControls;
     size_t numControls = unit->mNumControls;
+    size_t numDynamic = 0;
     int curControl = unit->mDSP->getNumInputs();
-    for (int i = 0; i < numControls; ++i) {
-        float value = IN0(curControl);
-        (controls++)->update(value);
-        curControl++;
+    for (size_t i = 0; i < numControls; ++i) {
+        Control* control = controls + i;
+        control->input = curControl + (int)i;
+        control->lastValue = IN0(control->input);
+        control->update(control->lastValue);
+        if (INRATE(control->input) != calc_ScalarRate) {
+            Control tmp = controls[numDynamic];
+            controls[numDynamic] = *control;
+            *control = tmp;
+            numDynamic++;
+        }
     }
+    unit->mNumDynamicControls = numDynamic;
 }
 
 void Faust_next(Faust* unit, int inNumSamples)
@@ -3131,18 +2567,13 @@ void Faust_next_copy(Faust* unit, int inNumSamples)
 {
     // update controls
     Faust_updateControls(unit);
-    // Copy buffers
-    for (int i = 0; i < unit->getNumAudioInputs(); ++i) {
-        float* b = unit->mInBufCopy[i];
-        if (INRATE(i) == calc_FullRate) {
-            // Audio rate: copy buffer
-            copyBuffer(b, inNumSamples, unit->mInBuf[i]);
-        } else {
-            // Control rate: linearly interpolate input
-            float v1 = IN0(i);
-            fillBuffer(b, inNumSamples, unit->mInBufValue[i], v1);
-            unit->mInBufValue[i] = v1;
-        }
+    // Control rate: linearly interpolate input, the audio rate buffers
+    // are used in place
+    for (int k = 0; k < unit->mNumCopies; ++k) {
+        int i = unit->mCopyInputs[k];
+        float v1 = IN0(i);
+        fillBuffer(unit->mInBufCopy[i], inNumSamples, unit->mInBufValue[k], v1);
+        unit->mInBufValue[k] = v1;
     }
     // dsp computation
     unit->mDSP->compute(inNumSamples, unit->mInBufCopy, unit->mOutBuf);
@@ -3155,6 +2586,12 @@ void Faust_next_clear(Faust* unit, int inNumSamples)
 
 void Faust_Ctor(Faust* unit)  // module constructor
 {
+    unit->mInBufCopy  = 0;
+    unit->mInBufValue = 0;
+    unit->mCopyInputs = 0;
+    unit->mNumCopies  = 0;
+    SETCALC(Faust_next_clear);
+
     // allocate dsp
     unit->mDSP = new(RTAlloc(unit->mWorld, sizeof(FAUSTCLASS))) FAUSTCLASS();
     if (!unit->mDSP) {
@@ -3164,14 +2601,12 @@ void Faust_Ctor(Faust* unit)  // module constructor
     {
         // init dsp
         unit->mDSP->instanceInit((int)SAMPLERATE);
-     
+
         // allocate controls
         unit->mNumControls = g_numControls;
         ControlAllocator ca(unit->mControls);
         unit->mDSP->buildUserInterface(&ca);
-        unit->mInBufCopy  = 0;
-        unit->mInBufValue = 0;
-     
+
         // check input/output channel configuration
         const size_t numInputs = unit->mDSP->getNumInputs() + unit->mNumControls;
         const size_t numOutputs = unit->mDSP->getNumOutputs();
@@ -3179,41 +2614,48 @@ void Faust_Ctor(Faust* unit)  // module constructor
         bool channelsValid = (numInputs == unit->mNumInputs) && (numOutputs == unit->mNumOutputs);
 
         if (channelsValid) {
-            bool rateValid = true;
-            for (int i = 0; i < unit->getNumAudioInputs(); ++i) {
+            Faust_initControls(unit);
+
+            const int numAudioInputs = unit->getNumAudioInputs();
+            int numCopies = 0;
+            for (int i = 0; i < numAudioInputs; ++i) {
                 if (INRATE(i) != calc_FullRate) {
-                    rateValid = false;
-                    break;
+                    numCopies++;
                 }
             }
-            if (rateValid) {
+            if (numCopies == 0) {
                 SETCALC(Faust_next);
             } else {
-                unit->mInBufCopy = (float**)RTAlloc(unit->mWorld, unit->getNumAudioInputs()*sizeof(float*));
-                if (!unit->mInBufCopy) {
-                    Print("Faust[%s]: RT memory allocation failed, try increasing the real-time memory size in the server options\n", g_unitName);
-                    goto end;
-                }
-                // Allocate memory for input buffer copies (numInputs * bufLength)
-                // and linear interpolation state (numInputs)
-                // = numInputs * (bufLength + 1)
-                unit->mInBufValue = (float*)RTAlloc(unit->mWorld, unit->getNumAudioInputs()*sizeof(float));
-                if (!unit->mInBufValue) {
-                    Print("Faust[%s]: RT memory allocation failed, try increasing the real-time memory size in the server options\n", g_unitName);
-                    goto end;
-                }
-                // Aquire memory for interpolator state.
-                float* mem = (float*)RTAlloc(unit->mWorld, unit->getNumAudioInputs()*BUFLENGTH*sizeof(float));
-                if (mem) {
+                // One block holds the buffer pointers of all audio inputs,
+                // then for each input that is not audio rate its
+                // interpolator state, buffer and index.
+                char* mem = (char*)RTAlloc(unit->mWorld,
+                                           numAudioInputs*sizeof(float*)
+                                           + numCopies*((BUFLENGTH + 1)*sizeof(float) + sizeof(int)));
+                if (!mem) {
                     Print("Faust[%s]: RT memory allocation failed, try increasing the real-time memory size in the server options\n", g_unitName);
                     goto end;
                 }
-                for (int i = 0; i < unit->getNumAudioInputs(); ++i) {
-                    // Initialize interpolator.
-                    unit->mInBufValue[i] = IN0(i);
-                    // Aquire buffer memory.
-                    unit->mInBufCopy[i] = mem;
-                    mem += BUFLENGTH;
+                unit->mInBufCopy  = (float**)mem;
+                unit->mInBufValue = (float*)(unit->mInBufCopy + numAudioInputs);
+                float* buffer     = unit->mInBufValue + numCopies;
+                unit->mCopyInputs = (int*)(buffer + numCopies*BUFLENGTH);
+                for (int i = 0; i < numAudioInputs; ++i) {
+                    if (INRATE(i) == calc_FullRate) {
+                        // Audio rate: use the buffer in place
+                        unit->mInBufCopy[i] = unit->mInBuf[i];
+                        continue;
+                    }
+                    unit->mInBufCopy[i] = buffer;
+                    if (INRATE(i) == calc_ScalarRate) {
+                        // Scalar rate: fill once
+                        fillBuffer(buffer, BUFLENGTH, IN0(i));
+                    } else {
+                        // Initialize interpolator.
+                        unit->mInBufValue[unit->mNumCopies] = IN0(i);
+                        unit->mCopyInputs[unit->mNumCopies++] = i;
+                    }
+                    buffer += BUFLENGTH;
                 }
                 SETCALC(Faust_next_copy);
             }
@@ -3221,9 +2663,13 @@ void Faust_Ctor(Faust* unit)  // module constructor
             Print("Faust[%s]:\n", g_unitName);
             Print("    Inputs:   %d\n"
                   "    Outputs:  %d\n"
-                  "    Callback: %s\n",
-                  numInputs, numOutputs,
-                  unit->mCalcFunc == (UnitCalcFunc)Faust_next ? "zero-copy" : "copy");
+                  "    Callback: %s\n"
+                  "    Interpolated inputs: %d of %d\n"
+                  "    Controls updated per block: %d of %d\n",
+                  (int)numInputs, (int)numOutputs,
+                  unit->mCalcFunc == (UnitCalcFunc)Faust_next ? "zero-copy" : "copy",
+                  unit->mNumCopies, numAudioInputs,
+                  (int)unit->mNumDynamicControls, (int)unit->mNumControls);
     #endif
         } else {
             Print("Faust[%s]:\n", g_unitName);
@@ -3233,10 +2679,9 @@ void Faust_Ctor(Faust* unit)  // module constructor
                   numInputs, unit->mNumInputs,
                   numOutputs, unit->mNumOutputs);
             Print("    Generating silence ...\n");
-            SETCALC(Faust_next_clear);
         }
     }
-    
+
 end:
     // Fix for https://github.com/grame-cncm/faust/issues/13
     ClearUnitOutputs(unit, 1);
@@ -3244,19 +2689,15 @@ end:
 
 void Faust_Dtor(Faust* unit)  // module destructor
 {
-    if (unit->mInBufValue) {
-        RTFree(unit->mWorld, unit->mInBufValue);
-    }
     if (unit->mInBufCopy) {
-        if (unit->mInBufCopy[0]) {
-            RTFree(unit->mWorld, unit->mInBufCopy[0]);
-        }
         RTFree(unit->mWorld, unit->mInBufCopy);
     }
-    
+
     // delete dsp
-    unit->mDSP->~FAUSTCLASS();
-    RTFree(unit->mWorld, unit->mDSP);
+    if (unit->mDSP) {
+        unit->mDSP->~FAUSTCLASS();
+        RTFree(unit->mWorld, unit->mDSP);
+    }
 }
 
 #ifdef SC_API_EXPORT
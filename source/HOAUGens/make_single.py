@@ -0,0 +1,81 @@
+#!/usr/bin/env python3
+"""Produce a single-precision variant of a generated HOAUGens source.
+
+The HOAUGens are generated with `faust -double`, so every compute() widens
+its float inputs to double and does all of its math in scalar double.
+This script rewrites the Faust generated section of such a file the way
+`faust -single` would have emitted it: `double` becomes `float` and every
+floating point literal gets an `f` suffix, so no expression is silently
+promoted back to double.
+
+When the sample loop of compute() carries no state from one sample to the
+next (no fRec/fVec/IOTA, i.e. the matrix-only decoders, converters,
+rotators and mirrors), it is prefixed with an ivdep pragma.  The wrapper
+registers the UGens with kUnitDef_CantAliasInputsToOutputs, so the input
+and output buffers never overlap, and the compiler can vectorize the loop
+without versioning it for every pair of the up to 242 channel pointers.
+
+Sources that were not compiled with -double are copied unchanged.
+
+Used by the build when HOA_UGENS_FLOAT is enabled:
+
+    ./make_single.py HOAPanLebedev263.cpp build/HOAPanLebedev263.cpp
+"""
+
+import re
+import sys
+
+BEGIN = "// FAUST generated code"
+END = "// SuperCollider/Faust interface"
+
+TOKEN_RE = re.compile(r'"(?:[^"\\]|\\.)*"|\b\d+\.\d*(?:e[-+]?\d+)?(?![\w.])|\bdouble\b')
+LOOP_RE = re.compile(r"^(\t+)(for \(int i = 0; \(i < count\); i = \(i \+ 1\)\) \{\n)(.*?)^\1\}$", re.M | re.S)
+STATE_RE = re.compile(r"\b(?:fRec|fVec|IOTA)")
+
+IVDEP = """#if defined(__clang__)
+#pragma clang loop vectorize(assume_safety)
+#elif defined(__GNUC__)
+#pragma GCC ivdep
+#endif
+"""
+
+
+def convert_token(m):
+    token = m.group(0)
+    if token.startswith('"'):
+        return token
+    if token == "double":
+        return "float"
+    return token + "f"
+
+
+def mark_loop(m):
+    if STATE_RE.search(m.group(3)):
+        return m.group(0)
+    return IVDEP + m.group(0)
+
+
+def make_single(text):
+    if "-double" not in text.split("*/", 1)[0]:
+        return text
+    head, rest = text.split(BEGIN, 1)
+    body, tail = rest.split(END, 1)
+    body = TOKEN_RE.sub(convert_token, body)
+    body = LOOP_RE.sub(mark_loop, body)
+    head = head.replace("-double", "-single (converted by make_single.py)", 1)
+    return head + BEGIN + body + END + tail
+
+
+def main(argv):
+    if len(argv) != 3:
+        sys.stderr.write("usage: %s input.cpp output.cpp\n" % argv[0])
+        return 2
+    with open(argv[1]) as f:
+        text = f.read()
+    with open(argv[2], "w") as f:
+        f.write(make_single(text))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
@@ -0,0 +1,307 @@
+#!/usr/bin/env python3
+"""Replace the input handling of the faust2supercollider wrapper.
+
+The stock wrapper switches to Faust_next_copy as soon as one audio input is
+not audio rate, and then copies every audio input buffer each block, even
+those it could pass to compute() in place.  It also calls the update
+function of every control each block, although scalar rate inputs never
+change.  With the 121 channel UGens and a single control rate input this
+is 120 needless buffer copies per block.
+
+This script rewrites the wrapper so that:
+
+  - Faust_next_copy passes the audio rate buffers in place, and only
+    interpolates the inputs that are control rate.  Scalar rate audio
+    inputs are filled once in the constructor.
+  - The controls are set once in the constructor.  Per block, only the
+    controls that are not scalar rate are read, and a control is only
+    updated when its input changed.
+  - The buffers are allocated in a single block, which also fixes the
+    inverted allocation check of the stock wrapper.
+  - With F2SC_DEBUG_MES (NDEBUG unset for the older wrapper), the debug
+    message reports the callback, the number of interpolated inputs and
+    the number of controls updated per block.
+
+Run it on the output of faust2supercollider after regenerating a UGen:
+
+    ./patch_wrapper.py HOAEncLebedev503.cpp ../DEINDUGens/GreyholeRaw.cpp ...
+
+Files that have already been patched, or that are not Faust generated,
+are left untouched.
+"""
+
+import re
+import sys
+
+MARKER = "// Input handling patched by patch_wrapper.py"
+
+CONTROL_OLD = """    UpdateFunction updateFunction;
+    FAUSTFLOAT* zone;
+    FAUSTFLOAT min, max;
+"""
+
+CONTROL_NEW = """    UpdateFunction updateFunction;
+    FAUSTFLOAT* zone;
+    FAUSTFLOAT min, max;
+    // Unit input of the control and its value at the last update
+    int input;
+    float lastValue;
+"""
+
+UNIT_OLD = """    // Buffers for control to audio rate conversion
+    float**     mInBufCopy;
+    float*      mInBufValue;
+    // Controls
+    size_t      mNumControls;
+"""
+
+UNIT_NEW = """    // Input buffers passed to compute() when some audio inputs are not
+    // audio rate.  The mNumCopies control rate inputs listed in
+    // mCopyInputs are interpolated into copies, the others are used
+    // in place.
+    float**     mInBufCopy;
+    float*      mInBufValue;
+    int*        mCopyInputs;
+    int         mNumCopies;
+    // Controls, the first mNumDynamicControls are not scalar rate
+    size_t      mNumControls;
+    size_t      mNumDynamicControls;
+"""
+
+INTERFACE = "// SuperCollider/Faust interface"
+
+FUNCTIONS_RE = re.compile(
+    r"^inline static void Faust_updateControls\(Faust\* unit\)\n.*?"
+    r"^void Faust_Dtor\(Faust\* unit\)  // module destructor\n\{\n.*?^\}\n",
+    re.M | re.S)
+
+DEBUG_RE = re.compile(r"^    #if (defined\(F2SC_DEBUG_MES\)|!defined\(NDEBUG\))$", re.M)
+
+FUNCTIONS = """inline static void Faust_updateControls(Faust* unit)
+{
+    // Scalar rate controls are set in the constructor, the others are
+    // only updated when their input changed.
+    Control* controls = unit->mControls;
+    size_t numControls = unit->mNumDynamicControls;
+    for (size_t i = 0; i < numControls; ++i) {
+        Control* control = controls + i;
+        float value = IN0(control->input);
+        if (value != control->lastValue) {
+            control->lastValue = value;
+            control->update(value);
+        }
+    }
+}
+
+// Set every control from its input, and move the controls that are not
+// scalar rate to the front of mControls.
+static void Faust_initControls(Faust* unit)
+{
+    Control* controls = unit->mControls;
+    size_t numControls = unit->mNumControls;
+    size_t numDynamic = 0;
+    int curControl = unit->mDSP->getNumInputs();
+    for (size_t i = 0; i < numControls; ++i) {
+        Control* control = controls + i;
+        control->input = curControl + (int)i;
+        control->lastValue = IN0(control->input);
+        control->update(control->lastValue);
+        if (INRATE(control->input) != calc_ScalarRate) {
+            Control tmp = controls[numDynamic];
+            controls[numDynamic] = *control;
+            *control = tmp;
+            numDynamic++;
+        }
+    }
+    unit->mNumDynamicControls = numDynamic;
+}
+
+void Faust_next(Faust* unit, int inNumSamples)
+{
+    // update controls
+    Faust_updateControls(unit);
+    // dsp computation
+    unit->mDSP->compute(inNumSamples, unit->mInBuf, unit->mOutBuf);
+}
+
+void Faust_next_copy(Faust* unit, int inNumSamples)
+{
+    // update controls
+    Faust_updateControls(unit);
+    // Control rate: linearly interpolate input, the audio rate buffers
+    // are used in place
+    for (int k = 0; k < unit->mNumCopies; ++k) {
+        int i = unit->mCopyInputs[k];
+        float v1 = IN0(i);
+        fillBuffer(unit->mInBufCopy[i], inNumSamples, unit->mInBufValue[k], v1);
+        unit->mInBufValue[k] = v1;
+    }
+    // dsp computation
+    unit->mDSP->compute(inNumSamples, unit->mInBufCopy, unit->mOutBuf);
+}
+
+void Faust_next_clear(Faust* unit, int inNumSamples)
+{
+    ClearUnitOutputs(unit, inNumSamples);
+}
+
+void Faust_Ctor(Faust* unit)  // module constructor
+{
+    unit->mInBufCopy  = 0;
+    unit->mInBufValue = 0;
+    unit->mCopyInputs = 0;
+    unit->mNumCopies  = 0;
+    SETCALC(Faust_next_clear);
+
+    // allocate dsp
+    unit->mDSP = new(RTAlloc(unit->mWorld, sizeof(FAUSTCLASS))) FAUSTCLASS();
+    if (!unit->mDSP) {
+        Print("Faust[%s]: RT memory allocation failed, try increasing the real-time memory size in the server options\\n", g_unitName);
+        goto end;
+    }
+    {
+        // init dsp
+        unit->mDSP->instanceInit((int)SAMPLERATE);
+
+        // allocate controls
+        unit->mNumControls = g_numControls;
+        ControlAllocator ca(unit->mControls);
+        unit->mDSP->buildUserInterface(&ca);
+
+        // check input/output channel configuration
+        const size_t numInputs = unit->mDSP->getNumInputs() + unit->mNumControls;
+        const size_t numOutputs = unit->mDSP->getNumOutputs();
+
+        bool channelsValid = (numInputs == unit->mNumInputs) && (numOutputs == unit->mNumOutputs);
+
+        if (channelsValid) {
+            Faust_initControls(unit);
+
+            const int numAudioInputs = unit->getNumAudioInputs();
+            int numCopies = 0;
+            for (int i = 0; i < numAudioInputs; ++i) {
+                if (INRATE(i) != calc_FullRate) {
+                    numCopies++;
+                }
+            }
+            if (numCopies == 0) {
+                SETCALC(Faust_next);
+            } else {
+                // One block holds the buffer pointers of all audio inputs,
+                // then for each input that is not audio rate its
+                // interpolator state, buffer and index.
+                char* mem = (char*)RTAlloc(unit->mWorld,
+                                           numAudioInputs*sizeof(float*)
+                                           + numCopies*((BUFLENGTH + 1)*sizeof(float) + sizeof(int)));
+                if (!mem) {
+                    Print("Faust[%s]: RT memory allocation failed, try increasing the real-time memory size in the server options\\n", g_unitName);
+                    goto end;
+                }
+                unit->mInBufCopy  = (float**)mem;
+                unit->mInBufValue = (float*)(unit->mInBufCopy + numAudioInputs);
+                float* buffer     = unit->mInBufValue + numCopies;
+                unit->mCopyInputs = (int*)(buffer + numCopies*BUFLENGTH);
+                for (int i = 0; i < numAudioInputs; ++i) {
+                    if (INRATE(i) == calc_FullRate) {
+                        // Audio rate: use the buffer in place
+                        unit->mInBufCopy[i] = unit->mInBuf[i];
+                        continue;
+                    }
+                    unit->mInBufCopy[i] = buffer;
+                    if (INRATE(i) == calc_ScalarRate) {
+                        // Scalar rate: fill once
+                        fillBuffer(buffer, BUFLENGTH, IN0(i));
+                    } else {
+                        // Initialize interpolator.
+                        unit->mInBufValue[unit->mNumCopies] = IN0(i);
+                        unit->mCopyInputs[unit->mNumCopies++] = i;
+                    }
+                    buffer += BUFLENGTH;
+                }
+                SETCALC(Faust_next_copy);
+            }
+    #if defined(F2SC_DEBUG_MES)
+            Print("Faust[%s]:\\n", g_unitName);
+            Print("    Inputs:   %d\\n"
+                  "    Outputs:  %d\\n"
+                  "    Callback: %s\\n"
+                  "    Interpolated inputs: %d of %d\\n"
+                  "    Controls updated per block: %d of %d\\n",
+                  (int)numInputs, (int)numOutputs,
+                  unit->mCalcFunc == (UnitCalcFunc)Faust_next ? "zero-copy" : "copy",
+                  unit->mNumCopies, numAudioInputs,
+                  (int)unit->mNumDynamicControls, (int)unit->mNumControls);
+    #endif
+        } else {
+            Print("Faust[%s]:\\n", g_unitName);
+            Print("    Input/Output channel mismatch\\n"
+                  "        Inputs:  faust %d, unit %d\\n"
+                  "        Outputs: faust %d, unit %d\\n",
+                  numInputs, unit->mNumInputs,
+                  numOutputs, unit->mNumOutputs);
+            Print("    Generating silence ...\\n");
+        }
+    }
+
+end:
+    // Fix for https://github.com/grame-cncm/faust/issues/13
+    ClearUnitOutputs(unit, 1);
+}
+
+void Faust_Dtor(Faust* unit)  // module destructor
+{
+    if (unit->mInBufCopy) {
+        RTFree(unit->mWorld, unit->mInBufCopy);
+    }
+
+    // delete dsp
+    if (unit->mDSP) {
+        unit->mDSP->~FAUSTCLASS();
+        RTFree(unit->mWorld, unit->mDSP);
+    }
+}
+"""
+
+
+def patch(text):
+    if INTERFACE not in text:
+        return None
+    if CONTROL_OLD not in text or UNIT_OLD not in text or INTERFACE not in text:
+        raise ValueError("unknown wrapper layout")
+    matches = FUNCTIONS_RE.findall(text)
+    if len(matches) != 1:
+        raise ValueError("wrapper functions not found")
+    debug = DEBUG_RE.search(matches[0])
+    functions = FUNCTIONS
+    if debug:
+        functions = functions.replace("defined(F2SC_DEBUG_MES)", debug.group(1))
+
+    text = text.replace(CONTROL_OLD, CONTROL_NEW, 1)
+    text = text.replace(UNIT_OLD, UNIT_NEW, 1)
+    text = FUNCTIONS_RE.sub(lambda m: functions, text, 1)
+    return text.replace(INTERFACE, INTERFACE + "\n" + MARKER, 1)
+
+
+def main(paths):
+    status = 0
+    for path in paths:
+        with open(path) as f:
+            text = f.read()
+        if MARKER in text:
+            continue
+        try:
+            result = patch(text)
+        except ValueError as e:
+            sys.stderr.write("%s: %s\n" % (path, e))
+            status = 1
+            continue
+        if result is None:
+            continue
+        with open(path, "w") as f:
+            f.write(result)
+        print("patched %s" % path)
+    return status
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
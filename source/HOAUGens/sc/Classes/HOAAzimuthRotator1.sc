@@ -1,11 +1,11 @@
 HOAAzimuthRotator1 : MultiOutUGen
 {
-  *ar { | in1, in2, in3, in4, azimuth(0.0) |
-      ^this.multiNew('audio', in1, in2, in3, in4, azimuth)
+  *ar { | in1, in2, in3, in4, azimuth(0.0), interpolate(0) |
+      ^this.multiNew('audio', in1, in2, in3, in4, azimuth, interpolate)
   }
 
-  *kr { | in1, in2, in3, in4, azimuth(0.0) |
-      ^this.multiNew('control', in1, in2, in3, in4, azimuth)
+  *kr { | in1, in2, in3, in4, azimuth(0.0), interpolate(0) |
+      ^this.multiNew('control', in1, in2, in3, in4, azimuth, interpolate)
   } 
 
   checkInputs {
@@ -26,8 +26,5 @@ HOAAzimuthRotator1 : MultiOutUGen
   }
 
   name { ^"HOAAzimuthRotator1" }
-
-
-  info { ^"Generated with Faust" }
 }
 
@@ -1,11 +1,11 @@
 HOAAzimuthRotator2 : MultiOutUGen
 {
-  *ar { | in1, in2, in3, in4, in5, in6, in7, in8, in9, azimuth(0.0) |
-      ^this.multiNew('audio', in1, in2, in3, in4, in5, in6, in7, in8, in9, azimuth)
+  *ar { | in1, in2, in3, in4, in5, in6, in7, in8, in9, azimuth(0.0), interpolate(0) |
+      ^this.multiNew('audio', in1, in2, in3, in4, in5, in6, in7, in8, in9, azimuth, interpolate)
   }
 
-  *kr { | in1, in2, in3, in4, in5, in6, in7, in8, in9, azimuth(0.0) |
-      ^this.multiNew('control', in1, in2, in3, in4, in5, in6, in7, in8, in9, azimuth)
+  *kr { | in1, in2, in3, in4, in5, in6, in7, in8, in9, azimuth(0.0), interpolate(0) |
+      ^this.multiNew('control', in1, in2, in3, in4, in5, in6, in7, in8, in9, azimuth, interpolate)
   } 
 
   checkInputs {
@@ -26,8 +26,5 @@ HOAAzimuthRotator2 : MultiOutUGen
   }
 
   name { ^"HOAAzimuthRotator2" }
-
-
-  info { ^"Generated with Faust" }
 }
 
@@ -26,8 +26,5 @@ HOAConverterAcnN3d2AcnSn3d1 : MultiOutUGen
   }
 
   name { ^"HOAConverterAcnN3d2AcnSn3d1" }
-
-
-  info { ^"Generated with Faust" }
 }
 
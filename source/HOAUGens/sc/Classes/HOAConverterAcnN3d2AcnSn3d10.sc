@@ -26,8 +26,5 @@ HOAConverterAcnN3d2AcnSn3d10 : MultiOutUGen
   }
 
   name { ^"HOAConverterAcnN3d2AcnSn3d10" }
-
-
-  info { ^"Generated with Faust" }
 }
 
@@ -26,8 +26,5 @@ HOAConverterAcnN3d2AcnSn3d2 : MultiOutUGen
   }
 
   name { ^"HOAConverterAcnN3d2AcnSn3d2" }
-
-
-  info { ^"Generated with Faust" }
 }
 
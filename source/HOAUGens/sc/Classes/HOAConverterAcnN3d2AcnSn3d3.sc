@@ -26,8 +26,5 @@ HOAConverterAcnN3d2AcnSn3d3 : MultiOutUGen
   }
 
   name { ^"HOAConverterAcnN3d2AcnSn3d3" }
-
-
-  info { ^"Generated with Faust" }
 }
 
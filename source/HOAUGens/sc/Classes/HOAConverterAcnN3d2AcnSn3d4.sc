@@ -26,8 +26,5 @@ HOAConverterAcnN3d2AcnSn3d4 : MultiOutUGen
   }
 
   name { ^"HOAConverterAcnN3d2AcnSn3d4" }
-
-
-  info { ^"Generated with Faust" }
 }
 
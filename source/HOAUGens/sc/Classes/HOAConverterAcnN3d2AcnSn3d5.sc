@@ -26,8 +26,5 @@ HOAConverterAcnN3d2AcnSn3d5 : MultiOutUGen
   }
 
   name { ^"HOAConverterAcnN3d2AcnSn3d5" }
-
-
-  info { ^"Generated with Faust" }
 }
 
@@ -26,8 +26,5 @@ HOAConverterAcnN3d2AcnSn3d6 : MultiOutUGen
   }
 
   name { ^"HOAConverterAcnN3d2AcnSn3d6" }
-
-
-  info { ^"Generated with Faust" }
 }
 
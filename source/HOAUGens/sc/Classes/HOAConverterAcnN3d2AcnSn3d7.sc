@@ -26,8 +26,5 @@ HOAConverterAcnN3d2AcnSn3d7 : MultiOutUGen
   }
 
   name { ^"HOAConverterAcnN3d2AcnSn3d7" }
-
-
-  info { ^"Generated with Faust" }
 }
 
@@ -26,8 +26,5 @@ HOAConverterAcnN3d2AcnSn3d8 : MultiOutUGen
   }
 
   name { ^"HOAConverterAcnN3d2AcnSn3d8" }
-
-
-  info { ^"Generated with Faust" }
 }
 
@@ -26,8 +26,5 @@ HOAConverterAcnN3d2AcnSn3d9 : MultiOutUGen
   }
 
   name { ^"HOAConverterAcnN3d2AcnSn3d9" }
-
-
-  info { ^"Generated with Faust" }
 }
 
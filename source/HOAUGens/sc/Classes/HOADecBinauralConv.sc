@@ -0,0 +1,36 @@
+HOADecBinauralConv : MultiOutUGen
+{
+  // in: an array of (order + 1)^2 ACN channels
+  // bufnum: HRIR spectra prepared with *prepareHRIRs
+  *ar { | in, bufnum, partitionSize(512), inputs_gain(0.0), outputs_gain(0.0) |
+      ^this.multiNewList(['audio'] ++ in.asArray ++ [bufnum, partitionSize, inputs_gain, outputs_gain])
+  }
+
+  // number of samples of the prepared buffer for an HRIR buffer with
+  // 2 * (order + 1)^2 channels (left ear filters, then right ear filters)
+  *calcBufSize { | partitionSize, hrirBuffer |
+      ^(hrirBuffer.numFrames / partitionSize).roundUp.asInteger * hrirBuffer.numChannels * 2 * partitionSize
+  }
+
+  // the spectra are computed by the server after the allocation, s.sync before use
+  *prepareHRIRs { | hrirBuffer, partitionSize(512) |
+      ^Buffer.alloc(hrirBuffer.server, this.calcBufSize(partitionSize, hrirBuffer), 1, { |buf|
+          ["/b_gen", buf.bufnum, "PrepareHOABinaural", hrirBuffer.bufnum, partitionSize]
+      })
+  }
+
+  checkInputs {
+    (inputs.size - 4).do({|i|
+      if (inputs.at(i).rate != 'audio', {
+        ^(" input at index " + i + "(" + inputs.at(i) +
+          ") is not audio rate");
+      });
+    });
+    ^this.checkValidInputs
+  }
+
+  init { | ... theInputs |
+      inputs = theInputs
+      ^this.initOutputs(2, rate)
+  }
+}
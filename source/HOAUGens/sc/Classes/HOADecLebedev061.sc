@@ -26,8 +26,5 @@ HOADecLebedev061 : MultiOutUGen
   }
 
   name { ^"HOADecLebedev061" }
-
-
-  info { ^"Generated with Faust" }
 }
 
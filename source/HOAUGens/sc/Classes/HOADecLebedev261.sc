@@ -26,8 +26,5 @@ HOADecLebedev261 : MultiOutUGen
   }
 
   name { ^"HOADecLebedev261" }
-
-
-  info { ^"Generated with Faust" }
 }
 
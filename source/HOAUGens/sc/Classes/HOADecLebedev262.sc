@@ -26,8 +26,5 @@ HOADecLebedev262 : MultiOutUGen
   }
 
   name { ^"HOADecLebedev262" }
-
-
-  info { ^"Generated with Faust" }
 }
 
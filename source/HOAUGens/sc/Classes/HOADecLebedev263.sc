@@ -26,8 +26,5 @@ HOADecLebedev263 : MultiOutUGen
   }
 
   name { ^"HOADecLebedev263" }
-
-
-  info { ^"Generated with Faust" }
 }
 
@@ -26,8 +26,5 @@ HOADecLebedev501 : MultiOutUGen
   }
 
   name { ^"HOADecLebedev501" }
-
-
-  info { ^"Generated with Faust" }
 }
 
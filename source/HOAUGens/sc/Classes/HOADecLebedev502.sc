@@ -26,8 +26,5 @@ HOADecLebedev502 : MultiOutUGen
   }
 
   name { ^"HOADecLebedev502" }
-
-
-  info { ^"Generated with Faust" }
 }
 
@@ -26,8 +26,5 @@ HOADecLebedev503 : MultiOutUGen
   }
 
   name { ^"HOADecLebedev503" }
-
-
-  info { ^"Generated with Faust" }
 }
 
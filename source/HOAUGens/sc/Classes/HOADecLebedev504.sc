@@ -26,8 +26,5 @@ HOADecLebedev504 : MultiOutUGen
   }
 
   name { ^"HOADecLebedev504" }
-
-
-  info { ^"Generated with Faust" }
 }
 
@@ -26,8 +26,5 @@ HOADecLebedev505 : MultiOutUGen
   }
 
   name { ^"HOADecLebedev505" }
-
-
-  info { ^"Generated with Faust" }
 }
 
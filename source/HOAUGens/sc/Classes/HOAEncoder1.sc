@@ -26,8 +26,5 @@ HOAEncoder1 : MultiOutUGen
   }
 
   name { ^"HOAEncoder1" }
-
-
-  info { ^"Generated with Faust" }
 }
 
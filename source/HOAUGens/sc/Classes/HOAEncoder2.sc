@@ -26,8 +26,5 @@ HOAEncoder2 : MultiOutUGen
   }
 
   name { ^"HOAEncoder2" }
-
-
-  info { ^"Generated with Faust" }
 }
 
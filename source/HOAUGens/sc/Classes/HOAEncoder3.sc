@@ -26,8 +26,5 @@ HOAEncoder3 : MultiOutUGen
   }
 
   name { ^"HOAEncoder3" }
-
-
-  info { ^"Generated with Faust" }
 }
 
@@ -26,8 +26,5 @@ HOAEncoder4 : MultiOutUGen
   }
 
   name { ^"HOAEncoder4" }
-
-
-  info { ^"Generated with Faust" }
 }
 
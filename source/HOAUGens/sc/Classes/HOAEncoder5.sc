@@ -26,8 +26,5 @@ HOAEncoder5 : MultiOutUGen
   }
 
   name { ^"HOAEncoder5" }
-
-
-  info { ^"Generated with Faust" }
 }
 
@@ -26,8 +26,5 @@ HOAMirror1 : MultiOutUGen
   }
 
   name { ^"HOAMirror1" }
-
-
-  info { ^"Generated with Faust" }
 }
 
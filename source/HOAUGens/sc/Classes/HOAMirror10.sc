@@ -26,8 +26,5 @@ HOAMirror10 : MultiOutUGen
   }
 
   name { ^"HOAMirror10" }
-
-
-  info { ^"Generated with Faust" }
 }
 
@@ -26,8 +26,5 @@ HOAMirror2 : MultiOutUGen
   }
 
   name { ^"HOAMirror2" }
-
-
-  info { ^"Generated with Faust" }
 }
 
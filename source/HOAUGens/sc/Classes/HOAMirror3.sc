@@ -26,8 +26,5 @@ HOAMirror3 : MultiOutUGen
   }
 
   name { ^"HOAMirror3" }
-
-
-  info { ^"Generated with Faust" }
 }
 
@@ -26,8 +26,5 @@ HOAMirror4 : MultiOutUGen
   }
 
   name { ^"HOAMirror4" }
-
-
-  info { ^"Generated with Faust" }
 }
 
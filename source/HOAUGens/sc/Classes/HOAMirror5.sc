@@ -26,8 +26,5 @@ HOAMirror5 : MultiOutUGen
   }
 
   name { ^"HOAMirror5" }
-
-
-  info { ^"Generated with Faust" }
 }
 
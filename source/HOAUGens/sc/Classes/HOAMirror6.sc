@@ -26,8 +26,5 @@ HOAMirror6 : MultiOutUGen
   }
 
   name { ^"HOAMirror6" }
-
-
-  info { ^"Generated with Faust" }
 }
 
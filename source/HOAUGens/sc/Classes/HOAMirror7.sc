@@ -26,8 +26,5 @@ HOAMirror7 : MultiOutUGen
   }
 
   name { ^"HOAMirror7" }
-
-
-  info { ^"Generated with Faust" }
 }
 
@@ -26,8 +26,5 @@ HOAMirror8 : MultiOutUGen
   }
 
   name { ^"HOAMirror8" }
-
-
-  info { ^"Generated with Faust" }
 }
 
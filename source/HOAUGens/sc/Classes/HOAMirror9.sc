@@ -26,8 +26,5 @@ HOAMirror9 : MultiOutUGen
   }
 
   name { ^"HOAMirror9" }
-
-
-  info { ^"Generated with Faust" }
 }
 
@@ -0,0 +1,25 @@
+HOAMultiEncoder2 : MultiOutUGen
+{
+  // in: an array of mono sources, the other arrays hold one value per source
+  *ar { | in, gain(0.0), radius(1.07), azimuth(0.0), elevation(0.0), speaker_radius(1.07) |
+      var numSources = in.asArray.size;
+      var perSource = { |x| x.asArray.wrapExtend(numSources) };
+      ^this.multiNewList(['audio'] ++ in.asArray ++ perSource.(gain) ++ perSource.(radius)
+          ++ perSource.(azimuth) ++ perSource.(elevation) ++ [speaker_radius])
+  }
+
+  checkInputs {
+    ((inputs.size - 1) / 5).do({|i|
+      if (inputs.at(i).rate != 'audio', {
+        ^(" input at index " + i + "(" + inputs.at(i) +
+          ") is not audio rate");
+      });
+    });
+    ^this.checkValidInputs
+  }
+
+  init { | ... theInputs |
+      inputs = theInputs
+      ^this.initOutputs(9, rate)
+  }
+}
@@ -26,8 +26,5 @@ HOARotator1 : MultiOutUGen
   }
 
   name { ^"HOARotator1" }
-
-
-  info { ^"Generated with Faust" }
 }
 
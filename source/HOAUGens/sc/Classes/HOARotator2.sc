@@ -26,8 +26,5 @@ HOARotator2 : MultiOutUGen
   }
 
   name { ^"HOARotator2" }
-
-
-  info { ^"Generated with Faust" }
 }
 
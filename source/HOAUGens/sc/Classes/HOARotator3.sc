@@ -26,8 +26,5 @@ HOARotator3 : MultiOutUGen
   }
 
   name { ^"HOARotator3" }
-
-
-  info { ^"Generated with Faust" }
 }
 
@@ -26,8 +26,5 @@ HOARotator4 : MultiOutUGen
   }
 
   name { ^"HOARotator4" }
-
-
-  info { ^"Generated with Faust" }
 }
 
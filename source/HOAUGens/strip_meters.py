@@ -0,0 +1,127 @@
+#!/usr/bin/env python3
+"""Remove the Faust VU-meter code from generated HOAUGens sources.
+
+The ambitools .dsp files attach a `vbargraph`/`hbargraph` level meter to
+every output channel.  In a faust2supercollider build these meters are
+never exposed (the ControlAllocator ignores passive widgets), but
+mydsp::compute still runs a `20*log10(max(.., fabs(x)))` peak-hold
+recursion per sample and per channel to feed them.
+
+Since the meter is attached with `attach`, its value never reaches an
+output, so dropping it does not change the audio.  This script removes:
+
+  - the `fRecN[0] = max((fRecN[1] - fConstK), min(.., 20*log10(..)))` lines
+    and the `f[HV]bargraphM = FAUSTFLOAT(fRecN[0])` lines that follow,
+  - the matching `fRecN[1] = fRecN[0]` state updates,
+  - the `fRecN` / `f[HV]bargraphM` members and their instanceClear loops,
+  - the bargraph widgets in buildUserInterface,
+  - any `fConstK` left unused (the meter decay rate).
+
+Run it on the output of faust2supercollider after regenerating a UGen:
+
+    ./strip_meters.py HOAEncLebedev503.cpp HOAPanLebedev263.cpp ...
+
+Files that have already been stripped are left untouched.
+"""
+
+import re
+import sys
+
+MARKER = "VU meters stripped by strip_meters.py"
+
+METER_RE = re.compile(
+    r"^\t+(fRec\d+)\[0\] = max\(\(\1\[1\] - fConst\d+\), "
+    r"min\([0-9.]+, \(20\.0 \* log10\(.*\);$")
+BARGRAPH_RE = re.compile(r"^\t+(f[HV]bargraph\d+) = FAUSTFLOAT\((fRec\d+)\[0\]\);$")
+CONST_DECL_RE = re.compile(r"^\tdouble (fConst\d+);$")
+
+
+def strip(text):
+    lines = text.split("\n")
+
+    recs = set()
+    bargraphs = set()
+    drop = set()
+    for i, line in enumerate(lines):
+        m = METER_RE.match(line)
+        if not m:
+            continue
+        b = BARGRAPH_RE.match(lines[i + 1]) if i + 1 < len(lines) else None
+        if not b or b.group(2) != m.group(1):
+            raise ValueError("meter recursion without bargraph at line %d" % (i + 1))
+        recs.add(m.group(1))
+        bargraphs.add(b.group(1))
+        drop.update((i, i + 1))
+
+    if not recs:
+        return None
+
+    rec_alt = "|".join(sorted(recs))
+    bar_alt = "|".join(sorted(bargraphs))
+    state_re = re.compile(r"^\t+(%s)\[1\] = \1\[0\];$" % rec_alt)
+    rec_decl_re = re.compile(r"^\tdouble (%s)\[2\];$" % rec_alt)
+    bar_decl_re = re.compile(r"^\tFAUSTFLOAT (%s);$" % bar_alt)
+    ui_re = re.compile(r"^\t+ui_interface->\w+\(.*&(%s)\b" % bar_alt)
+    clear_re = re.compile(r"^\t+(%s)\[(l\d+)\] = 0\.0;$" % rec_alt)
+
+    for i, line in enumerate(lines):
+        if state_re.match(line) or rec_decl_re.match(line) \
+                or bar_decl_re.match(line) or ui_re.match(line):
+            drop.add(i)
+        elif clear_re.match(line):
+            # for (int lK = 0; (lK < 2); lK = (lK + 1)) {
+            #     fRecN[lK] = 0.0;
+            #
+            # }
+            if not lines[i - 1].lstrip().startswith("for (int "):
+                raise ValueError("unexpected instanceClear layout at line %d" % (i + 1))
+            drop.update((i - 1, i, i + 1, i + 2))
+
+    lines = [l for i, l in enumerate(lines) if i not in drop]
+
+    # Drop constants that were only used by the meters (decay per sample).
+    while True:
+        body = "\n".join(lines)
+        unused = []
+        for line in lines:
+            m = CONST_DECL_RE.match(line)
+            if m and len(re.findall(r"\b%s\b" % m.group(1), body)) == 2:
+                unused.append(m.group(1))
+        if not unused:
+            break
+        alt = "|".join(unused)
+        decl_re = re.compile(r"^\tdouble (%s);$" % alt)
+        assign_re = re.compile(r"^\t+(%s) = .*;$" % alt)
+        lines = [l for l in lines if not decl_re.match(l) and not assign_re.match(l)]
+
+    text = "\n".join(lines)
+    if "log10(" in text.split("// FAUST generated code", 1)[1]:
+        raise ValueError("log10 left in generated code")
+
+    return text.replace("Compilation options: ",
+                        MARKER + "\nCompilation options: ", 1)
+
+
+def main(paths):
+    status = 0
+    for path in paths:
+        with open(path) as f:
+            text = f.read()
+        if MARKER in text:
+            continue
+        try:
+            result = strip(text)
+        except ValueError as e:
+            sys.stderr.write("%s: %s\n" % (path, e))
+            status = 1
+            continue
+        if result is None:
+            continue
+        with open(path, "w") as f:
+            f.write(result)
+        print("stripped %s" % path)
+    return status
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
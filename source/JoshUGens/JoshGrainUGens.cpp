@@ -50,16 +50,250 @@ const double sqrt6div3 = sqrt(6.) * 0.3333333333;
 
 static InterfaceTable *ft;
 
-struct Grain
+//////////////////////////////// Grain pool ////////////////////////////////////////
+// structure-of-arrays storage for the grains with a sine squared envelope, used by
+// MonoGrain, InGrain, SinGrain, FMGrain, BufGrain and their BF versions. The arrays
+// come from the RT pool and double in size whenever they are full. The envelopes are
+// computed kGrainBatch grains at a time, so the recursion vectorizes across grains. The
+// sources then run input and sine grains side by side as well, FM and buffer grains one
+// at a time.
+
+enum {
+	kGrainSin = 1, // sinb1, siny1, siny2
+	kGrainFM = 2, // oscphase, modphase, modfreq, deviation, carbase
+	kGrainBuf = 4, // phase, rate, buf, interp
+	kGrainBF = 8, // wamp, xamp, yamp, zamp
+	kGrainEach = 16 // run by GrainPool_nextEach, the envelope starts at the grain's first sample
+};
+
+const int kGrainPoolStart = 64;
+const int kGrainBatch = 8;
+const int kGrainChunk = 64;
+
+struct GrainPool
+{
+	int numActive, capacity, fields;
+	void *memory;
+	double *b1, *y1, *y2; // envelope
+	int *counter; // samples left, counted from the start of the block
+	int *start; // samples before the grain starts, only nonzero in its first block
+	double *sinb1, *siny1, *siny2; // sine oscillator
+	int32 *oscphase, *modphase, *modfreq;
+	float *deviation, *carbase;
+	double *phase, *rate;
+	SndBuf **buf;
+	int *interp;
+	float *wamp, *xamp, *yamp, *zamp;
+};
+
+#define GRAIN_POOL_FIELDS(FIELD) \
+	FIELD(0, double, b1) \
+	FIELD(0, double, y1) \
+	FIELD(0, double, y2) \
+	FIELD(0, int, counter) \
+	FIELD(0, int, start) \
+	FIELD(kGrainSin, double, sinb1) \
+	FIELD(kGrainSin, double, siny1) \
+	FIELD(kGrainSin, double, siny2) \
+	FIELD(kGrainFM, int32, oscphase) \
+	FIELD(kGrainFM, int32, modphase) \
+	FIELD(kGrainFM, int32, modfreq) \
+	FIELD(kGrainFM, float, deviation) \
+	FIELD(kGrainFM, float, carbase) \
+	FIELD(kGrainBuf, double, phase) \
+	FIELD(kGrainBuf, double, rate) \
+	FIELD(kGrainBuf, SndBuf*, buf) \
+	FIELD(kGrainBuf, int, interp) \
+	FIELD(kGrainBF, float, wamp) \
+	FIELD(kGrainBF, float, xamp) \
+	FIELD(kGrainBF, float, yamp) \
+	FIELD(kGrainBF, float, zamp) \
+
+#define GRAIN_POOL_HAS(flag) ((flag) == 0 || (pool->fields & (flag)))
+
+// places the arrays for capacity grains in memory, or only adds up their size if memory is 0
+static size_t GrainPool_layout(GrainPool *pool, int capacity, char *memory)
+{
+	size_t size = 0;
+#define GRAIN_POOL_LAYOUT(flag, type, name) \
+	if (GRAIN_POOL_HAS(flag)) { \
+		if (memory) pool->name = (type*)(memory + size); \
+		size += (capacity * sizeof(type) + 15) & ~(size_t)15; \
+	} else if (memory) { \
+		pool->name = 0; \
+	}
+	GRAIN_POOL_FIELDS(GRAIN_POOL_LAYOUT)
+#undef GRAIN_POOL_LAYOUT
+	return size;
+}
+
+static bool GrainPool_grow(World *world, GrainPool *pool, int capacity)
+{
+	char *memory = (char*)RTAlloc(world, GrainPool_layout(pool, capacity, 0));
+	if (!memory) return false;
+	GrainPool grown = *pool;
+	GrainPool_layout(&grown, capacity, memory);
+	int numActive = pool->numActive;
+#define GRAIN_POOL_COPY(flag, type, name) \
+	if (GRAIN_POOL_HAS(flag) && numActive) memcpy(grown.name, pool->name, numActive * sizeof(type));
+	GRAIN_POOL_FIELDS(GRAIN_POOL_COPY)
+#undef GRAIN_POOL_COPY
+	if (pool->memory) RTFree(world, pool->memory);
+	grown.memory = memory;
+	grown.capacity = capacity;
+	*pool = grown;
+	return true;
+}
+
+static void GrainPool_init(World *world, GrainPool *pool, int fields)
 {
-	double phase, rate;
-	double b1, y1, y2; // envelope
-	int counter;
-	int bufnum;
-	int interp;
-	SndBuf *m_buf;
+	memset(pool, 0, sizeof(GrainPool));
+	pool->fields = fields;
+	// if this fails, GrainPool_add tries again
+	GrainPool_grow(world, pool, kGrainPoolStart);
+}
+
+static void GrainPool_free(World *world, GrainPool *pool)
+{
+	if (pool->memory) RTFree(world, pool->memory);
+	pool->memory = 0;
+	pool->numActive = pool->capacity = 0;
+}
+
+// adds a grain of counter samples that starts start samples into the block, and returns its
+// index, or -1 if there is no memory for it. For GrainPool_next the envelope is set up as if
+// the grain had started at the beginning of the block, the samples before start are masked.
+static int GrainPool_add(World *world, GrainPool *pool, double counter, int start)
+{
+	if (pool->numActive == pool->capacity
+	    && !GrainPool_grow(world, pool, sc_max(kGrainPoolStart, pool->capacity * 2))) {
+		Print("Too many grains!\n");
+		return -1;
+	}
+	int g = pool->numActive++;
+	counter = sc_max(4., counter);
+	double w = pi / counter;
+	pool->counter[g] = (int)counter + start;
+	pool->start[g] = start;
+	pool->b1[g] = 2. * cos(w);
+	if (pool->fields & kGrainEach) {
+		pool->y1[g] = sin(w);
+		pool->y2[g] = 0.;
+	} else {
+		pool->y1[g] = sin(w * (1 - start));
+		pool->y2[g] = sin(w * -start);
+	}
+	return g;
+}
+
+static inline void GrainPool_remove(GrainPool *pool, int g)
+{
+	int last = --pool->numActive;
+#define GRAIN_POOL_MOVE(flag, type, name) \
+	if (GRAIN_POOL_HAS(flag)) pool->name[g] = pool->name[last];
+	GRAIN_POOL_FIELDS(GRAIN_POOL_MOVE)
+#undef GRAIN_POOL_MOVE
+}
+
+// the envelopes of grains first .. first + count - 1 for nsmps samples. All kGrainBatch lanes
+// are computed so the loop over them vectorizes, missing lanes repeat the first grain.
+static inline void GrainPool_env(GrainPool *pool, int first, int count, int nsmps, float env[][kGrainBatch])
+{
+	double b1[kGrainBatch], y1[kGrainBatch], y2[kGrainBatch];
+	for (int k=0; k<kGrainBatch; ++k) {
+		int g = first + (k < count ? k : 0);
+		b1[k] = pool->b1[g];
+		y1[k] = pool->y1[g];
+		y2[k] = pool->y2[g];
+	}
+	for (int j=0; j<nsmps; ++j) {
+		for (int k=0; k<kGrainBatch; ++k) {
+			env[j][k] = y1[k] * y1[k];
+			double y0 = b1[k] * y1[k] - y2[k];
+			y2[k] = y1[k];
+			y1[k] = y0;
+		}
+	}
+	for (int k=0; k<count; ++k) {
+		pool->y1[first + k] = y1[k];
+		pool->y2[first + k] = y2[k];
+	}
+}
+
+// runs all grains over the block. For each batch, source.batch gets the envelopes, zeroed
+// outside each grain's from .. to - 1 and in the lanes past count, and writes from offset on.
+template <class Source>
+static void GrainPool_next(GrainPool *pool, Source &source, int inNumSamples)
+{
+	float env[kGrainChunk][kGrainBatch];
+	int from[kGrainBatch], to[kGrainBatch];
+
+	for (int offset=0; offset<inNumSamples; offset+=kGrainChunk) {
+		int nsmps = sc_min(kGrainChunk, inNumSamples - offset);
+		for (int first=0; first<pool->numActive; first+=kGrainBatch) {
+			int count = sc_min(kGrainBatch, pool->numActive - first);
+			GrainPool_env(pool, first, count, nsmps, env);
+			for (int k=0; k<kGrainBatch; ++k) {
+				if (k < count) {
+					int g = first + k;
+					from[k] = sc_min(pool->start[g], nsmps);
+					to[k] = sc_min(pool->counter[g], nsmps);
+					pool->start[g] -= from[k];
+					pool->counter[g] -= nsmps;
+				} else {
+					from[k] = to[k] = 0;
+				}
+				for (int j=0; j<from[k]; ++j) env[j][k] = 0.f;
+				for (int j=to[k]; j<nsmps; ++j) env[j][k] = 0.f;
+			}
+			source.batch(pool, first, count, env, from, to, offset, nsmps);
+		}
+		for (int g=0; g<pool->numActive; ) {
+			if (pool->counter[g] <= 0) GrainPool_remove(pool, g);
+			else ++g;
+		}
+	}
+}
+
+// the envelope of a single grain, stepped one sample at a time
+struct GrainEnvelope
+{
+	double b1, y1, y2;
+
+	float next()
+	{
+		float amp = y1 * y1;
+		double y0 = b1 * y1 - y2;
+		y2 = y1;
+		y1 = y0;
+		return amp;
+	}
 };
 
+// runs all grains over the block one at a time, for the sources whose grains can't run side
+// by side. source.grain writes grain g from sample from to to - 1, stepping its envelope.
+// The pool needs kGrainEach.
+template <class Source>
+static void GrainPool_nextEach(GrainPool *pool, Source &source, int inNumSamples)
+{
+	for (int g=0; g<pool->numActive; ) {
+		int from = sc_min(pool->start[g], inNumSamples);
+		int to = sc_min(pool->counter[g], inNumSamples);
+		GrainEnvelope env = {pool->b1[g], pool->y1[g], pool->y2[g]};
+		source.grain(pool, g, env, from, to);
+		pool->counter[g] -= inNumSamples;
+		if (pool->counter[g] <= 0) {
+			// the last grain moves to g and is run next
+			GrainPool_remove(pool, g);
+		} else {
+			pool->y1[g] = env.y1;
+			pool->y2[g] = env.y2;
+			pool->start[g] = 0;
+			++g;
+		}
+	}
+}
+
 struct WinGrain
 {
 	double phase, rate;
@@ -91,42 +325,21 @@ const int kMaxSynthGrains = 512;
 
 struct MonoGrain : public Unit
 {
-	int mNumActive;
 	int m_NextGrain;
-	Grain mGrains[kMaxSynthGrains];
-};
-
-struct Grainbf
-{
-	double phase, rate;
-	double b1, y1, y2; // envelope
-	int counter;
-	int bufnum;
-	int interp;
-	double loc, elevation, rho;
-	float m_azimuth, m_elevation, m_rho, m_level, m_W_amp, m_X_amp, m_Y_amp, m_Z_amp;
-
+	GrainPool mPool;
 };
 
 struct MonoGrainBF : public Unit
 {
-	int mNumActive;
 	int m_NextGrain;
-	Grainbf mGrains[kMaxSynthGrains];
+	GrainPool mPool;
 };
 
 // for granular synthesis
-struct IGrain
-{
-	double b1, y1, y2; // envelope
-	int counter;
-};
-
 struct InGrain : public Unit
 {
-	int mNumActive;
 	float curtrig;
-	IGrain mGrains[kMaxSynthGrains];
+	GrainPool mPool;
 };
 
 struct IGrainB
@@ -160,21 +373,12 @@ struct InGrainI : public Unit
 	IGrainI mGrains[kMaxSynthGrains];
 };
 
-struct SGrain
-{
-	double b1, y1, y2; // envelope
-	int counter;
-	int32 oscphase; // the phase of the osc inside this grain
-	int32 freq; // the freq of the osc inside this grain in phase inc
-};
-
 struct SinGrain : public Unit
 {
-	int mNumActive;
 	uint32 m_lomask;
 	float curtrig;
 	double m_cpstoinc, m_radtoinc;
-	SGrain mGrains[kMaxSynthGrains];
+	GrainPool mPool;
 };
 
 struct SGrainB
@@ -216,23 +420,13 @@ struct SinGrainI : public Unit
 	SGrainI mGrains[kMaxSynthGrains];
 };
 
-struct FGrain
-{
-	int32 coscphase, moscphase; // the phase of the osc inside this grain
-	int32 mfreq; // the freq of the osc inside this grain in phase inc
-	double b1, y1, y2; // envelope
-	float deviation, carbase;
-	int counter;
-};
-
 
 struct FMGrain : public Unit
 {
-	int mNumActive;
 	uint32 m_lomask;
 	float curtrig;
 	double m_cpstoinc, m_radtoinc;
-	FGrain mGrains[kMaxSynthGrains];
+	GrainPool mPool;
 };
 
 
@@ -280,9 +474,8 @@ struct FMGrainI : public Unit
 
 struct BufGrain : public Unit
 {
-	int mNumActive;
 	float curtrig;
-	Grain mGrains[kMaxSynthGrains];
+	GrainPool mPool;
 };
 
 struct BufGrainB : public Unit
@@ -302,20 +495,11 @@ struct BufGrainI : public Unit
 ///////////////////// Ambisonic versions of grain UGens ////////////////////
 
 // for granular synthesis
-struct IGrainBF
-{
-	double b1, y1, y2; // envelope
-	int counter;
-	float m_wamp, m_xamp, m_yamp, m_zamp;
-};
-
 struct InGrainBF : public Unit
 {
-	int mNumActive;
 	float curtrig;
 	float m_wComp;
-	IGrainBF mGrains[kMaxSynthGrains];
-
+	GrainPool mPool;
 };
 
 struct IGrainBBF
@@ -354,24 +538,13 @@ struct InGrainIBF : public Unit
 	IGrainIBF mGrains[kMaxSynthGrains];
 };
 
-struct SGrainBF
-{
-	double b1, y1, y2; // envelope
-	int counter;
-	int32 oscphase; // the phase of the osc inside this grain
-	int32 freq; // the freq of the osc inside this grain in phase inc
-	float m_wamp, m_xamp, m_yamp, m_zamp;
-
-};
-
 struct SinGrainBF : public Unit
 {
-	int mNumActive;
 	uint32 m_lomask;
 	float curtrig;
 	double m_cpstoinc, m_radtoinc;
 	float m_wComp;
-	SGrainBF mGrains[kMaxSynthGrains];
+	GrainPool mPool;
 };
 
 struct SGrainBBF
@@ -419,25 +592,14 @@ struct SinGrainIBF : public Unit
 };
 
 
-struct FGrainBF
-{
-	int32 coscphase, moscphase; // the phase of the osc inside this grain
-	int32 mfreq; // the freq of the osc inside this grain in phase inc
-	double b1, y1, y2; // envelope
-	float deviation, carbase;
-	int counter;
-	float m_wamp, m_xamp, m_yamp, m_zamp;
-};
-
 
 struct FMGrainBF : public Unit
 {
-	int mNumActive;
 	uint32 m_lomask;
 	float curtrig;
 	double m_cpstoinc, m_radtoinc;
 	float m_wComp;
-	FGrainBF mGrains[kMaxSynthGrains];
+	GrainPool mPool;
 };
 
 
@@ -487,17 +649,6 @@ struct FMGrainIBF : public Unit
 	FGrainIBF mGrains[kMaxSynthGrains];
 };
 
-struct GrainBF
-{
-	double phase, rate;
-	double b1, y1, y2; // envelope
-	int counter;
-	int bufnum;
-	int interp;
-	float m_wamp, m_xamp, m_yamp, m_zamp;
-	SndBuf *m_buf;
-};
-
 struct WinGrainBF
 {
 	double phase, rate;
@@ -527,10 +678,9 @@ struct WinGrainIBF
 
 struct BufGrainBF : public Unit
 {
-	int mNumActive;
 	float curtrig;
 	float m_wComp;
-	GrainBF mGrains[kMaxSynthGrains];
+	GrainPool mPool;
 };
 
 struct BufGrainBBF : public Unit
@@ -554,11 +704,14 @@ extern "C"
 {
 	void MonoGrain_next(MonoGrain *unit, int inNumSamples);
 	void MonoGrain_Ctor(MonoGrain* unit);
+	void MonoGrain_Dtor(MonoGrain* unit);
 
 	void MonoGrainBF_next(MonoGrainBF *unit, int inNumSamples);
 	void MonoGrainBF_Ctor(MonoGrainBF* unit);
+	void MonoGrainBF_Dtor(MonoGrainBF* unit);
 
 	void SinGrain_Ctor(SinGrain* unit);
+	void SinGrain_Dtor(SinGrain* unit);
 	void SinGrain_next_a(SinGrain* unit, int inNumSamples);
 	void SinGrain_next_k(SinGrain* unit, int inNumSamples);
 
@@ -571,6 +724,7 @@ extern "C"
 	void SinGrainI_next_k(SinGrainI* unit, int inNumSamples);
 
 	void InGrain_Ctor(InGrain* unit);
+	void InGrain_Dtor(InGrain* unit);
 	void InGrain_next_a(InGrain* unit, int inNumSamples);
 	void InGrain_next_k(InGrain* unit, int inNumSamples);
 
@@ -583,6 +737,7 @@ extern "C"
 	void InGrainI_next_k(InGrainI* unit, int inNumSamples);
 
 	void FMGrain_Ctor(FMGrain* unit);
+	void FMGrain_Dtor(FMGrain* unit);
 	void FMGrain_next_a(FMGrain* unit, int inNumSamples);
 	void FMGrain_next_k(FMGrain* unit, int inNumSamples);
 
@@ -595,6 +750,7 @@ extern "C"
 	void FMGrainI_next_k(FMGrainI* unit, int inNumSamples);
 
 	void BufGrain_Ctor(BufGrain* unit);
+	void BufGrain_Dtor(BufGrain* unit);
 	void BufGrain_next_a(BufGrain *unit, int inNumSamples);
 	void BufGrain_next_k(BufGrain *unit, int inNumSamples);
 
@@ -609,6 +765,7 @@ extern "C"
 	/////// Ambisonic Versions of grains /////////////////
 
 	void SinGrainBF_Ctor(SinGrainBF* unit);
+	void SinGrainBF_Dtor(SinGrainBF* unit);
 	void SinGrainBF_next_a(SinGrainBF* unit, int inNumSamples);
 	void SinGrainBF_next_k(SinGrainBF* unit, int inNumSamples);
 
@@ -621,6 +778,7 @@ extern "C"
 	void SinGrainIBF_next_k(SinGrainIBF* unit, int inNumSamples);
 
 	void FMGrainBF_Ctor(FMGrainBF* unit);
+	void FMGrainBF_Dtor(FMGrainBF* unit);
 	void FMGrainBF_next_a(FMGrainBF* unit, int inNumSamples);
 	void FMGrainBF_next_k(FMGrainBF* unit, int inNumSamples);
 
@@ -633,6 +791,7 @@ extern "C"
 	void FMGrainIBF_next_k(FMGrainIBF* unit, int inNumSamples);
 
 	void InGrainBF_Ctor(InGrainBF* unit);
+	void InGrainBF_Dtor(InGrainBF* unit);
 	void InGrainBF_next_a(InGrainBF* unit, int inNumSamples);
 	void InGrainBF_next_k(InGrainBF* unit, int inNumSamples);
 
@@ -645,6 +804,7 @@ extern "C"
 	void InGrainBBF_next_k(InGrainBBF* unit, int inNumSamples);
 
 	void BufGrainBF_Ctor(BufGrainBF* unit);
+	void BufGrainBF_Dtor(BufGrainBF* unit);
 	void BufGrainBF_next_a(BufGrainBF *unit, int inNumSamples);
 	void BufGrainBF_next_k(BufGrainBF *unit, int inNumSamples);
 
@@ -903,139 +1063,352 @@ inline double sc_gloop(double in, double hi)
 
 ////////////////////////////////////////////////////////////////////////////////////
 
+//////////////////////// grain pool sources ////////////////////////////////////////
+// the outputs the grains are written to. add writes one grain, Gain holds what is per
+// grain so it can be kept in registers. addLanes sums the kGrainBatch lanes of a batch.
+
+struct GrainMonoOut
+{
+	struct Gain {};
+	struct Gains {};
+	float *out;
+
+	GrainMonoOut(Unit *unit) : out(OUT(0)) {}
+	Gain gain(GrainPool *pool, int g) const { return Gain(); }
+	void add(const Gain &gain, int i, float outval) const { out[i] += outval; }
+	void load(GrainPool *pool, int first, int count, Gains &gains) const {}
+	void addLanes(const Gains &gains, int i, const float *vals) const
+	{
+		float sum = 0.f;
+		for (int k=0; k<kGrainBatch; ++k) sum += vals[k];
+		out[i] += sum;
+	}
+};
+
+struct GrainBFOut
+{
+	struct Gain { float W_amp, X_amp, Y_amp, Z_amp; };
+	struct Gains { float W_amp[kGrainBatch], X_amp[kGrainBatch], Y_amp[kGrainBatch], Z_amp[kGrainBatch]; };
+	float *Wout, *Xout, *Yout, *Zout;
+
+	GrainBFOut(Unit *unit) : Wout(OUT(0)), Xout(OUT(1)), Yout(OUT(2)), Zout(OUT(3)) {}
+	Gain gain(GrainPool *pool, int g) const
+	{
+		Gain gain = {pool->wamp[g], pool->xamp[g], pool->yamp[g], pool->zamp[g]};
+		return gain;
+	}
+	void add(const Gain &gain, int i, float outval) const
+	{
+		Wout[i] += outval * gain.W_amp;
+		Xout[i] += outval * gain.X_amp;
+		Yout[i] += outval * gain.Y_amp;
+		Zout[i] += outval * gain.Z_amp;
+	}
+	void load(GrainPool *pool, int first, int count, Gains &gains) const
+	{
+		for (int k=0; k<kGrainBatch; ++k) {
+			int g = first + (k < count ? k : 0);
+			gains.W_amp[k] = pool->wamp[g];
+			gains.X_amp[k] = pool->xamp[g];
+			gains.Y_amp[k] = pool->yamp[g];
+			gains.Z_amp[k] = pool->zamp[g];
+		}
+	}
+	void addLanes(const Gains &gains, int i, const float *vals) const
+	{
+		float w = 0.f, x = 0.f, y = 0.f, z = 0.f;
+		for (int k=0; k<kGrainBatch; ++k) {
+			w += vals[k] * gains.W_amp[k];
+			x += vals[k] * gains.X_amp[k];
+			y += vals[k] * gains.Y_amp[k];
+			z += vals[k] * gains.Z_amp[k];
+		}
+		Wout[i] += w;
+		Xout[i] += x;
+		Yout[i] += y;
+		Zout[i] += z;
+	}
+};
+
+// calculates the position of the grain in space, as CALC_BF_COEFS
+static void GrainPool_setBF(GrainPool *pool, int g, float azimuth, float elevation, float rho, float wComp)
+{
+	float sina = sin(azimuth);
+	float sinb = sin(elevation);
+	float cosa = cos(azimuth);
+	float cosb = cos(elevation);
+	float sinint, cosint;
+	if (rho >= 1) {
+		float intrho = 1 / pow(rho, 1.5);
+		sinint = (rsqrt2 * (sin(0.78539816339745))) * intrho;
+		cosint = (rsqrt2 * (cos(0.78539816339745))) * intrho;
+	} else {
+		sinint = rsqrt2 * (sin(0.78539816339745 * rho));
+		cosint = rsqrt2 * (cos(0.78539816339745 * rho));
+	}
+	float X_amp = pool->xamp[g] = cosa * cosb * sinint;
+	float Y_amp = pool->yamp[g] = sina * cosb * sinint;
+	float Z_amp = pool->zamp[g] = sinb * sinint;
+	if (wComp > 0.) {
+		pool->wamp[g] = cosint * (1 - (0.293 * ((X_amp * X_amp) + (Y_amp * Y_amp) + (Z_amp * Z_amp))));
+	} else {
+		pool->wamp[g] = cosint * 0.707;
+	}
+}
+
+// grains of an input signal, the envelopes are summed and applied to the input once per sample
+template <class Out>
+struct GrainInSource
+{
+	Out out;
+	const float *in;
+
+	GrainInSource(Unit *unit, int input) : out(unit), in(IN(input)) {}
+	void batch(GrainPool *pool, int first, int count, const float env[][kGrainBatch],
+		   const int *from, const int *to, int offset, int nsmps)
+	{
+		typename Out::Gains gains;
+		out.load(pool, first, count, gains);
+		for (int j=0; j<nsmps; ++j) {
+			float inval = in[offset + j];
+			float vals[kGrainBatch];
+			for (int k=0; k<kGrainBatch; ++k) vals[k] = env[j][k] * inval;
+			out.addLanes(gains, offset + j, vals);
+		}
+	}
+};
+
+// sine grains. The oscillator is a recursion like the envelope, set up by GrainPool_setSin,
+// so all lanes of a batch run together.
+template <class Out>
+struct GrainSinSource
+{
+	Out out;
+
+	GrainSinSource(Unit *unit) : out(unit) {}
+	void batch(GrainPool *pool, int first, int count, const float env[][kGrainBatch],
+		   const int *from, const int *to, int offset, int nsmps)
+	{
+		typename Out::Gains gains;
+		out.load(pool, first, count, gains);
+		double b1[kGrainBatch], y1[kGrainBatch], y2[kGrainBatch];
+		for (int k=0; k<kGrainBatch; ++k) {
+			int g = first + (k < count ? k : 0);
+			b1[k] = pool->sinb1[g];
+			y1[k] = pool->siny1[g];
+			y2[k] = pool->siny2[g];
+		}
+		for (int j=0; j<nsmps; ++j) {
+			float vals[kGrainBatch];
+			for (int k=0; k<kGrainBatch; ++k) {
+				vals[k] = env[j][k] * (float)y1[k];
+				double y0 = b1[k] * y1[k] - y2[k];
+				y2[k] = y1[k];
+				y1[k] = y0;
+			}
+			out.addLanes(gains, offset + j, vals);
+		}
+		for (int k=0; k<count; ++k) {
+			pool->siny1[first + k] = y1[k];
+			pool->siny2[first + k] = y2[k];
+		}
+	}
+};
+
+// a sine of freq Hz with phase 0 at sample start of the block
+static void GrainPool_setSin(Unit *unit, GrainPool *pool, int g, float freq, int start)
+{
+	double w = twopi * freq * SAMPLEDUR;
+	pool->sinb1[g] = 2. * cos(w);
+	pool->siny1[g] = sin(w * -start);
+	pool->siny2[g] = sin(w * (-1 - start));
+}
+
+// the FM carrier follows the modulator from sample to sample, so FM grains run one at a time
+template <class Out>
+struct GrainFMSource
+{
+	Out out;
+	uint32 lomask;
+	double cpstoinc;
+	const float *table0, *table1;
+
+	GrainFMSource(Unit *unit, uint32 lomask, double cpstoinc) : out(unit), lomask(lomask), cpstoinc(cpstoinc),
+		table0(ft->mSineWavetable), table1(ft->mSineWavetable + 1) {}
+	void grain(GrainPool *pool, int g, GrainEnvelope &env, int from, int to)
+	{
+		typename Out::Gain gain = out.gain(pool, g);
+		int32 coscphase = pool->oscphase[g];
+		int32 moscphase = pool->modphase[g];
+		int32 mfreq = pool->modfreq[g];
+		float deviation = pool->deviation[g];
+		float carbase = pool->carbase[g];
+		for (int j=from; j<to; ++j) {
+			float amp = env.next();
+			float thismod = lookupi1(table0, table1, moscphase, lomask) * deviation;
+			float outval = amp * lookupi1(table0, table1, coscphase, lomask);
+			out.add(gain, j, outval);
+			int32 cfreq = (int32)(cpstoinc * (carbase + thismod)); // needs to be calced in the loop!
+			coscphase += cfreq;
+			moscphase += mfreq;
+		}
+		pool->oscphase[g] = coscphase;
+		pool->modphase[g] = moscphase;
+	}
+};
+
+// reads one sample of a mono buffer, as the GRAIN_LOOP_BODY_ macros
+template <int interp>
+static inline float GrainBuf_read(const float *bufData, uint32 bufSamples, int guardFrame, double phase)
+{
+	int32 iphase = (int32)phase;
+	if (interp == 4) {
+		const float* table1 = bufData + iphase;
+		const float* table0 = table1 - 1;
+		const float* table2 = table1 + 1;
+		const float* table3 = table1 + 2;
+		if (iphase == 0) {
+			table0 += bufSamples;
+		} else if (iphase >= guardFrame) {
+			if (iphase == guardFrame) {
+				table3 -= bufSamples;
+			} else {
+				table2 -= bufSamples;
+				table3 -= bufSamples;
+			}
+		}
+		float fracphase = phase - (double)iphase;
+		return cubicinterp(fracphase, table0[0], table1[0], table2[0], table3[0]);
+	} else if (interp == 2) {
+		const float* table1 = bufData + iphase;
+		const float* table2 = table1 + 1;
+		if (iphase > guardFrame) {
+			table2 -= bufSamples;
+		}
+		float fracphase = phase - (double)iphase;
+		float b = table1[0];
+		float c = table2[0];
+		return b + fracphase * (c - b);
+	} else {
+		return bufData[iphase];
+	}
+}
+
+// buffer reads are scattered, so buffer grains run one at a time
+template <class Out>
+struct GrainBufSource
+{
+	Out out;
+
+	GrainBufSource(Unit *unit) : out(unit) {}
+	void grain(GrainPool *pool, int g, GrainEnvelope &env, int from, int to)
+	{
+		SndBuf *buf = pool->buf[g];
+		// the buffer was freed under the grain
+		if (!buf->data) return;
+		int interp = pool->interp[g];
+		if (interp >= 4) {
+			run<4>(pool, g, buf, env, from, to);
+		} else if (interp >= 2) {
+			run<2>(pool, g, buf, env, from, to);
+		} else {
+			run<1>(pool, g, buf, env, from, to);
+		}
+	}
+
+	template <int interp>
+	void run(GrainPool *pool, int g, SndBuf *buf, GrainEnvelope &env, int from, int to)
+	{
+		const float *bufData = buf->data;
+		uint32 bufSamples = buf->samples;
+		uint32 bufFrames = buf->frames;
+		int guardFrame = bufFrames - 2;
+		double loopMax = (double)bufFrames;
+		typename Out::Gain gain = out.gain(pool, g);
+		double rate = pool->rate[g];
+		double phase = pool->phase[g];
+		for (int j=from; j<to; ++j) {
+			float amp = env.next();
+			phase = sc_gloop(phase, loopMax);
+			float outval = amp * GrainBuf_read<interp>(bufData, bufSamples, guardFrame, phase);
+			out.add(gain, j, outval);
+			phase += rate;
+		}
+		pool->phase[g] = phase;
+	}
+};
+
+// as SETUP_GRAIN_BUF
+static SndBuf *GrainPool_getBuf(Unit *unit, uint32 bufnum)
+{
+	World *world = unit->mWorld;
+	if (bufnum >= world->mNumSndBufs) {
+		int localBufNum = bufnum - world->mNumSndBufs;
+		Graph *parent = unit->mParent;
+		if (localBufNum < parent->localBufNum) {
+			return parent->mLocalSndBufs + localBufNum;
+		} else {
+			return world->mSndBufs;
+		}
+	}
+	return world->mSndBufs + bufnum;
+}
+
 void MonoGrain_next(MonoGrain *unit, int inNumSamples)
 {
 	ClearUnitOutputs(unit, inNumSamples);
-	float *out = OUT(0);
-	float *in = IN(0);
+	GrainPool *pool = &unit->mPool;
 	float winSize = IN0(1);
 	float grainFreq = IN0(2);
 	float randSize = IN0(3);
-	for (int i=0; i < unit->mNumActive; ) {
-		Grain *grain = unit->mGrains + i;
-		double b1 = grain->b1;
-		double y1 = grain->y1;
-		double y2 = grain->y2;
-		int nsmps = sc_min(grain->counter, inNumSamples);
-		for (int j=0; j<nsmps; ++j) {
-		    float amp = y1 * y1;
-		    float outval = amp * in[j];
-		    out[j] += outval;
-		    double y0 = b1 * y1 - y2;
-		    y2 = y1;
-		    y1 = y0;
-		    }
-		grain->y1 = y1;
-		grain->y2 = y2;
-		grain->counter -= nsmps;
-		if (grain->counter <= 0) {
-			// remove grain
-			*grain = unit->mGrains[--unit->mNumActive];
-		} else ++i;
-	}
 	int nextGrain = unit->m_NextGrain;
 	for (int i=0; i<inNumSamples; ++i) {
 		--nextGrain;
 		if (nextGrain <= 0) {
 			// start a grain
-			if (unit->mNumActive+1 >= kMaxSynthGrains) break;
-			Grain *grain = unit->mGrains + unit->mNumActive++;
-			RGET
-//			s1 = trand(s1, s2, s3);
-//			s2 = trand(s2, s3, s1);
-//			s3 = trand(s3, s1, s2);
 			if (grainFreq <= 0.0) {printf("GrainFreq must be greater than 0\n"); break;}
+			RGET
 			double counter = winSize * SAMPLERATE;
 			double winrandamt = frand2(s1, s2, s3) * randSize;
 			counter = floor(counter + (counter * winrandamt));
-			counter = sc_max(4., counter);
-			grain->counter = (int)counter;
-			nextGrain = (int)(SAMPLERATE / grainFreq);
-			double w = pi / counter;
-			double b1 = grain->b1 = 2. * cos(w);
-			double y1 = sin(w);
-			double y2 = 0.;
-			int nsmps = sc_min(grain->counter, inNumSamples - i);
-			for (int j=0; j<nsmps; ++j) {
-			    float amp = y1 * y1;
-			    float outval = amp * in[j];
-			    out[j] += outval;
-			    double y0 = b1 * y1 - y2;
-			    y2 = y1;
-			    y1 = y0;
-			}
-			grain->y1 = y1;
-			grain->y2 = y2;
 			// store random values
 			RPUT
-			// end change
-			grain->counter -= nsmps;
-			if (grain->counter <= 0) {
-				// remove grain
-				*grain = unit->mGrains[--unit->mNumActive];
-			}
+			nextGrain = (int)(SAMPLERATE / grainFreq);
+			if (GrainPool_add(unit->mWorld, pool, counter, i) < 0) break;
 		}
 	}
 	unit->m_NextGrain = nextGrain;
+
+	GrainInSource<GrainMonoOut> source(unit, 0);
+	GrainPool_next(pool, source, inNumSamples);
 }
 
 void MonoGrain_Ctor(MonoGrain *unit)
 {
 	SETCALC(MonoGrain_next);
-	unit->mNumActive = 0;
+	GrainPool_init(unit->mWorld, &unit->mPool, 0);
 	unit->m_NextGrain = 1;
 	ClearUnitOutputs(unit, 1);
 }
 
+void MonoGrain_Dtor(MonoGrain *unit)
+{
+	GrainPool_free(unit->mWorld, &unit->mPool);
+}
+
 // a BFormat version of the previous MonoGrain
 void MonoGrainBF_next(MonoGrainBF *unit, int inNumSamples)
 {
 	ClearUnitOutputs(unit, inNumSamples);
-	float *Wout = OUT(0);
-	float *Xout = OUT(1);
-	float *Yout = OUT(2);
-	float *Zout = OUT(3);
-	float *in = IN(0);
-
-	for (int i=0; i < unit->mNumActive; ) {
-		Grainbf *grainbf = unit->mGrains + i;
-		double b1 = grainbf->b1;
-		double y1 = grainbf->y1;
-		double y2 = grainbf->y2;
-		float W_amp = grainbf->m_W_amp;
-		float X_amp = grainbf->m_X_amp;
-		float Y_amp = grainbf->m_Y_amp;
-		float Z_amp = grainbf->m_Z_amp;
-		int nsmps = sc_min(grainbf->counter, inNumSamples);
-		for (int j=0; j<nsmps; ++j) {
-		    float amp = y1 * y1;
-		    float outval = amp * in[j];
-		    // do the BFormat encoding on the resultant signal
-		    Wout[j] += outval * W_amp;
-		    Xout[j] += outval * X_amp;
-		    Yout[j] += outval * Y_amp;
-		    Zout[j] += outval * Z_amp;
-		    double y0 = b1 * y1 - y2;
-		    y2 = y1;
-		    y1 = y0;
-		    }
-		grainbf->y1 = y1;
-		grainbf->y2 = y2;
-		grainbf->counter -= nsmps;
-		if (grainbf->counter <= 0) {
-			// remove grain
-			*grainbf = unit->mGrains[--unit->mNumActive];
-		} else ++i;
-	}
+	GrainPool *pool = &unit->mPool;
 	int nextGrain = unit->m_NextGrain;
 	if (nextGrain > inNumSamples) {
-	    unit->m_NextGrain -=inNumSamples;
+	    nextGrain -= inNumSamples;
 	    } else {
 	    for (int i=0; i<inNumSamples; ++i) {
 		    --nextGrain;
 		    if (nextGrain <= 0) {
 			    // start a grain
-			    if (unit->mNumActive+1 >= kMaxSynthGrains) break;
 			    float winSize = IN_AT(unit, 1, i);
 			    float grainFreq = IN_AT(unit, 2, i);
 			    float randSize = IN_AT(unit, 3, i);
@@ -1045,26 +1418,19 @@ void MonoGrainBF_next(MonoGrainBF *unit, int inNumSamples)
 			    float elevationrand = IN_AT(unit, 7, i);
 			    float rho = IN_AT(unit, 8, i); // place at the speaker radius for now
 			    float sinint, cosint;
-			    Grainbf *grainbf = unit->mGrains + unit->mNumActive++;
-			    RGET
 			    if (grainFreq <= 0.0) {printf("GrainFreq must be greater than 0\n"); break;}
+			    RGET
 			    double counter = winSize * SAMPLERATE;
 			    double ranval = frand2(s1, s2, s3);
 			    double winrandamt = ranval * randSize;
 			    counter = floor(counter + (counter * winrandamt));
-			    counter = sc_max(4., counter);
-			    grainbf->counter = (int)counter;
+			    // store random values
+			    RPUT
 			    nextGrain = (int)(SAMPLERATE / grainFreq);
-			    double w = pi / counter;
-			    double b1 = grainbf->b1 = 2. * cos(w);
-			    double y1 = sin(w);
-			    double y2 = 0.;
+			    int g = GrainPool_add(unit->mWorld, pool, counter, i);
+			    if (g < 0) break;
 			    double thisloc = loc + (locrand * (ranval * pi));
 			    double thiselevation = elevation + (elevationrand * (ranval * 0.5 * pi));
-			    float *Wout1 = Wout + i;
-			    float *Xout1 = Xout + i;
-			    float *Yout1 = Yout + i;
-			    float *Zout1 = Zout + i;
 			    float sina = sin(thisloc);
 			    float sinb = sin(thiselevation);
 			    float cosa = cos(thisloc);
@@ -1075,208 +1441,74 @@ void MonoGrainBF_next(MonoGrainBF *unit, int inNumSamples)
 			    else
 				{sinint = rsqrt2 * (sin(0.78539816339745 * rho));
 				cosint = rsqrt2 * (cos(0.78539816339745 * rho));};
-			    float W_amp = rsqrt2 * cosint;
-			    float X_amp = cosa * cosb * sinint;
-			    float Y_amp = sina * cosb * sinint;
-			    float Z_amp = sinb * sinint;
-			    int nsmps = sc_min(grainbf->counter, inNumSamples - i);
-			    for (int j=0; j<nsmps; ++j) {
-				float amp = y1 * y1;
-				float outval = amp * in[j];
-				// do the BFormat encoding on the resultant signal
-				Wout1[j] += outval * W_amp;
-				Xout1[j] += outval * X_amp;
-				Yout1[j] += outval * Y_amp;
-				Zout1[j] += outval * Z_amp;
-				double y0 = b1 * y1 - y2;
-				y2 = y1;
-				y1 = y0;
-			    }
-			    grainbf->y1 = y1;
-			    grainbf->y2 = y2;
-			    grainbf->m_W_amp = W_amp;
-			    grainbf->m_X_amp = X_amp;
-			    grainbf->m_Y_amp = Y_amp;
-			    grainbf->m_Z_amp = Z_amp;
-			    // store random values
-			    RPUT
-			    grainbf->counter -= nsmps;
-			    if (grainbf->counter <= 0) {
-				    // remove grain
-				    *grainbf = unit->mGrains[--unit->mNumActive];
-				}
+			    pool->wamp[g] = rsqrt2 * cosint;
+			    pool->xamp[g] = cosa * cosb * sinint;
+			    pool->yamp[g] = sina * cosb * sinint;
+			    pool->zamp[g] = sinb * sinint;
 			}
 		}
-	    unit->m_NextGrain = nextGrain;
 	    }
+	unit->m_NextGrain = nextGrain;
+
+	GrainInSource<GrainBFOut> source(unit, 0);
+	GrainPool_next(pool, source, inNumSamples);
 }
 
 void MonoGrainBF_Ctor(MonoGrainBF *unit)
 {
 	SETCALC(MonoGrainBF_next);
-	unit->mNumActive = 0;
+	GrainPool_init(unit->mWorld, &unit->mPool, kGrainBF);
 	unit->m_NextGrain = 1;
 	ClearUnitOutputs(unit, 1);
 }
 
+void MonoGrainBF_Dtor(MonoGrainBF *unit)
+{
+	GrainPool_free(unit->mWorld, &unit->mPool);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /* granular synthesis UGens - SinOsc / FM / Buffer / In */
 ///////////////////////////////////SinGrain ///////////////////////////////////
 
+static void SinGrain_start(SinGrain *unit, int i)
+{
+	GrainPool *pool = &unit->mPool;
+	int g = GrainPool_add(unit->mWorld, pool, IN_AT(unit, 1, i) * SAMPLERATE, i);
+	if (g < 0) return;
+	GrainPool_setSin(unit, pool, g, IN_AT(unit, 2, i), i);
+}
+
 void SinGrain_next_a(SinGrain *unit, int inNumSamples)
 {
 	ClearUnitOutputs(unit, inNumSamples);
-	float *out = OUT(0);
 	float *trig = IN(0);
-	float winSize, freq;
-	float *table0 = ft->mSineWavetable;
-	float *table1 = table0 + 1;
-
-	for (int i=0; i < unit->mNumActive; ) {
-		SGrain *grain = unit->mGrains + i;
-		double b1 = grain->b1;
-		double y1 = grain->y1;
-		double y2 = grain->y2;
-		int32 thisfreq = grain->freq;
-		int32 oscphase = grain->oscphase;
-
-		int nsmps = sc_min(grain->counter, inNumSamples);
-		for (int j=0; j<nsmps; ++j) {
-		    float amp = y1 * y1;
-		    float outval = amp * lookupi1(table0, table1, oscphase, unit->m_lomask);
-		    out[j] += outval;
-		    double y0 = b1 * y1 - y2;
-		    y2 = y1;
-		    y1 = y0;
-		    oscphase += thisfreq;
-		    }
-		grain->y1 = y1;
-		grain->y2 = y2;
-		grain->oscphase = oscphase;
-		grain->counter -= nsmps;
-		if (grain->counter <= 0) {
-			// remove grain
-			*grain = unit->mGrains[--unit->mNumActive];
-		} else ++i;
-	}
 
 	for (int i=0; i<inNumSamples; ++i) {
 		if ((unit->curtrig <= 0) && (trig[i] > 0.0)) {
 			// start a grain
-			if (unit->mNumActive+1 >= kMaxSynthGrains) {Print("Too many grains!\n"); break;}
-			SGrain *grain = unit->mGrains + unit->mNumActive++;
-			// INRATE(1) == calcFullRate
-			freq = IN_AT(unit, 2, i);
-			winSize = IN_AT(unit, 1, i);
-			int32 thisfreq = grain->freq = (int32)(unit->m_cpstoinc * freq);
-			int32 oscphase = 0;
-			double counter = winSize * SAMPLERATE;
-			counter = sc_max(4., counter);
-			grain->counter = (int)counter;
-			double w = pi / counter;
-			double b1 = grain->b1 = 2. * cos(w);
-			double y1 = sin(w);
-			double y2 = 0.;
-			float *out1 = out + i;
-			int nsmps = sc_min(grain->counter, inNumSamples - i);
-			for (int j=0; j<nsmps; ++j) {
-			    float amp = y1 * y1;
-			    float outval = amp * lookupi1(table0, table1, oscphase, unit->m_lomask);
-			    out1[j] += outval;
-			    double y0 = b1 * y1 - y2;
-			    y2 = y1;
-			    y1 = y0;
-			    oscphase += thisfreq;
-			}
-			grain->oscphase = oscphase;
-			grain->y1 = y1;
-			grain->y2 = y2;
-			grain->counter -= nsmps;
-			if (grain->counter <= 0) {
-				// remove grain
-				*grain = unit->mGrains[--unit->mNumActive];
-			}
+			SinGrain_start(unit, i);
 		}
 		unit->curtrig = trig[i];
 	}
+
+	GrainSinSource<GrainMonoOut> source(unit);
+	GrainPool_next(&unit->mPool, source, inNumSamples);
 }
 
 void SinGrain_next_k(SinGrain *unit, int inNumSamples)
 {
 	ClearUnitOutputs(unit, inNumSamples);
-	float *out = OUT(0);
 	float trig = IN0(0);
-	float winSize, freq;
-	float *table0 = ft->mSineWavetable;
-	float *table1 = table0 + 1;
-
-	for (int i=0; i < unit->mNumActive; ) {
-		SGrain *grain = unit->mGrains + i;
-		double b1 = grain->b1;
-		double y1 = grain->y1;
-		double y2 = grain->y2;
-		int32 thisfreq = grain->freq;
-		int32 oscphase = grain->oscphase;
 
-		int nsmps = sc_min(grain->counter, inNumSamples);
-		for (int j=0; j<nsmps; ++j) {
-		    float amp = y1 * y1;
-		    float outval = amp * lookupi1(table0, table1, oscphase, unit->m_lomask);
-		    out[j] += outval;
-		    double y0 = b1 * y1 - y2;
-		    y2 = y1;
-		    y1 = y0;
-		    oscphase += thisfreq;
-		    }
-		grain->y1 = y1;
-		grain->y2 = y2;
-		grain->oscphase = oscphase;
-		grain->counter -= nsmps;
-		if (grain->counter <= 0) {
-			// remove grain
-			*grain = unit->mGrains[--unit->mNumActive];
-		} else ++i;
+	if ((unit->curtrig <= 0) && (trig > 0.0)) {
+		// start a grain
+		SinGrain_start(unit, 0);
 	}
+	unit->curtrig = trig;
 
-	if ((unit->curtrig <= 0) && (trig > 0.0)) {
-		    // start a grain
-		    if (unit->mNumActive+1 >= kMaxSynthGrains)
-		    {
-		    Print("Too many grains!\n");
-		    } else {
-		    SGrain *grain = unit->mGrains + unit->mNumActive++;
-		    freq = IN0(2);
-		    winSize = IN0(1);
-		    int32 thisfreq = grain->freq = (int32)(unit->m_cpstoinc * freq);
-		    int32 oscphase = 0;
-		    double counter = winSize * SAMPLERATE;
-		    counter = sc_max(4., counter);
-		    grain->counter = (int)counter;
-		    double w = pi / counter;
-		    double b1 = grain->b1 = 2. * cos(w);
-		    double y1 = sin(w);
-		    double y2 = 0.;
-			int nsmps = sc_min(grain->counter, inNumSamples);
-			for (int j=0; j<nsmps; ++j) {
-			    float amp = y1 * y1;
-			    float outval = amp * lookupi1(table0, table1, oscphase, unit->m_lomask);
-			    out[j] += outval;
-			    double y0 = b1 * y1 - y2;
-			    y2 = y1;
-			    y1 = y0;
-			    oscphase += thisfreq;
-			}
-			grain->oscphase = oscphase;
-			grain->y1 = y1;
-			grain->y2 = y2;
-			grain->counter -= nsmps;
-			if (grain->counter <= 0) {
-				// remove grain
-				*grain = unit->mGrains[--unit->mNumActive];
-			}
-		}
-	    }
-	    unit->curtrig = trig;
+	GrainSinSource<GrainMonoOut> source(unit);
+	GrainPool_next(&unit->mPool, source, inNumSamples);
 }
 
 
@@ -1292,10 +1524,15 @@ void SinGrain_Ctor(SinGrain *unit)
 	unit->m_radtoinc = tableSizeSin * (rtwopi * 65536.);
 	unit->m_cpstoinc = tableSizeSin * SAMPLEDUR * 65536.;
 	unit->curtrig = 0.f;
-	unit->mNumActive = 0;
+	GrainPool_init(unit->mWorld, &unit->mPool, kGrainSin);
 	SinGrain_next_k(unit, 1);
 }
 
+void SinGrain_Dtor(SinGrain *unit)
+{
+	GrainPool_free(unit->mWorld, &unit->mPool);
+}
+
 ///////////////////////// SinGrainB ////////////////////////////
 
 void SinGrainB_next_a(SinGrainB *unit, int inNumSamples)
@@ -1643,191 +1880,51 @@ void SinGrainI_Ctor(SinGrainI *unit)
 
 //////////////////////// FM grains /////////////////////////////
 
+static void FMGrain_start(FMGrain *unit, int i)
+{
+	GrainPool *pool = &unit->mPool;
+	int g = GrainPool_add(unit->mWorld, pool, IN_AT(unit, 1, i) * SAMPLERATE, i);
+	if (g < 0) return;
+	float carfreq = IN_AT(unit, 2, i);
+	float modfreq = IN_AT(unit, 3, i);
+	float index = IN_AT(unit, 4, i);
+	pool->deviation[g] = index * modfreq;
+	pool->modfreq[g] = (int32)(unit->m_cpstoinc * modfreq);
+	pool->carbase[g] = carfreq;
+	pool->oscphase[g] = 0;
+	pool->modphase[g] = 0;
+}
+
 void FMGrain_next_a(FMGrain *unit, int inNumSamples)
 {
 	ClearUnitOutputs(unit, inNumSamples);
-	float *out = OUT(0);
 	float *trig = IN(0);
-	float winSize, carfreq, modfreq, index;
-
-	float *table0 = ft->mSineWavetable;
-	float *table1 = table0 + 1;
-
-	for (int i=0; i < unit->mNumActive; ) {
-		FGrain *grain = unit->mGrains + i;
-		double b1 = grain->b1;
-		double y1 = grain->y1;
-		double y2 = grain->y2;
-		int32 mfreq = grain->mfreq;
-		int32 moscphase = grain->moscphase;
-		int32 coscphase = grain->coscphase;
-		float deviation = grain->deviation;
-		float carbase = grain->carbase;
-
-		int nsmps = sc_min(grain->counter, inNumSamples);
-		for (int j=0; j<nsmps; ++j) {
-			float amp = y1 * y1;
-			float thismod = lookupi1(table0, table1, moscphase, unit->m_lomask) * deviation;
-			float outval = amp * lookupi1(table0, table1, coscphase, unit->m_lomask);
-			out[j] += outval;
-			double y0 = b1 * y1 - y2;
-			y2 = y1;
-			y1 = y0;
-			int32 cfreq = (int32)(unit->m_cpstoinc * (carbase + thismod)); // needs to be calced in the loop!
-			coscphase += cfreq;
-			moscphase += mfreq;
-		    } // need to save float carbase, int32 mfreq, float deviation
-		grain->coscphase = coscphase;
-		grain->moscphase = moscphase;
-		grain->y1 = y1;
-		grain->y2 = y2;
-		grain->counter -= nsmps;
-		if (grain->counter <= 0) {
-			// remove grain
-			*grain = unit->mGrains[--unit->mNumActive];
-		} else ++i;
-	}
 
 	for (int i=0; i<inNumSamples; ++i) {
-	    if ((unit->curtrig <= 0) && (trig[i] > 0.0)) {
-		// start a grain
-		if (unit->mNumActive+1 >= kMaxSynthGrains) {Print("Too many grains!\n"); break;}
-		FGrain *grain = unit->mGrains + unit->mNumActive++;
-		winSize = IN_AT(unit, 1, i);
-		carfreq = IN_AT(unit, 2, i);
-		modfreq = IN_AT(unit, 3, i);
-		index = IN_AT(unit, 4, i);
-		float deviation = grain->deviation = index * modfreq;
-		int32 mfreq = grain->mfreq = (int32)(unit->m_cpstoinc * modfreq);
-		grain->carbase = carfreq;
-		int32 coscphase = 0;
-		int32 moscphase = 0;
-		double counter = winSize * SAMPLERATE;
-		counter = sc_max(4., counter);
-		grain->counter = (int)counter;
-		double w = pi / counter;
-		double b1 = grain->b1 = 2. * cos(w);
-		double y1 = sin(w);
-		double y2 = 0.;
-		float *out1 = out + i;
-		int nsmps = sc_min(grain->counter, inNumSamples - i);
-		for (int j=0; j<nsmps; ++j) {
-		    float amp = y1 * y1;
-		    float thismod = lookupi1(table0, table1, moscphase, unit->m_lomask) * deviation;
-		    float outval = amp * lookupi1(table0, table1, coscphase, unit->m_lomask);
-		    out1[j] += outval;
-		    double y0 = b1 * y1 - y2;
-		    y2 = y1;
-		    y1 = y0;
-		    int32 cfreq = (int32)(unit->m_cpstoinc * (carfreq + thismod)); // needs to be calced in the loop!
-		    coscphase += cfreq;
-		    moscphase += mfreq;
-		} // need to save float carbase, int32 mfreq, float deviation
-		grain->coscphase = coscphase;
-		grain->moscphase = moscphase;
-		grain->y1 = y1;
-		grain->y2 = y2;
-		grain->counter -= nsmps;
-		if (grain->counter <= 0) {
-			// remove grain
-			*grain = unit->mGrains[--unit->mNumActive];
-		}
+		if ((unit->curtrig <= 0) && (trig[i] > 0.0)) {
+			// start a grain
+			FMGrain_start(unit, i);
 		}
 		unit->curtrig = trig[i];
 	}
+
+	GrainFMSource<GrainMonoOut> source(unit, unit->m_lomask, unit->m_cpstoinc);
+	GrainPool_nextEach(&unit->mPool, source, inNumSamples);
 }
 
 void FMGrain_next_k(FMGrain *unit, int inNumSamples)
 {
 	ClearUnitOutputs(unit, inNumSamples);
-	float *out = OUT(0);
 	float trig = IN0(0);
-	float winSize, carfreq, modfreq, index;
-
-	float *table0 = ft->mSineWavetable;
-	float *table1 = table0 + 1;
-
-	for (int i=0; i < unit->mNumActive; ) {
-		FGrain *grain = unit->mGrains + i;
-		double b1 = grain->b1;
-		double y1 = grain->y1;
-		double y2 = grain->y2;
-		int32 mfreq = grain->mfreq;
-		int32 moscphase = grain->moscphase;
-		int32 coscphase = grain->coscphase;
-		float deviation = grain->deviation;
-		float carbase = grain->carbase;
-
-		int nsmps = sc_min(grain->counter, inNumSamples);
-		for (int j=0; j<nsmps; ++j) {
-			float amp = y1 * y1;
-			float thismod = lookupi1(table0, table1, moscphase, unit->m_lomask) * deviation;
-			float outval = amp * lookupi1(table0, table1, coscphase, unit->m_lomask);
-			out[j] += outval;
-			double y0 = b1 * y1 - y2;
-			y2 = y1;
-			y1 = y0;
-			int32 cfreq = (int32)(unit->m_cpstoinc * (carbase + thismod)); // needs to be calced in the loop!
-			coscphase += cfreq;
-			moscphase += mfreq;
-		    } // need to save float carbase, int32 mfreq, float deviation
-		grain->coscphase = coscphase;
-		grain->moscphase = moscphase;
-		grain->y1 = y1;
-		grain->y2 = y2;
-		grain->counter -= nsmps;
-		if (grain->counter <= 0) {
-			// remove grain
-			*grain = unit->mGrains[--unit->mNumActive];
-		} else ++i;
-	    }
 
-	    if ((unit->curtrig <= 0) && (trig > 0.0)) {
+	if ((unit->curtrig <= 0) && (trig > 0.0)) {
 		// start a grain
-		if (unit->mNumActive+1 >= kMaxSynthGrains) {Print("Too many grains!\n");
-		} else {
-		FGrain *grain = unit->mGrains + unit->mNumActive++;
-		winSize = IN0(1);
-		carfreq = IN0(2);
-		modfreq = IN0(3);
-		index = IN0(4);
-		float deviation = grain->deviation = index * modfreq;
-		int32 mfreq = grain->mfreq = (int32)(unit->m_cpstoinc * modfreq);
-		grain->carbase = carfreq;
-		int32 coscphase = 0;
-		int32 moscphase = 0;
-		double counter = winSize * SAMPLERATE;
-		counter = sc_max(4., counter);
-		grain->counter = (int)counter;
-		double w = pi / counter;
-		double b1 = grain->b1 = 2. * cos(w);
-		double y1 = sin(w);
-		double y2 = 0.;
-		int nsmps = sc_min(grain->counter, inNumSamples);
-		for (int j=0; j<nsmps; ++j) {
-		    float amp = y1 * y1;
-		    float thismod = lookupi1(table0, table1, moscphase, unit->m_lomask) * deviation;
-		    float outval = amp * lookupi1(table0, table1, coscphase, unit->m_lomask);
-		    out[j] += outval;
-		    double y0 = b1 * y1 - y2;
-		    y2 = y1;
-		    y1 = y0;
-		    int32 cfreq = (int32)(unit->m_cpstoinc * (carfreq + thismod)); // needs to be calced in the loop!
-		    coscphase += cfreq;
-		    moscphase += mfreq;
-		} // need to save float carbase, int32 mfreq, float deviation
-		grain->coscphase = coscphase;
-		grain->moscphase = moscphase;
-		grain->y1 = y1;
-		grain->y2 = y2;
-		grain->counter -= nsmps;
-		if (grain->counter <= 0) {
-			// remove grain
-			*grain = unit->mGrains[--unit->mNumActive];
-		}
-	    }
+		FMGrain_start(unit, 0);
 	}
 	unit->curtrig = trig;
+
+	GrainFMSource<GrainMonoOut> source(unit, unit->m_lomask, unit->m_cpstoinc);
+	GrainPool_nextEach(&unit->mPool, source, inNumSamples);
 }
 
 void FMGrain_Ctor(FMGrain *unit)
@@ -1841,10 +1938,15 @@ void FMGrain_Ctor(FMGrain *unit)
 	unit->m_radtoinc = tableSizeSin * (rtwopi * 65536.);
 	unit->m_cpstoinc = tableSizeSin * SAMPLEDUR * 65536.;
 	unit->curtrig = 0.f;
-	unit->mNumActive = 0;
+	GrainPool_init(unit->mWorld, &unit->mPool, kGrainFM | kGrainEach);
 	FMGrain_next_k(unit, 1);
 }
 
+void FMGrain_Dtor(FMGrain *unit)
+{
+	GrainPool_free(unit->mWorld, &unit->mPool);
+}
+
 ///////////////////////  FMGrainB //////////////////////////////////////////
 
 void FMGrainB_next_a(FMGrainB *unit, int inNumSamples)
@@ -2256,261 +2358,55 @@ void FMGrainI_Ctor(FMGrainI *unit)
 }
 ///////////////////// BufGrain (basically Warp1 with a trigger... which is basically TGrains in Mono???) //////////////
 
+static void BufGrain_start(BufGrain *unit, int i)
+{
+	SndBuf *buf = GrainPool_getBuf(unit, (uint32)IN_AT(unit, 2, i));
+	if (!buf->data) {
+		unit->mDone = true;
+		return;
+	}
+	if (buf->channels != 1) return;
+
+	GrainPool *pool = &unit->mPool;
+	int g = GrainPool_add(unit->mWorld, pool, IN_AT(unit, 1, i) * SAMPLERATE, i);
+	if (g < 0) return;
+	float bufRateScale = buf->samplerate * SAMPLEDUR;
+	pool->buf[g] = buf;
+	pool->rate[g] = IN_AT(unit, 3, i) * bufRateScale;
+	pool->phase[g] = IN_AT(unit, 4, i) * buf->frames;
+	pool->interp[g] = (int)IN_AT(unit, 5, i);
+}
+
 void BufGrain_next_a(BufGrain *unit, int inNumSamples)
 {
 	ClearUnitOutputs(unit, inNumSamples);
-	float *out;
-	out = ZOUT(0);
 	float *trig = IN(0);
 
-	World *world = unit->mWorld;
-//	SndBuf *bufs = world->mSndBufs;
-//	uint32 numBufs = world->mNumSndBufs;
+	for (int i=0; i<inNumSamples; ++i) {
+		if ((trig[i] > 0) && (unit->curtrig <=0)) {
+			// start a grain
+			BufGrain_start(unit, i);
+		}
+		unit->curtrig = trig[i];
+	}
 
-	for (int i=0; i < unit->mNumActive; ) {
-		Grain *grain = unit->mGrains + i;
-//		uint32 bufnum = grain->bufnum;
+	GrainBufSource<GrainMonoOut> source(unit);
+	GrainPool_nextEach(&unit->mPool, source, inNumSamples);
+}
 
-		GRAIN_BUF
+void BufGrain_next_k(BufGrain *unit, int inNumSamples)
+{
+	ClearUnitOutputs(unit, inNumSamples);
+	float trig = IN0(0);
 
-		if (bufChannels != 1) {
-			 ++i;
-			 continue;
-		}
-		double loopMax = (double)bufFrames;
-		double rate = grain->rate;
-		double phase = grain->phase;
-		double b1 = grain->b1;
-		double y1 = grain->y1;
-		double y2 = grain->y2;
-
-		float *out1 = out;
-
-		int nsmps = sc_min(grain->counter, inNumSamples);
-		if (grain->interp >= 4) {
-			for (int j=0; j<nsmps; ++j) {
-				GRAIN_LOOP_BODY_4;
-				phase += rate;
-			}
-		} else if (grain->interp >= 2) {
-			for (int j=0; j<nsmps; ++j) {
-				GRAIN_LOOP_BODY_2;
-				phase += rate;
-			}
-		} else {
-			for (int j=0; j<nsmps; ++j) {
-				GRAIN_LOOP_BODY_1;
-				phase += rate;
-			}
-		}
-
-		grain->phase = phase;
-		grain->y1 = y1;
-		grain->y2 = y2;
-
-		grain->counter -= nsmps;
-		if (grain->counter <= 0) {
-			// remove grain
-			*grain = unit->mGrains[--unit->mNumActive];
-		} else ++i;
-	}
-
-	for (int i=0; i<inNumSamples; ++i) {
-		if ((trig[i] > 0) && (unit->curtrig <=0)) {
-			// start a grain
-			if (unit->mNumActive+1 >= kMaxSynthGrains) {Print("Too many grains!\n");
-			} else {
-			uint32 bufnum = (uint32)IN_AT(unit, 2, i);
-//			if (bufnum >= numBufs) continue;
-			Grain *grain = unit->mGrains + unit->mNumActive++;
-
-			SETUP_GRAIN_BUF
-			GRAIN_BUF
-
-			if (bufChannels != 1) continue;
-
-			float bufSampleRate = buf->samplerate;
-			float bufRateScale = bufSampleRate * SAMPLEDUR;
-			double loopMax = (double)bufFrames;
-
-//			Grain *grain = unit->mGrains + unit->mNumActive++;
-//			grain->bufnum = bufnum;
-
-			double counter = IN_AT(unit, 1, i) * SAMPLERATE;
-			counter = sc_max(4., counter);
-			grain->counter = (int)counter;
-
-			double rate = grain->rate = IN_AT(unit, 3, i) * bufRateScale;
-			double phase = IN_AT(unit, 4, i) * bufFrames;
-			grain->interp = (int)IN_AT(unit, 5, i);
-
-			double w = pi / counter;
-			double b1 = grain->b1 = 2. * cos(w);
-			double y1 = sin(w);
-			double y2 = 0.;
-
-			float *out1 = out + i;
-
-			int nsmps = sc_min(grain->counter, inNumSamples - i);
-			if (grain->interp >= 4) {
-				for (int j=0; j<nsmps; ++j) {
-					GRAIN_LOOP_BODY_4;
-					phase += rate;
-				}
-			} else if (grain->interp >= 2) {
-				for (int j=0; j<nsmps; ++j) {
-					GRAIN_LOOP_BODY_2;
-					phase += rate;
-				}
-			} else {
-				for (int j=0; j<nsmps; ++j) {
-					GRAIN_LOOP_BODY_1;
-					phase += rate;
-				}
-			}
-
-			grain->phase = phase;
-			grain->y1 = y1;
-			grain->y2 = y2;
-			// end change
-			grain->counter -= nsmps;
-			if (grain->counter <= 0) {
-				// remove grain
-				*grain = unit->mGrains[--unit->mNumActive];
-			}
-		    }
-		}
-		unit->curtrig = trig[i];
-	    }
-
-}
-
-void BufGrain_next_k(BufGrain *unit, int inNumSamples)
-{
-	ClearUnitOutputs(unit, inNumSamples);
-	float *out;
-	out = ZOUT(0);
-	float trig = IN0(0);
-
-	World *world = unit->mWorld;
-//	SndBuf *bufs = world->mSndBufs;
-	//uint32 numBufs = world->mNumSndBufs;
-
-	for (int i=0; i < unit->mNumActive; ) {
-		Grain *grain = unit->mGrains + i;
-//		uint32 bufnum = grain->bufnum;
-
-		GRAIN_BUF
-		CHECK_BUF
-
-		if (bufChannels != 1) {
-			 ++i;
-			 continue;
-		}
-
-		double loopMax = (double)bufFrames;
-
-		double rate = grain->rate;
-		double phase = grain->phase;
-		double b1 = grain->b1;
-		double y1 = grain->y1;
-		double y2 = grain->y2;
-
-		float *out1 = out;
-
-		int nsmps = sc_min(grain->counter, inNumSamples);
-		if (grain->interp >= 4) {
-			for (int j=0; j<nsmps; ++j) {
-				GRAIN_LOOP_BODY_4;
-				phase += rate;
-			}
-		} else if (grain->interp >= 2) {
-			for (int j=0; j<nsmps; ++j) {
-				GRAIN_LOOP_BODY_2;
-				phase += rate;
-			}
-		} else {
-			for (int j=0; j<nsmps; ++j) {
-				GRAIN_LOOP_BODY_1;
-				phase += rate;
-			}
-		}
-
-		grain->phase = phase;
-		grain->y1 = y1;
-		grain->y2 = y2;
-
-		grain->counter -= nsmps;
-		if (grain->counter <= 0) {
-			// remove grain
-			*grain = unit->mGrains[--unit->mNumActive];
-		} else ++i;
-	    }
-
-		if ((trig > 0) && (unit->curtrig <=0)) {
-			// start a grain
-			if (unit->mNumActive+1 >= kMaxSynthGrains) {Print("Too many grains!\n");
-			} else {
-			uint32 bufnum = (uint32)IN0(2);
-			Grain *grain = unit->mGrains + unit->mNumActive++;
-
-			SETUP_GRAIN_BUF
-			GRAIN_BUF
-			CHECK_BUF
-
-			float bufSampleRate = buf->samplerate;
-			float bufRateScale = bufSampleRate * SAMPLEDUR;
-			double loopMax = (double)bufFrames;
-
-//			Grain *grain = unit->mGrains + unit->mNumActive++;
-//			grain->bufnum = bufnum;
-
-			double counter = IN0(1) * SAMPLERATE;
-			counter = sc_max(4., counter);
-			grain->counter = (int)counter;
-
-			double rate = grain->rate = IN0(3) * bufRateScale;
-			double phase = IN0(4) * bufFrames;
-			grain->interp = (int)IN0(5);
-
-			double w = pi / counter;
-			double b1 = grain->b1 = 2. * cos(w);
-			double y1 = sin(w);
-			double y2 = 0.;
-
-			float *out1 = out;
-
-			int nsmps = sc_min(grain->counter, inNumSamples);
-			if (grain->interp >= 4) {
-				for (int j=0; j<nsmps; ++j) {
-					GRAIN_LOOP_BODY_4;
-					phase += rate;
-				}
-			} else if (grain->interp >= 2) {
-				for (int j=0; j<nsmps; ++j) {
-					GRAIN_LOOP_BODY_2;
-					phase += rate;
-				}
-			} else {
-				for (int j=0; j<nsmps; ++j) {
-					GRAIN_LOOP_BODY_1;
-					phase += rate;
-				}
-			}
-
-			grain->phase = phase;
-			grain->y1 = y1;
-			grain->y2 = y2;
-			// end change
-			grain->counter -= nsmps;
-			if (grain->counter <= 0) {
-				// remove grain
-				*grain = unit->mGrains[--unit->mNumActive];
-			}
-		}
-	    }
-	    unit->curtrig = trig;
+	if ((trig > 0) && (unit->curtrig <=0)) {
+		// start a grain
+		BufGrain_start(unit, 0);
+	}
+	unit->curtrig = trig;
 
+	GrainBufSource<GrainMonoOut> source(unit);
+	GrainPool_nextEach(&unit->mPool, source, inNumSamples);
 }
 
 void BufGrain_Ctor(BufGrain *unit)
@@ -2519,11 +2415,16 @@ void BufGrain_Ctor(BufGrain *unit)
 	    SETCALC(BufGrain_next_a);
 	    else
 	    SETCALC(BufGrain_next_k);
-	unit->mNumActive = 0;
 	unit->curtrig = 0.f;
+	GrainPool_init(unit->mWorld, &unit->mPool, kGrainBuf | kGrainEach);
 	BufGrain_next_k(unit, 1); // should be _k
 }
 
+void BufGrain_Dtor(BufGrain *unit)
+{
+	GrainPool_free(unit->mWorld, &unit->mPool);
+}
+
 ////////////////////// BufGrainsB ///////////////////////////////
 
 void BufGrainB_next_a(BufGrainB *unit, int inNumSamples)
@@ -3137,7 +3038,64 @@ void BufGrainI_Ctor(BufGrainI *unit)
 
 //////////////////// InGrain ////////////////////
 
+static void InGrain_start(InGrain *unit, int i)
+{
+	GrainPool_add(unit->mWorld, &unit->mPool, IN_AT(unit, 1, i) * SAMPLERATE, i);
+}
+
 void InGrain_next_a(InGrain *unit, int inNumSamples)
+{
+	ClearUnitOutputs(unit, inNumSamples);
+	float *trig = IN(0);
+
+	for (int i=0; i<inNumSamples; ++i) {
+		if ((unit->curtrig <= 0) && (trig[i] > 0.0)) {
+			// start a grain
+			InGrain_start(unit, i);
+		}
+		unit->curtrig = trig[i];
+	}
+
+	GrainInSource<GrainMonoOut> source(unit, 2);
+	GrainPool_next(&unit->mPool, source, inNumSamples);
+}
+
+void InGrain_next_k(InGrain *unit, int inNumSamples)
+{
+	ClearUnitOutputs(unit, inNumSamples);
+	float trig = IN0(0);
+
+	if ((unit->curtrig <= 0) && (trig > 0.0)) {
+		// start a grain
+		InGrain_start(unit, 0);
+	}
+	unit->curtrig = trig;
+
+	GrainInSource<GrainMonoOut> source(unit, 2);
+	GrainPool_next(&unit->mPool, source, inNumSamples);
+}
+
+
+void InGrain_Ctor(InGrain *unit)
+{
+
+	if (INRATE(0) == calc_FullRate)
+	    SETCALC(InGrain_next_a);
+	    else
+	    SETCALC(InGrain_next_k);
+	unit->curtrig = 0.f;
+	GrainPool_init(unit->mWorld, &unit->mPool, 0);
+	InGrain_next_k(unit, 1);
+}
+
+void InGrain_Dtor(InGrain *unit)
+{
+	GrainPool_free(unit->mWorld, &unit->mPool);
+}
+
+///////////////////////// InGrainB ////////////////////////////
+
+void InGrainB_next_a(InGrainB *unit, int inNumSamples)
 {
 	ClearUnitOutputs(unit, inNumSamples);
 	float *out = OUT(0);
@@ -3146,22 +3104,20 @@ void InGrain_next_a(InGrain *unit, int inNumSamples)
 	float winSize;
 
 	for (int i=0; i < unit->mNumActive; ) {
-		IGrain *grain = unit->mGrains + i;
-		double b1 = grain->b1;
-		double y1 = grain->y1;
-		double y2 = grain->y2;
+		IGrainB *grain = unit->mGrains + i;
+		GET_GRAIN_WIN
 
+		double winInc = grain->winInc;
+		double winPos = grain->winPos;
+		double amp = grain->curamp;
 		int nsmps = sc_min(grain->counter, inNumSamples);
 		for (int j=0; j<nsmps; ++j) {
-		    float amp = y1 * y1;
 		    float outval = amp * in[j];
 		    out[j] += outval;
-		    double y0 = b1 * y1 - y2;
-		    y2 = y1;
-		    y1 = y0;
+		    BUF_GRAIN_AMP
 		    }
-		grain->y1 = y1;
-		grain->y2 = y2;
+		grain->winPos = winPos;
+		grain->curamp = amp;
 		grain->counter -= nsmps;
 		if (grain->counter <= 0) {
 			// remove grain
@@ -3173,176 +3129,26 @@ void InGrain_next_a(InGrain *unit, int inNumSamples)
 		if ((unit->curtrig <= 0) && (trig[i] > 0.0)) {
 			// start a grain
 			if (unit->mNumActive+1 >= kMaxSynthGrains) {Print("Too many grains!\n"); break;}
-			IGrain *grain = unit->mGrains + unit->mNumActive++;
-			// INRATE(1) == calcFullRate
+			IGrainB *grain = unit->mGrains + unit->mNumActive++;
 			winSize = IN_AT(unit, 1, i);
+			grain->mWindow = (int)IN_AT(unit, 3, i);
+			double winPos = grain->winPos = 0.f;
+			GET_GRAIN_WIN
 			double counter = winSize * SAMPLERATE;
+			double winInc = grain->winInc = (double)windowSamples / counter;
 			counter = sc_max(4., counter);
 			grain->counter = (int)counter;
-			double w = pi / counter;
-			double b1 = grain->b1 = 2. * cos(w);
-			double y1 = sin(w);
-			double y2 = 0.;
+			double amp = windowData[0];
 			float *out1 = out + i;
 			float *in1 = in + i;
 			int nsmps = sc_min(grain->counter, inNumSamples - i);
 			for (int j=0; j<nsmps; ++j) {
-			    float amp = y1 * y1;
 			    float outval = amp * in1[j];
 			    out1[j] += outval;
-			    double y0 = b1 * y1 - y2;
-			    y2 = y1;
-			    y1 = y0;
+			    BUF_GRAIN_AMP
 			}
-			grain->y1 = y1;
-			grain->y2 = y2;
-			grain->counter -= nsmps;
-			if (grain->counter <= 0) {
-				// remove grain
-				*grain = unit->mGrains[--unit->mNumActive];
-			}
-		}
-		unit->curtrig = trig[i];
-	}
-}
-
-void InGrain_next_k(InGrain *unit, int inNumSamples)
-{
-	ClearUnitOutputs(unit, inNumSamples);
-	float *out = OUT(0);
-	float trig = IN0(0);
-	float *in = IN(2);
-	float winSize;
-
-	for (int i=0; i < unit->mNumActive; ) {
-		IGrain *grain = unit->mGrains + i;
-		double b1 = grain->b1;
-		double y1 = grain->y1;
-		double y2 = grain->y2;
-
-		int nsmps = sc_min(grain->counter, inNumSamples);
-		for (int j=0; j<nsmps; ++j) {
-		    float amp = y1 * y1;
-		    float outval = amp * in[j];
-		    out[j] += outval;
-		    double y0 = b1 * y1 - y2;
-		    y2 = y1;
-		    y1 = y0;
-		    }
-		grain->y1 = y1;
-		grain->y2 = y2;
-		grain->counter -= nsmps;
-		if (grain->counter <= 0) {
-			// remove grain
-			*grain = unit->mGrains[--unit->mNumActive];
-		} else ++i;
-	}
-
-	if ((unit->curtrig <= 0) && (trig > 0.0)) {
-		    // start a grain
-		    if (unit->mNumActive+1 >= kMaxSynthGrains)
-		    {
-		    Print("Too many grains!\n");
-		    } else {
-		    IGrain *grain = unit->mGrains + unit->mNumActive++;
-		    winSize = IN0(1);
-		    double counter = winSize * SAMPLERATE;
-		    counter = sc_max(4., counter);
-		    grain->counter = (int)counter;
-		    double w = pi / counter;
-		    double b1 = grain->b1 = 2. * cos(w);
-		    double y1 = sin(w);
-		    double y2 = 0.;
-		    int nsmps = sc_min(grain->counter, inNumSamples);
-		    for (int j=0; j<nsmps; ++j) {
-			float amp = y1 * y1;
-			float outval = amp * in[j];
-			out[j] += outval;
-			double y0 = b1 * y1 - y2;
-			y2 = y1;
-			y1 = y0;
-		    }
-		    grain->y1 = y1;
-		    grain->y2 = y2;
-		    grain->counter -= inNumSamples;
-		    if (grain->counter <= 0) {
-			    // remove grain
-			    *grain = unit->mGrains[--unit->mNumActive];
-		    }
-		}
-	    }
-	    unit->curtrig = trig;
-}
-
-
-void InGrain_Ctor(InGrain *unit)
-{
-
-	if (INRATE(0) == calc_FullRate)
-	    SETCALC(InGrain_next_a);
-	    else
-	    SETCALC(InGrain_next_k);
-	unit->mNumActive = 0;
-	unit->curtrig = 0.f;
-	InGrain_next_k(unit, 1);
-}
-
-///////////////////////// InGrainB ////////////////////////////
-
-void InGrainB_next_a(InGrainB *unit, int inNumSamples)
-{
-	ClearUnitOutputs(unit, inNumSamples);
-	float *out = OUT(0);
-	float *trig = IN(0);
-	float *in = IN(2);
-	float winSize;
-
-	for (int i=0; i < unit->mNumActive; ) {
-		IGrainB *grain = unit->mGrains + i;
-		GET_GRAIN_WIN
-
-		double winInc = grain->winInc;
-		double winPos = grain->winPos;
-		double amp = grain->curamp;
-		int nsmps = sc_min(grain->counter, inNumSamples);
-		for (int j=0; j<nsmps; ++j) {
-		    float outval = amp * in[j];
-		    out[j] += outval;
-		    BUF_GRAIN_AMP
-		    }
-		grain->winPos = winPos;
-		grain->curamp = amp;
-		grain->counter -= nsmps;
-		if (grain->counter <= 0) {
-			// remove grain
-			*grain = unit->mGrains[--unit->mNumActive];
-		} else ++i;
-	}
-
-	for (int i=0; i<inNumSamples; ++i) {
-		if ((unit->curtrig <= 0) && (trig[i] > 0.0)) {
-			// start a grain
-			if (unit->mNumActive+1 >= kMaxSynthGrains) {Print("Too many grains!\n"); break;}
-			IGrainB *grain = unit->mGrains + unit->mNumActive++;
-			winSize = IN_AT(unit, 1, i);
-			grain->mWindow = (int)IN_AT(unit, 3, i);
-			double winPos = grain->winPos = 0.f;
-			GET_GRAIN_WIN
-			double counter = winSize * SAMPLERATE;
-			double winInc = grain->winInc = (double)windowSamples / counter;
-			counter = sc_max(4., counter);
-			grain->counter = (int)counter;
-			double amp = windowData[0];
-			float *out1 = out + i;
-			float *in1 = in + i;
-			int nsmps = sc_min(grain->counter, inNumSamples - i);
-			for (int j=0; j<nsmps; ++j) {
-			    float outval = amp * in1[j];
-			    out1[j] += outval;
-			    BUF_GRAIN_AMP
-			}
-			grain->curamp = amp;
-			grain->winPos = winPos;
+			grain->curamp = amp;
+			grain->winPos = winPos;
 			grain->counter -= nsmps;
 			if (grain->counter <= 0) {
 				// remove grain
@@ -3782,169 +3588,44 @@ void InGrainI_Ctor(InGrainI *unit)
 
 //////////////////// InGrainBF ///////////////////
 
+static void InGrainBF_start(InGrainBF *unit, int i)
+{
+	GrainPool *pool = &unit->mPool;
+	int g = GrainPool_add(unit->mWorld, pool, IN_AT(unit, 1, i) * SAMPLERATE, i);
+	if (g < 0) return;
+	GrainPool_setBF(pool, g, IN_AT(unit, 3, i), IN_AT(unit, 4, i), IN_AT(unit, 5, i), unit->m_wComp);
+}
+
 void InGrainBF_next_a(InGrainBF *unit, int inNumSamples)
 {
 	ClearUnitOutputs(unit, inNumSamples);
-
-	SETUP_BF_OUTS
-
 	float *trig = IN(0);
-	float *in = IN(2);
-	float winSize;
-	float wComp = unit->m_wComp;
-	for (int i=0; i < unit->mNumActive; ) {
-		IGrainBF *grain = unit->mGrains + i;
-		double b1 = grain->b1;
-		double y1 = grain->y1;
-		double y2 = grain->y2;
-
-		GET_BF_AMPS
-
-		int nsmps = sc_min(grain->counter, inNumSamples);
-		for (int j=0; j<nsmps; ++j) {
-		    float amp = y1 * y1;
-		    float outval = amp * in[j];
-
-		    OUT_BF
 
-		    double y0 = b1 * y1 - y2;
-		    y2 = y1;
-		    y1 = y0;
-		    }
-		grain->y1 = y1;
-		grain->y2 = y2;
-		grain->counter -= nsmps;
-		if (grain->counter <= 0) {
-			// remove grain
-			*grain = unit->mGrains[--unit->mNumActive];
-		} else ++i;
-	}
 	for (int i=0; i<inNumSamples; ++i) {
 		if ((unit->curtrig <= 0) && (trig[i] > 0.0)) {
 			// start a grain
-			if (unit->mNumActive+1 >= kMaxSynthGrains) {Print("Too many grains!\n"); break;}
-			IGrainBF *grain = unit->mGrains + unit->mNumActive++;
-			// INRATE(1) == calcFullRate
-			winSize = IN_AT(unit, 1, i);
-			double counter = winSize * SAMPLERATE;
-			counter = sc_max(4., counter);
-			grain->counter = (int)counter;
-			double w = pi / counter;
-			double b1 = grain->b1 = 2. * cos(w);
-			double y1 = sin(w);
-			double y2 = 0.;
-			float azimuth = IN_AT(unit, 3, i);
-			float elevation = IN_AT(unit, 4, i);
-			float rho = IN_AT(unit, 5, i);
-
-			CALC_BF_COEFS
-			SETUP_INIT_BF_OUTS
-
-			float *in1 = in + i;
-			int nsmps = sc_min(grain->counter, inNumSamples - i);
-			for (int j=0; j<nsmps; ++j) {
-			    float amp = y1 * y1;
-			    float outval = amp * in1[j];
-
-			    OUT_INIT_BF
-
-			    double y0 = b1 * y1 - y2;
-			    y2 = y1;
-			    y1 = y0;
-			}
-			grain->y1 = y1;
-			grain->y2 = y2;
-			grain->counter -= nsmps;
-			if (grain->counter <= 0) {
-				// remove grain
-				*grain = unit->mGrains[--unit->mNumActive];
-			}
+			InGrainBF_start(unit, i);
 		}
 		unit->curtrig = trig[i];
 	}
+
+	GrainInSource<GrainBFOut> source(unit, 2);
+	GrainPool_next(&unit->mPool, source, inNumSamples);
 }
 
 void InGrainBF_next_k(InGrainBF *unit, int inNumSamples)
 {
 	ClearUnitOutputs(unit, inNumSamples);
-
-	SETUP_BF_OUTS
-
 	float trig = IN0(0);
-	float *in = IN(2);
-	float winSize;
-	float wComp = unit->m_wComp;
-
-	for (int i=0; i < unit->mNumActive; ) {
-		IGrainBF *grain = unit->mGrains + i;
-		double b1 = grain->b1;
-		double y1 = grain->y1;
-		double y2 = grain->y2;
-
-		GET_BF_AMPS
-
-		int nsmps = sc_min(grain->counter, inNumSamples);
-		for (int j=0; j<nsmps; ++j) {
-		    float amp = y1 * y1;
-		    float outval = amp * in[j];
-
-		    OUT_BF
-
-		    double y0 = b1 * y1 - y2;
-		    y2 = y1;
-		    y1 = y0;
-		    }
-		grain->y1 = y1;
-		grain->y2 = y2;
-		grain->counter -= nsmps;
-		if (grain->counter <= 0) {
-			// remove grain
-			*grain = unit->mGrains[--unit->mNumActive];
-		} else ++i;
-	}
 
 	if ((unit->curtrig <= 0) && (trig > 0.0)) {
-		    // start a grain
-		    if (unit->mNumActive+1 >= kMaxSynthGrains)
-		    {
-		    Print("Too many grains!\n");
-		    } else {
-		    IGrainBF *grain = unit->mGrains + unit->mNumActive++;
-		    winSize = IN0(1);
-		    double counter = winSize * SAMPLERATE;
-		    counter = sc_max(4., counter);
-		    grain->counter = (int)counter;
-		    double w = pi / counter;
-		    double b1 = grain->b1 = 2. * cos(w);
-		    double y1 = sin(w);
-		    double y2 = 0.;
-		    float azimuth = IN0(3);
-		    float elevation = IN0(4);
-		    float rho = IN0(5);
-
-		    CALC_BF_COEFS
-
-		    int nsmps = sc_min(grain->counter, inNumSamples);
-		    for (int j=0; j<nsmps; ++j) {
-			float amp = y1 * y1;
-			float outval = amp * in[j];
-
-			OUT_BF
+		// start a grain
+		InGrainBF_start(unit, 0);
+	}
+	unit->curtrig = trig;
 
-			double y0 = b1 * y1 - y2;
-			y2 = y1;
-			y1 = y0;
-		    }
-		    grain->y1 = y1;
-		    grain->y2 = y2;
-		    grain->counter -= nsmps;
-		    if (grain->counter <= 0) {
-			    // remove grain
-			    *grain = unit->mGrains[--unit->mNumActive];
-		    }
-		}
-	    }
-	    unit->curtrig = trig;
+	GrainInSource<GrainBFOut> source(unit, 2);
+	GrainPool_next(&unit->mPool, source, inNumSamples);
 }
 
 
@@ -3955,10 +3636,15 @@ void InGrainBF_Ctor(InGrainBF *unit)
 	    SETCALC(InGrainBF_next_a);
 	    else
 	    SETCALC(InGrainBF_next_k);
-	unit->mNumActive = 0;
 	unit->curtrig = 0.f;
-	InGrainBF_next_k(unit, 1);
 	unit->m_wComp = IN0(6);
+	GrainPool_init(unit->mWorld, &unit->mPool, kGrainBF);
+	InGrainBF_next_k(unit, 1);
+}
+
+void InGrainBF_Dtor(InGrainBF *unit)
+{
+	GrainPool_free(unit->mWorld, &unit->mPool);
 }
 
 
@@ -4311,216 +3997,73 @@ void InGrainIBF_Ctor(InGrainIBF *unit)
 
 ///////////////////////////////////SinGrainBF ///////////////////////////////////
 
+static void SinGrainBF_start(SinGrainBF *unit, int i)
+{
+	GrainPool *pool = &unit->mPool;
+	int g = GrainPool_add(unit->mWorld, pool, IN_AT(unit, 1, i) * SAMPLERATE, i);
+	if (g < 0) return;
+	GrainPool_setSin(unit, pool, g, IN_AT(unit, 2, i), i);
+	GrainPool_setBF(pool, g, IN_AT(unit, 3, i), IN_AT(unit, 4, i), IN_AT(unit, 5, i), unit->m_wComp);
+}
+
 void SinGrainBF_next_a(SinGrainBF *unit, int inNumSamples)
-{
-	ClearUnitOutputs(unit, inNumSamples);
-
-	SETUP_BF_OUTS
-
-	float *trig = IN(0);
-	float winSize, freq;
-	float *table0 = ft->mSineWavetable;
-	float *table1 = table0 + 1;
-	float wComp = unit->m_wComp;
-
-	for (int i=0; i < unit->mNumActive; ) {
-		SGrainBF *grain = unit->mGrains + i;
-		double b1 = grain->b1;
-		double y1 = grain->y1;
-		double y2 = grain->y2;
-
-		GET_BF_AMPS
-
-		int32 thisfreq = grain->freq;
-		int32 oscphase = grain->oscphase;
-
-		int nsmps = sc_min(grain->counter, inNumSamples);
-		for (int j=0; j<nsmps; ++j) {
-		    float amp = y1 * y1;
-		    float outval = amp * lookupi1(table0, table1, oscphase, unit->m_lomask);
-
-		    OUT_BF
-
-		    double y0 = b1 * y1 - y2;
-		    y2 = y1;
-		    y1 = y0;
-		    oscphase += thisfreq;
-		    }
-		grain->y1 = y1;
-		grain->y2 = y2;
-		grain->oscphase = oscphase;
-		grain->counter -= nsmps;
-		if (grain->counter <= 0) {
-			// remove grain
-			*grain = unit->mGrains[--unit->mNumActive];
-		} else ++i;
-	}
-
-	for (int i=0; i<inNumSamples; ++i) {
-		if ((unit->curtrig <= 0) && (trig[i] > 0.0)) {
-			// start a grain
-			if (unit->mNumActive+1 >= kMaxSynthGrains) {Print("Too many grains!\n"); break;}
-			SGrainBF *grain = unit->mGrains + unit->mNumActive++;
-			// INRATE(1) == calcFullRate
-			freq = IN_AT(unit, 2, i);
-			winSize = IN_AT(unit, 1, i);
-			int32 thisfreq = grain->freq = (int32)(unit->m_cpstoinc * freq);
-			int32 oscphase = 0;
-			double counter = winSize * SAMPLERATE;
-			counter = sc_max(4., counter);
-			grain->counter = (int)counter;
-			double w = pi / counter;
-			double b1 = grain->b1 = 2. * cos(w);
-			double y1 = sin(w);
-			double y2 = 0.;
-
-			float azimuth = IN_AT(unit, 3, i);
-			float elevation = IN_AT(unit, 4, i);
-			float rho = IN_AT(unit, 5, i);
-
-			CALC_BF_COEFS
-			SETUP_INIT_BF_OUTS
-
-			int nsmps = sc_min(grain->counter, inNumSamples - i);
-			for (int j=0; j<nsmps; ++j) {
-			    float amp = y1 * y1;
-			    float outval = amp * lookupi1(table0, table1, oscphase, unit->m_lomask);
-
-			    OUT_INIT_BF
-
-			    double y0 = b1 * y1 - y2;
-			    y2 = y1;
-			    y1 = y0;
-			    oscphase += thisfreq;
-			}
-			grain->oscphase = oscphase;
-			grain->y1 = y1;
-			grain->y2 = y2;
-			grain->counter -= nsmps;
-			if (grain->counter <= 0) {
-				// remove grain
-				*grain = unit->mGrains[--unit->mNumActive];
-			}
-		}
-		unit->curtrig = trig[i];
-	}
-}
-
-void SinGrainBF_next_k(SinGrainBF *unit, int inNumSamples)
-{
-	ClearUnitOutputs(unit, inNumSamples);
-
-	SETUP_BF_OUTS
-
-	float trig = IN0(0);
-	float winSize, freq;
-	float *table0 = ft->mSineWavetable;
-	float *table1 = table0 + 1;
-	float wComp = unit->m_wComp;
-	for (int i=0; i < unit->mNumActive; ) {
-		SGrainBF *grain = unit->mGrains + i;
-		double b1 = grain->b1;
-		double y1 = grain->y1;
-		double y2 = grain->y2;
-
-		GET_BF_AMPS
-
-		int32 thisfreq = grain->freq;
-		int32 oscphase = grain->oscphase;
-
-		int nsmps = sc_min(grain->counter, inNumSamples);
-		for (int j=0; j<nsmps; ++j) {
-		    float amp = y1 * y1;
-		    float outval = amp * lookupi1(table0, table1, oscphase, unit->m_lomask);
-
-		    OUT_BF
-
-		    double y0 = b1 * y1 - y2;
-		    y2 = y1;
-		    y1 = y0;
-		    oscphase += thisfreq;
-		    }
-		grain->y1 = y1;
-		grain->y2 = y2;
-		grain->oscphase = oscphase;
-		grain->counter -= nsmps;
-		if (grain->counter <= 0) {
-			// remove grain
-			*grain = unit->mGrains[--unit->mNumActive];
-		} else ++i;
-	}
-
-	if ((unit->curtrig <= 0) && (trig > 0.0)) {
-		    // start a grain
-		    if (unit->mNumActive+1 >= kMaxSynthGrains)
-		    {
-		    Print("Too many grains!\n");
-		    } else {
-		    SGrainBF *grain = unit->mGrains + unit->mNumActive++;
-		    freq = IN0(2);
-		    winSize = IN0(1);
-		    int32 thisfreq = grain->freq = (int32)(unit->m_cpstoinc * freq);
-		    int32 oscphase = 0;
-		    double counter = winSize * SAMPLERATE;
-		    counter = sc_max(4., counter);
-		    grain->counter = (int)counter;
-		    double w = pi / counter;
-		    double b1 = grain->b1 = 2. * cos(w);
-		    double y1 = sin(w);
-		    double y2 = 0.;
-
-		    float azimuth = IN0(3);
-		    float elevation = IN0(4);
-		    float rho = IN0(5);
-
-		    CALC_BF_COEFS
-
-		    int nsmps = sc_min(grain->counter, inNumSamples);
-		    for (int j=0; j<nsmps; ++j) {
-			float amp = y1 * y1;
-			float outval = amp * lookupi1(table0, table1, oscphase, unit->m_lomask);
-
-			OUT_BF
-
-			double y0 = b1 * y1 - y2;
-			y2 = y1;
-			y1 = y0;
-			oscphase += thisfreq;
-		    }
-		    grain->oscphase = oscphase;
-		    grain->y1 = y1;
-		    grain->y2 = y2;
-		    grain->counter -= nsmps;
-		    if (grain->counter <= 0) {
-			    // remove grain
-			    *grain = unit->mGrains[--unit->mNumActive];
-		    }
-		}
-	    }
-	    unit->curtrig = trig;
-}
-
-
-void SinGrainBF_Ctor(SinGrainBF *unit)
-{
-
-	if (INRATE(0) == calc_FullRate)
-	    SETCALC(SinGrainBF_next_a);
-	    else
-	    SETCALC(SinGrainBF_next_k);
-	int tableSizeSin = ft->mSineSize;
-	unit->m_lomask = (tableSizeSin - 1) << 3;
-	unit->m_radtoinc = tableSizeSin * (rtwopi * 65536.);
-	unit->m_cpstoinc = tableSizeSin * SAMPLEDUR * 65536.;
-	unit->curtrig = 0.f;
-	unit->mNumActive = 0;
-	unit->m_wComp = IN0(6);
-	SinGrainBF_next_k(unit, 1);
-}
-
-///////////////////////// SinGrainB ////////////////////////////
-
-void SinGrainBBF_next_a(SinGrainBBF *unit, int inNumSamples)
+{
+	ClearUnitOutputs(unit, inNumSamples);
+	float *trig = IN(0);
+
+	for (int i=0; i<inNumSamples; ++i) {
+		if ((unit->curtrig <= 0) && (trig[i] > 0.0)) {
+			// start a grain
+			SinGrainBF_start(unit, i);
+		}
+		unit->curtrig = trig[i];
+	}
+
+	GrainSinSource<GrainBFOut> source(unit);
+	GrainPool_next(&unit->mPool, source, inNumSamples);
+}
+
+void SinGrainBF_next_k(SinGrainBF *unit, int inNumSamples)
+{
+	ClearUnitOutputs(unit, inNumSamples);
+	float trig = IN0(0);
+
+	if ((unit->curtrig <= 0) && (trig > 0.0)) {
+		// start a grain
+		SinGrainBF_start(unit, 0);
+	}
+	unit->curtrig = trig;
+
+	GrainSinSource<GrainBFOut> source(unit);
+	GrainPool_next(&unit->mPool, source, inNumSamples);
+}
+
+
+void SinGrainBF_Ctor(SinGrainBF *unit)
+{
+
+	if (INRATE(0) == calc_FullRate)
+	    SETCALC(SinGrainBF_next_a);
+	    else
+	    SETCALC(SinGrainBF_next_k);
+	int tableSizeSin = ft->mSineSize;
+	unit->m_lomask = (tableSizeSin - 1) << 3;
+	unit->m_radtoinc = tableSizeSin * (rtwopi * 65536.);
+	unit->m_cpstoinc = tableSizeSin * SAMPLEDUR * 65536.;
+	unit->curtrig = 0.f;
+	unit->m_wComp = IN0(6);
+	GrainPool_init(unit->mWorld, &unit->mPool, kGrainSin | kGrainBF);
+	SinGrainBF_next_k(unit, 1);
+}
+
+void SinGrainBF_Dtor(SinGrainBF *unit)
+{
+	GrainPool_free(unit->mWorld, &unit->mPool);
+}
+
+///////////////////////// SinGrainB ////////////////////////////
+
+void SinGrainBBF_next_a(SinGrainBBF *unit, int inNumSamples)
 {
 	ClearUnitOutputs(unit, inNumSamples);
 
@@ -4917,7 +4460,78 @@ void SinGrainIBF_Ctor(SinGrainIBF *unit)
 
 //////////////////////// FM grains /////////////////////////////
 
+static void FMGrainBF_start(FMGrainBF *unit, int i)
+{
+	GrainPool *pool = &unit->mPool;
+	int g = GrainPool_add(unit->mWorld, pool, IN_AT(unit, 1, i) * SAMPLERATE, i);
+	if (g < 0) return;
+	float carfreq = IN_AT(unit, 2, i);
+	float modfreq = IN_AT(unit, 3, i);
+	float index = IN_AT(unit, 4, i);
+	pool->deviation[g] = index * modfreq;
+	pool->modfreq[g] = (int32)(unit->m_cpstoinc * modfreq);
+	pool->carbase[g] = carfreq;
+	pool->oscphase[g] = 0;
+	pool->modphase[g] = 0;
+	GrainPool_setBF(pool, g, IN_AT(unit, 5, i), IN_AT(unit, 6, i), IN_AT(unit, 7, i), unit->m_wComp);
+}
+
 void FMGrainBF_next_a(FMGrainBF *unit, int inNumSamples)
+{
+	ClearUnitOutputs(unit, inNumSamples);
+	float *trig = IN(0);
+
+	for (int i=0; i<inNumSamples; ++i) {
+		if ((unit->curtrig <= 0) && (trig[i] > 0.0)) {
+			// start a grain
+			FMGrainBF_start(unit, i);
+		}
+		unit->curtrig = trig[i];
+	}
+
+	GrainFMSource<GrainBFOut> source(unit, unit->m_lomask, unit->m_cpstoinc);
+	GrainPool_nextEach(&unit->mPool, source, inNumSamples);
+}
+
+void FMGrainBF_next_k(FMGrainBF *unit, int inNumSamples)
+{
+	ClearUnitOutputs(unit, inNumSamples);
+	float trig = IN0(0);
+
+	if ((unit->curtrig <= 0) && (trig > 0.0)) {
+		// start a grain
+		FMGrainBF_start(unit, 0);
+	}
+	unit->curtrig = trig;
+
+	GrainFMSource<GrainBFOut> source(unit, unit->m_lomask, unit->m_cpstoinc);
+	GrainPool_nextEach(&unit->mPool, source, inNumSamples);
+}
+
+void FMGrainBF_Ctor(FMGrainBF *unit)
+{
+	if (INRATE(0) == calc_FullRate)
+	    SETCALC(FMGrainBF_next_a);
+	    else
+	    SETCALC(FMGrainBF_next_k);
+	int tableSizeSin = ft->mSineSize;
+	unit->m_lomask = (tableSizeSin - 1) << 3;
+	unit->m_radtoinc = tableSizeSin * (rtwopi * 65536.);
+	unit->m_cpstoinc = tableSizeSin * SAMPLEDUR * 65536.;
+	unit->curtrig = 0.f;
+	unit->m_wComp = IN0(8);
+	GrainPool_init(unit->mWorld, &unit->mPool, kGrainFM | kGrainBF | kGrainEach);
+	FMGrainBF_next_k(unit, 1);
+}
+
+void FMGrainBF_Dtor(FMGrainBF *unit)
+{
+	GrainPool_free(unit->mWorld, &unit->mPool);
+}
+
+///////////////////////  FMGrainB //////////////////////////////////////////
+
+void FMGrainBBF_next_a(FMGrainBBF *unit, int inNumSamples)
 {
 	ClearUnitOutputs(unit, inNumSamples);
 
@@ -4931,38 +4545,32 @@ void FMGrainBF_next_a(FMGrainBF *unit, int inNumSamples)
 	float wComp = unit->m_wComp;
 
 	for (int i=0; i < unit->mNumActive; ) {
-		FGrainBF *grain = unit->mGrains + i;
-		double b1 = grain->b1;
-		double y1 = grain->y1;
-		double y2 = grain->y2;
-
-		GET_BF_AMPS
-
+		FGrainBBF *grain = unit->mGrains + i;
 		int32 mfreq = grain->mfreq;
 		int32 moscphase = grain->moscphase;
 		int32 coscphase = grain->coscphase;
 		float deviation = grain->deviation;
 		float carbase = grain->carbase;
+		GET_GRAIN_WIN
+		GET_BF_AMPS
 
+		double amp = grain->curamp;
+		double winInc = grain->winInc;
+		double winPos = grain->winPos;
 		int nsmps = sc_min(grain->counter, inNumSamples);
 		for (int j=0; j<nsmps; ++j) {
-			float amp = y1 * y1;
 			float thismod = lookupi1(table0, table1, moscphase, unit->m_lomask) * deviation;
 			float outval = amp * lookupi1(table0, table1, coscphase, unit->m_lomask);
-
 			OUT_BF
-
-			double y0 = b1 * y1 - y2;
-			y2 = y1;
-			y1 = y0;
+			BUF_GRAIN_AMP
 			int32 cfreq = (int32)(unit->m_cpstoinc * (carbase + thismod)); // needs to be calced in the loop!
 			coscphase += cfreq;
 			moscphase += mfreq;
 		    } // need to save float carbase, int32 mfreq, float deviation
 		grain->coscphase = coscphase;
 		grain->moscphase = moscphase;
-		grain->y1 = y1;
-		grain->y2 = y2;
+		grain->curamp = amp;
+		grain->winPos = winPos;
 		grain->counter -= nsmps;
 		if (grain->counter <= 0) {
 			// remove grain
@@ -4974,50 +4582,47 @@ void FMGrainBF_next_a(FMGrainBF *unit, int inNumSamples)
 	    if ((unit->curtrig <= 0) && (trig[i] > 0.0)) {
 		// start a grain
 		if (unit->mNumActive+1 >= kMaxSynthGrains) {Print("Too many grains!\n"); break;}
-		FGrainBF *grain = unit->mGrains + unit->mNumActive++;
+		FGrainBBF *grain = unit->mGrains + unit->mNumActive++;
 		winSize = IN_AT(unit, 1, i);
 		carfreq = IN_AT(unit, 2, i);
 		modfreq = IN_AT(unit, 3, i);
 		index = IN_AT(unit, 4, i);
+		grain->mWindow = (int)IN_AT(unit, 5, i);
+		double winPos = grain->winPos = 0.f;
+		GET_GRAIN_WIN
+
+		float azimuth = IN_AT(unit, 6, i);
+		float elevation = IN_AT(unit, 7, i);
+		float rho = IN_AT(unit, 8, i);
+
+		CALC_BF_COEFS
+		SETUP_INIT_BF_OUTS
+
+		double counter = winSize * SAMPLERATE;
+		double winInc = grain->winInc = (double)windowSamples / counter;
+		double amp = windowData[0];
 		float deviation = grain->deviation = index * modfreq;
 		int32 mfreq = grain->mfreq = (int32)(unit->m_cpstoinc * modfreq);
 		grain->carbase = carfreq;
 		int32 coscphase = 0;
 		int32 moscphase = 0;
-		double counter = winSize * SAMPLERATE;
 		counter = sc_max(4., counter);
 		grain->counter = (int)counter;
-		double w = pi / counter;
-		double b1 = grain->b1 = 2. * cos(w);
-		double y1 = sin(w);
-		double y2 = 0.;
-
-		float azimuth = IN_AT(unit, 5, i);
-		float elevation = IN_AT(unit, 6, i);
-		float rho = IN_AT(unit, 7, i);
-
-		CALC_BF_COEFS
-		SETUP_INIT_BF_OUTS
 
 		int nsmps = sc_min(grain->counter, inNumSamples - i);
 		for (int j=0; j<nsmps; ++j) {
-		    float amp = y1 * y1;
 		    float thismod = lookupi1(table0, table1, moscphase, unit->m_lomask) * deviation;
 		    float outval = amp * lookupi1(table0, table1, coscphase, unit->m_lomask);
-
 		    OUT_INIT_BF
-
-		    double y0 = b1 * y1 - y2;
-		    y2 = y1;
-		    y1 = y0;
+		    BUF_GRAIN_AMP
 		    int32 cfreq = (int32)(unit->m_cpstoinc * (carfreq + thismod)); // needs to be calced in the loop!
 		    coscphase += cfreq;
 		    moscphase += mfreq;
 		} // need to save float carbase, int32 mfreq, float deviation
 		grain->coscphase = coscphase;
 		grain->moscphase = moscphase;
-		grain->y1 = y1;
-		grain->y2 = y2;
+		grain->curamp = amp;
+		grain->winPos = winPos;
 		grain->counter -= nsmps;
 		if (grain->counter <= 0) {
 			// remove grain
@@ -5028,7 +4633,7 @@ void FMGrainBF_next_a(FMGrainBF *unit, int inNumSamples)
 	}
 }
 
-void FMGrainBF_next_k(FMGrainBF *unit, int inNumSamples)
+void FMGrainBBF_next_k(FMGrainBBF *unit, int inNumSamples)
 {
 	ClearUnitOutputs(unit, inNumSamples);
 
@@ -5042,13 +4647,13 @@ void FMGrainBF_next_k(FMGrainBF *unit, int inNumSamples)
 	float wComp = unit->m_wComp;
 
 	for (int i=0; i < unit->mNumActive; ) {
-		FGrainBF *grain = unit->mGrains + i;
-		double b1 = grain->b1;
-		double y1 = grain->y1;
-		double y2 = grain->y2;
-
+		FGrainBBF *grain = unit->mGrains + i;
+		GET_GRAIN_WIN
 		GET_BF_AMPS
 
+		double amp = grain->curamp;
+		double winInc = grain->winInc;
+		double winPos = grain->winPos;
 		int32 mfreq = grain->mfreq;
 		int32 moscphase = grain->moscphase;
 		int32 coscphase = grain->coscphase;
@@ -5057,23 +4662,18 @@ void FMGrainBF_next_k(FMGrainBF *unit, int inNumSamples)
 
 		int nsmps = sc_min(grain->counter, inNumSamples);
 		for (int j=0; j<nsmps; ++j) {
-			float amp = y1 * y1;
 			float thismod = lookupi1(table0, table1, moscphase, unit->m_lomask) * deviation;
 			float outval = amp * lookupi1(table0, table1, coscphase, unit->m_lomask);
-
 			OUT_BF
-
-			double y0 = b1 * y1 - y2;
-			y2 = y1;
-			y1 = y0;
+			BUF_GRAIN_AMP
 			int32 cfreq = (int32)(unit->m_cpstoinc * (carbase + thismod)); // needs to be calced in the loop!
 			coscphase += cfreq;
 			moscphase += mfreq;
 		    } // need to save float carbase, int32 mfreq, float deviation
 		grain->coscphase = coscphase;
 		grain->moscphase = moscphase;
-		grain->y1 = y1;
-		grain->y2 = y2;
+		grain->curamp = amp;
+		grain->winPos = winPos;
 		grain->counter -= nsmps;
 		if (grain->counter <= 0) {
 			// remove grain
@@ -5085,250 +4685,25 @@ void FMGrainBF_next_k(FMGrainBF *unit, int inNumSamples)
 		// start a grain
 		if (unit->mNumActive+1 >= kMaxSynthGrains) {Print("Too many grains!\n");
 		} else {
-		FGrainBF *grain = unit->mGrains + unit->mNumActive++;
+		FGrainBBF *grain = unit->mGrains + unit->mNumActive++;
 		winSize = IN0(1);
 		carfreq = IN0(2);
 		modfreq = IN0(3);
 		index = IN0(4);
-		float deviation = grain->deviation = index * modfreq;
-		int32 mfreq = grain->mfreq = (int32)(unit->m_cpstoinc * modfreq);
-		grain->carbase = carfreq;
-		int32 coscphase = 0;
-		int32 moscphase = 0;
-		double counter = winSize * SAMPLERATE;
-		counter = sc_max(4., counter);
-		grain->counter = (int)counter;
-		double w = pi / counter;
-		double b1 = grain->b1 = 2. * cos(w);
-		double y1 = sin(w);
-		double y2 = 0.;
-
-		float azimuth = IN0(5);
-		float elevation = IN0(6);
-		float rho = IN0(7);
-
-		CALC_BF_COEFS
-
-		int nsmps = sc_min(grain->counter, inNumSamples);
-		for (int j=0; j<nsmps; ++j) {
-		    float amp = y1 * y1;
-		    float thismod = lookupi1(table0, table1, moscphase, unit->m_lomask) * deviation;
-		    float outval = amp * lookupi1(table0, table1, coscphase, unit->m_lomask);
-
-		    OUT_BF
-
-		    double y0 = b1 * y1 - y2;
-		    y2 = y1;
-		    y1 = y0;
-		    int32 cfreq = (int32)(unit->m_cpstoinc * (carfreq + thismod)); // needs to be calced in the loop!
-		    coscphase += cfreq;
-		    moscphase += mfreq;
-		} // need to save float carbase, int32 mfreq, float deviation
-		grain->coscphase = coscphase;
-		grain->moscphase = moscphase;
-		grain->y1 = y1;
-		grain->y2 = y2;
-		grain->counter -= nsmps;
-		if (grain->counter <= 0) {
-			// remove grain
-			*grain = unit->mGrains[--unit->mNumActive];
-		}
-	    }
-	}
-	unit->curtrig = trig;
-}
-
-void FMGrainBF_Ctor(FMGrainBF *unit)
-{
-	if (INRATE(0) == calc_FullRate)
-	    SETCALC(FMGrainBF_next_a);
-	    else
-	    SETCALC(FMGrainBF_next_k);
-	int tableSizeSin = ft->mSineSize;
-	unit->m_lomask = (tableSizeSin - 1) << 3;
-	unit->m_radtoinc = tableSizeSin * (rtwopi * 65536.);
-	unit->m_cpstoinc = tableSizeSin * SAMPLEDUR * 65536.;
-	unit->curtrig = 0.f;
-	unit->mNumActive = 0;
-	unit->m_wComp = IN0(8);
-	FMGrainBF_next_k(unit, 1);
-}
-
-///////////////////////  FMGrainB //////////////////////////////////////////
-
-void FMGrainBBF_next_a(FMGrainBBF *unit, int inNumSamples)
-{
-	ClearUnitOutputs(unit, inNumSamples);
-
-	SETUP_BF_OUTS
-
-	float *trig = IN(0);
-	float winSize, carfreq, modfreq, index;
-
-	float *table0 = ft->mSineWavetable;
-	float *table1 = table0 + 1;
-	float wComp = unit->m_wComp;
-
-	for (int i=0; i < unit->mNumActive; ) {
-		FGrainBBF *grain = unit->mGrains + i;
-		int32 mfreq = grain->mfreq;
-		int32 moscphase = grain->moscphase;
-		int32 coscphase = grain->coscphase;
-		float deviation = grain->deviation;
-		float carbase = grain->carbase;
-		GET_GRAIN_WIN
-		GET_BF_AMPS
-
-		double amp = grain->curamp;
-		double winInc = grain->winInc;
-		double winPos = grain->winPos;
-		int nsmps = sc_min(grain->counter, inNumSamples);
-		for (int j=0; j<nsmps; ++j) {
-			float thismod = lookupi1(table0, table1, moscphase, unit->m_lomask) * deviation;
-			float outval = amp * lookupi1(table0, table1, coscphase, unit->m_lomask);
-			OUT_BF
-			BUF_GRAIN_AMP
-			int32 cfreq = (int32)(unit->m_cpstoinc * (carbase + thismod)); // needs to be calced in the loop!
-			coscphase += cfreq;
-			moscphase += mfreq;
-		    } // need to save float carbase, int32 mfreq, float deviation
-		grain->coscphase = coscphase;
-		grain->moscphase = moscphase;
-		grain->curamp = amp;
-		grain->winPos = winPos;
-		grain->counter -= nsmps;
-		if (grain->counter <= 0) {
-			// remove grain
-			*grain = unit->mGrains[--unit->mNumActive];
-		} else ++i;
-	}
-
-	for (int i=0; i<inNumSamples; ++i) {
-	    if ((unit->curtrig <= 0) && (trig[i] > 0.0)) {
-		// start a grain
-		if (unit->mNumActive+1 >= kMaxSynthGrains) {Print("Too many grains!\n"); break;}
-		FGrainBBF *grain = unit->mGrains + unit->mNumActive++;
-		winSize = IN_AT(unit, 1, i);
-		carfreq = IN_AT(unit, 2, i);
-		modfreq = IN_AT(unit, 3, i);
-		index = IN_AT(unit, 4, i);
-		grain->mWindow = (int)IN_AT(unit, 5, i);
-		double winPos = grain->winPos = 0.f;
-		GET_GRAIN_WIN
-
-		float azimuth = IN_AT(unit, 6, i);
-		float elevation = IN_AT(unit, 7, i);
-		float rho = IN_AT(unit, 8, i);
-
-		CALC_BF_COEFS
-		SETUP_INIT_BF_OUTS
-
-		double counter = winSize * SAMPLERATE;
-		double winInc = grain->winInc = (double)windowSamples / counter;
-		double amp = windowData[0];
-		float deviation = grain->deviation = index * modfreq;
-		int32 mfreq = grain->mfreq = (int32)(unit->m_cpstoinc * modfreq);
-		grain->carbase = carfreq;
-		int32 coscphase = 0;
-		int32 moscphase = 0;
-		counter = sc_max(4., counter);
-		grain->counter = (int)counter;
-
-		int nsmps = sc_min(grain->counter, inNumSamples - i);
-		for (int j=0; j<nsmps; ++j) {
-		    float thismod = lookupi1(table0, table1, moscphase, unit->m_lomask) * deviation;
-		    float outval = amp * lookupi1(table0, table1, coscphase, unit->m_lomask);
-		    OUT_INIT_BF
-		    BUF_GRAIN_AMP
-		    int32 cfreq = (int32)(unit->m_cpstoinc * (carfreq + thismod)); // needs to be calced in the loop!
-		    coscphase += cfreq;
-		    moscphase += mfreq;
-		} // need to save float carbase, int32 mfreq, float deviation
-		grain->coscphase = coscphase;
-		grain->moscphase = moscphase;
-		grain->curamp = amp;
-		grain->winPos = winPos;
-		grain->counter -= nsmps;
-		if (grain->counter <= 0) {
-			// remove grain
-			*grain = unit->mGrains[--unit->mNumActive];
-		}
-		}
-		unit->curtrig = trig[i];
-	}
-}
-
-void FMGrainBBF_next_k(FMGrainBBF *unit, int inNumSamples)
-{
-	ClearUnitOutputs(unit, inNumSamples);
-
-	SETUP_BF_OUTS
-
-	float trig = IN0(0);
-	float winSize, carfreq, modfreq, index;
-
-	float *table0 = ft->mSineWavetable;
-	float *table1 = table0 + 1;
-	float wComp = unit->m_wComp;
-
-	for (int i=0; i < unit->mNumActive; ) {
-		FGrainBBF *grain = unit->mGrains + i;
-		GET_GRAIN_WIN
-		GET_BF_AMPS
-
-		double amp = grain->curamp;
-		double winInc = grain->winInc;
-		double winPos = grain->winPos;
-		int32 mfreq = grain->mfreq;
-		int32 moscphase = grain->moscphase;
-		int32 coscphase = grain->coscphase;
-		float deviation = grain->deviation;
-		float carbase = grain->carbase;
-
-		int nsmps = sc_min(grain->counter, inNumSamples);
-		for (int j=0; j<nsmps; ++j) {
-			float thismod = lookupi1(table0, table1, moscphase, unit->m_lomask) * deviation;
-			float outval = amp * lookupi1(table0, table1, coscphase, unit->m_lomask);
-			OUT_BF
-			BUF_GRAIN_AMP
-			int32 cfreq = (int32)(unit->m_cpstoinc * (carbase + thismod)); // needs to be calced in the loop!
-			coscphase += cfreq;
-			moscphase += mfreq;
-		    } // need to save float carbase, int32 mfreq, float deviation
-		grain->coscphase = coscphase;
-		grain->moscphase = moscphase;
-		grain->curamp = amp;
-		grain->winPos = winPos;
-		grain->counter -= nsmps;
-		if (grain->counter <= 0) {
-			// remove grain
-			*grain = unit->mGrains[--unit->mNumActive];
-		} else ++i;
-	    }
-
-	    if ((unit->curtrig <= 0) && (trig > 0.0)) {
-		// start a grain
-		if (unit->mNumActive+1 >= kMaxSynthGrains) {Print("Too many grains!\n");
-		} else {
-		FGrainBBF *grain = unit->mGrains + unit->mNumActive++;
-		winSize = IN0(1);
-		carfreq = IN0(2);
-		modfreq = IN0(3);
-		index = IN0(4);
-		grain->mWindow = (int)IN0(5);
-		double winPos = grain->winPos = 0.f;
-		GET_GRAIN_WIN
-
-		float azimuth = IN0(6);
-		float elevation = IN0(7);
-		float rho = IN0(8);
-
-		CALC_BF_COEFS
-
-		double counter = winSize * SAMPLERATE;
-		double winInc = grain->winInc = (double)windowSamples / counter;
-		float amp = windowData[0];
-
+		grain->mWindow = (int)IN0(5);
+		double winPos = grain->winPos = 0.f;
+		GET_GRAIN_WIN
+
+		float azimuth = IN0(6);
+		float elevation = IN0(7);
+		float rho = IN0(8);
+
+		CALC_BF_COEFS
+
+		double counter = winSize * SAMPLERATE;
+		double winInc = grain->winInc = (double)windowSamples / counter;
+		float amp = windowData[0];
+
 		float deviation = grain->deviation = index * modfreq;
 		int32 mfreq = grain->mfreq = (int32)(unit->m_cpstoinc * modfreq);
 		grain->carbase = carfreq;
@@ -5616,300 +4991,56 @@ void FMGrainIBF_Ctor(FMGrainIBF *unit)
 
 ///////////////////// BufGrain (basically Warp1 with a trigger... which is basically TGrains in Mono???) //////////////
 
+static void BufGrainBF_start(BufGrainBF *unit, int i)
+{
+	SndBuf *buf = GrainPool_getBuf(unit, (uint32)IN_AT(unit, 2, i));
+	if (!buf->data) {
+		unit->mDone = true;
+		return;
+	}
+	if (buf->channels != 1) return;
+
+	GrainPool *pool = &unit->mPool;
+	int g = GrainPool_add(unit->mWorld, pool, IN_AT(unit, 1, i) * SAMPLERATE, i);
+	if (g < 0) return;
+	float bufRateScale = buf->samplerate * SAMPLEDUR;
+	pool->buf[g] = buf;
+	pool->rate[g] = IN_AT(unit, 3, i) * bufRateScale;
+	pool->phase[g] = IN_AT(unit, 4, i) * buf->frames;
+	pool->interp[g] = (int)IN_AT(unit, 5, i);
+	GrainPool_setBF(pool, g, IN_AT(unit, 6, i), IN_AT(unit, 7, i), IN_AT(unit, 8, i), unit->m_wComp);
+}
+
 void BufGrainBF_next_a(BufGrainBF *unit, int inNumSamples)
 {
 	ClearUnitOutputs(unit, inNumSamples);
-	float *Wout = ZOUT(0);
-	float *Xout = ZOUT(1);
-	float *Yout = ZOUT(2);
-	float *Zout = ZOUT(3);
-
 	float *trig = IN(0);
 
-	World *world = unit->mWorld;
-//	SndBuf *bufs = world->mSndBufs;
-//	uint32 numBufs = world->mNumSndBufs;
-	float wComp = unit->m_wComp;
-
-	for (int i=0; i < unit->mNumActive; ) {
-		GrainBF *grain = unit->mGrains + i;
-//		uint32 bufnum = grain->bufnum;
-
-		GRAIN_BUF
-		CHECK_BUF
-
-		GET_BF_AMPS
-
-		if (bufChannels != 1) {
-			 ++i;
-			 continue;
-		}
-		double loopMax = (double)bufFrames;
-		double rate = grain->rate;
-		double phase = grain->phase;
-		double b1 = grain->b1;
-		double y1 = grain->y1;
-		double y2 = grain->y2;
-
-		float *Wout1 = Wout;
-		float *Xout1 = Xout;
-		float *Yout1 = Yout;
-		float *Zout1 = Zout;
-
-		int nsmps = sc_min(grain->counter, inNumSamples);
-		if (grain->interp >= 4) {
-			for (int j=0; j<nsmps; ++j) {
-				GRAIN_LOOP_BF_BODY_4;
-				phase += rate;
-			}
-		} else if (grain->interp >= 2) {
-			for (int j=0; j<nsmps; ++j) {
-				GRAIN_LOOP_BF_BODY_2;
-				phase += rate;
-			}
-		} else {
-			for (int j=0; j<nsmps; ++j) {
-				GRAIN_LOOP_BF_BODY_1;
-				phase += rate;
-			}
-		}
-
-		grain->phase = phase;
-		grain->y1 = y1;
-		grain->y2 = y2;
-
-		grain->counter -= nsmps;
-		if (grain->counter <= 0) {
-			// remove grain
-			*grain = unit->mGrains[--unit->mNumActive];
-		} else ++i;
-	}
-
 	for (int i=0; i<inNumSamples; ++i) {
 		if ((trig[i] > 0) && (unit->curtrig <=0)) {
 			// start a grain
-			if (unit->mNumActive+1 >= kMaxSynthGrains) {Print("Too many grains!\n");
-			} else {
-			uint32 bufnum = (uint32)IN_AT(unit, 2, i);
-//			if (bufnum >= numBufs) continue;
-
-			GrainBF *grain = unit->mGrains + unit->mNumActive++;
-
-			SETUP_GRAIN_BUF
-			GRAIN_BUF
-			CHECK_BUF
-
-
-			if (bufChannels != 1) continue;
-
-			float bufSampleRate = buf->samplerate;
-			float bufRateScale = bufSampleRate * SAMPLEDUR;
-			double loopMax = (double)bufFrames;
-
-//			GrainBF *grain = unit->mGrains + unit->mNumActive++;
-//			grain->bufnum = bufnum;
-
-			double counter = IN_AT(unit, 1, i) * SAMPLERATE;
-			counter = sc_max(4., counter);
-			grain->counter = (int)counter;
-
-			double rate = grain->rate = IN_AT(unit, 3, i) * bufRateScale;
-			double phase = IN_AT(unit, 4, i) * bufFrames;
-			grain->interp = (int)IN_AT(unit, 5, i);
-
-			double w = pi / counter;
-			double b1 = grain->b1 = 2. * cos(w);
-			double y1 = sin(w);
-			double y2 = 0.;
-
-			float azimuth = IN_AT(unit, 6, i);
-			float elevation = IN_AT(unit, 7, i);
-			float rho = IN_AT(unit, 8, i);
-
-			CALC_BF_COEFS
-
-			float *Wout1 = Wout + i;
-			float *Xout1 = Xout + i;
-			float *Yout1 = Yout + i;
-			float *Zout1 = Zout + i;
-
-			int nsmps = sc_min(grain->counter, inNumSamples - i);
-			if (grain->interp >= 4) {
-				for (int j=0; j<nsmps; ++j) {
-					GRAIN_LOOP_BF_BODY_4;
-					phase += rate;
-				}
-			} else if (grain->interp >= 2) {
-				for (int j=0; j<nsmps; ++j) {
-					GRAIN_LOOP_BF_BODY_2;
-					phase += rate;
-				}
-			} else {
-				for (int j=0; j<nsmps; ++j) {
-					GRAIN_LOOP_BF_BODY_1;
-					phase += rate;
-				}
-			}
-
-			grain->phase = phase;
-			grain->y1 = y1;
-			grain->y2 = y2;
-			// end change
-			grain->counter -= nsmps;
-			if (grain->counter <= 0) {
-				// remove grain
-				*grain = unit->mGrains[--unit->mNumActive];
-			}
-		    }
+			BufGrainBF_start(unit, i);
 		}
 		unit->curtrig = trig[i];
-	    }
 	}
 
+	GrainBufSource<GrainBFOut> source(unit);
+	GrainPool_nextEach(&unit->mPool, source, inNumSamples);
+}
+
 void BufGrainBF_next_k(BufGrainBF *unit, int inNumSamples)
 {
 	ClearUnitOutputs(unit, inNumSamples);
-	float *Wout = ZOUT(0);
-	float *Xout = ZOUT(1);
-	float *Yout = ZOUT(2);
-	float *Zout = ZOUT(3);
-
-	float trig = ZIN0(0);
-	float wComp = unit->m_wComp;
-
-	World *world = unit->mWorld;
-//	SndBuf *bufs = world->mSndBufs;
-	//uint32 numBufs = world->mNumSndBufs;
-
-	for (int i=0; i < unit->mNumActive; ) {
-		GrainBF *grain = unit->mGrains + i;
-//		uint32 bufnum = grain->bufnum;
-
-		GRAIN_BUF
-		CHECK_BUF
-
-		if (bufChannels != 1) {
-			 ++i;
-			 continue;
-		}
-
-		double loopMax = (double)bufFrames;
-
-		double rate = grain->rate;
-		double phase = grain->phase;
-		double b1 = grain->b1;
-		double y1 = grain->y1;
-		double y2 = grain->y2;
-
-		float *Wout1 = Wout;
-		float *Xout1 = Xout;
-		float *Yout1 = Yout;
-		float *Zout1 = Zout;
-
-		GET_BF_AMPS
-
-		int nsmps = sc_min(grain->counter, inNumSamples);
-		if (grain->interp >= 4) {
-			for (int j=0; j<nsmps; ++j) {
-				GRAIN_LOOP_BF_BODY_4;
-				phase += rate;
-			}
-		} else if (grain->interp >= 2) {
-			for (int j=0; j<nsmps; ++j) {
-				GRAIN_LOOP_BF_BODY_2;
-				phase += rate;
-			}
-		} else {
-			for (int j=0; j<nsmps; ++j) {
-				GRAIN_LOOP_BF_BODY_1;
-				phase += rate;
-			}
-		}
-
-		grain->phase = phase;
-		grain->y1 = y1;
-		grain->y2 = y2;
-
-		grain->counter -= nsmps;
-		if (grain->counter <= 0) {
-			// remove grain
-			*grain = unit->mGrains[--unit->mNumActive];
-		} else ++i;
-	    }
-
-		if ((trig > 0.) && (unit->curtrig <= 0.)) {
-			// start a grain
-			if (unit->mNumActive+1 >= kMaxSynthGrains) {Print("Too many grains!\n");
-			} else {
-			uint32 bufnum = (uint32)ZIN0(2);
-
-			GrainBF *grain = unit->mGrains + unit->mNumActive++;
-
-			SETUP_GRAIN_BUF
-			GRAIN_BUF
-			CHECK_BUF
-
-			float bufSampleRate = buf->samplerate;
-			float bufRateScale = bufSampleRate * SAMPLEDUR;
-			double loopMax = (double)bufFrames;
-
-//			GrainBF *grain = unit->mGrains + unit->mNumActive++;
-//			grain->bufnum = bufnum;
-
-			double counter = ZIN0(1) * SAMPLERATE;
-			counter = sc_max(4., counter);
-			grain->counter = (int)counter;
-
-			double rate = grain->rate = ZIN0(3) * bufRateScale;
-			double phase = ZIN0(4) * bufFrames;
-			grain->interp = (int)ZIN0(5);
-
-			double w = pi / counter;
-			double b1 = grain->b1 = 2. * cos(w);
-			double y1 = sin(w);
-			double y2 = 0.;
-
-			float azimuth = ZIN0(6);
-			float elevation = ZIN0(7);
-			float rho = ZIN0(8);
-
-			CALC_BF_COEFS
-
-			float *Wout1 = Wout;
-			float *Xout1 = Xout;
-			float *Yout1 = Yout;
-			float *Zout1 = Zout;
-
-			int nsmps = sc_min(grain->counter, inNumSamples);
-			if (grain->interp >= 4) {
-				for (int j=0; j<nsmps; ++j) {
-					GRAIN_LOOP_BF_BODY_4;
-					phase += rate;
-				}
-			} else if (grain->interp >= 2) {
-				for (int j=0; j<nsmps; ++j) {
-					GRAIN_LOOP_BF_BODY_2;
-					phase += rate;
-				}
-			} else {
-				for (int j=0; j<nsmps; ++j) {
-					GRAIN_LOOP_BF_BODY_1;
-					phase += rate;
-				}
-			}
+	float trig = IN0(0);
 
-			grain->phase = phase;
-			grain->y1 = y1;
-			grain->y2 = y2;
-			grain->counter -= nsmps;
-			if (grain->counter <= 0) {
-				// remove grain
-				*grain = unit->mGrains[--unit->mNumActive];
-			}
-		}
-	    }
-	    unit->curtrig = trig;
+	if ((trig > 0) && (unit->curtrig <=0)) {
+		// start a grain
+		BufGrainBF_start(unit, 0);
+	}
+	unit->curtrig = trig;
 
+	GrainBufSource<GrainBFOut> source(unit);
+	GrainPool_nextEach(&unit->mPool, source, inNumSamples);
 }
 
 void BufGrainBF_Ctor(BufGrainBF *unit)
@@ -5918,12 +5049,17 @@ void BufGrainBF_Ctor(BufGrainBF *unit)
 	    SETCALC(BufGrainBF_next_a);
 	    else
 	    SETCALC(BufGrainBF_next_k);
-	unit->mNumActive = 0;
 	unit->curtrig = 0.f;
 	unit->m_wComp = IN0(9);
+	GrainPool_init(unit->mWorld, &unit->mPool, kGrainBuf | kGrainBF | kGrainEach);
 	BufGrainBF_next_k(unit, 1); // should be _k
 }
 
+void BufGrainBF_Dtor(BufGrainBF *unit)
+{
+	GrainPool_free(unit->mWorld, &unit->mPool);
+}
+
 ////////////////////// BufGrainsB ///////////////////////////////
 
 void BufGrainBBF_next_a(BufGrainBBF *unit, int inNumSamples)
@@ -7872,30 +7008,30 @@ PluginLoad(JoshGrain)
 {
 	ft = inTable;
 
-	DefineSimpleCantAliasUnit(MonoGrain);
-	DefineSimpleCantAliasUnit(MonoGrainBF);
-	DefineSimpleCantAliasUnit(SinGrain);
+	DefineDtorCantAliasUnit(MonoGrain);
+	DefineDtorCantAliasUnit(MonoGrainBF);
+	DefineDtorCantAliasUnit(SinGrain);
 	DefineSimpleCantAliasUnit(SinGrainB);
 	DefineSimpleCantAliasUnit(SinGrainI);
-	DefineSimpleCantAliasUnit(InGrain);
+	DefineDtorCantAliasUnit(InGrain);
 	DefineSimpleCantAliasUnit(InGrainB);
 	DefineSimpleCantAliasUnit(InGrainI);
-	DefineSimpleCantAliasUnit(FMGrain);
+	DefineDtorCantAliasUnit(FMGrain);
 	DefineSimpleCantAliasUnit(FMGrainB);
 	DefineSimpleCantAliasUnit(FMGrainI);
-	DefineSimpleCantAliasUnit(BufGrain);
+	DefineDtorCantAliasUnit(BufGrain);
 	DefineSimpleCantAliasUnit(BufGrainB);
 	DefineSimpleCantAliasUnit(BufGrainI);
-	DefineSimpleCantAliasUnit(InGrainBF);
+	DefineDtorCantAliasUnit(InGrainBF);
 	DefineSimpleCantAliasUnit(InGrainBBF);
 	DefineSimpleCantAliasUnit(InGrainIBF);
-	DefineSimpleCantAliasUnit(SinGrainBF);
+	DefineDtorCantAliasUnit(SinGrainBF);
 	DefineSimpleCantAliasUnit(SinGrainBBF);
 	DefineSimpleCantAliasUnit(SinGrainIBF);
-	DefineSimpleCantAliasUnit(FMGrainBF);
+	DefineDtorCantAliasUnit(FMGrainBF);
 	DefineSimpleCantAliasUnit(FMGrainBBF);
 	DefineSimpleCantAliasUnit(FMGrainIBF);
-	DefineSimpleCantAliasUnit(BufGrainBF);
+	DefineDtorCantAliasUnit(BufGrainBF);
 	DefineSimpleCantAliasUnit(BufGrainBBF);
 	DefineSimpleCantAliasUnit(BufGrainIBF);
 	DefineDtorCantAliasUnit(GrainInJ);
@@ -15,11 +15,72 @@
 #include "SC_PlugIn.h"
 #include "ladspa.h"
 #include <dlfcn.h>
+#include <dirent.h>
+#include <errno.h>
 #include <stdio.h>
 #include <stdlib.h>
-#include "utils.h"
+#include <string.h>
+#include <sys/stat.h>
 
 static InterfaceTable *ft; 
+
+/*
+ * Plugin index
+ *
+ * Scanning LADSPA_PATH means dlopen()ing every library, which takes seconds
+ * with a few hundred of them. The result of the scan is kept in an index file
+ * (see ladspa_index_path) and a library is only opened again if its mtime or
+ * size changed. Libraries are dlopen()ed for real the first time one of their
+ * plugins is requested, in the NRT thread.
+ *
+ * Plugin instances are created, activated and cleaned up in the NRT thread as
+ * well, as many plugins allocate delay lines or compute tables there. Released
+ * instances are deactivated and kept in a pool per plugin, the next unit that
+ * uses the plugin activates one of them again instead of instantiating.
+ *
+ * The index is a text file:
+ *
+ *   LadspaUGen index 1
+ *   L <mtime> <size> <library path>
+ *   P <UniqueID> <ports> <label>
+ *   ...
+ *
+ * Each L line is followed by the plugins of that library, libraries without
+ * plugins are kept as well so that they are not opened on every boot. <ports>
+ * has one character per port: 'a'/'k' for audio/control inputs, 'A'/'K' for
+ * audio/control outputs.
+ */
+
+#define LADSPA_INDEX_HEADER "LadspaUGen index 1"
+#define LADSPA_POOL_SIZE 16
+
+struct LadspaLibrary {
+    char *path;
+    long long mtime;
+    long long size;
+    void *dlhandle;             // NRT, opened on first use
+    int first_plugin;           // only used while loading the index
+    int plugin_count;
+};
+
+struct LadspaPlugin {
+    unsigned long id;
+    int library;
+    char *label;
+    char *ports;
+
+    // NRT only
+    const LADSPA_Descriptor *desc;
+    LADSPA_Handle pool[LADSPA_POOL_SIZE];   // deactivated instances
+    int pool_count;
+    unsigned long pool_rate;
+};
+
+static LadspaLibrary *libraries;
+static int libraries_index;
+static int libraries_size;
+
+static LadspaPlugin *plugins;
 static int plugins_index;
 static int plugins_size;
 
@@ -29,48 +90,108 @@ struct LADSPA : public Unit
     const LADSPA_Descriptor *desc;
     int requested_channels;
     int plugin_channels;
+    LadspaPlugin *plugin;
+    struct LADSPACmd *pending;
+};
+
+// data to be shared between RT and NRT threads
+struct LADSPACmd {
+    LADSPA *unit;       // cleared when the unit is freed before the instance arrives
+    LadspaPlugin *plugin;
+    const LADSPA_Descriptor *desc;
+    LADSPA_Handle handle;
+    unsigned long samplerate;
 };
 
 extern "C" {  
-    static const LADSPA_Descriptor **plugins;
     void LADSPA_next(LADSPA *unit, int inNumSamples);
     void LADSPA_Ctor(LADSPA *unit);
     void LADSPA_Dtor(LADSPA *unit);
 }
 
-static int desc_cmp(const void *m1, const void *m2) {
-    const LADSPA_Descriptor *a = *(LADSPA_Descriptor**) m1;
-    const LADSPA_Descriptor *b = *(LADSPA_Descriptor**) m2;
-    return (a->UniqueID - b->UniqueID);
+static int plugin_cmp(const void *m1, const void *m2) {
+    const LadspaPlugin *a = (const LadspaPlugin*) m1;
+    const LadspaPlugin *b = (const LadspaPlugin*) m2;
+    if(a->id < b->id) return -1;
+    return a->id > b->id;
 }
 
-void LADSPA_Ctor(LADSPA *unit) {
-    LADSPA_Descriptor key, *keyp = &key;
-    const LADSPA_Descriptor **found;
+static LadspaPlugin *find_plugin(unsigned long id) {
+    LadspaPlugin key;
+    key.id = id;
+    return (LadspaPlugin*) bsearch(&key, plugins, plugins_index, sizeof(LadspaPlugin), plugin_cmp);
+}
 
-    unit->desc = NULL;
-    unit->handle = NULL;
-    unit->requested_channels = (int) IN0(0);
-    if(unit->requested_channels < 1) {
-        Print("LADSPA: Must request more than 0 channels\n");
-        unit->mDone = true;
-        SETCALC(ClearUnitOutputs);
-        return;
+// NRT: open the library of the plugin and look up its descriptor
+static const LADSPA_Descriptor *resolve_plugin(LadspaPlugin *plugin) {
+    if(plugin->desc) return plugin->desc;
+
+    LadspaLibrary *lib = &libraries[plugin->library];
+    if(!lib->dlhandle) {
+        lib->dlhandle = dlopen(lib->path, RTLD_LAZY);
+        if(!lib->dlhandle) {
+            Print("LADSPA: ERROR, could not open %s: %s\n", lib->path, dlerror());
+            return NULL;
+        }
     }
 
-    key.UniqueID = (unsigned long) IN0(1);
-    found = (const LADSPA_Descriptor**) bsearch(&keyp, &plugins[0], plugins_index, sizeof(LADSPA_Descriptor*), desc_cmp);
+    LADSPA_Descriptor_Function descFunc = (LADSPA_Descriptor_Function) dlsym(lib->dlhandle, "ladspa_descriptor");
+    if(!descFunc) {
+        Print("LADSPA: ERROR, %s is not a LADSPA library any more\n", lib->path);
+        return NULL;
+    }
 
-    if(!found) {
-        Print("LADSPA: ERROR, plugin %lu not found!\n",key.UniqueID);
-        unit->mDone = true;
-        SETCALC(ClearUnitOutputs);
-        return;
+    const LADSPA_Descriptor *desc;
+    for(long i = 0; (desc = descFunc(i)) != NULL; i++) {
+        if(desc->UniqueID != plugin->id) continue;
+        if(strcmp(desc->Label, plugin->label) || desc->PortCount != strlen(plugin->ports))
+            Print("LADSPA: WARNING, plugin %lu in %s has changed, the index is stale\n", plugin->id, lib->path);
+        plugin->desc = desc;
+        return desc;
+    }
+
+    Print("LADSPA: ERROR, plugin %lu is not in %s any more\n", plugin->id, lib->path);
+    return NULL;
+}
+
+// NRT: an activated instance, from the pool if possible
+static LADSPA_Handle acquire_instance(LadspaPlugin *plugin, const LADSPA_Descriptor *desc, unsigned long samplerate) {
+    LADSPA_Handle handle;
+    if(plugin->pool_count && plugin->pool_rate == samplerate) {
+        handle = plugin->pool[--plugin->pool_count];
     } else {
-        unit->desc = *found;
+        handle = desc->instantiate(desc, samplerate);
+        if(!handle) {
+            Print("LADSPA: ERROR, could not instantiate plugin %lu\n", plugin->id);
+            return NULL;
+        }
     }
 
-    unit->handle = unit->desc->instantiate(unit->desc,SAMPLERATE);
+    if(desc->activate)
+        desc->activate(handle);
+    return handle;
+}
+
+// NRT
+static void release_instance(LadspaPlugin *plugin, const LADSPA_Descriptor *desc, LADSPA_Handle handle, unsigned long samplerate) {
+    if(desc->deactivate)
+        desc->deactivate(handle);
+
+    if(plugin->pool_rate != samplerate) {
+        while(plugin->pool_count)
+            desc->cleanup(plugin->pool[--plugin->pool_count]);
+        plugin->pool_rate = samplerate;
+    }
+
+    if(plugin->pool_count < LADSPA_POOL_SIZE)
+        plugin->pool[plugin->pool_count++] = handle;
+    else
+        desc->cleanup(handle);
+}
+
+static void LADSPA_start(LADSPA *unit, const LADSPA_Descriptor *desc, LADSPA_Handle handle) {
+    unit->desc = desc;
+    unit->handle = handle;
 
     int in_index = 2, out_index = 0;
     for(unsigned long i = 0; i < unit->desc->PortCount; i++) {
@@ -86,18 +207,106 @@ void LADSPA_Ctor(LADSPA *unit) {
 
 //    printf("output channels: ladspa: %d ugen: %d\n",unit->plugin_channels,unit->requested_channels);
 
-    if(unit->desc->activate)
-        unit->desc->activate(unit->handle);
-
     SETCALC(LADSPA_next);
 }
 
+static bool LADSPA_instantiateStage2(World *world, LADSPACmd *cmd) { // NRT
+    cmd->desc = resolve_plugin(cmd->plugin);
+    if(cmd->desc)
+        cmd->handle = acquire_instance(cmd->plugin, cmd->desc, cmd->samplerate);
+    return true;
+}
+
+static bool LADSPA_instantiateStage3(World *world, LADSPACmd *cmd) { // RT
+    LADSPA *unit = cmd->unit;
+    if(!unit) return cmd->handle != NULL; // the unit is gone, release in stage 4
+
+    unit->pending = NULL;
+    if(cmd->handle)
+        LADSPA_start(unit, cmd->desc, cmd->handle);
+    else
+        unit->mDone = true;
+    return false;
+}
+
+static bool LADSPA_releaseStage(World *world, LADSPACmd *cmd) { // NRT
+    release_instance(cmd->plugin, cmd->desc, cmd->handle, cmd->samplerate);
+    return false;
+}
+
+static void LADSPA_cmdCleanup(World *world, void *cmd) {
+    RTFree(world, cmd);
+}
+
+void LADSPA_Ctor(LADSPA *unit) {
+    unit->desc = NULL;
+    unit->handle = NULL;
+    unit->pending = NULL;
+    unit->requested_channels = (int) IN0(0);
+    if(unit->requested_channels < 1) {
+        Print("LADSPA: Must request more than 0 channels\n");
+        unit->mDone = true;
+        SETCALC(ClearUnitOutputs);
+        return;
+    }
+
+    unsigned long id = (unsigned long) IN0(1);
+    LadspaPlugin *plugin = find_plugin(id);
+
+    if(!plugin) {
+        Print("LADSPA: ERROR, plugin %lu not found!\n",id);
+        unit->mDone = true;
+        SETCALC(ClearUnitOutputs);
+        return;
+    }
+
+    // silent until the instance arrives
+    SETCALC(ClearUnitOutputs);
+    ClearUnitOutputs(unit, 1);
+
+    LADSPACmd *cmd = (LADSPACmd*) RTAlloc(unit->mWorld, sizeof(LADSPACmd));
+    if(!cmd) {
+        Print("LADSPA: RT memory allocation failed\n");
+        unit->mDone = true;
+        return;
+    }
+    unit->plugin = plugin;
+    cmd->unit = unit;
+    cmd->plugin = plugin;
+    cmd->desc = NULL;
+    cmd->handle = NULL;
+    cmd->samplerate = (unsigned long) SAMPLERATE;
+    unit->pending = cmd;
+
+    DoAsynchronousCommand(unit->mWorld, 0, "", (void*)cmd,
+                          (AsyncStageFn)LADSPA_instantiateStage2,
+                          (AsyncStageFn)LADSPA_instantiateStage3,
+                          (AsyncStageFn)LADSPA_releaseStage,
+                          LADSPA_cmdCleanup,
+                          0, 0);
+}
+
 void LADSPA_Dtor(LADSPA *unit)
 {
+    if(unit->pending) unit->pending->unit = NULL;
     if(!unit->desc) return;
-    if(unit->desc->deactivate)
-        unit->desc->deactivate(unit->handle);
-    unit->desc->cleanup(unit->handle);
+
+    LADSPACmd *cmd = (LADSPACmd*) RTAlloc(unit->mWorld, sizeof(LADSPACmd));
+    if(!cmd) {
+        Print("LADSPA: RT memory allocation failed, plugin instance leaked\n");
+        return;
+    }
+    cmd->unit = NULL;
+    cmd->plugin = unit->plugin;
+    cmd->desc = unit->desc;
+    cmd->handle = unit->handle;
+    cmd->samplerate = (unsigned long) SAMPLERATE;
+
+    DoAsynchronousCommand(unit->mWorld, 0, "", (void*)cmd,
+                          (AsyncStageFn)LADSPA_releaseStage,
+                          NULL, NULL,
+                          LADSPA_cmdCleanup,
+                          0, 0);
 }
 
 void LADSPA_next( LADSPA *unit, int inNumSamples ) {
@@ -110,37 +319,268 @@ void LADSPA_next( LADSPA *unit, int inNumSamples ) {
     }
 }
 
-static void getPluginLibrary(const char *fn, void *dlHandle, LADSPA_Descriptor_Function descFunc) {
-    const LADSPA_Descriptor * desc;
+////////////////////////////////////////////////////////////////////////////
+// index
 
-    for(long i = 0; (desc = descFunc(i)) != NULL; i++) {
-        if(plugins_index >= plugins_size) {
-            plugins_size += 64;
-            plugins = (const LADSPA_Descriptor**) realloc((void*)plugins, sizeof(LADSPA_Descriptor*) * plugins_size);
+static LadspaLibrary *add_library(const char *path, long long mtime, long long size) {
+    if(libraries_index >= libraries_size) {
+        libraries_size += 64;
+        libraries = (LadspaLibrary*) realloc((void*)libraries, sizeof(LadspaLibrary) * libraries_size);
+    }
+    LadspaLibrary *lib = &libraries[libraries_index++];
+    lib->path = strdup(path);
+    lib->mtime = mtime;
+    lib->size = size;
+    lib->dlhandle = NULL;
+    lib->first_plugin = plugins_index;
+    lib->plugin_count = 0;
+    return lib;
+}
+
+static void add_plugin(unsigned long id, const char *ports, const char *label) {
+    if(plugins_index >= plugins_size) {
+        plugins_size += 64;
+        plugins = (LadspaPlugin*) realloc((void*)plugins, sizeof(LadspaPlugin) * plugins_size);
+    }
+    LadspaPlugin *plugin = &plugins[plugins_index++];
+    plugin->id = id;
+    plugin->library = libraries_index - 1;
+    plugin->label = strdup(label);
+    plugin->ports = strdup(ports);
+    plugin->desc = NULL;
+    plugin->pool_count = 0;
+    plugin->pool_rate = 0;
+    libraries[libraries_index - 1].plugin_count++;
+}
+
+static void describe_ports(const LADSPA_Descriptor *desc, char *ports) {
+    unsigned long i;
+    for(i = 0; i < desc->PortCount; i++) {
+        LADSPA_PortDescriptor port = desc->PortDescriptors[i];
+        char c = LADSPA_IS_PORT_AUDIO(port) ? 'a' : 'k';
+        ports[i] = LADSPA_IS_PORT_OUTPUT(port) ? c - 'a' + 'A' : c;
+    }
+    ports[i] = 0;
+}
+
+// open the library and add its plugins, then close it again
+static void scan_library(const char *path, long long mtime, long long size) {
+    add_library(path, mtime, size);
+
+    void *dlhandle = dlopen(path, RTLD_LAZY);
+    if(!dlhandle) return;
+
+    dlerror();
+    LADSPA_Descriptor_Function descFunc = (LADSPA_Descriptor_Function) dlsym(dlhandle, "ladspa_descriptor");
+    if(dlerror() == NULL && descFunc) {
+        const LADSPA_Descriptor *desc;
+        for(long i = 0; (desc = descFunc(i)) != NULL; i++) {
+            char *ports = (char*) malloc(desc->PortCount + 1);
+            describe_ports(desc, ports);
+            add_plugin(desc->UniqueID, ports, desc->Label);
+            free(ports);
+        }
+    }
+    dlclose(dlhandle);
+}
+
+static bool ladspa_index_path(char *path, size_t size) {
+    const char *env = getenv("LADSPA_UGEN_INDEX");
+    if(env) {
+        snprintf(path, size, "%s", env);
+        return true;
+    }
+
+    const char *home = getenv("HOME");
+#ifdef __APPLE__
+    if(!home) return false;
+    snprintf(path, size, "%s/Library/Caches/SuperCollider/LadspaUGen.index", home);
+#else
+    const char *cache = getenv("XDG_CACHE_HOME");
+    if(cache && *cache)
+        snprintf(path, size, "%s/SuperCollider/LadspaUGen.index", cache);
+    else if(home)
+        snprintf(path, size, "%s/.cache/SuperCollider/LadspaUGen.index", home);
+    else
+        return false;
+#endif
+    return true;
+}
+
+static void read_index(const char *path) {
+    FILE *file = fopen(path, "r");
+    if(!file) return;
+
+    char line[8192];
+    if(!fgets(line, sizeof(line), file) || strncmp(line, LADSPA_INDEX_HEADER, strlen(LADSPA_INDEX_HEADER))) {
+        fclose(file);
+        return;
+    }
+
+    while(fgets(line, sizeof(line), file)) {
+        line[strcspn(line, "\n")] = 0;
+        long long mtime, size;
+        unsigned long id;
+        int offset;
+        if(sscanf(line, "L %lld %lld %n", &mtime, &size, &offset) == 2) {
+            add_library(line + offset, mtime, size);
+        } else if(libraries_index && sscanf(line, "P %lu %n", &id, &offset) == 1) {
+            char *ports = line + offset;
+            char *label = strchr(ports, ' ');
+            if(!label) continue;
+            *label++ = 0;
+            add_plugin(id, ports, label);
+        }
+    }
+    fclose(file);
+}
+
+static void write_index(const char *path) {
+    // create the cache directories, errors show up when opening the file
+    char dir[4096];
+    snprintf(dir, sizeof(dir), "%s", path);
+    for(char *slash = strchr(dir + 1, '/'); slash; slash = strchr(slash + 1, '/')) {
+        *slash = 0;
+        mkdir(dir, 0755);
+        *slash = '/';
+    }
+
+    char tmp[4096];
+    snprintf(tmp, sizeof(tmp), "%s.tmp", path);
+    FILE *file = fopen(tmp, "w");
+    if(!file) {
+        Print("LADSPA: could not write the plugin index %s: %s\n", tmp, strerror(errno));
+        return;
+    }
+
+    fprintf(file, "%s\n", LADSPA_INDEX_HEADER);
+    for(int i = 0; i < libraries_index; i++) {
+        LadspaLibrary *lib = &libraries[i];
+        fprintf(file, "L %lld %lld %s\n", lib->mtime, lib->size, lib->path);
+        for(int j = lib->first_plugin; j < lib->first_plugin + lib->plugin_count; j++)
+            fprintf(file, "P %lu %s %s\n", plugins[j].id, plugins[j].ports, plugins[j].label);
+    }
+
+    if(fclose(file) || rename(tmp, path)) {
+        Print("LADSPA: could not write the plugin index %s: %s\n", path, strerror(errno));
+        remove(tmp);
+    }
+}
+
+// the index entries of the previous boot, while the directories are scanned
+static LadspaLibrary *cached_libraries;
+static int cached_libraries_index;
+static LadspaPlugin *cached_plugins;
+
+static bool reuse_library(const char *path, long long mtime, long long size) {
+    for(int i = 0; i < cached_libraries_index; i++) {
+        LadspaLibrary *cached = &cached_libraries[i];
+        if(!cached->path || strcmp(cached->path, path)) continue;
+        if(cached->mtime != mtime || cached->size != size) return false;
+
+        add_library(path, mtime, size);
+        for(int j = cached->first_plugin; j < cached->first_plugin + cached->plugin_count; j++)
+            add_plugin(cached_plugins[j].id, cached_plugins[j].ports, cached_plugins[j].label);
+
+        free(cached->path);
+        cached->path = NULL;    // taken
+        return true;
+    }
+    return false;
+}
+
+// returns true if a library had to be scanned
+static bool search_directory(const char *directory) {
+    DIR *dir = opendir(directory);
+    if(!dir) return false;
+
+    bool scanned = false;
+    struct dirent *entry;
+    while((entry = readdir(dir))) {
+        char path[4096];
+        struct stat st;
+        snprintf(path, sizeof(path), "%s%s%s", directory,
+                 directory[strlen(directory) - 1] == '/' ? "" : "/", entry->d_name);
+        if(stat(path, &st) || !S_ISREG(st.st_mode)) continue;
+
+        if(!reuse_library(path, st.st_mtime, st.st_size)) {
+            scan_library(path, st.st_mtime, st.st_size);
+            scanned = true;
         }
-        plugins[plugins_index] = desc;
-        plugins_index++;
     }
+    closedir(dir);
+    return scanned;
+}
+
+static void search_plugins() {
+    char index[4096];
+    bool have_index = ladspa_index_path(index, sizeof(index));
+    if(have_index)
+        read_index(index);
+
+    cached_libraries = libraries;
+    cached_libraries_index = libraries_index;
+    cached_plugins = plugins;
+    int cached_plugins_index = plugins_index;
+    libraries = NULL;
+    libraries_index = libraries_size = 0;
+    plugins = NULL;
+    plugins_index = plugins_size = 0;
+
+    const char *path = getenv("LADSPA_PATH");
+    if(!path) {
+#ifdef __APPLE__
+        path = "/Library/Audio/Plug-Ins/LADSPA";
+#else
+        path = "/usr/lib/ladspa:/usr/local/lib/ladspa";
+#endif
+    }
+
+    bool changed = false;
+    while(*path) {
+        size_t length = strcspn(path, ":");
+        char directory[4096];
+        snprintf(directory, sizeof(directory), "%.*s", (int)length, path);
+        if(length && search_directory(directory))
+            changed = true;
+        path += length;
+        if(*path == ':') path++;
+    }
+
+    // libraries that went away
+    for(int i = 0; i < cached_libraries_index; i++) {
+        if(cached_libraries[i].path) {
+            changed = true;
+            free(cached_libraries[i].path);
+        }
+    }
+    for(int i = 0; i < cached_plugins_index; i++) {
+        free(cached_plugins[i].label);
+        free(cached_plugins[i].ports);
+    }
+    free(cached_libraries);
+    free(cached_plugins);
+    cached_libraries = NULL;
+    cached_plugins = NULL;
+
+    if(have_index && changed)
+        write_index(index);
+
+    qsort(plugins, plugins_index, sizeof(LadspaPlugin), plugin_cmp);
 }
 
 PluginLoad(LadspaUGen)
 {
     ft = inTable;
 
-    plugins_index = 0;
-    plugins_size = 64;
-    plugins = (const LADSPA_Descriptor**) malloc(sizeof(LADSPA_Descriptor*)*plugins_size);
-    LADSPAPluginSearch(getPluginLibrary);
-
-    qsort(&plugins[0], plugins_index, sizeof(LADSPA_Descriptor*), desc_cmp);
+    search_plugins();
 
 //    for(int i=0;i<plugins_index;i++) {
-//        const LADSPA_Descriptor *p = plugins[i];
-//        printf("%03d: %lu (%s)\n",i,p->UniqueID,p->Label);
+//        const LadspaPlugin *p = &plugins[i];
+//        printf("%03d: %lu (%s)\n",i,p->id,p->label);
 //    }
     Print("Found %d LADSPA plugins\n",plugins_index);
 
 //    DefineDtorUnit(LADSPA);
     DefineDtorCantAliasUnit(LADSPA);
 }
-
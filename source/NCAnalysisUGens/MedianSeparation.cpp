@@ -27,6 +27,7 @@
 #include "SC_PlugIn.h"
 #include <math.h>
 #include <stdlib.h>
+#include <string.h>
 #include "FFT_UGens.h"
 
 
@@ -58,6 +59,14 @@ struct MedianSeparation : public Unit
     float * horizontalmedians_;
     float * verticalmedians_;
     
+    //sliding horizontal median, per bin: the magnitude of each frame slot, and the slots in two heaps, a max heap of the lowest
+    //lowersize_ values followed by a min heap of the rest, so the median is the top of the first. Each new frame replaces one slot
+    float * slidingvalues_;
+    uint16 * slidingheaps_;
+    uint16 * slidingpositions_; //where each slot is in the heaps
+    int lowersize_;
+    int slidingstale_; //set while the mean is used, since frames are not added then
+    
     int amortisationstep_; 
     int bufnum1_;
     int bufnum2_; 
@@ -89,6 +98,165 @@ int cmp(const void* vp,const void* vq) {
 
 
 
+//sliding median: the heap functions work on the heaps of one bin, lower selects the max heap starting at 0, else the min heap starting at lowersize
+
+static inline bool MedianSeparation_above(float a, float b, bool lower) {
+    
+    return lower ? (a>b) : (a<b);
+}
+
+
+static void MedianSeparation_sift(float * values, uint16 * heap, uint16 * positions, int start, int size, int node, bool lower) {
+    
+    uint16 slot = heap[start+node];
+    float value = values[slot];
+    
+    //up
+    while (node>0) {
+        
+        int parent = (node-1)/2;
+        uint16 parentslot = heap[start+parent];
+        
+        if(!MedianSeparation_above(value, values[parentslot], lower))
+            break;
+        
+        heap[start+node] = parentslot;
+        positions[parentslot] = start+node;
+        node = parent;
+    }
+    
+    //down
+    while (true) {
+        
+        int child = 2*node+1;
+        
+        if(child>=size)
+            break;
+        
+        if((child+1<size) && MedianSeparation_above(values[heap[start+child+1]], values[heap[start+child]], lower))
+            ++child;
+        
+        uint16 childslot = heap[start+child];
+        
+        if(!MedianSeparation_above(values[childslot], value, lower))
+            break;
+        
+        heap[start+node] = childslot;
+        positions[childslot] = start+node;
+        node = child;
+    }
+    
+    heap[start+node] = slot;
+    positions[slot] = start+node;
+}
+
+
+//give a frame slot of one bin a new magnitude, O(log medsize)
+static void MedianSeparation_replace(float * values, uint16 * heap, uint16 * positions, int medsize, int lowersize, int slot, float value) {
+    
+    int uppersize = medsize-lowersize;
+    int position = positions[slot];
+    
+    values[slot] = value;
+    
+    if(position<lowersize) {
+        
+        uint16 uppertop = heap[lowersize];
+        
+        if(value>values[uppertop]) {
+            
+            //crosses over: the least of the upper heap becomes the greatest of the lower, and the slot takes its place
+            heap[position] = uppertop;
+            positions[uppertop] = position;
+            MedianSeparation_sift(values, heap, positions, 0, lowersize, position, true);
+            
+            heap[lowersize] = slot;
+            positions[slot] = lowersize;
+            MedianSeparation_sift(values, heap, positions, lowersize, uppersize, 0, false);
+            
+        } else
+            MedianSeparation_sift(values, heap, positions, 0, lowersize, position, true);
+        
+    } else {
+        
+        uint16 lowertop = heap[0];
+        
+        if(value<values[lowertop]) {
+            
+            heap[position] = lowertop;
+            positions[lowertop] = position;
+            MedianSeparation_sift(values, heap, positions, lowersize, uppersize, position-lowersize, false);
+            
+            heap[0] = slot;
+            positions[slot] = 0;
+            MedianSeparation_sift(values, heap, positions, 0, lowersize, 0, true);
+            
+        } else
+            MedianSeparation_sift(values, heap, positions, lowersize, uppersize, position-lowersize, false);
+    }
+}
+
+
+//all slots of all bins back to zero, as in the constructor. If refill, then replace every slot with the stored magnitudes
+static void MedianSeparation_resetsliding(MedianSeparation * unit, bool refill) {
+    
+    int i, j;
+    
+    int medsize = unit->mediansize_;
+    int numbands = unit->fftbins_;
+    
+    for (i=0; i<numbands; ++i) {
+        
+        float * values = unit->slidingvalues_ + (i*medsize);
+        uint16 * heap = unit->slidingheaps_ + (i*medsize);
+        uint16 * positions = unit->slidingpositions_ + (i*medsize);
+        
+        //all equal, so any arrangement is a valid pair of heaps
+        for (j=0; j<medsize; ++j) {
+            values[j] = 0.0f;
+            heap[j] = j;
+            positions[j] = j;
+        }
+        
+        if(refill) {
+            for (j=0; j<medsize; ++j)
+                MedianSeparation_replace(values, heap, positions, medsize, unit->lowersize_, j, unit->magnitudes_[(j*numbands) + i]);
+        }
+    }
+    
+    unit->slidingstale_ = 0;
+}
+
+
+//insert into or remove from a sorted window of n values, for the vertical median
+static void MedianSeparation_insert(float * window, int n, float value) {
+    
+    int low = 0, high = n;
+    
+    while (low<high) {
+        int middle = (low+high)/2;
+        if(window[middle]<=value) low = middle+1; else high = middle;
+    }
+    
+    memmove(window+low+1, window+low, (n-low)*sizeof(float));
+    window[low] = value;
+}
+
+
+static void MedianSeparation_remove(float * window, int n, float value) {
+    
+    int low = 0, high = n-1;
+    
+    while (low<high) {
+        int middle = (low+high)/2;
+        if(window[middle]<value) low = middle+1; else high = middle;
+    }
+    
+    memmove(window+low, window+low+1, (n-low-1)*sizeof(float));
+}
+
+
+
 void MedianSeparation_Ctor( MedianSeparation* unit ) {
 	
     //fft, fftharmonic, fftpercussive, fftsize, mediansize=17, hardorsoft=0, p=1
@@ -105,6 +273,10 @@ void MedianSeparation_Ctor( MedianSeparation* unit ) {
     if(unit->mediansize_<3)
         unit->mediansize_ = 17; 
     
+    //frame slots are stored as uint16
+    if(unit->mediansize_>65535)
+        unit->mediansize_ = 65535; 
+    
     unit->midpoint_ = unit->mediansize_/2; 
     
     
@@ -133,10 +305,19 @@ void MedianSeparation_Ctor( MedianSeparation* unit ) {
         unit->phases_[i] = 0.0f;
     
     
-    unit->collection_ = (float *) RTAlloc(unit->mWorld, sizeof(float)* unit->mediansize_); //reusable array for sorting and finding median
+    unit->collection_ = (float *) RTAlloc(unit->mWorld, sizeof(float)* unit->mediansize_); //reusable array, the sorted window for the vertical median
     unit->horizontalmedians_ = (float *) RTAlloc(unit->mWorld, sizeof(float)* unit->fftbins_); 
     unit->verticalmedians_ = (float *) RTAlloc(unit->mWorld, sizeof(float)* unit->fftbins_);
     
+    unit->slidingvalues_ = (float *) RTAlloc(unit->mWorld, sizeof(float)* unit->mediansize_ * unit->fftbins_);
+    unit->slidingheaps_ = (uint16 *) RTAlloc(unit->mWorld, sizeof(uint16)* unit->mediansize_ * unit->fftbins_);
+    unit->slidingpositions_ = (uint16 *) RTAlloc(unit->mWorld, sizeof(uint16)* unit->mediansize_ * unit->fftbins_);
+    
+    //the median is the element mid from the top, as sorted in descending order by cmp
+    unit->lowersize_ = unit->mediansize_ - unit->midpoint_; 
+    
+    MedianSeparation_resetsliding(unit, false); 
+    
     //need to go a step at a time over the vertical, horizontal sort and the eventual output (so takes four blocks to calculate, FFT must be at least 256)
     unit->amortisationstep_=0; 
     
@@ -156,6 +337,9 @@ void MedianSeparation_Dtor( MedianSeparation* unit ) {
     RTFree(unit->mWorld, unit->collection_); 
     RTFree(unit->mWorld, unit->horizontalmedians_);
     RTFree(unit->mWorld, unit->verticalmedians_);
+    RTFree(unit->mWorld, unit->slidingvalues_);
+    RTFree(unit->mWorld, unit->slidingheaps_);
+    RTFree(unit->mWorld, unit->slidingpositions_);
     
 }
 
@@ -260,24 +444,22 @@ void MedianSeparation_next( MedianSeparation *unit, int inNumSamples ) {
                 
                 //vertical; easier to do in indexing 
                 
+                //array holds the window of bins around i in ascending order; sliding up the bins, one leaves at the bottom and one comes in at the top
+                int number = 0; 
+                
+                for (j=0; (j<mid) && (j<=top); ++j)
+                    MedianSeparation_insert(array, number++, magsnow[j]); 
+                
                 for (i=0; i<numbands; ++i) {
                     
-                    int lower = i-mid; 
-                    if(lower<0) lower =0; 
-                    int higher = i+mid; 
-                    if(higher>top) higher = top; 
-                    int number = higher-lower+1; 
+                    if(i-mid-1>=0) 
+                        MedianSeparation_remove(array, number--, magsnow[i-mid-1]); 
                     
-                    float * pnow = magsnow + lower; 
-                    
-                    //collect into array
-                    for (j=0; j<number; ++j)
-                        array[j] = pnow[j]; 
+                    if(i+mid<=top) 
+                        MedianSeparation_insert(array, number++, magsnow[i+mid]); 
                     
-                    qsort(array,number,sizeof(float),cmp);
-                    //result is midpoint of magnitudes
-                    
-                    vertical[i] = array[number/2];
+                    //element number/2 of the descending order
+                    vertical[i] = array[number-1-(number/2)];
                     
                 }
                 
@@ -330,18 +512,25 @@ void MedianSeparation_next( MedianSeparation *unit, int inNumSamples ) {
                 
                 //printf("median calc horizontal\n");   
                 
-                for (i=0; i<numbands; ++i) {
+                //the new frame replaces the oldest in each bin, unless frames were missed while the mean was used
+                if(unit->slidingstale_) {
                     
-                    //no checks required for the medsize, but have to get correct indices
+                    MedianSeparation_resetsliding(unit, true); 
                     
-                    //collect into array
-                    for (j=0; j<medsize; ++j)
-                        array[j] = mags[(j*numbands) + i]; 
+                } else {
+                    
+                    float * pnow = mags + (pos*numbands); 
+                    
+                    for (i=0; i<numbands; ++i)
+                        MedianSeparation_replace(unit->slidingvalues_ + (i*medsize), unit->slidingheaps_ + (i*medsize), unit->slidingpositions_ + (i*medsize), medsize, unit->lowersize_, pos, pnow[i]); 
                     
-                    qsort(array,medsize,sizeof(float),cmp);
-                    //result is midpoint of magnitudes
+                }
+                
+                for (i=0; i<numbands; ++i) {
                     
-                    horizontal[i] = array[mid];
+                    float * values = unit->slidingvalues_ + (i*medsize); 
+                    
+                    horizontal[i] = values[unit->slidingheaps_[i*medsize]];
                     
                 }
                 
@@ -352,6 +541,8 @@ void MedianSeparation_next( MedianSeparation *unit, int inNumSamples ) {
                 float sum; 
                 float recip = 1.0f/medsize; 
                 
+                unit->slidingstale_ = 1; 
+                
                 for (i=0; i<numbands; ++i) {
                     
                     //no checks required for the medsize, but have to get correct indices
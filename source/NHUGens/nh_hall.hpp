@@ -109,8 +109,10 @@ unceremoniously tampered with after NHHall receives it and makes the program
 easier to reason about. After this initialization, use of the unit is unchanged
 from the above.
 
-If the allocator ever returns a null pointer during initialization, NHHall
-immediately stops all further allocation and sets the
+NHHall makes a single allocation for all of its delay lines, sized up front
+from the sample rate, and aligns the lines to cache lines itself.
+
+If the allocator returns a null pointer during initialization, NHHall sets the
 m_initialization_was_successful flag to false. You should always check that
 flag and make sure it worked. If you forget to do this, running NHHall.process
 will access garbage memory and probably crash your app.
@@ -159,6 +161,7 @@ occasionally.
 #pragma once
 #include <cstdlib> // malloc / free
 #include <cstring> // memset
+#include <cstdint> // uintptr_t
 #include <memory> // std::unique_ptr
 #include <array> // std::array
 #include <cmath> // cosf/sinf
@@ -167,9 +170,11 @@ namespace nh_ugens {
 
 typedef std::array<float, 2> Stereo;
 
+// Single precision constants, so that the flush stays in float registers and
+// vectorizes along with the surrounding code.
 static inline float flush_denormals(float x) {
-    x += 1.0e-25;
-    x -= 1.0e-25;
+    x += 1.0e-25f;
+    x -= 1.0e-25f;
     return x;
 }
 
@@ -178,6 +183,29 @@ static inline Stereo flush_denormals(Stereo x) {
     return result;
 }
 
+// Lane-wise arithmetic on Stereo. The left and right channels of the reverb run
+// through identical processing, so everything from the allpasses to the shelf
+// filters is written in terms of these, which the compiler turns into SIMD.
+static inline Stereo operator+(Stereo a, Stereo b) {
+    Stereo result = {{a[0] + b[0], a[1] + b[1]}};
+    return result;
+}
+
+static inline Stereo operator-(Stereo a, Stereo b) {
+    Stereo result = {{a[0] - b[0], a[1] - b[1]}};
+    return result;
+}
+
+static inline Stereo operator*(Stereo a, float b) {
+    Stereo result = {{a[0] * b, a[1] * b}};
+    return result;
+}
+
+static inline Stereo operator*(float a, Stereo b) {
+    Stereo result = {{a * b[0], a * b[1]}};
+    return result;
+}
+
 static inline int next_power_of_two(int x) {
     int result = 1;
     while (result < x) {
@@ -346,6 +374,7 @@ private:
     float m_k = 0.99f;
 };
 
+// The shelf filters run both channels of a late stage with shared coefficients.
 class HiShelf {
 public:
     HiShelf(
@@ -372,8 +401,8 @@ public:
         m_a2 = ((a + 1) - (a - 1) * cos_w0 - x) * inv_a0;
     }
 
-    float process(float in) {
-        float out =
+    Stereo process(Stereo in) {
+        Stereo out =
             m_b0 * in + m_b1 * m_x1 + m_b2 * m_x2
             - m_a1 * m_y1 - m_a2 * m_y2;
         m_x2 = m_x1;
@@ -385,10 +414,10 @@ public:
 
 private:
     const float m_sample_rate;
-    float m_x1 = 0.0f;
-    float m_x2 = 0.0f;
-    float m_y1 = 0.0f;
-    float m_y2 = 0.0f;
+    Stereo m_x1 = {{0.0f, 0.0f}};
+    Stereo m_x2 = {{0.0f, 0.0f}};
+    Stereo m_y1 = {{0.0f, 0.0f}};
+    Stereo m_y2 = {{0.0f, 0.0f}};
     float m_b0 = 1.0f, m_b1 = 0.0f, m_b2 = 0.0f, m_a1 = 0.0f, m_a2 = 0.0f;
 };
 
@@ -418,8 +447,8 @@ public:
         m_a2 = ((a + 1) + (a - 1) * cos_w0 - x) * inv_a0;
     }
 
-    float process(float in) {
-        float out =
+    Stereo process(Stereo in) {
+        Stereo out =
             m_b0 * in + m_b1 * m_x1 + m_b2 * m_x2
             - m_a1 * m_y1 - m_a2 * m_y2;
         m_x2 = m_x1;
@@ -431,14 +460,17 @@ public:
 
 private:
     const float m_sample_rate;
-    float m_x1 = 0.0f;
-    float m_x2 = 0.0f;
-    float m_y1 = 0.0f;
-    float m_y2 = 0.0f;
+    Stereo m_x1 = {{0.0f, 0.0f}};
+    Stereo m_x2 = {{0.0f, 0.0f}};
+    Stereo m_y1 = {{0.0f, 0.0f}};
+    Stereo m_y2 = {{0.0f, 0.0f}};
     float m_b0 = 1.0f, m_b1 = 0.0f, m_b2 = 0.0f, m_a1 = 0.0f, m_a2 = 0.0f;
 };
 
 
+// A pair of delay lines running in lockstep, one per lane. The two lines are
+// interleaved in a single buffer, so they share the write position and every
+// write stores both lanes at once. The buffer is sized for the longer line.
 class BaseDelay {
 public:
     int m_size;
@@ -446,64 +478,90 @@ public:
 
     BaseDelay(
         float sample_rate,
-        float max_delay,
-        float delay
+        Stereo max_delay,
+        Stereo delay
     ) :
     m_sample_rate(sample_rate)
     {
-        int max_delay_in_samples = m_sample_rate * max_delay;
-        m_size = next_power_of_two(max_delay_in_samples);
+        int max_delay_in_samples_left = m_sample_rate * max_delay[0];
+        int max_delay_in_samples_right = m_sample_rate * max_delay[1];
+        m_size = next_power_of_two(
+            std::max(max_delay_in_samples_left, max_delay_in_samples_right)
+        );
         m_mask = m_size - 1;
 
         m_read_position = 0;
 
         m_delay = delay;
-        m_delay_in_samples = m_sample_rate * delay;
+        m_delay_in_samples[0] = m_sample_rate * delay[0];
+        m_delay_in_samples[1] = m_sample_rate * delay[1];
+    }
+
+    // Size of the buffer in floats.
+    int buffer_size() const {
+        return 2 * m_size;
     }
 
 protected:
     const float m_sample_rate;
     int m_mask;
     int m_read_position;
-    float m_delay;
-    int m_delay_in_samples;
+    Stereo m_delay;
+    int m_delay_in_samples[2];
+
+    inline float read(int lane, int position) const {
+        return m_buffer[2 * (position & m_mask) + lane];
+    }
+
+    inline Stereo read_fixed() const {
+        Stereo out = {{
+            read(0, m_read_position - m_delay_in_samples[0]),
+            read(1, m_read_position - m_delay_in_samples[1])
+        }};
+        return out;
+    }
+
+    inline void write(Stereo in) {
+        float* frame = m_buffer + 2 * m_read_position;
+        frame[0] = in[0];
+        frame[1] = in[1];
+        m_read_position = (m_read_position + 1) & m_mask;
+    }
 };
 
-// Fixed delay line.
+// Fixed delay lines.
 class Delay : public BaseDelay {
 public:
     Delay(
         float sample_rate,
-        float delay
+        Stereo delay
     ) :
     BaseDelay(sample_rate, delay, delay)
     {
     }
 
-    float process(float in) {
-        float out_value = m_buffer[(m_read_position - m_delay_in_samples) & m_mask];
-        m_buffer[m_read_position] = in;
-        m_read_position = (m_read_position + 1) & m_mask;
-        float out = out_value;
+    Stereo process(Stereo in) {
+        Stereo out = read_fixed();
+        write(in);
         return out;
     }
 
-    float tap(float delay) {
+    float tap(int lane, float delay) {
         int delay_in_samples = delay * m_sample_rate;
         int position = m_read_position - 1 - delay_in_samples;
-        float out = m_buffer[position & m_mask];
+        float out = read(lane, position);
         return out;
     }
 };
 
-// Fixed Schroeder allpass.
+// Fixed Schroeder allpasses.
 class Allpass : public BaseDelay {
 public:
     float m_k = 0.5;
 
     Allpass(
         float sample_rate,
-        float delay,
+        Stereo delay,
         float diffusion_sign
     ) :
     BaseDelay(sample_rate, delay, delay),
@@ -515,12 +573,11 @@ public:
         m_k = diffusion * m_diffusion_sign;
     }
 
-    float process(float in) {
-        float delayed_signal = m_buffer[(m_read_position - m_delay_in_samples) & m_mask];
-        float feedback_plus_input = in + delayed_signal * m_k;
-        m_buffer[m_read_position] = flush_denormals(feedback_plus_input);
-        m_read_position = (m_read_position + 1) & m_mask;
-        float out = feedback_plus_input * -m_k + delayed_signal;
+    Stereo process(Stereo in) {
+        Stereo delayed_signal = read_fixed();
+        Stereo feedback_plus_input = in + delayed_signal * m_k;
+        write(flush_denormals(feedback_plus_input));
+        Stereo out = feedback_plus_input * -m_k + delayed_signal;
         return out;
     }
 
@@ -528,18 +585,25 @@ private:
     float m_diffusion_sign;
 };
 
-// Schroeder allpass with variable delay and cubic interpolation.
+// Schroeder allpasses with variable delay and cubic interpolation.
 class VariableAllpass : public BaseDelay {
 public:
     float m_k = 0.5;
 
     VariableAllpass(
         float sample_rate,
-        float delay,
+        Stereo delay,
         float max_mod_depth,
         float diffusion_sign
     ) :
-    BaseDelay(sample_rate, delay + max_mod_depth + 4.0 / sample_rate, delay),
+    BaseDelay(
+        sample_rate,
+        {{
+            static_cast<float>(delay[0] + max_mod_depth + 4.0 / sample_rate),
+            static_cast<float>(delay[1] + max_mod_depth + 4.0 / sample_rate)
+        }},
+        delay
+    ),
     m_diffusion_sign(diffusion_sign)
     {
     }
@@ -548,29 +612,31 @@ public:
         m_k = diffusion * m_diffusion_sign;
     }
 
-    float process(float in, float offset) {
-        float position = m_read_position - (m_delay + offset) * m_sample_rate;
+    Stereo process(Stereo in, Stereo offset) {
+        Stereo delayed_signal;
+        for (int lane = 0; lane < 2; lane++) {
+            float position = m_read_position - (m_delay[lane] + offset[lane]) * m_sample_rate;
 
-        // This catches a very sneaky bug -- casting position to int rounds
-        // toward zero. To mitigate this, we ensure that the position is always
-        // above zero before rounding it down, using the fact that
-        // (m_delay + offset) * m_sample_rate < m_size.
-        position += m_size;
+            // This catches a very sneaky bug -- casting position to int rounds
+            // toward zero. To mitigate this, we ensure that the position is
+            // always above zero before rounding it down, using the fact that
+            // (m_delay + offset) * m_sample_rate < m_size.
+            position += m_size;
 
-        int iposition = position;
-        float position_frac = position - iposition;
+            int iposition = position;
+            float position_frac = position - iposition;
 
-        float y0 = m_buffer[iposition & m_mask];
-        float y1 = m_buffer[(iposition + 1) & m_mask];
-        float y2 = m_buffer[(iposition + 2) & m_mask];
-        float y3 = m_buffer[(iposition + 3) & m_mask];
+            float y0 = read(lane, iposition);
+            float y1 = read(lane, iposition + 1);
+            float y2 = read(lane, iposition + 2);
+            float y3 = read(lane, iposition + 3);
 
-        float delayed_signal = interpolate_cubic(position_frac, y0, y1, y2, y3);
+            delayed_signal[lane] = interpolate_cubic(position_frac, y0, y1, y2, y3);
+        }
 
-        float feedback_plus_input = in + delayed_signal * m_k;
-        m_buffer[m_read_position] = flush_denormals(feedback_plus_input);
-        m_read_position = (m_read_position + 1) & m_mask;
-        float out = feedback_plus_input * -m_k + delayed_signal;
+        Stereo feedback_plus_input = in + delayed_signal * m_k;
+        write(flush_denormals(feedback_plus_input));
+        Stereo out = feedback_plus_input * -m_k + delayed_signal;
 
         return out;
     }
@@ -595,46 +661,32 @@ public:
     m_lfo(sample_rate),
     m_dc_blocker(sample_rate),
 
-    m_low_shelves {{sample_rate, sample_rate, sample_rate, sample_rate}},
-    m_hi_shelves {{sample_rate, sample_rate, sample_rate, sample_rate}},
+    m_low_shelves {{sample_rate, sample_rate}},
+    m_hi_shelves {{sample_rate, sample_rate}},
 
+    // Lane 0 is the left channel, lane 1 the right channel.
     m_early_allpasses {{
-        Allpass(sample_rate, 9.5e-3f, 1),
-        Allpass(sample_rate, 12.0e-3f, -1),
-        Allpass(sample_rate, 7.8e-3f, 1),
-        Allpass(sample_rate, 14.2e-3f, -1),
-        Allpass(sample_rate, 23.5e-3f, 1),
-        Allpass(sample_rate, 8.0e-3f, -1),
-        Allpass(sample_rate, 25.8e-3f, 1),
-        Allpass(sample_rate, 7.2e-3f, -1)
+        Allpass(sample_rate, {{9.5e-3f, 7.8e-3f}}, 1),
+        Allpass(sample_rate, {{12.0e-3f, 14.2e-3f}}, -1),
+        Allpass(sample_rate, {{23.5e-3f, 25.8e-3f}}, 1),
+        Allpass(sample_rate, {{8.0e-3f, 7.2e-3f}}, -1)
     }},
 
-    m_early_delays {{
-        Delay(sample_rate, 5.45e-3),
-        Delay(sample_rate, 3.25e-3),
-        Delay(sample_rate, 2.36e-3),
-        Delay(sample_rate, 7.17e-3)
-    }},
+    m_early_delays(sample_rate, {{5.45e-3f, 3.25e-3f}}),
 
     m_late_variable_allpasses {{
-        VariableAllpass(sample_rate, 25.6e-3f, RandomLFO::k_max_amplitude, 1),
-        VariableAllpass(sample_rate, 50.7e-3f, RandomLFO::k_max_amplitude, -1),
-        VariableAllpass(sample_rate, 68.6e-3f, RandomLFO::k_max_amplitude, 1),
-        VariableAllpass(sample_rate, 45.7e-3f, RandomLFO::k_max_amplitude, -1)
+        VariableAllpass(sample_rate, {{25.6e-3f, 68.6e-3f}}, RandomLFO::k_max_amplitude, 1),
+        VariableAllpass(sample_rate, {{50.7e-3f, 45.7e-3f}}, RandomLFO::k_max_amplitude, -1)
     }},
 
     m_late_allpasses {{
-        Allpass(sample_rate, 41.4e-3f, -1),
-        Allpass(sample_rate, 25.6e-3f, 1),
-        Allpass(sample_rate, 29.4e-3f, -1),
-        Allpass(sample_rate, 23.6e-3f, 1)
+        Allpass(sample_rate, {{41.4e-3f, 29.4e-3f}}, -1),
+        Allpass(sample_rate, {{25.6e-3f, 23.6e-3f}}, 1)
     }},
 
     m_late_delays {{
-        Delay(sample_rate, k_delay_time_1),
-        Delay(sample_rate, k_delay_time_2),
-        Delay(sample_rate, k_delay_time_3),
-        Delay(sample_rate, k_delay_time_4)
+        Delay(sample_rate, {{k_delay_time_1, k_delay_time_3}}),
+        Delay(sample_rate, {{k_delay_time_2, k_delay_time_4}})
     }}
 
     {
@@ -719,10 +771,7 @@ public:
 
         Stereo out = process_outputs(early);
 
-        Stereo late = {{
-            process_late_left(early[0], lfo),
-            process_late_right(early[1], lfo)
-        }};
+        Stereo late = process_late(early, lfo);
         late = rotate(late, m_rotate_cos, m_rotate_sin);
         m_feedback = flush_denormals(late);
 
@@ -755,127 +804,112 @@ private:
     RandomLFO m_lfo;
     DCBlocker m_dc_blocker;
 
-    std::array<LowShelf, 4> m_low_shelves;
-    std::array<HiShelf, 4> m_hi_shelves;
+    std::array<LowShelf, 2> m_low_shelves;
+    std::array<HiShelf, 2> m_hi_shelves;
 
-    // NOTE: When adding new delay units, don't forget to allocate the memory
-    // in the constructor and free it in the destructor.
-    std::array<Allpass, 8> m_early_allpasses;
-    std::array<Delay, 4> m_early_delays;
+    // NOTE: When adding new delay units, don't forget to list them in
+    // for_each_delay_line so that they get their share of the arena.
+    std::array<Allpass, 4> m_early_allpasses;
+    Delay m_early_delays;
 
-    std::array<VariableAllpass, 4> m_late_variable_allpasses;
-    std::array<Allpass, 4> m_late_allpasses;
-    std::array<Delay, 4> m_late_delays;
+    std::array<VariableAllpass, 2> m_late_variable_allpasses;
+    std::array<Allpass, 2> m_late_allpasses;
+    std::array<Delay, 2> m_late_delays;
 
-    bool allocate_delay_lines() {
+    // All delay lines live in a single allocation, each of them starting on
+    // its own cache line.
+    static constexpr int k_cache_line_size = 64;
+    void* m_arena = nullptr;
+
+    template <class F>
+    void for_each_delay_line(F f) {
         for (auto& x : m_early_allpasses) {
-            bool success = allocate_delay_line(x);
-            if (!success) {
-                return false;
-            }
-        }
-        for (auto& x : m_early_delays) {
-            bool success = allocate_delay_line(x);
-            if (!success) {
-                return false;
-            }
+            f(x);
         }
+        f(m_early_delays);
         for (auto& x : m_late_variable_allpasses) {
-            bool success = allocate_delay_line(x);
-            if (!success) {
-                return false;
-            }
+            f(x);
         }
         for (auto& x : m_late_allpasses) {
-            bool success = allocate_delay_line(x);
-            if (!success) {
-                return false;
-            }
+            f(x);
         }
         for (auto& x : m_late_delays) {
-            bool success = allocate_delay_line(x);
-            if (!success) {
-                return false;
-            }
+            f(x);
         }
-        return true;
     }
 
-    void free_delay_lines() {
-        for (auto& x : m_early_allpasses) {
-            free_delay_line(x);
-        }
-        for (auto& x : m_early_delays) {
-            free_delay_line(x);
-        }
-        for (auto& x : m_late_variable_allpasses) {
-            free_delay_line(x);
-        }
-        for (auto& x : m_late_allpasses) {
-            free_delay_line(x);
-        }
-        for (auto& x : m_late_delays) {
-            free_delay_line(x);
-        }
+    static int padded_size(const BaseDelay& delay) {
+        int size = sizeof(float) * delay.buffer_size();
+        return (size + k_cache_line_size - 1) & ~(k_cache_line_size - 1);
     }
 
-    bool allocate_delay_line(BaseDelay& delay) {
-        void* memory = m_allocator->allocate(sizeof(float) * delay.m_size);
-        if (!memory) {
+    bool allocate_delay_lines() {
+        // The allocator makes no promise about alignment, so leave room to
+        // align the start of the arena ourselves.
+        int arena_size = k_cache_line_size;
+        for_each_delay_line([&](BaseDelay& delay) {
+            arena_size += padded_size(delay);
+        });
+
+        m_arena = m_allocator->allocate(arena_size);
+        if (!m_arena) {
             return false;
         }
-        delay.m_buffer = static_cast<float*>(memory);
-        memset(delay.m_buffer, 0, sizeof(float) * delay.m_size);
+        memset(m_arena, 0, arena_size);
+
+        uintptr_t address = reinterpret_cast<uintptr_t>(m_arena);
+        address = (address + k_cache_line_size - 1) & ~uintptr_t(k_cache_line_size - 1);
+        char* memory = reinterpret_cast<char*>(address);
+        for_each_delay_line([&](BaseDelay& delay) {
+            delay.m_buffer = reinterpret_cast<float*>(memory);
+            memory += padded_size(delay);
+        });
         return true;
     }
 
-    void free_delay_line(BaseDelay& delay) {
-        if (delay.m_buffer != nullptr) {
-            m_allocator->deallocate(delay.m_buffer);
+    void free_delay_lines() {
+        if (m_arena != nullptr) {
+            m_allocator->deallocate(m_arena);
         }
     }
 
     inline Stereo process_early(Stereo in) {
-        Stereo sig = {{in[0], in[1]}};
+        Stereo sig = in;
 
-        sig[0] = m_early_allpasses[0].process(sig[0]);
-        sig[0] = m_early_allpasses[1].process(sig[0]);
-        sig[1] = m_early_allpasses[2].process(sig[1]);
-        sig[1] = m_early_allpasses[3].process(sig[1]);
+        sig = m_early_allpasses[0].process(sig);
+        sig = m_early_allpasses[1].process(sig);
         sig = rotate(sig, m_rotate_cos, m_rotate_sin);
         Stereo early = sig;
 
-        sig[0] = m_early_delays[0].process(sig[0]);
-        sig[1] = m_early_delays[1].process(sig[1]);
+        sig = m_early_delays.process(sig);
 
-        sig[0] = m_early_allpasses[4].process(sig[0]);
-        sig[0] = m_early_allpasses[5].process(sig[0]);
-        sig[1] = m_early_allpasses[6].process(sig[1]);
-        sig[1] = m_early_allpasses[7].process(sig[1]);
+        sig = m_early_allpasses[2].process(sig);
+        sig = m_early_allpasses[3].process(sig);
         sig = rotate(sig, m_rotate_cos, m_rotate_sin);
-        early[0] += sig[0] * 0.5f;
-        early[1] += sig[1] * 0.5f;
+        early = early + sig * 0.5f;
 
         return early;
     }
 
-    inline float process_late_left(float early_left, Stereo lfo) {
-        float sig = 0.f;
+    inline Stereo process_late(Stereo early, Stereo lfo) {
+        Stereo sig = m_feedback;
 
-        sig += m_feedback[0];
+        // The LFO modulates the two channels in opposite directions.
+        Stereo offset_1 = {{-lfo[0], lfo[0]}};
+        Stereo offset_2 = {{-lfo[1], lfo[1]}};
 
-        sig += early_left;
-        sig = m_late_variable_allpasses[0].process(sig, -lfo[0]);
+        sig = sig + early;
+        sig = m_late_variable_allpasses[0].process(sig, offset_1);
         sig = m_late_allpasses[0].process(sig);
-        sig *= m_k;
+        sig = sig * m_k;
         sig = m_late_delays[0].process(sig);
         sig = m_low_shelves[0].process(sig);
         sig = m_hi_shelves[0].process(sig);
 
-        sig += early_left;
-        sig = m_late_variable_allpasses[1].process(sig, -lfo[1]);
+        sig = sig + early;
+        sig = m_late_variable_allpasses[1].process(sig, offset_2);
         sig = m_late_allpasses[1].process(sig);
-        sig *= m_k;
+        sig = sig * m_k;
         sig = m_late_delays[1].process(sig);
         sig = m_low_shelves[1].process(sig);
         sig = m_hi_shelves[1].process(sig);
@@ -883,30 +917,6 @@ private:
         return sig;
     }
 
-    inline float process_late_right(float early_right, Stereo lfo) {
-        float sig = 0.f;
-
-        sig += m_feedback[1];
-
-        sig += early_right;
-        sig = m_late_variable_allpasses[2].process(sig, lfo[0]);
-        sig = m_late_allpasses[2].process(sig);
-        sig *= m_k;
-        sig = m_late_delays[2].process(sig);
-        sig = m_low_shelves[2].process(sig);
-        sig = m_hi_shelves[2].process(sig);
-
-        sig += early_right;
-        sig = m_late_variable_allpasses[3].process(sig, lfo[1]);
-        sig = m_late_allpasses[3].process(sig);
-        sig *= m_k;
-        sig = m_late_delays[3].process(sig);
-        sig = m_low_shelves[3].process(sig);
-        sig = m_hi_shelves[3].process(sig);
-
-        return sig;
-    }
-
     inline Stereo process_outputs(Stereo early) {
         // Keep the inter-channel delays somewhere between 0.1 and 0.7 ms --
         // this allows the Haas effect to come in.
@@ -915,17 +925,17 @@ private:
 
         float haas_multiplier = -0.6f;
 
-        out[0] += m_late_delays[0].tap(0.0e-3f);
-        out[1] += m_late_delays[0].tap(0.3e-3f) * haas_multiplier;
+        out[0] += m_late_delays[0].tap(0, 0.0e-3f);
+        out[1] += m_late_delays[0].tap(0, 0.3e-3f) * haas_multiplier;
 
-        out[0] += m_late_delays[1].tap(0.0e-3f);
-        out[1] += m_late_delays[1].tap(0.1e-3f) * haas_multiplier;
+        out[0] += m_late_delays[1].tap(0, 0.0e-3f);
+        out[1] += m_late_delays[1].tap(0, 0.1e-3f) * haas_multiplier;
 
-        out[0] += m_late_delays[2].tap(0.7e-3f) * haas_multiplier;
-        out[1] += m_late_delays[2].tap(0.0e-3f);
+        out[0] += m_late_delays[0].tap(1, 0.7e-3f) * haas_multiplier;
+        out[1] += m_late_delays[0].tap(1, 0.0e-3f);
 
-        out[0] += m_late_delays[3].tap(0.2e-3f) * haas_multiplier;
-        out[1] += m_late_delays[3].tap(0.0e-3f);
+        out[0] += m_late_delays[1].tap(1, 0.2e-3f) * haas_multiplier;
+        out[1] += m_late_delays[1].tap(1, 0.0e-3f);
 
         return out;
     }
@@ -0,0 +1,352 @@
+/*
+ *
+ *    Copyright (C) 2013 Tim Blechmann
+ *
+ *    This program is free software; you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation; either version 2 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this program; if not, write to the Free Software
+ *    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef MAPPEDSOUNDFILE_HPP
+#define MAPPEDSOUNDFILE_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace nova {
+
+// read-only memory mapping of an uncompressed WAV, AIFF or AIFC file with 16, 24 or 32 bit integer or 32 bit float
+// samples. samples are converted to float with the same scaling as libsndfile.
+//
+// for any other file (and on windows) isValid() returns false, and the caller is expected to fall back to libsndfile.
+class MappedSoundFile
+{
+public:
+    explicit MappedSoundFile(const char * path)
+    {
+#ifndef _WIN32
+        int fd = ::open(path, O_RDONLY);
+        if (fd == -1)
+            return;
+
+        struct stat info;
+        if (::fstat(fd, &info) == 0 && info.st_size > 12) {
+            void * map = ::mmap(nullptr, info.st_size, PROT_READ, MAP_SHARED, fd, 0);
+            if (map != MAP_FAILED) {
+                map_     = static_cast<const unsigned char*>(map);
+                mapSize_ = info.st_size;
+            }
+        }
+        ::close(fd);
+
+        if (!map_)
+            return;
+
+        if (!parseWave() && !parseAiff()) {
+            unmap();
+            return;
+        }
+
+        // sequential streaming: let the kernel read ahead aggressively
+        ::madvise(const_cast<unsigned char*>(map_), mapSize_, MADV_SEQUENTIAL);
+#endif
+    }
+
+    ~MappedSoundFile()
+    {
+        unmap();
+    }
+
+    MappedSoundFile(MappedSoundFile const &) = delete;
+    MappedSoundFile & operator=(MappedSoundFile const &) = delete;
+
+    bool isValid() const
+    {
+        return data_ != nullptr;
+    }
+
+    int channels() const
+    {
+        return channels_;
+    }
+
+    int64_t frames() const
+    {
+        return frames_;
+    }
+
+    // read up to `frames` interleaved frames, returns the number of frames read
+    size_t readInterleaved(float * destination, int64_t position, size_t frames) const
+    {
+        frames = availableFrames(position, frames);
+        const unsigned char * source = data_ + position * frameSize_;
+
+        convert(destination, source, frames * channels_, 1);
+        return frames;
+    }
+
+    // read up to `frames` frames into one buffer per channel, starting at `sampleOffset`. returns the number of frames
+    // read
+    size_t readDeinterleaved(float ** destination, size_t sampleOffset, int64_t position, size_t frames) const
+    {
+        frames = availableFrames(position, frames);
+        const unsigned char * source = data_ + position * frameSize_;
+
+        for (int channel = 0; channel != channels_; ++channel)
+            convert(destination[channel] + sampleOffset, source + channel * sampleSize_, frames, channels_);
+        return frames;
+    }
+
+private:
+    enum SampleType {
+        Int16,
+        Int24,
+        Int32,
+        Float32
+    };
+
+    size_t availableFrames(int64_t position, size_t frames) const
+    {
+        if (position < 0 || position >= frames_)
+            return 0;
+        return (size_t)std::min<int64_t>(frames, frames_ - position);
+    }
+
+    // convert `count` samples, `stride` samples apart in the source
+    void convert(float * destination, const unsigned char * source, size_t count, int stride) const
+    {
+        switch (sampleType_) {
+        case Int16:
+            if (bigEndian_)
+                return convertSamples<Int16, true>(destination, source, count, stride);
+            return convertSamples<Int16, false>(destination, source, count, stride);
+
+        case Int24:
+            if (bigEndian_)
+                return convertSamples<Int24, true>(destination, source, count, stride);
+            return convertSamples<Int24, false>(destination, source, count, stride);
+
+        case Int32:
+            if (bigEndian_)
+                return convertSamples<Int32, true>(destination, source, count, stride);
+            return convertSamples<Int32, false>(destination, source, count, stride);
+
+        case Float32:
+            if (bigEndian_)
+                return convertSamples<Float32, true>(destination, source, count, stride);
+            return convertSamples<Float32, false>(destination, source, count, stride);
+        }
+    }
+
+    template <SampleType Type, bool BigEndian>
+    static void convertSamples(float * destination, const unsigned char * source, size_t count, int stride)
+    {
+        const size_t step = stride * bytesPerSample(Type);
+        for (size_t i = 0; i != count; ++i) {
+            destination[i] = loadSample<Type, BigEndian>(source);
+            source += step;
+        }
+    }
+
+    static size_t bytesPerSample(SampleType type)
+    {
+        switch (type) {
+        case Int16:   return 2;
+        case Int24:   return 3;
+        default:      return 4;
+        }
+    }
+
+    template <bool BigEndian>
+    static uint32_t load(const unsigned char * p, int bytes)
+    {
+        uint32_t ret = 0;
+        for (int i = 0; i != bytes; ++i)
+            ret |= uint32_t(p[BigEndian ? i : bytes - 1 - i]) << (8 * (bytes - 1 - i));
+        return ret;
+    }
+
+    template <SampleType Type, bool BigEndian>
+    static float loadSample(const unsigned char * p)
+    {
+        switch (Type) {
+        case Int16:
+            return int16_t(load<BigEndian>(p, 2)) * (1.f / 32768.f);
+
+        case Int24:
+            // sign extend through the upper byte
+            return int32_t(load<BigEndian>(p, 3) << 8) * (1.f / 2147483648.f);
+
+        case Int32:
+            return int32_t(load<BigEndian>(p, 4)) * (1.f / 2147483648.f);
+
+        case Float32:
+        default: {
+            uint32_t bits = load<BigEndian>(p, 4);
+            float ret;
+            std::memcpy(&ret, &bits, sizeof(float));
+            return ret;
+        }
+        }
+    }
+
+    bool setFormat(int channels, int bits, bool isFloat, bool bigEndian, const unsigned char * data, uint64_t dataSize)
+    {
+        if (channels <= 0)
+            return false;
+
+        if (isFloat && bits == 32)
+            sampleType_ = Float32;
+        else if (!isFloat && bits == 16)
+            sampleType_ = Int16;
+        else if (!isFloat && bits == 24)
+            sampleType_ = Int24;
+        else if (!isFloat && bits == 32)
+            sampleType_ = Int32;
+        else
+            return false;
+
+        const uint64_t available = map_ + mapSize_ - data;
+        dataSize = std::min(dataSize, available);
+
+        channels_   = channels;
+        bigEndian_  = bigEndian;
+        sampleSize_ = bytesPerSample(sampleType_);
+        frameSize_  = sampleSize_ * channels;
+        frames_     = dataSize / frameSize_;
+        data_       = data;
+        return true;
+    }
+
+    // finds the chunk `id` of a RIFF or IFF file, starting at `chunk`
+    template <bool BigEndian>
+    const unsigned char * findChunk(const unsigned char * chunk, const char * id, uint64_t & size) const
+    {
+        const unsigned char * end = map_ + mapSize_;
+        while (chunk + 8 <= end) {
+            size = load<BigEndian>(chunk + 4, 4);
+            if (std::memcmp(chunk, id, 4) == 0)
+                return chunk + 8;
+            chunk += 8 + size + (size & 1);
+        }
+        return nullptr;
+    }
+
+    bool parseWave()
+    {
+        if (std::memcmp(map_, "RIFF", 4) != 0 || std::memcmp(map_ + 8, "WAVE", 4) != 0)
+            return false;
+
+        uint64_t formatSize, dataSize;
+        const unsigned char * format = findChunk<false>(map_ + 12, "fmt ", formatSize);
+        const unsigned char * data   = findChunk<false>(map_ + 12, "data", dataSize);
+        if (!format || !data || formatSize < 16 || format + 16 > map_ + mapSize_)
+            return false;
+
+        uint32_t formatTag = load<false>(format, 2);
+        const int channels = load<false>(format + 2, 2);
+        const int bits     = load<false>(format + 14, 2);
+
+        const uint32_t WaveFormatPcm        = 1;
+        const uint32_t WaveFormatFloat      = 3;
+        const uint32_t WaveFormatExtensible = 0xfffe;
+
+        // the subformat guid starts with the format tag
+        if (formatTag == WaveFormatExtensible) {
+            if (formatSize < 40 || format + 26 > map_ + mapSize_)
+                return false;
+            formatTag = load<false>(format + 24, 2);
+        }
+
+        if (formatTag != WaveFormatPcm && formatTag != WaveFormatFloat)
+            return false;
+
+        return setFormat(channels, bits, formatTag == WaveFormatFloat, false, data, dataSize);
+    }
+
+    bool parseAiff()
+    {
+        if (std::memcmp(map_, "FORM", 4) != 0)
+            return false;
+
+        const bool isAifc = std::memcmp(map_ + 8, "AIFC", 4) == 0;
+        if (!isAifc && std::memcmp(map_ + 8, "AIFF", 4) != 0)
+            return false;
+
+        uint64_t commonSize, soundSize;
+        const unsigned char * common = findChunk<true>(map_ + 12, "COMM", commonSize);
+        const unsigned char * sound  = findChunk<true>(map_ + 12, "SSND", soundSize);
+        if (!common || !sound || commonSize < 18 || soundSize < 8 || common + 18 > map_ + mapSize_)
+            return false;
+
+        const int      channels = int16_t(load<true>(common, 2));
+        const uint64_t frames   = load<true>(common + 2, 4);
+        const int      bits     = int16_t(load<true>(common + 6, 2));
+
+        bool isFloat   = false;
+        bool bigEndian = true;
+        if (isAifc) {
+            if (commonSize < 22 || common + 22 > map_ + mapSize_)
+                return false;
+            const unsigned char * compression = common + 18;
+            if (std::memcmp(compression, "sowt", 4) == 0)
+                bigEndian = false;
+            else if (std::memcmp(compression, "fl32", 4) == 0 || std::memcmp(compression, "FL32", 4) == 0)
+                isFloat = true;
+            else if (std::memcmp(compression, "NONE", 4) != 0)
+                return false;
+        }
+
+        const uint32_t offset = load<true>(sound, 4);
+        const unsigned char * data = sound + 8 + offset;
+        if (data > map_ + mapSize_)
+            return false;
+
+        const uint64_t dataSize = std::min<uint64_t>(soundSize - 8 - std::min<uint64_t>(offset, soundSize - 8),
+                                                     frames * channels * ((bits + 7) / 8));
+        return setFormat(channels, bits, isFloat, bigEndian, data, dataSize);
+    }
+
+    void unmap()
+    {
+#ifndef _WIN32
+        if (map_)
+            ::munmap(const_cast<unsigned char*>(map_), mapSize_);
+#endif
+        map_  = nullptr;
+        data_ = nullptr;
+    }
+
+    const unsigned char * map_  = nullptr;
+    size_t                mapSize_ = 0;
+
+    const unsigned char * data_ = nullptr;
+    int64_t               frames_ = 0;
+    int                   channels_ = 0;
+    size_t                sampleSize_ = 0;
+    size_t                frameSize_ = 0;
+    SampleType            sampleType_ = Float32;
+    bool                  bigEndian_ = false;
+};
+
+}
+
+#endif // MAPPEDSOUNDFILE_HPP
@@ -24,14 +24,20 @@
 
 #include "tlsf_allocator.hpp"
 
+#include <algorithm>
 #include <array>
 #include <atomic>
+#include <condition_variable>
+#include <limits>
 #include <map>
+#include <mutex>
+#include <set>
 #include <thread>
 #include <scoped_allocator>
 
 #define BOOST_ERROR_CODE_HEADER_ONLY
 
+#include "MappedSoundFile.hpp"
 #include "NovaUtils.hpp"
 
 #include <boost/intrusive/set.hpp>
@@ -48,243 +54,340 @@ namespace intrusive = boost::intrusive;
 
 namespace {
 
+// records each file through a ring buffer sized from its channel count and the buffer duration of the unit. the
+// units write interleaved frames into the rings, a pool of disk threads writes them to the files. the rt side never
+// blocks: if a ring is full, the frames are dropped and counted
+//
+// the files are distributed over the threads by their ticket. a thread only writes once a file has CoalesceBytes in
+// its ring (or when the file is closed), so each file is written in few large writes
 struct DiskOutThread
 {
-    typedef enum {
-        OpenFile,
-        WriteFrames,
-        CloseFile
-    } CmdType;
-
-    static const int PayloadSize = 1024 * 64 * sizeof(float); // pessimize: 64 channels, 1024 samples
-
-    struct Cmd
-    {
-        CmdType cmd;
-        int ticket;
-        int channels;
-        int frames;
-        int samplerate;
-        char payload[PayloadSize];
+    static const int MaxFiles        = 256;
+    static const int MaxPathLength   = 4096;
+    static const int MinBufferFrames = 4096;
+    static const int CoalesceBytes   = 256 * 1024;
+    static const int MaxThreads      = 4;
+
+    enum HeaderFormat {
+        CAF,
+        WAV,
+        W64,
+        AIFF,
+        RF64
     };
 
-    const int NumberOfElements = 256;
+    enum SampleFormat {
+        Float,
+        Int16,
+        Int24,
+        Int32
+    };
 
-    DiskOutThread():
-        mQueue(NumberOfElements),
-        mPool(NumberOfElements + 8)
+    struct Recording
+    {
+        enum State {
+            Free,
+            Claimed,    // rt: being set up by the unit
+            Requested,  // waiting for the disk thread to allocate the ring
+            Open        // the ring can be written
+        };
+
+        std::atomic_int  state;
+        std::atomic_bool closeRequested;
+
+        // set up by the unit, before the recording is requested
+        int    channels;
+        int    samplerate;
+        int    format;         // libsndfile format
+        size_t capacity;       // in frames
+        size_t coalesceFrames; // frames per write
+        char   path[MaxPathLength];
+
+        float *               ring; // interleaved, published by the Open state
+        std::atomic<uint64_t> writePosition;
+        std::atomic<uint64_t> readPosition;
+
+        uint64_t lastWakeup;    // rt
+        uint64_t droppedFrames; // rt, read by the disk thread after the close request
+
+        SNDFILE * handle;       // nrt
+    };
+
+    struct Writer
+    {
+        std::thread            thread;
+        boost::sync::semaphore semaphore;
+    };
+
+    explicit DiskOutThread(int numberOfThreads = std::thread::hardware_concurrency()):
+        mRecordings(new Recording[MaxFiles]),
+        mNumWriters(std::min(std::max(numberOfThreads, 1), (int)MaxThreads)),
+        mWriters(new Writer[mNumWriters])
     {
         using namespace std;
 
-        loop(NumberOfElements, [&](){
-            Cmd * cmd = new Cmd();
-            memset(cmd, 0, sizeof(Cmd));
-            mPool.push( cmd );
-        });
+        for (int i = 0; i != MaxFiles; ++i) {
+            mRecordings[i].state          = Recording::Free;
+            mRecordings[i].closeRequested = false;
+            mRecordings[i].ring           = nullptr;
+            mRecordings[i].handle         = nullptr;
+        }
 
         mRunning = true;
-        mThread = move(thread(bind(&DiskOutThread::cmdLoop, this)));
+        for (int i = 0; i != mNumWriters; ++i)
+            mWriters[i].thread = move(thread(bind(&DiskOutThread::cmdLoop, this, i)));
     }
 
     ~DiskOutThread()
     {
         mRunning = false;
 
-        mSemaphore.post();
-        mThread.join();
-
-        for(;;) {
-            Cmd * cmd;
-            bool success = mPool.pop(cmd);
-            if (!success)
-                break;
-            delete cmd;
+        for (int i = 0; i != mNumWriters; ++i) {
+            mWriters[i].semaphore.post();
+            mWriters[i].thread.join();
         }
 
-        for (auto elem : mSndfileMap) {
-            SNDFILE * handle = elem.second;
-            sf_close(handle);
+        for (int i = 0; i != MaxFiles; ++i) {
+            Recording & recording = mRecordings[i];
+            if (recording.state == Recording::Requested)
+                openRecording(recording);
+
+            if (recording.state == Recording::Open) {
+                writeFrames(recording, true);
+                closeRecording(recording);
+            }
         }
     }
 
-    int openFile(const char * fileName, int channels, int samplingRate)
+    // rt: returns the ticket of the file, or -1
+    int openFile(const char * fileName, int channels, int samplingRate, float bufferDuration,
+                 HeaderFormat headerFormat = CAF, SampleFormat sampleFormat = Float)
     {
-        int ret = mTicket.fetch_add(1);
-
-        Cmd * cmd = allocateCmd(OpenFile, ret);
-        if (!cmd)
+        if (strlen(fileName) >= MaxPathLength)
             return -1;
 
-        cmd->channels   = channels;
-        cmd->samplerate = samplingRate;
-        strcpy(cmd->payload, fileName);
+        for (int i = 0; i != MaxFiles; ++i) {
+            const int ticket = (mNextTicket + i) % MaxFiles;
+            Recording & recording = mRecordings[ticket];
 
-        pushCommand(cmd);
+            int expected = Recording::Free;
+            if (!recording.state.compare_exchange_strong(expected, Recording::Claimed))
+                continue;
 
-        return ret;
-    }
+            mNextTicket = ticket + 1;
 
-    template <typename Functor>
-    bool pushFrames(int ticket, Functor const & fillCmdStruct)
-    {
-        Cmd * cmd = allocateCmd(WriteFrames, ticket);
-        if (!cmd)
-            return false;
+            recording.channels   = channels;
+            recording.samplerate = samplingRate;
+            recording.format     = soundFileFormat(headerFormat, sampleFormat);
+            recording.capacity   = std::max<size_t>(size_t(bufferDuration * samplingRate), MinBufferFrames);
+            strcpy(recording.path, fileName);
 
-        fillCmdStruct(cmd);
+            // a write must never need more than half of the ring
+            const size_t bytesPerFrame = channels * sizeof(float);
+            recording.coalesceFrames = std::max<size_t>(std::min<size_t>(CoalesceBytes / bytesPerFrame,
+                                                                         recording.capacity / 2), 1);
 
-        pushCommand(cmd);
+            recording.writePosition = 0;
+            recording.readPosition  = 0;
+            recording.lastWakeup    = 0;
+            recording.droppedFrames = 0;
 
-        return true;
+            recording.state.store(Recording::Requested, std::memory_order_release);
+            wakeWriter(ticket);
+            return ticket;
+        }
+
+        return -1;
     }
 
-    bool closeFile(int ticket)
+    // rt: true once frames can be pushed
+    bool isOpen(int ticket) const
     {
-        Cmd * cmd = allocateCmd(CloseFile, ticket);
-        if (!cmd)
-            return false;
+        return mRecordings[ticket].state.load(std::memory_order_acquire) == Recording::Open;
+    }
 
-        pushCommand(cmd);
+    // rt: interleave `frames` frames from one buffer per channel into the ring. returns the number of frames written,
+    // the remaining frames are dropped
+    size_t pushFrames(int ticket, const float * const * input, size_t frames)
+    {
+        Recording & recording = mRecordings[ticket];
+        const int channels = recording.channels;
 
-        return true;
+        return writeToRing(recording, frames, [&](float * destination, size_t sourceFrame, size_t count) {
+            for (size_t frame = 0; frame != count; ++frame)
+                for (int channel = 0; channel != channels; ++channel)
+                    *destination++ = input[channel][sourceFrame + frame];
+        });
     }
 
-    void cmdLoop()
+    // rt: like pushFrames, for interleaved frames
+    size_t pushInterleaved(int ticket, const float * input, size_t frames)
     {
-        while (mRunning) {
-            mSemaphore.wait();
-            processQueueEvent();
-        }
+        Recording & recording = mRecordings[ticket];
+        const int channels = recording.channels;
 
-        while (processQueueEvent()) {
-            // nop
-        }
+        return writeToRing(recording, frames, [&](float * destination, size_t sourceFrame, size_t count) {
+            memcpy(destination, input + sourceFrame * channels, count * channels * sizeof(float));
+        });
     }
 
-private:
-    void pushCommand( Cmd * cmd )
+    // rt
+    void dropFrames(int ticket, size_t frames)
     {
-        bool warningPosted = false;
-        for (int attempts = 0; ; ++attempts) {
-            bool success = mQueue.push(cmd);
-            if (success)
-                break;
+        mRecordings[ticket].droppedFrames += frames;
+    }
 
-            if (attempts < 256)
-                continue;
+    // rt
+    void closeFile(int ticket)
+    {
+        mRecordings[ticket].closeRequested.store(true, std::memory_order_release);
+        wakeWriter(ticket);
+    }
 
-            if (!warningPosted)
-                printf("DiskOutThread: warning - cannot push command to queue\n");
+    void cmdLoop(int writerIndex)
+    {
+        Writer & writer = mWriters[writerIndex];
 
-            // no rt-safe!
-            if (attempts < 2048)
-                std::this_thread::yield();
-            else
-                std::this_thread::sleep_for( std::chrono::milliseconds(10) );
+        while (mRunning) {
+            writer.semaphore.wait();
+
+            for (int i = writerIndex; i < MaxFiles; i += mNumWriters)
+                serviceRecording(mRecordings[i]);
         }
-        mSemaphore.post();
     }
 
-    Cmd * allocateCmd(CmdType cmdType, int ticket)
+private:
+    static int soundFileFormat(HeaderFormat headerFormat, SampleFormat sampleFormat)
     {
-        Cmd * cmd;
-        bool warningPosted = false;
-        for (int attempts = 0; ; ++attempts) {
-            bool success = mPool.pop(cmd);
-            if (success)
-               break;
+        int format;
+        switch (headerFormat) {
+        case WAV:  format = SF_FORMAT_WAV;  break;
+        case W64:  format = SF_FORMAT_W64;  break;
+        case AIFF: format = SF_FORMAT_AIFF; break;
+        case RF64: format = SF_FORMAT_RF64; break;
+        case CAF:
+        default:   format = SF_FORMAT_CAF;  break;
+        }
 
-            if (attempts < 256)
-                continue;
+        switch (sampleFormat) {
+        case Int16: return format | SF_FORMAT_PCM_16;
+        case Int24: return format | SF_FORMAT_PCM_24;
+        case Int32: return format | SF_FORMAT_PCM_32;
+        case Float:
+        default:    return format | SF_FORMAT_FLOAT;
+        }
+    }
 
-            if (!warningPosted)
-                printf("DiskOutThread: warning - cannot allocate command struct\n");
+    void wakeWriter(int ticket)
+    {
+        mWriters[ticket % mNumWriters].semaphore.post();
+    }
 
-            if (attempts < 2048)
-                std::this_thread::yield();
-            else
-                std::this_thread::sleep_for( std::chrono::milliseconds(10) );
+    template <typename CopyFunctor>
+    size_t writeToRing(Recording & recording, size_t frames, CopyFunctor const & copyFrames)
+    {
+        const uint64_t writePosition = recording.writePosition.load(std::memory_order_relaxed);
+        const uint64_t readPosition  = recording.readPosition.load(std::memory_order_acquire);
+        const size_t   capacity      = recording.capacity;
+
+        const size_t framesToWrite = std::min<size_t>(frames, capacity - (writePosition - readPosition));
+        const size_t offset        = writePosition % capacity;
+        const size_t firstPart     = std::min(framesToWrite, capacity - offset);
+
+        copyFrames(recording.ring + offset * recording.channels, 0, firstPart);
+        if (firstPart != framesToWrite)
+            copyFrames(recording.ring, firstPart, framesToWrite - firstPart);
+
+        recording.writePosition.store(writePosition + framesToWrite, std::memory_order_release);
+        recording.droppedFrames += frames - framesToWrite;
+
+        // wake the disk thread when there is enough to write, or when the ring is full
+        const uint64_t written = writePosition + framesToWrite;
+        if (written - recording.lastWakeup >= recording.coalesceFrames || framesToWrite != frames) {
+            recording.lastWakeup = written;
+            wakeWriter(&recording - mRecordings.get());
         }
 
-        cmd->cmd    = cmdType;
-        cmd->ticket = ticket;
-        return cmd;
+        return framesToWrite;
     }
 
-    bool processQueueEvent()
+    void serviceRecording(Recording & recording)
     {
-        Cmd * cmd;
-        bool success = mQueue.pop(cmd);
+        const int state = recording.state.load(std::memory_order_acquire);
+        if (state == Recording::Requested)
+            openRecording(recording);
+        else if (state != Recording::Open)
+            return;
 
-        if (success) {
-            switch (cmd->cmd) {
-            case OpenFile:
-            {
-                SF_INFO info;
-                info.samplerate = cmd->samplerate;
-                info.channels = cmd->channels;
-                info.format   = SF_FORMAT_CAF | SF_FORMAT_FLOAT;
+        const bool closeRequested = recording.closeRequested.load(std::memory_order_acquire);
 
-                SNDFILE * handle = sf_open(cmd->payload, SFM_WRITE, &info);
-                if (!handle) {
-                    printf("could not open file: %s %s\n", cmd->payload, sf_error_number(sf_error(handle)));
-                    break;
-                }
+        writeFrames(recording, closeRequested);
 
-                mSndfileMap.insert(std::make_pair(cmd->ticket, handle));
-                break;
-            }
+        if (closeRequested)
+            closeRecording(recording);
+    }
 
-            case CloseFile:
-            {
-                SNDFILE * handle = mSndfileMap[cmd->ticket];
-                sf_close(handle);
-                mSndfileMap.erase(cmd->ticket);
-                break;
-            }
+    void openRecording(Recording & recording)
+    {
+        // the ring is published before the file is opened, so the unit can write as early as possible
+        recording.ring = new float[recording.capacity * recording.channels];
+        recording.state.store(Recording::Open, std::memory_order_release);
+
+        SF_INFO info;
+        info.samplerate = recording.samplerate;
+        info.channels   = recording.channels;
+        info.format     = recording.format;
+
+        recording.handle = sf_open(recording.path, SFM_WRITE, &info);
+        if (!recording.handle)
+            printf("could not open file: %s %s\n", recording.path, sf_error_number(sf_error(recording.handle)));
+    }
 
-            case WriteFrames:
-            {
-                interleave(cmd->channels, cmd->frames, (float*)cmd->payload, mScratchpad.data());
+    // write the frames in the ring to the file, once at least coalesceFrames are available or when flushing
+    void writeFrames(Recording & recording, bool flush)
+    {
+        const uint64_t writePosition = recording.writePosition.load(std::memory_order_acquire);
+        uint64_t       readPosition  = recording.readPosition.load(std::memory_order_relaxed);
 
-                SNDFILE * handle = mSndfileMap[cmd->ticket];
-                int written = sf_writef_float(handle, mScratchpad.data(), cmd->frames);
+        if (!flush && writePosition - readPosition < recording.coalesceFrames)
+            return;
 
-                break;
-            }
+        while (readPosition != writePosition) {
+            const size_t offset = readPosition % recording.capacity;
+            const size_t frames = std::min<uint64_t>(writePosition - readPosition, recording.capacity - offset);
 
-            default:
-                assert(false);
-            }
+            if (recording.handle)
+                sf_writef_float(recording.handle, recording.ring + offset * recording.channels, frames);
 
-            bool pushSuccessful = mPool.push(cmd);
-            assert(pushSuccessful);
-            return true;
-        } else
-            return false;
+            readPosition += frames;
+            recording.readPosition.store(readPosition, std::memory_order_release);
+        }
     }
 
-    static void interleave(int channels, int frames, const float * source, float * destination)
+    void closeRecording(Recording & recording)
     {
-        nova::loop(frames, [&](int frame) {
-            nova::loop(channels, [&](int channel) {
-                destination[frame * channels + channel] = source[channel * frames + frame];
-            });
-        });
-    }
+        if (recording.handle) {
+            sf_close(recording.handle);
+            recording.handle = nullptr;
+        }
 
-    std::thread mThread;
-    std::atomic_bool mRunning;
+        if (recording.droppedFrames)
+            printf("DiskOutThread: warning - %llu frames dropped writing %s\n",
+                   (unsigned long long)recording.droppedFrames, recording.path);
 
-    boost::lockfree::queue<Cmd*> mQueue;
-    boost::lockfree::stack<Cmd*> mPool;
+        delete[] recording.ring;
+        recording.ring = nullptr;
 
-    boost::sync::semaphore mSemaphore;
+        recording.closeRequested = false;
+        recording.state.store(Recording::Free, std::memory_order_release);
+    }
 
-    std::atomic_int mTicket;
+    std::atomic_bool mRunning;
 
-    std::map<int, SNDFILE*> mSndfileMap;
-    std::array<float, PayloadSize> mScratchpad;
+    std::unique_ptr<Recording[]> mRecordings;
+    const int                    mNumWriters;
+    std::unique_ptr<Writer[]>    mWriters;
+    std::atomic_int mNextTicket {0}; // rt, a hint
 };
 
 std::unique_ptr<DiskOutThread> gThread;
@@ -295,7 +398,10 @@ struct NovaDiskOut:
     public SCUnit
 {
 public:
-    NovaDiskOut()
+    static const int StagingFrames = 8192;
+
+    NovaDiskOut():
+        mStaging(nullptr), mStagedFrames(0)
     {
         mChannelCount = in0(0);
 
@@ -309,52 +415,156 @@ public:
         });
         path[pathSize] = 0;
 
-        mTicket = gThread->openFile(path, mChannelCount, (int)sampleRate());
+        // older synthdefs have no buffer duration
+        const int indexOfBufferDuration = indexOfPathStart + pathSize;
+        const float bufferDuration = indexOfBufferDuration < (int)mNumInputs ? in0(indexOfBufferDuration) : 2.f;
+
+        const int indexOfHeaderFormat = indexOfBufferDuration + 1;
+        const int indexOfSampleFormat = indexOfBufferDuration + 2;
+        const int headerFormat = indexOfHeaderFormat < (int)mNumInputs ? (int)in0(indexOfHeaderFormat) : 0;
+        const int sampleFormat = indexOfSampleFormat < (int)mNumInputs ? (int)in0(indexOfSampleFormat) : 0;
+
+        mTicket = gThread->openFile(path, mChannelCount, (int)sampleRate(), bufferDuration,
+                                    (DiskOutThread::HeaderFormat)headerFormat,
+                                    (DiskOutThread::SampleFormat)sampleFormat);
         if (mTicket == -1) {
             Print("Cannot open file %s\n", path);
             mCalcFunc = ft->fClearUnitOutputs;
             return;
         }
 
+        // frames are staged until the disk thread has allocated the ring
+        mStaging = (float*)RTAlloc(mWorld, StagingFrames * mChannelCount * sizeof(float));
+
         mCalcFunc = make_calc_function<NovaDiskOut, &NovaDiskOut::next>();
     }
 
     ~NovaDiskOut()
     {
+        if (mTicket == -1)
+            return;
+
+        if (mStaging) {
+            if (gThread->isOpen(mTicket))
+                flushStaging();
+            else
+                gThread->dropFrames(mTicket, mStagedFrames);
+            RTFree(mWorld, mStaging);
+        }
+
         gThread->closeFile(mTicket);
     }
 
 private:
     void next(int inNumSamples)
     {
-        gThread->pushFrames(mTicket, [&](DiskOutThread::Cmd * cmd) {
-            cmd->frames   = inNumSamples;
-            cmd->channels = mChannelCount;
+        if (mStaging) {
+            if (!gThread->isOpen(mTicket)) {
+                stageFrames(inNumSamples);
+                return;
+            }
 
-            nova::loop(mChannelCount, [&](int channel) {
-                const float * data = in(1 + channel);
-                float * cmdData    = (float*)cmd->payload + channel * inNumSamples;
+            flushStaging();
+            RTFree(mWorld, mStaging);
+            mStaging = nullptr;
+        }
 
-                memcpy(cmdData, data, inNumSamples * sizeof(float));
-            });
-        });
+        if (!gThread->isOpen(mTicket)) {
+            gThread->dropFrames(mTicket, inNumSamples);
+            return;
+        }
+
+        gThread->pushFrames(mTicket, mInBuf + 1, inNumSamples);
+    }
+
+    void stageFrames(int inNumSamples)
+    {
+        const int frames = std::min(inNumSamples, StagingFrames - mStagedFrames);
+        float * staging  = mStaging + mStagedFrames * mChannelCount;
+
+        for (int frame = 0; frame != frames; ++frame)
+            for (int channel = 0; channel != mChannelCount; ++channel)
+                *staging++ = in(1 + channel)[frame];
+
+        mStagedFrames += frames;
+        gThread->dropFrames(mTicket, inNumSamples - frames);
+    }
+
+    void flushStaging()
+    {
+        gThread->pushInterleaved(mTicket, mStaging, mStagedFrames);
+        mStagedFrames = 0;
     }
 
     int mChannelCount;
     int mTicket;
+    float * mStaging;
+    int mStagedFrames;
 };
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+
 namespace {
 
-static const size_t framesPerChunk = 65536; // power of 2!
-static const size_t chunksBefore   = 16;
-static const size_t chunksAfter    = 32;
-static const size_t chunksAhead    = 16;
+static const size_t framesPerChunk   = 65536; // power of 2!
+static const size_t chunksBefore     = 16;
+static const size_t chunksAfter      = 32;
+static const size_t defaultLookahead = 16 * framesPerChunk;
+static const size_t maxLookahead     = 256 * framesPerChunk;
+static const int    readerThreads    = 4;
 
 typedef std::int64_t position_t;
 
+// reads uncompressed wav/aiff files from a memory mapping, everything else through libsndfile
+class SoundFileReader
+{
+public:
+    explicit SoundFileReader(std::string const & filename):
+        mapped(filename.c_str())
+    {
+        if (!mapped.isValid())
+            sf = SndfileHandle(filename.c_str(), SFM_READ);
+    }
+
+    int channels() const
+    {
+        return mapped.isValid() ? mapped.channels() : sf.channels();
+    }
+
+    // the length of the file, or the maximum position if it is unknown
+    position_t frames() const
+    {
+        const position_t frames = mapped.isValid() ? mapped.frames() : sf.frames();
+        return frames > 0 ? frames : std::numeric_limits<position_t>::max();
+    }
+
+    bool isMapped() const
+    {
+        return mapped.isValid();
+    }
+
+    size_t readInterleaved(float * destination, position_t position, size_t frames)
+    {
+        if (mapped.isValid())
+            return mapped.readInterleaved(destination, position, frames);
+
+        sf.seek(position, SEEK_SET);
+        return sf.readf(destination, frames);
+    }
+
+    // only valid for mapped files
+    size_t readDeinterleaved(float ** destination, size_t sampleOffset, position_t position, size_t frames)
+    {
+        assert(mapped.isValid());
+        return mapped.readDeinterleaved(destination, sampleOffset, position, frames);
+    }
+
+private:
+    nova::MappedSoundFile mapped;
+    SndfileHandle         sf;
+};
+
 struct Chunk:
     public intrusive::set_base_hook<>
 {
@@ -364,9 +574,9 @@ struct Chunk:
         data_.resize(frames * channels, 0.f);
     }
 
-    void read(SndfileHandle & sndfile, position_t currentPosition)
+    void read(SoundFileReader & file, position_t currentPosition)
     {
-        size_t numberOfFrames = sndfile.readf(data_.data(), framesPerChunk);
+        size_t numberOfFrames = file.readInterleaved(data_.data(), currentPosition, framesPerChunk);
         startFrame_ = currentPosition;
         frames_     = numberOfFrames;
     }
@@ -399,52 +609,190 @@ struct CompareChunkWithPosition
     }
 };
 
+class PlaybackQueue;
+
+// reads the chunks requested by the playback queues of all open files. requests are served in the order of their
+// deadline, the time at which the playhead reaches the chunk, so the files which are closest to an underrun are
+// served first.
+class ReadScheduler
+{
+public:
+    ReadScheduler():
+        terminate(false), busy(readerThreads, nullptr)
+    {}
+
+    ~ReadScheduler()
+    {
+        stop();
+    }
+
+    // nrt: the threads are started with the first queue, not when the plugin is loaded
+    void start()
+    {
+        if (!threads.empty())
+            return;
+
+        for (int i = 0; i != readerThreads; ++i)
+            threads.emplace_back([this, i]() {
+                this->readerLoop(i);
+            });
+    }
+
+    void stop()
+    {
+        if (threads.empty())
+            return;
+
+        terminate = true;
+        for (std::thread & thread : threads) {
+            (void)thread;
+            semaphore.post();
+        }
+        for (std::thread & thread : threads)
+            thread.join();
+        threads.clear();
+    }
+
+    // rt: `deadline` is in frames of the server clock
+    bool post(PlaybackQueue * queue, position_t position, position_t deadline)
+    {
+        Request request = { queue, position, deadline };
+        if (!requests.push(request))
+            return false;
+
+        semaphore.post();
+        return true;
+    }
+
+    // nrt: drop the pending requests of a queue, and wait until no thread is reading for it
+    void cancel(PlaybackQueue * queue)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        collectRequests();
+
+        for (auto it = pending.begin(); it != pending.end();) {
+            if (it->queue == queue)
+                it = pending.erase(it);
+            else
+                ++it;
+        }
+
+        idle.wait(lock, [&]() {
+            return std::find(busy.begin(), busy.end(), queue) == busy.end();
+        });
+    }
+
+private:
+    struct Request
+    {
+        PlaybackQueue * queue;
+        position_t      position;
+        position_t      deadline;
+
+        bool operator<(Request const & rhs) const
+        {
+            return deadline < rhs.deadline;
+        }
+    };
+
+    // called with the mutex locked
+    void collectRequests()
+    {
+        requests.consume_all([&](Request const & request) {
+            pending.insert(request);
+        });
+    }
+
+    void readerLoop(int index);
+
+    typedef boost::lockfree::queue<Request, boost::lockfree::capacity<4096>> RequestQueue;
+
+    RequestQueue           requests; // rt -> nrt
+    boost::sync::semaphore semaphore;
+    std::atomic_bool       terminate;
+
+    std::mutex                   mutex;
+    std::condition_variable      idle;
+    std::multiset<Request>       pending;
+    std::vector<PlaybackQueue*>  busy;  // the queue each thread is reading for
+    std::vector<std::thread>     threads;
+};
+
+ReadScheduler gReadScheduler;
+
+// read-ahead telemetry of a playback queue, in frames. only accessed from the rt thread
+struct PlaybackStatistics
+{
+    PlaybackStatistics(position_t lookahead)
+    {
+        reset(lookahead);
+    }
+
+    void reset(position_t lookahead)
+    {
+        misses           = 0;
+        zeroFilledFrames = 0;
+        lead             = lookahead;
+        worstLead        = lookahead;
+    }
+
+    std::int64_t misses;           // blocks which could not be read completely
+    std::int64_t zeroFilledFrames; // frames output as zeros because their chunk was missing
+    position_t   lead;             // frames available ahead of the playhead, capped at the lookahead
+    position_t   worstLead;        // lowest lead since the last reset
+};
 
 class PlaybackQueue:
     public intrusive::unordered_set_base_hook< intrusive::store_hash<true> >
 {
 public:
     // nrt
-    PlaybackQueue( bool isRealtime, int32_t id, std::string const & filename, position_t startIndex = 0 ):
-        id(id), sf(filename.c_str(), SFM_READ), terminate(false), realTimeSynthesis(isRealtime)
+    PlaybackQueue( bool isRealtime, int32_t id, std::string const & filename, position_t startIndex = 0,
+                   position_t lookaheadFrames = 0 ):
+        id(id), reader(filename), channels(reader.channels()), fileFrames(reader.frames()),
+        lookahead(lookaheadFrames > 0 ? std::min<position_t>(lookaheadFrames, maxLookahead) : defaultLookahead),
+        statistics(lookahead), realTimeSynthesis(isRealtime)
     {
         if (!isRealtime)
             return;
 
-        // we start queuing the first chunks immediately so they are available
-        for (int i = 0; i != 16; ++i)
-            queue( chunkAt(startIndex + i * framesPerChunk) );
+        const size_t chunksAhead = (lookahead + framesPerChunk - 1) / framesPerChunk;
+        chunkPool.reserve(chunksBefore + chunksAhead + 1);
 
-        registerAvailableChunks(16);
+        // we start queuing the first chunks immediately so they are available
+        const position_t firstChunk = chunkAt(startIndex);
+        int queuedChunks = 0;
+        for (position_t position = firstChunk; position < std::min(startIndex + lookahead, fileFrames);
+             position += framesPerChunk) {
+            queue( position );
+            queuedChunks++;
+        }
 
-        workerThread = std::move(std::thread([&]() {
-            this->readerLoop();
-        }));
+        registerAvailableChunks(queuedChunks);
     }
 
     // nrt
     ~PlaybackQueue()
     {
         if (realTimeSynthesis) {
-            terminate = true;
-            positionRequestSemaphore.post();
-            workerThread.join();
+            gReadScheduler.cancel(this);
 
             chunksForRt.consume_all(  std::default_delete<Chunk>() );
             chunks.clear_and_dispose( std::default_delete<Chunk>() );
             freeRetiredChunks();
+            for (Chunk * chunk : chunkPool)
+                delete chunk;
         }
     }
 
-    // nrt
+    // nrt: called by one thread at a time
     void queue(position_t queuePosition)
     {
-        sf.seek(queuePosition, SEEK_SET);
+        freeRetiredChunks();
 
-        Chunk * chunk = new Chunk(framesPerChunk, sf.channels());
+        Chunk * chunk = allocateChunk();
 
-        chunk->read(sf, queuePosition);
-        queuePosition += chunk->frames_;
+        chunk->read(reader, queuePosition);
 
         for (;;) {
             bool success = chunksForRt.push(chunk);
@@ -454,120 +802,96 @@ public:
         }
     }
 
+    // nrt: chunks are only allocated when the pool is empty. retired chunks go back to the pool, and are freed
+    // together with the queue
+    Chunk * allocateChunk()
+    {
+        if (chunkPool.empty())
+            return new Chunk(framesPerChunk, channels);
+
+        Chunk * chunk = chunkPool.back();
+        chunkPool.pop_back();
+        return chunk;
+    }
+
     // nrt
     void freeRetiredChunks()
     {
-        retiredChunks.consume_all( std::default_delete<Chunk>() );
+        retiredChunks.consume_all( [&](Chunk * chunk) {
+            chunkPool.push_back(chunk);
+        });
     }
 
     // rt
     void readSamples(float ** out, position_t position, size_t numberOfFrames, int expectedChannels)
     {
-        const int channels = sf.channels();
         if (channels != expectedChannels) { // channel mismatch!
             clearOutput(out, expectedChannels, 0, numberOfFrames);
             return;
         }
 
-        const position_t chunk1Pos = chunkAt(position);
-
-        auto chunk1It = chunks.find(chunk1Pos, CompareChunkWithPosition() );
-        if (chunk1It == chunks.end()) {
-            clearOutput(out, expectedChannels, 0, numberOfFrames);
-            return;
-        }
-
-        Chunk & chunk1 = *chunk1It;
+        size_t framesRead = 0;
+        while (framesRead != numberOfFrames) {
+            const position_t framePosition = position + framesRead;
+            const position_t chunkPosition = chunkAt(framePosition);
 
-        const size_t firstFrameInChunk1  = position - chunk1Pos;
-        const size_t availFramesInChunk1 = framesPerChunk - firstFrameInChunk1;
-
-        const size_t framesFromChunk1    = std::min(availFramesInChunk1, numberOfFrames);
-        const size_t offset              = firstFrameInChunk1 * channels;
+            auto chunkIt = chunks.find(chunkPosition, CompareChunkWithPosition() );
+            if (chunkIt == chunks.end()) {
+                zeroFill(out, framePosition, framesRead, numberOfFrames - framesRead);
+                return;
+            }
 
-        deinterleaveToOutput( out, channels, 0, framesFromChunk1, chunk1.data_.data() + offset );
+            Chunk & chunk = *chunkIt;
 
-        if (framesFromChunk1 == numberOfFrames)
-            return; // we are done
+            const size_t firstFrameInChunk = framePosition - chunkPosition;
+            if (firstFrameInChunk >= chunk.frames_) { // end of file or short read
+                zeroFill(out, framePosition, framesRead, numberOfFrames - framesRead);
+                return;
+            }
 
-        const size_t remainingFrames  = numberOfFrames - framesFromChunk1;
+            const size_t framesFromChunk = std::min(chunk.frames_ - firstFrameInChunk, numberOfFrames - framesRead);
+            const size_t offset          = firstFrameInChunk * channels;
 
-        const position_t chunk2Pos = chunkAt(position + numberOfFrames);
-        auto chunk2It = chunks.find(chunk2Pos, CompareChunkWithPosition() );
-        if (chunk2It == chunks.end()) {
-            clearOutput( out, channels, framesFromChunk1, remainingFrames );
-            return;
+            deinterleaveToOutput( out, channels, framesRead, framesFromChunk, chunk.data_.data() + offset );
+            framesRead += framesFromChunk;
         }
-
-        Chunk & chunk2 = *chunk2It;
-
-        const size_t framesFromChunk2 = std::min(remainingFrames, chunk2.frames_);
-        const size_t framesToClear    = remainingFrames - framesFromChunk2;
-
-        deinterleaveToOutput( out, channels, framesFromChunk1, framesFromChunk2, chunk2.data_.data() );
-
-        if (framesToClear) {
-            assert( framesFromChunk1 + framesFromChunk2 + framesToClear == numberOfFrames );
-            clearOutput( out, channels, framesFromChunk1 + framesFromChunk2, framesToClear );
-        } else
-            assert( framesFromChunk1 + framesFromChunk2 == numberOfFrames );
     }
 
     void readSamplesNRT(float ** out, position_t position, size_t numberOfFrames, int expectedChannels)
     {
-        const int channels = sf.channels();
         if (channels != expectedChannels) { // channel mismatch!
             clearOutput(out, expectedChannels, 0, numberOfFrames);
             return;
         }
 
-        sf.seek(position, SEEK_SET);
-
-        std::vector<float> interleavedData(numberOfFrames * expectedChannels);
-        size_t readFrames = sf.readf(interleavedData.data(), numberOfFrames);
+        size_t readFrames;
+        if (reader.isMapped()) {
+            readFrames = reader.readDeinterleaved(out, 0, position, numberOfFrames);
+        } else {
+            nrtBuffer.resize(numberOfFrames * expectedChannels);
+            readFrames = reader.readInterleaved(nrtBuffer.data(), position, numberOfFrames);
 
-        deinterleaveToOutput( out, expectedChannels, 0, readFrames, interleavedData.data() );
+            deinterleaveToOutput( out, expectedChannels, 0, readFrames, nrtBuffer.data() );
+        }
 
         if (readFrames != numberOfFrames)
             clearOutput( out, expectedChannels, readFrames, numberOfFrames - readFrames);
     }
 
-
-    // nrt
-    void readerLoop()
-    {
-        for(;;) {
-            positionRequestSemaphore.wait();
-            freeRetiredChunks();
-            if (terminate.load(std::memory_order_relaxed) == true)
-                return;
-
-            requestQueue.consume_one([&](position_t requestPosition) {
-                queue(requestPosition);
-            });
-        }
-    }
-
     // rt
-    void requestChunk(position_t position)
+    void requestChunk(position_t position, position_t deadline)
     {
-        for (int i = 0; i != 32; ++i) {
-            bool requestPosted = requestQueue.push(position);
-
-            if (requestPosted) {
-                positionRequestSemaphore.post();
-                requestedChunks.insert(position);
-                return;
-            }
-        }
+        bool requestPosted = gReadScheduler.post(this, position, deadline);
+        if (requestPosted)
+            requestedChunks.insert(position);
     }
 
-    // rt
-    void performMaintenance(position_t currentPosition)
+    // rt: `now` is the server clock in frames
+    void performMaintenance(position_t currentPosition, position_t now)
     {
         assert(realTimeSynthesis);
 
-        requestReadaheadChunks(currentPosition);
+        requestReadaheadChunks(currentPosition, now);
 
         int allowedOperations = 16;
         allowedOperations -= registerAvailableChunks(allowedOperations);
@@ -576,7 +900,19 @@ public:
             allowedOperations -= retireBefore(currentPosition - chunksBefore * framesPerChunk, allowedOperations);
 
         if (allowedOperations > 0)
-            retireAfter(currentPosition + chunksAfter * framesPerChunk, allowedOperations);
+            retireAfter(currentPosition + std::max<position_t>(chunksAfter * framesPerChunk, lookahead + framesPerChunk),
+                        allowedOperations);
+    }
+
+    // rt
+    PlaybackStatistics & getStatistics()
+    {
+        return statistics;
+    }
+
+    position_t getLookahead() const
+    {
+        return lookahead;
     }
 
     // hashing
@@ -602,6 +938,19 @@ private:
         }
     }
 
+    // clear the output from `framePosition` on. frames before the end of the file count as missed
+    void zeroFill(float ** out, position_t framePosition, int sampleOffset, size_t framesToClear)
+    {
+        clearOutput(out, channels, sampleOffset, framesToClear);
+
+        if (framePosition >= fileFrames)
+            return;
+
+        const size_t missedFrames = std::min<position_t>(framesToClear, fileFrames - framePosition);
+        statistics.misses           += 1;
+        statistics.zeroFilledFrames += missedFrames;
+    }
+
     static void deinterleaveToOutput(float ** outputRegions, int numberOfChannels, int sampleOffset, size_t numFrames,
                                      const float * interleavedInput)
     {
@@ -632,6 +981,10 @@ private:
 
     int retireBefore(position_t position, int rateLimit = 16)
     {
+        // nothing is read ahead once the playhead is past the end of the file
+        if (chunks.empty())
+            return 0;
+
         auto it = chunks.begin();
         for (int i = 0; i != rateLimit; ++i) {
             if (it->startFrame_ < position) {
@@ -655,6 +1008,9 @@ private:
 
     int retireAfter(position_t position, int rateLimit = 16)
     {
+        if (chunks.empty())
+            return 0;
+
         auto it = chunks.rbegin();
         for (int i = 0; i != rateLimit; ++i) {
             if (it->startFrame_ > position) {
@@ -677,20 +1033,29 @@ private:
         return rateLimit;
     }
 
-    void requestReadaheadChunks(position_t currentPosition)
+    // request the missing chunks between the playhead and the end of the lookahead window. the deadline of a chunk is
+    // the time at which the playhead will reach it
+    void requestReadaheadChunks(position_t currentPosition, position_t now)
     {
         const position_t currentChunkPosition = chunkAt(currentPosition);
-        const position_t readahead = currentChunkPosition + chunksAhead * framesPerChunk;
+        const position_t readahead = std::min(currentPosition + lookahead, fileFrames);
 
-        for (position_t requestPosition = currentChunkPosition; requestPosition <= readahead; requestPosition += framesPerChunk) {
+        position_t lead = lookahead;
+        for (position_t requestPosition = currentChunkPosition; requestPosition < readahead; requestPosition += framesPerChunk) {
             if ( chunks.find(requestPosition, CompareChunkWithPosition()) != chunks.end() )
                 continue; // already queued
 
+            const position_t framesAhead = std::max<position_t>(requestPosition - currentPosition, 0);
+            lead = std::min(lead, framesAhead);
+
             if ( requestedChunks.find(requestPosition) != requestedChunks.end() )
                 continue; // already requested
 
-            requestChunk(requestPosition);
+            requestChunk(requestPosition, now + framesAhead);
         }
+
+        statistics.lead      = lead;
+        statistics.worstLead = std::min(statistics.worstLead, lead);
     }
     //@}
 
@@ -700,26 +1065,67 @@ private:
     }
 
     typedef boost::lockfree::queue<Chunk*, boost::lockfree::capacity<512>> ChunkQueue;
-    typedef boost::lockfree::queue<position_t, boost::lockfree::capacity<512>> PositionQueue;
     typedef intrusive::set<Chunk> ChunkSet;
     typedef nova::tlsf_allocator<char, 128 * 1024> RtAllocator; // 128k
 
-    SndfileHandle sf;
+    SoundFileReader  reader;
+    const int        channels;
+    const position_t fileFrames;
+    const position_t lookahead;
+
+    std::vector<Chunk*> chunkPool;
+    std::vector<float>  nrtBuffer;
 
     ChunkQueue chunksForRt;
     ChunkSet   chunks;
     ChunkQueue retiredChunks;
 
-    PositionQueue                                             requestQueue;
     std::set<position_t, std::less<position_t>, RtAllocator > requestedChunks;
-    boost::sync::semaphore                                    positionRequestSemaphore;
 
-    bool realTimeSynthesis;
+    PlaybackStatistics statistics;
 
-    std::thread      workerThread;
-    std::atomic_bool terminate;
+    bool realTimeSynthesis;
 };
 
+void ReadScheduler::readerLoop(int index)
+{
+    for (;;) {
+        semaphore.wait();
+
+        Request request;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (terminate.load(std::memory_order_relaxed) == true)
+                return;
+
+            collectRequests();
+
+            // the most urgent request whose queue is not being read by another thread
+            auto it = std::find_if(pending.begin(), pending.end(), [&](Request const & candidate) {
+                return std::find(busy.begin(), busy.end(), candidate.queue) == busy.end();
+            });
+            if (it == pending.end())
+                continue;
+
+            request = *it;
+            pending.erase(it);
+            busy[index] = request.queue;
+        }
+
+        request.queue->queue(request.position);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            busy[index] = nullptr;
+
+            // requests skipped while this queue was busy
+            if (!pending.empty())
+                semaphore.post();
+        }
+        idle.notify_all();
+    }
+}
+
 class NovaPlaybackManager
 {
 public:
@@ -728,9 +1134,13 @@ public:
     {}
 
     // nrt
-    PlaybackQueue * openAndQueueFile( bool isRealtime, int32_t id, std::string const & filename, position_t queuePosition )
+    PlaybackQueue * openAndQueueFile( bool isRealtime, int32_t id, std::string const & filename, position_t queuePosition,
+                                      position_t lookahead )
     {
-        return new PlaybackQueue( isRealtime, id, filename, queuePosition );
+        if (isRealtime)
+            gReadScheduler.start();
+
+        return new PlaybackQueue( isRealtime, id, filename, queuePosition, lookahead );
     }
 
     // rt
@@ -763,14 +1173,15 @@ public:
     }
 
     // rt
-    void readFromChunk( int32_t id, position_t position, float ** out, int inNumSamples, int expectedChannels)
+    void readFromChunk( int32_t id, position_t position, float ** out, int inNumSamples, int expectedChannels,
+                        position_t now )
     {
         auto it = playerQueues.find( id, HashFunctor(), EqualFunctor() );
         if ( it == playerQueues.end() )
             return;
 
         it->readSamples(out, position, inNumSamples, expectedChannels);
-        it->performMaintenance(position + inNumSamples);
+        it->performMaintenance(position + inNumSamples, now + inNumSamples);
     }
 
     void readNRT( int32_t id, position_t position, float ** out, int inNumSamples, int expectedChannels)
@@ -782,6 +1193,15 @@ public:
         it->readSamplesNRT(out, position, inNumSamples, expectedChannels);
     }
 
+    // rt
+    PlaybackQueue * findPlaybackQueue( int32_t id )
+    {
+        auto it = playerQueues.find( id, HashFunctor(), EqualFunctor() );
+        if ( it == playerQueues.end() )
+            return nullptr;
+        return &*it;
+    }
+
 private:
     struct EqualFunctor
     {
@@ -829,6 +1249,7 @@ struct NovaDiskInCmd
     int mode;
     char * path;
     int queuePosition;
+    int lookahead;
     int id;
     PlaybackQueue * queue;
 };
@@ -839,7 +1260,8 @@ static bool novaDiskInCmd2Nrt(World* world, void* inUserData)
 
     switch (cmd->mode) {
     case kOpen:
-        cmd->queue = gPlaybackManager.openAndQueueFile( world->mRealTime, cmd->id, std::string(cmd->path), cmd->queuePosition );
+        cmd->queue = gPlaybackManager.openAndQueueFile( world->mRealTime, cmd->id, std::string(cmd->path), cmd->queuePosition,
+                                                        cmd->lookahead );
         break;
 
     case kClose:
@@ -906,6 +1328,7 @@ void novaDiskInCmd(World *inWorld, void* inUserData, struct sc_msg_iter *args, v
     }
 
     cmd->queuePosition = args->geti(0);
+    cmd->lookahead     = args->geti(0); // frames, 0 for the default
 
     // completion message
     int msgSize = args->getbsize();
@@ -952,10 +1375,43 @@ public:
         ClearUnitOutputs(this, 1);
     }
 
+    // u_cmd "stats" [replyID, reset]: replies with
+    // /NovaDiskIn.stats nodeID replyID cueID misses zeroFilledFrames worstLead lead lookahead
+    static void statsCmd(Unit * unit, sc_msg_iter * args)
+    {
+        NovaDiskIn * self = static_cast<NovaDiskIn*>(unit);
+
+        const int replyID = args->geti(0);
+        const bool reset  = args->geti(0) != 0;
+
+        PlaybackQueue * queue = gPlaybackManager.findPlaybackQueue(self->mPlaybackQueueIndex);
+        if (!queue)
+            return;
+
+        PlaybackStatistics & statistics = queue->getStatistics();
+
+        float values[] = {
+            (float)self->mPlaybackQueueIndex,
+            (float)statistics.misses,
+            (float)statistics.zeroFilledFrames,
+            (float)statistics.worstLead,
+            (float)statistics.lead,
+            (float)queue->getLookahead()
+        };
+
+        SendNodeReply(&self->mParent->mNode, replyID, "/NovaDiskIn.stats", 6, values);
+
+        if (reset)
+            statistics.reset(queue->getLookahead());
+    }
+
 private:
     void next(int inNumSamples)
     {
-        gPlaybackManager.readFromChunk(mPlaybackQueueIndex, currentPosition, this->mOutBuf, inNumSamples, mChannelCount);
+        const position_t now = position_t(mWorld->mBufCounter) * mWorld->mFullRate.mBufLength;
+
+        gPlaybackManager.readFromChunk(mPlaybackQueueIndex, currentPosition, this->mOutBuf, inNumSamples, mChannelCount,
+                                       now);
         currentPosition += inNumSamples;
     }
 
@@ -986,4 +1442,5 @@ PluginLoad(NovaDiskIO)
 
     DefineDtorUnit(NovaDiskIn);
     DefinePlugInCmd("NovaDiskIn", novaDiskInCmd, (void*)&gPlaybackManager);
+    DefineUnitCmd("NovaDiskIn", "stats", &NovaDiskIn::statsCmd);
 }
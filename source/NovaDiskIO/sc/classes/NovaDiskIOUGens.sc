@@ -1,6 +1,28 @@
 NovaDiskOut : UGen {
-	*ar { arg signal, filename;
-		var args = [signal.size] ++ signal ++ [filename.size] ++ filename.asString.collectAs(_.ascii, Array);
+	classvar headerFormats, sampleFormats;
+
+	*initClass {
+		headerFormats = [\caf, \wav, \w64, \aiff, \rf64];
+		sampleFormats = [\float, \int16, \int24, \int32];
+	}
+
+	// bufferDuration: seconds of audio buffered before frames are dropped, if the disk cannot keep up
+	// headerFormat: caf, wav, w64, aiff or rf64
+	// sampleFormat: float, int16, int24 or int32
+	*ar { arg signal, filename, bufferDuration = 2, headerFormat = "caf", sampleFormat = "float";
+		var headerIndex = headerFormats.indexOf(headerFormat.asString.toLower.asSymbol);
+		var sampleIndex = sampleFormats.indexOf(sampleFormat.asString.toLower.asSymbol);
+		var args;
+
+		if (headerIndex.isNil) {
+			Error("NovaDiskOut: unknown header format %".format(headerFormat)).throw
+		};
+		if (sampleIndex.isNil) {
+			Error("NovaDiskOut: unknown sample format %".format(sampleFormat)).throw
+		};
+
+		args = [signal.size] ++ signal ++ [filename.size] ++ filename.asString.collectAs(_.ascii, Array)
+			++ [bufferDuration, headerIndex, sampleIndex];
 		^this.multiNew('audio', *args)
 	}
 }
@@ -12,14 +34,18 @@ NovaDiskIn : MultiOutUGen {
 		readerIDAllocator = StackNumberAllocator(0, 1073741824)
 	}
 
-	*cueSoundfile {|filename, completionMessage, server|
+	// lookahead: seconds of the file which are read ahead of the playhead, nil for the default
+	*cueSoundfile {|filename, completionMessage, server, lookahead|
 		var cueID = readerIDAllocator.alloc;
+		var lookaheadFrames;
 
 		if (server.isNil) {
 			server = Server.default
 		};
 
-		server.sendMsg(\cmd, \NovaDiskIn, 0 /* open */, cueID, filename, completionMessage);
+		lookaheadFrames = if (lookahead.isNil) { 0 } { (lookahead * (server.sampleRate ? 44100)).asInteger };
+
+		server.sendMsg(\cmd, \NovaDiskIn, 0 /* open */, cueID, filename, 0, lookaheadFrames, completionMessage);
 		^cueID
 	}
 
@@ -28,10 +54,18 @@ NovaDiskIn : MultiOutUGen {
 			server = Server.default
 		};
 
-		server.sendMsg(\cmd, \NovaDiskIn, 2 /* close */, cueID, "", completionMessage);
+		server.sendMsg(\cmd, \NovaDiskIn, 2 /* close */, cueID, "", 0, 0, completionMessage);
 		readerIDAllocator.free( cueID )
 	}
 
+	// the server replies with
+	// ['/NovaDiskIn.stats', nodeID, replyID, cueID, misses, zeroFilledFrames, worstLead, lead, lookahead]
+	// misses counts the blocks which were partially zero filled because their data was not read in time, the lead
+	// values are the frames available ahead of the playhead
+	*requestStats {|synth, ugenIndex = 0, replyID = 0, reset = 0|
+		synth.server.sendMsg(\u_cmd, synth.nodeID, ugenIndex, \stats, replyID, reset);
+	}
+
 	*ar { arg numberOfChannels, cueID;
 		^this.multiNew('audio', numberOfChannels, cueID)
 	}
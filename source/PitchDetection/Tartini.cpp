@@ -46,15 +46,17 @@ PO Box 56, Dunedin 9015, New Zealand.
 
 // parameters- in, threshold (k-rate),  n (i-rate), k (i-rate), overlap (i-rate), smallcutoff(k-rate)
 
+// MultiTartini parameters- threshold (k-rate),  n (i-rate), k (i-rate), overlap (i-rate), smallcutoff(k-rate), ins
+
 #include "PitchDetection.h"
 
 
 void setupTartini(InterfaceTable *);
-void preparefft(Tartini *unit, float* in);
-void dofft(Tartini *unit);
-void inversefft(Tartini *unit);
-void nsdf(Tartini *unit);
-void peakpicking(Tartini *unit);
+void preparefft(TartiniTracker *tracker, float* in, int blocklength);
+void dofft(TartiniTracker *tracker);
+void inversefft(TartiniTracker *tracker);
+void nsdf(TartiniTracker *tracker);
+void peakpicking(TartiniTracker *tracker, float threshold, float smallCutoff, double rate);
 
 
 #if SC_FFT_VDSP
@@ -66,6 +68,160 @@ static COMPLEX_SPLIT splitBuf2; // output buf
 
 #endif
 
+
+#if SC_FFT_FFTW
+//fftw plans shared by all trackers of the same size. They are made with FFTW_UNALIGNED, so one plan can run on the
+//buffers of any tracker through fftwf_execute_r2r. The standard sizes are planned at load and only read afterwards,
+//they live as long as the plug-in. A unit with any other size makes its own plans in the NRT thread and is silent until
+//they arrive.
+#define TARTINI_NUMSTANDARDPLANS 4
+
+static TartiniPlans tartiniPlans[TARTINI_NUMSTANDARDPLANS];
+
+//NRT
+static void Tartini_destroyplans(TartiniPlans * plans) {
+
+	if (plans->time2FFT)
+		fftwf_destroy_plan(plans->time2FFT);
+	if (plans->fft2Time)
+		fftwf_destroy_plan(plans->fft2Time);
+	plans->size = 0;
+	plans->time2FFT = NULL;
+	plans->fft2Time = NULL;
+}
+
+//NRT or load, returns false if fftw could not make the plans
+static bool Tartini_makeplans(TartiniPlans * plans, int size) {
+
+	//with FFTW_ESTIMATE the planner doesn't touch the data
+	float * time = (float*)fftwf_malloc(sizeof(float) * size);
+	float * freq = (float*)fftwf_malloc(sizeof(float) * size);
+
+	plans->size = size;
+	plans->time2FFT = fftwf_plan_r2r_1d(size, time, freq, FFTW_R2HC, FFTW_ESTIMATE | FFTW_UNALIGNED);
+	plans->fft2Time = fftwf_plan_r2r_1d(size, freq, time, FFTW_HC2R, FFTW_ESTIMATE | FFTW_UNALIGNED);
+
+	fftwf_free(time);
+	fftwf_free(freq);
+
+	if (!plans->time2FFT || !plans->fft2Time) {
+		Tartini_destroyplans(plans);
+		return false;
+	}
+	return true;
+}
+
+static const TartiniPlans * Tartini_standardplans(int size) {
+
+	for (int i=0; i<TARTINI_NUMSTANDARDPLANS; ++i) {
+		if(tartiniPlans[i].size == size)
+			return tartiniPlans + i;
+	}
+	return NULL;
+}
+
+static void Tartini_setplans(TartiniTracker * trackers, int numtrackers, const TartiniPlans * plans) {
+
+	for (int i=0; i<numtrackers; ++i) {
+		trackers[i].planAutocorrTime2FFT = plans->time2FFT;
+		trackers[i].planAutocorrFFT2Time = plans->fft2Time;
+	}
+}
+
+static bool Tartini_planStage2(World * world, TartiniPlanCmd * cmd) { // NRT
+	Tartini_makeplans(&cmd->plans, cmd->size);
+	return true;
+}
+
+static bool Tartini_planStage3(World * world, TartiniPlanCmd * cmd) { // RT
+	Unit * unit = cmd->unit;
+	if (!unit) return cmd->plans.size != 0; //the unit is gone, destroy the plans in stage 4
+
+	*cmd->pending = NULL;
+	if (cmd->plans.size) {
+		*cmd->ownplans = cmd->plans;
+		Tartini_setplans(cmd->trackers, cmd->numtrackers, &cmd->plans);
+		unit->mCalcFunc = cmd->calcfunc;
+	} else
+		Print("Tartini: could not make FFT plans of size %d\n", cmd->size);
+	return false;
+}
+
+static bool Tartini_destroyStage(World * world, TartiniPlanCmd * cmd) { // NRT
+	Tartini_destroyplans(&cmd->plans);
+	return false;
+}
+
+static void Tartini_cmdCleanup(World * world, void * cmd) {
+	RTFree(world, cmd);
+}
+
+//use the standard plans for the size of the trackers, or request plans of their own. The unit outputs zeros until
+//calcfunc is installed
+static void Tartini_requestplans(Unit * unit, TartiniTracker * trackers, int numtrackers, TartiniPlans * ownplans,
+								 TartiniPlanCmd ** pending, UnitCalcFunc calcfunc) {
+
+	ownplans->size = 0;
+	*pending = NULL;
+
+	unit->mCalcFunc = ft->fClearUnitOutputs;
+	ClearUnitOutputs(unit, 1);
+
+	const TartiniPlans * plans = Tartini_standardplans(trackers[0].size);
+	if (plans) {
+		Tartini_setplans(trackers, numtrackers, plans);
+		unit->mCalcFunc = calcfunc;
+		return;
+	}
+
+	TartiniPlanCmd * cmd = (TartiniPlanCmd*)RTAlloc(unit->mWorld, sizeof(TartiniPlanCmd));
+	if (!cmd) {
+		Print("Tartini: RT memory allocation failed\n");
+		return;
+	}
+	cmd->unit = unit;
+	cmd->size = trackers[0].size;
+	cmd->plans.size = 0;
+	cmd->plans.time2FFT = NULL;
+	cmd->plans.fft2Time = NULL;
+	cmd->trackers = trackers;
+	cmd->numtrackers = numtrackers;
+	cmd->ownplans = ownplans;
+	cmd->pending = pending;
+	cmd->calcfunc = calcfunc;
+	*pending = cmd;
+
+	DoAsynchronousCommand(unit->mWorld, 0, "", (void*)cmd,
+						  (AsyncStageFn)Tartini_planStage2,
+						  (AsyncStageFn)Tartini_planStage3,
+						  (AsyncStageFn)Tartini_destroyStage,
+						  Tartini_cmdCleanup,
+						  0, 0);
+}
+
+//called from the Dtors
+static void Tartini_releaseplans(Unit * unit, TartiniPlans * ownplans, TartiniPlanCmd * pending) {
+
+	if (pending) pending->unit = NULL;
+	if (!ownplans->size) return;
+
+	TartiniPlanCmd * cmd = (TartiniPlanCmd*)RTAlloc(unit->mWorld, sizeof(TartiniPlanCmd));
+	if (!cmd) {
+		Print("Tartini: RT memory allocation failed, FFT plans leaked\n");
+		return;
+	}
+	cmd->unit = NULL;
+	cmd->plans = *ownplans;
+
+	DoAsynchronousCommand(unit->mWorld, 0, "", (void*)cmd,
+						  (AsyncStageFn)Tartini_destroyStage,
+						  NULL, NULL,
+						  Tartini_cmdCleanup,
+						  0, 0);
+}
+#endif
+
+
 void setupTartini(InterfaceTable * inTable) {
 
 	ft= inTable;
@@ -74,12 +230,17 @@ void setupTartini(InterfaceTable * inTable) {
 	//for Tartini
 	
 	DefineDtorUnit(Tartini);
-	//	prepareFFTW(1024+512);
-	//	prepareFFTW(512+256);
-	//	prepareFFTW(2048+1024);
+	DefineDtorUnit(MultiTartini);
 	
+	#if SC_FFT_FFTW
 	
-	#if SC_FFT_VDSP
+	//standard sizes: n + n/2 for n = 512, 1024, 2048, 4096
+	for (int i=0; i<TARTINI_NUMSTANDARDPLANS; ++i) {
+		int n = 512 << i;
+		Tartini_makeplans(tartiniPlans + i, n + n/2);
+	}
+
+	#elif SC_FFT_VDSP
 	
 	for (int i=0; i<3; ++i) {
 		fftSetup3[i] = vDSP_create_fftsetup(fftAllowedSizes[i],FFT_RADIX3);  //FFT has size 3*(2**n), SC_fftlib.cpp can't support this easily
@@ -97,18 +258,12 @@ void setupTartini(InterfaceTable * inTable) {
 
 
 
+//read n, k and overlap from the three inputs starting at firstinput
+static void Tartini_parameters(Unit * unit, int firstinput, int blocklength, int * pn, int * pk, int * poverlap) {
 
-
-void Tartini_Ctor( Tartini* unit ) {
-	
-	//int i;
-	
-	double samplingrate = unit->mWorld->mSampleRate; //SAMPLERATE; //unit->mWorld->mFullRate->mSampleRate
-	unit->blocklength= unit->mWorld->mFullRate.mBufLength; //BUFLENGTH; 
-	
-	int n = (int)(ZIN0(2)+0.1); //poor man's roundoff
-	int k = (int)(ZIN0(3)+0.1); 
-	int overlap= (int)(ZIN0(4)+0.1); 
+	int n = (int)(ZIN0(firstinput)+0.1); //poor man's roundoff
+	int k = (int)(ZIN0(firstinput+1)+0.1);
+	int overlap= (int)(ZIN0(firstinput+2)+0.1);
 	
 	//printf("n %d k %d overlap %d \n", n, k, overlap); 
 	
@@ -125,15 +280,12 @@ void Tartini_Ctor( Tartini* unit ) {
 	switch(n) {
 		case 2048: 
 			k= 1024; 
-			//m_whichfftindex = 2;
 			break;
 		case 1024:
 			k=512;
-			//m_whichfftindex = 1;
 			break;
 		case 512:
 			k=256;
-			//m_whichfftindex = 0; 
 			break;
 		default:
 			n= 2048;
@@ -142,141 +294,248 @@ void Tartini_Ctor( Tartini* unit ) {
 			break;
 	}
 	
-	unit->m_whichfftindex = LOG2CEIL(k)-8;
-
 #endif	
 	
-	
 	if (overlap<0) overlap=0;
 	
 	//allow time for amortisation
-	if (overlap>(n-(4*unit->blocklength))) overlap=(n-(4*unit->blocklength));
+	if (overlap>(n-(4*blocklength))) overlap=(n-(4*blocklength));
+
+	*pn= n;
+	*pk= k;
+	*poverlap= overlap;
+}
+
+
+//size of the RT memory needed by one tracker
+static size_t Tartini_trackerbytes(int n, int k) {
+
+	int size = n + k;
+
+	//output, input, dataTemp, autocorrTime, autocorrFFT, periodEstimates, periodEstimatesAmp, maxPositions
+	return sizeof(float) * (k + n + n + size + size + k + k) + sizeof(int) * k;
+}
+
+
+//carve the tracker buffers from memory (Tartini_trackerbytes(n, k) bytes), and start filling the window at bufpos.
+//With fftw the plans are set by Tartini_requestplans
+static void Tartini_inittracker(TartiniTracker * tracker, int n, int k, int overlap, int bufpos, char * memory) {
 	
 	//int n=2048;
 	//int k = (n + 1) / 2; //will lead to odd FFT 3072 or 1536 points, cheaper if power of 2
 	int size = n + k;
 	
+	tracker->overlap= overlap;
+	tracker->overlapindex= n-overlap;
 
-	
-	//unit->nover2=  (n + 1) / 2;
-	unit->overlap= overlap; //unit->nover2; 
-	unit->overlapindex= n-overlap; 
-	
-	//float freqPerBin = samplingrate / double(size); 
-	
-	//printf("size %d n %d k %d overlap %d overlapindex %d \n", size, n, k, overlap, unit->overlapindex); 
-	
-	unit->n= n;
-	unit->k= k;
-	unit->size=size;
+	//printf("size %d n %d k %d overlap %d overlapindex %d \n", size, n, k, overlap, tracker->overlapindex);
 
+	tracker->n= n;
+	tracker->k= k;
+	tracker->size=size;
+
+	tracker->m_bufWritePos = bufpos;
+
+	float * buffer = (float*)memory;
+
+	tracker->output = buffer; 				buffer += k;
+	tracker->input = buffer; 				buffer += n;
+	tracker->dataTemp = buffer; 			buffer += n;
+	tracker->autocorrTime = buffer; 		buffer += size;
+	tracker->autocorrFFT  = buffer; 		buffer += size;
+	tracker->periodEstimates = buffer; 		buffer += k;
+	tracker->periodEstimatesAmp = buffer; 	buffer += k;
+	tracker->maxPositions = (int*)buffer;
+
+	//a staggered tracker analyses a partly filled first window
+	Clear(n, tracker->dataTemp);
+
+#if SC_FFT_VDSP
+	tracker->m_whichfftindex = LOG2CEIL(k)-8;
+	tracker->log2n = fftAllowedSizes[tracker->m_whichfftindex]; //LOG2CEIL(size)
+
+#endif
+
+	tracker->m_currfreq=440;
+	tracker->m_hasfreq=0;
+
+	//amortisation and states
+	tracker->m_amortisationstate=0; //off
+}
 
 	
-	//unit->freqPerBin=freqPerBin;
-	unit->rate=samplingrate;
-	
-	unit->m_bufWritePos = 0;
+//one block of a tracker: the pending amortised stage, then the input
+static void Tartini_advance(TartiniTracker * tracker, float * in, int blocklength, float threshold, float smallCutoff, double rate) {
 	
+	switch(tracker->m_amortisationstate) {
+		case 0:
+			break; //do nothing case (will take fft if necessary)
+		case 1: //calculate ifft and nsdf
+			inversefft(tracker);
+			tracker->m_amortisationstate=2;
+			break;
+		case 2: //calculate ifft and nsdf
+			nsdf(tracker);
+			tracker->m_amortisationstate=3;
+			break;
+		case 3: //calculate peak picking
+			peakpicking(tracker, threshold, smallCutoff, rate);
+			tracker->m_amortisationstate=0;
+			break;
+		//default:
+		//	break;
+	}
+	preparefft(tracker, in, blocklength);
+}
+
 
-	unit->output = (float*)RTAlloc(unit->mWorld, sizeof(float) * k);
-	unit->input = (float*)RTAlloc(unit->mWorld, sizeof(float) * n);
 	
-	unit->dataTemp = (float*)RTAlloc(unit->mWorld, sizeof(float) * n);
-	unit->autocorrTime = (float*)RTAlloc(unit->mWorld, sizeof(float) * size);
-	unit->autocorrFFT  = (float*)RTAlloc(unit->mWorld, sizeof(float) * size);
+void Tartini_Ctor( Tartini* unit ) {
 	
-//	unit->dataTemp = (float*)fftwf_malloc(sizeof(float) * n);
-//	unit->autocorrTime = (float*)fftwf_malloc(sizeof(float) * size);
-//	unit->autocorrFFT  = (float*)fftwf_malloc(sizeof(float) * size);
+	unit->rate = unit->mWorld->mSampleRate; //SAMPLERATE; //unit->mWorld->mFullRate.mSampleRate
+	unit->blocklength= unit->mWorld->mFullRate.mBufLength; //BUFLENGTH;
 	
+	int n, k, overlap;
+	Tartini_parameters(unit, 2, unit->blocklength, &n, &k, &overlap);
+
+	char * memory = (char*)RTAlloc(unit->mWorld, Tartini_trackerbytes(n, k));
 	
 #if SC_FFT_FFTW
-	unit->planAutocorrTime2FFT = fftwf_plan_r2r_1d(size, unit->autocorrTime, unit->autocorrFFT, FFTW_R2HC, FFTW_ESTIMATE);
-	unit->planAutocorrFFT2Time = fftwf_plan_r2r_1d(size, unit->autocorrFFT, unit->autocorrTime, FFTW_HC2R, FFTW_ESTIMATE);
-#elif SC_FFT_VDSP	
-	unit->log2n = fftAllowedSizes[unit->m_whichfftindex]; //LOG2CEIL(size)	
-
+	unit->ownplans.size = 0;
+	unit->pending = NULL;
 #endif
+
+	if (!memory) {
+		Print("Tartini: could not allocate memory for n %d k %d\n", n, k);
+		unit->tracker.output = NULL;
+		unit->mCalcFunc = ft->fClearUnitOutputs;
+		ClearUnitOutputs(unit, 1);
+		return;
+	}
 	
-	unit->m_currfreq=440;  
-	unit->m_hasfreq=0;
-	
-	//amortisation and states
-	unit->m_amortisationstate=0; //off
-	
-	
+	Tartini_inittracker(&unit->tracker, n, k, overlap, 0, memory);
+
+#if SC_FFT_FFTW
+	Tartini_requestplans(unit, &unit->tracker, 1, &unit->ownplans, &unit->pending, (UnitCalcFunc)&Tartini_next);
+#else
 	SETCALC(Tartini_next);
+#endif
 }
 
 void Tartini_Dtor(Tartini *unit) {
 	
-#if SC_FFT_FFTW	
-    fftwf_destroy_plan(unit->planAutocorrFFT2Time);
-    fftwf_destroy_plan(unit->planAutocorrTime2FFT);
-#endif	
-//    fftwf_free(unit->autocorrFFT);
-//    fftwf_free(unit->autocorrTime);
-//    fftwf_free(unit->dataTemp);
+#if SC_FFT_FFTW
+	Tartini_releaseplans(unit, &unit->ownplans, unit->pending);
+#endif
 
-	//fftwf_free(unit->output);
-	//	fftwf_free(unit->input);
-	RTFree(unit->mWorld, unit->autocorrFFT);
-    RTFree(unit->mWorld, unit->autocorrTime);
-    RTFree(unit->mWorld, unit->dataTemp);
-	RTFree(unit->mWorld, unit->output);
-	RTFree(unit->mWorld, unit->input);
-	
-	
+	//output is the start of the tracker memory
+	if (unit->tracker.output)
+		RTFree(unit->mWorld, unit->tracker.output);
 }
 
 
 //kr rate
 void Tartini_next( Tartini *unit, int inNumSamples ) {
 	
-	float *in = IN(0);
+	TartiniTracker * tracker = &unit->tracker;
 	
-	switch(unit->m_amortisationstate) {
-		case 0:
-			break; //do nothing case (will take fft if necessary)
-		case 1: //calculate ifft and nsdf
-			inversefft(unit);
-			unit->m_amortisationstate=2;
-			break;
-		case 2: //calculate ifft and nsdf
-			nsdf(unit);
-			unit->m_amortisationstate=3;
-			break;
-		case 3: //calculate peak picking
-			peakpicking(unit);
-			unit->m_amortisationstate=0;	
-			break;
-		//default:
-		//	break;
+	Tartini_advance(tracker, IN(0), unit->blocklength, ZIN0(1), ZIN0(5), unit->rate);
+
+	ZOUT0(0)=tracker->m_currfreq;
+	ZOUT0(1)=tracker->m_hasfreq;
+
+}
+
+
+
+void MultiTartini_Ctor( MultiTartini* unit ) {
+
+	unit->rate = unit->mWorld->mSampleRate;
+	unit->blocklength= unit->mWorld->mFullRate.mBufLength;
+
+	int n, k, overlap;
+	Tartini_parameters(unit, 1, unit->blocklength, &n, &k, &overlap);
+
+	int numtrackers = unit->mNumInputs - 5;
+	size_t trackerbytes = Tartini_trackerbytes(n, k);
+
+	unit->numtrackers = numtrackers;
+	unit->trackers = (TartiniTracker*)RTAlloc(unit->mWorld, numtrackers * (sizeof(TartiniTracker) + trackerbytes));
+
+#if SC_FFT_FFTW
+	unit->ownplans.size = 0;
+	unit->pending = NULL;
+#endif
+
+	if (!unit->trackers) {
+		Print("MultiTartini: could not allocate memory for %d trackers, n %d k %d\n", numtrackers, n, k);
+		unit->mCalcFunc = ft->fClearUnitOutputs;
+		ClearUnitOutputs(unit, 1);
+		return;
+	}
+
+	//stagger the first windows over the hop, so the trackers take their FFTs in different blocks
+	int hopblocks = (n - overlap) / unit->blocklength;
+	char * memory = (char*)(unit->trackers + numtrackers);
+
+	for (int i=0; i<numtrackers; ++i) {
+		int bufpos = ((i * hopblocks) / numtrackers) * unit->blocklength;
+
+		Tartini_inittracker(unit->trackers + i, n, k, overlap, bufpos, memory);
+		memory += trackerbytes;
 	}	
-	preparefft(unit, in);
-	
-	ZOUT0(0)=unit->m_currfreq;
-	ZOUT0(1)=unit->m_hasfreq;
 	
+#if SC_FFT_FFTW
+	Tartini_requestplans(unit, unit->trackers, numtrackers, &unit->ownplans, &unit->pending,
+						 (UnitCalcFunc)&MultiTartini_next);
+#else
+	SETCALC(MultiTartini_next);
+#endif
+}
+
+void MultiTartini_Dtor(MultiTartini *unit) {
+
+#if SC_FFT_FFTW
+	Tartini_releaseplans(unit, &unit->ownplans, unit->pending);
+#endif
+
+	if (unit->trackers)
+		RTFree(unit->mWorld, unit->trackers);
+}
+
+
+//kr rate, outputs freq and hasFreq of each tracker in turn
+void MultiTartini_next( MultiTartini *unit, int inNumSamples ) {
+
+	float threshold = ZIN0(0);
+	float smallCutoff = ZIN0(4);
+
+	for (int i=0; i<unit->numtrackers; ++i) {
+		TartiniTracker * tracker = unit->trackers + i;
+
+		Tartini_advance(tracker, IN(5 + i), unit->blocklength, threshold, smallCutoff, unit->rate);
+
+		ZOUT0(2*i)=tracker->m_currfreq;
+		ZOUT0(2*i+1)=tracker->m_hasfreq;
+	}
 }	
 
 
 //rewritten this for arbitrary overlap, n
 
 //Tristan Jehan recommends copying ints rather than floats- I say negligible compared to other algorithm costs for the moment
-void preparefft(Tartini *unit, float* in) {
+void preparefft(TartiniTracker *tracker, float* in, int blocklength) {
 	
-	int n=unit->n;
+	int n=tracker->n;
 	
 	//urk! 
 	
-	int bufpos= unit->m_bufWritePos;
-	int blocklength=unit->blocklength;
+	int bufpos= tracker->m_bufWritePos;
 	
 	int i, index = 0, cpt = blocklength, maxindex;
 	
-	float * preparefftbuf=unit->dataTemp;
-	float * fftbuf= unit->autocorrTime;
+	float * preparefftbuf=tracker->dataTemp;
+	float * fftbuf= tracker->autocorrTime;
 	
 	// Copy input samples into prepare buffer	
 	while ((bufpos < n) && (cpt > 0)) {
@@ -289,58 +548,29 @@ void preparefft(Tartini *unit, float* in) {
 	// When Buffer is full...
 	if (bufpos >= n) {
 		
-		float * input= unit->input;
+		float * input= tracker->input;
 		
 		// Make a copy of prepared buffer into FFT buffer for computation
-		/*
-		for (i=0; i<n; i++) {
-			fftbuf[i] = preparefftbuf[i];
-			input[i]=  preparefftbuf[i];
-		}
-		*/
 		Copy(n, fftbuf, preparefftbuf);
 		Copy(n, input , preparefftbuf);
 		
 		//zero padding: zero the top k elements
-		int size=unit->size;
+		int size=tracker->size;
 		Clear(size-n, fftbuf+n);
 		
-		//proving that fftw FFT doesn't do anything to input data array! 
-		//	
-		//		printf("before \n");
-		//			for (i=0; i<20; i++) 
-		//			printf("%f ",preparefftbuf[i]);
-		//			
-		//		printf("\n\n");
-		
 		//FFT buffer ready- calculate away!
-		dofft(unit);
-		
-		//need to use preparefftbuf too, must be careful if amortising or make a copy of time domain too
-		
-		//		
-		//		printf("after \n");
-		//			for (i=0; i<20; i++) 
-		//			printf("%f ",preparefftbuf[i]);
-		//			
-		//		printf("\n\n");
-		
-		
+		dofft(tracker);
 		
 		//if(unit->m_overlap>0) will be safe as long as overlap=0l overlapindex=0 too
 		
 		// Save overlapping samples back into buffer- no danger since no indices overwritten
-		/*
-		for (i=0; i<unit->overlap; i++) 
-			preparefftbuf[i] = preparefftbuf[unit->overlapindex+i];
-		*/
-		Copy(unit->overlap, preparefftbuf, preparefftbuf + unit->overlapindex);
+		Copy(tracker->overlap, preparefftbuf, preparefftbuf + tracker->overlapindex);
 		
-		maxindex = blocklength - index + unit->overlap;
+		maxindex = blocklength - index + tracker->overlap;
 		
 		//blockSize less than n-overlapindex so no problem
 		// Copy the rest of incoming samples into prepareFFTBuffer
-		for (i=unit->overlap; i<maxindex; i++) {
+		for (i=tracker->overlap; i<maxindex; i++) {
 			preparefftbuf[i] = in[index];
 			index++;
 		}
@@ -350,7 +580,7 @@ void preparefft(Tartini *unit, float* in) {
 	}
 	
 	
-	unit->m_bufWritePos= bufpos;
+	tracker->m_bufWritePos= bufpos;
 	//printf("%d \n",bufpos);
 	
 }
@@ -359,15 +589,15 @@ void preparefft(Tartini *unit, float* in) {
 
 //calculation function once FFT data ready, will be removing windowing! 
 //I've split the autocorr calculation over two functions, as below, for amortisation, hence a small amount of repeated code
-void dofft(Tartini *unit) {
+void dofft(TartiniTracker *tracker) {
 	
 	int j;
-	int size=unit->size;
-	float * autocorrFFT= unit->autocorrFFT; //results of FFT
+	int size=tracker->size;
+	float * autocorrFFT= tracker->autocorrFFT; //results of FFT
 	
 	
 #if SC_FFT_FFTW	
-	fftwf_execute(unit->planAutocorrTime2FFT);
+	fftwf_execute_r2r(tracker->planAutocorrTime2FFT, tracker->autocorrTime, autocorrFFT);
 
 	//do half of the calculations
 	for(j=1; j<size/4; ++j) {
@@ -380,7 +610,7 @@ void dofft(Tartini *unit) {
 	
 #else
 	
-	float * autocorrTime= unit->autocorrTime; //input to FFT
+	float * autocorrTime= tracker->autocorrTime; //input to FFT
 	
 	//different packing: as complex data	
 	//leave junk data in FFT_VSP_MAXSIZE, just prepare up to size
@@ -390,9 +620,9 @@ void dofft(Tartini *unit) {
 	}
 	
 	// Now the actual FFT; out of place COMPLEX to COMPLEX FFT
-	vDSP_fft3_zop(fftSetup3[unit->m_whichfftindex], &splitBuf, 1, &splitBuf2, 1, unit->log2n, 1);
+	vDSP_fft3_zop(fftSetup3[tracker->m_whichfftindex], &splitBuf, 1, &splitBuf2, 1, tracker->log2n, 1);
 	
-	unit->m_nyquist = splitBuf2.realp[size/2]; 
+	tracker->m_nyquist = splitBuf2.realp[size/2];
 	
 	// Copy the data to the public output buf, transforming it back out of "split" representation
 	vDSP_ztoc(&splitBuf2, 1, (DSPComplex*)autocorrFFT, 2, size >> 1);
@@ -412,16 +642,16 @@ void dofft(Tartini *unit) {
 	}
 #endif
 
-	unit->m_amortisationstate=1; //on	
+	tracker->m_amortisationstate=1; //on
 }
 
-void inversefft(Tartini *unit) {
+void inversefft(TartiniTracker *tracker) {
 
 	int j;
-	int size=unit->size;
+	int size=tracker->size;
 	
 	int start= size/4;
-	float * autocorrFFT= unit->autocorrFFT; //results of FFT
+	float * autocorrFFT= tracker->autocorrFFT; //results of FFT
 
 #if SC_FFT_FFTW	
 	
@@ -438,11 +668,11 @@ void inversefft(Tartini *unit) {
 	
 
 			//Do an inverse FFT
-	fftwf_execute(unit->planAutocorrFFT2Time);
+	fftwf_execute_r2r(tracker->planAutocorrFFT2Time, autocorrFFT, tracker->autocorrTime);
 	
 #else
 	
-	float * autocorrTime= unit->autocorrTime; //input to FFT
+	float * autocorrTime= tracker->autocorrTime; //input to FFT
 	
 	for(j=start; j<size/2; j++) {
 		float val1= autocorrFFT[2*j];
@@ -455,7 +685,7 @@ void inversefft(Tartini *unit) {
 	
 	autocorrFFT[0] = autocorrFFT[0]*autocorrFFT[0];	//dc
 
-	float nyquist = unit->m_nyquist; 
+	float nyquist = tracker->m_nyquist;
 	
 	autocorrFFT[size/2] = nyquist*nyquist; //autocorrFFT[size/2]*autocorrFFT[size/2];	//nyquist, packed format from vDSP
 	
@@ -465,7 +695,7 @@ void inversefft(Tartini *unit) {
 		splitBuf.imagp[j] = 0.0f; 
 	}
 	
-	vDSP_fft3_zop(fftSetup3[unit->m_whichfftindex], &splitBuf, 1, &splitBuf2, 1, unit->log2n, 0);
+	vDSP_fft3_zop(fftSetup3[tracker->m_whichfftindex], &splitBuf, 1, &splitBuf2, 1, tracker->log2n, 0);
 	
 	
 	for(j=0; j<size; j++) {
@@ -483,18 +713,18 @@ void inversefft(Tartini *unit) {
 }
 
 //amortised
-void nsdf(Tartini *unit) {
+void nsdf(TartiniTracker *tracker) {
 	
 	int j;
-	int size=unit->size;
+	int size=tracker->size;
 
-	float * autocorrTime= unit->autocorrTime; //results ofinverse FFT
-	float * output= unit->output;
+	float * autocorrTime= tracker->autocorrTime; //results ofinverse FFT
+	float * output= tracker->output;
 	float fsize_rec = 1.f / float(size);
 	//buffer for k outputs (512 autocorr coefficients- check if same if take 2048 point autocorr?)
 	
-	int k= unit->k;
-	int n= unit->n;
+	int k= tracker->k;
+	int n= tracker->n;
 	
 	for(float *p1=output, *p2=autocorrTime+1; p1<output+k;)
 	    *p1++ = *p2++ * fsize_rec;
@@ -504,7 +734,7 @@ void nsdf(Tartini *unit) {
 	//NSDF
 	double sumRightSq = sumSq, sumLeftSq = sumSq;
 	
-	float * input= unit->input; //dataTemp; //safety because of amortisation
+	float * input= tracker->input; //dataTemp; //safety because of amortisation
 	
 	for(j=0; j<k; ++j) {
 		float left= input[n-1-j];
@@ -541,19 +771,16 @@ inline void parabolaTurningPoint2(float y_1, float y0, float y1, float xOffset,
 }
 
 
-#include <vector>
+//relatively direct port of Tartini code; the maxima and period estimates go to the tracker's preallocated scratch
+//(at most one maximum per lag, so k entries suffice) instead of std::vectors, so nothing is allocated in the audio thread
+void peakpicking(TartiniTracker *tracker, float threshold, float smallCutoff, double rate) {
 
-//can move vectors to permanent membership, clear each time used
+	float * output= tracker->output;
+	int k=tracker->k;
+	//int n=tracker->n;
 
-//relatively direct port of Tartini code, even keeping the std library code ; )
-//doesn't push up plug-in size too dramatically
-void peakpicking(Tartini *unit) {
-	
-	float * output= unit->output;
-	int k=unit->k;
-	//int n=unit->n;
-	
-	std::vector<int> maxPositions; //std library include
+	int * maxPositions= tracker->maxPositions;
+	int numMaxPositions = 0;
 	int pos = 0;
 	int curMaxPos = 0;
 	
@@ -585,7 +812,7 @@ void peakpicking(Tartini *unit) {
 		pos++;
 		if(pos < k-1 && !(output[pos] > 0.0f)) { //a negative zero crossing
 			if(curMaxPos > 0) { //if there was a maximum
-				maxPositions.push_back(curMaxPos); //add it to the vector of maxima
+				maxPositions[numMaxPositions++] = curMaxPos; //add it to the list of maxima
 				curMaxPos = 0; //clear the maximum position, so we start looking for a new ones
 			}
 			while(pos < k-1 && !(output[pos] > 0.0f)) pos++; //loop over all the values below zero
@@ -593,96 +820,71 @@ void peakpicking(Tartini *unit) {
     }
 	
     if(curMaxPos > 0) { //if there was a maximum in the last part
-		maxPositions.push_back(curMaxPos); //add it to the vector of maxima
+		maxPositions[numMaxPositions++] = curMaxPos; //add it to the list of maxima
 		curMaxPos = 0; //clear the maximum position, so we start looking for a new ones
     }
     
-	std::vector<float> periodEstimates;
-	std::vector<float> periodEstimatesAmp;
-	
-    //store some of the best period estimates
-    periodEstimates.clear();
-    periodEstimatesAmp.clear();
+	//store some of the best period estimates
+	float * periodEstimates= tracker->periodEstimates;
+	float * periodEstimatesAmp= tracker->periodEstimatesAmp;
+	int numPeriodEstimates = 0;
 	
     //float smallThreshold = 0.7f;
     //float smallCutoff = output[overallMaxIndex] * smallThreshold;
-    float smallCutoff = ZIN0(5); //0.5f;
-    for(std::vector<int>::iterator iter = maxPositions.begin(); iter < maxPositions.end(); iter++) {
-		if(output[*iter] >= smallCutoff) {
+    for(int i = 0; i < numMaxPositions; i++) {
+		int maxPos = maxPositions[i];
+
+		if(output[maxPos] >= smallCutoff) {
 			
 			float x, y;
 			//do a parabola fit to find the maximum
-			parabolaTurningPoint2(output[*iter-1], output[*iter], output[*iter+1], float(*iter + 1), &x, &y);
+			parabolaTurningPoint2(output[maxPos-1], output[maxPos], output[maxPos+1], float(maxPos + 1), &x, &y);
 			
 			if(y < -1.0f) y = -1.0f;
 			if(y > 1.0f) y = 1.0f;
 			
-			//y = bound(y, -1.0f, 1.0f);
-			periodEstimates.push_back(x);
-			periodEstimatesAmp.push_back(y);
+			periodEstimates[numPeriodEstimates] = x;
+			periodEstimatesAmp[numPeriodEstimates] = y;
+			numPeriodEstimates++;
 		}
     }
     
-    //if(maxPositions.empty()) { //no period found
-    if(periodEstimates.empty()) { //no period found
-		
-		//  analysisData.correlation = 0.0f;
-		//      analysisData.fundamentalFreq = 0.0f;
-		//      analysisData.note = 0.0f;
-		//      analysisData.volumeValue = 0.0f;
-		//      analysisData.highestCorrelationIndex = -1;
-		//      analysisData.chosenCorrelationIndex = -1;
-		//      analysisData.noteIndex = -1;
-		//      analysisData.done = true;
-		//	  
-		unit->m_hasfreq=0;
-		
-		
+    if(numPeriodEstimates == 0) { //no period found
+		tracker->m_hasfreq=0;
 		return;
     }
     
     
     //find the overall maximum position
     int overallMaxIndex = 0;
-	unsigned int iterPos;
-    //for(std::vector<float>::iterator iterPos = analysisData.periodEstimatesAmp.begin()+1; iterPos < analysisData.periodEstimatesAmp.end(); iterPos++) {
-    for(iterPos = 1; iterPos < periodEstimatesAmp.size(); iterPos++) {
+	int iterPos;
+    for(iterPos = 1; iterPos < numPeriodEstimates; iterPos++) {
 		if(periodEstimatesAmp[iterPos] > periodEstimatesAmp[overallMaxIndex]) overallMaxIndex = iterPos;
     }
     int highestCorrelationIndex = overallMaxIndex;
 	
 	//chooseCorrelationIndex(analysisData, threshold);
     
-	//uint iterPos;
 	int choosenMaxIndex = 0;
 	
-	//already tested!
-	//if(periodEstimates.empty()) return; //no period found
-	
-	
-	//seems to be an int of 97 in setting code but I'll ignore for now
-	float threshold= ZIN0(1); //0.93; //93% is GUI default in Tartini program
+	//threshold: 0.93 (93%) is GUI default in Tartini program
 	
     //choose a cutoff value based on the highest value and a relative threshold
     float cutoff = periodEstimatesAmp[highestCorrelationIndex] * threshold;
     //find the first of the maxPositions which is above the cutoff
-    for(iterPos = 0; iterPos < periodEstimatesAmp.size(); iterPos++) {
+    for(iterPos = 0; iterPos < numPeriodEstimates; iterPos++) {
 		if(periodEstimatesAmp[iterPos] >= cutoff) { choosenMaxIndex = iterPos; break; }
     }
 	
-	//int chosenCorrelationIndex = choosenMaxIndex;
-	//float correlation = periodEstimatesAmp[choosenMaxIndex];
-	
 	double period = periodEstimates[choosenMaxIndex];
-	double freq = (unit->rate) / period;
+	double freq = rate / period;
 	float fundamentalFreq = float(freq);
 	
 	//was unit->m_hasfreq= 1, Dan Stowell spotted this quick fix:
-	unit->m_hasfreq = periodEstimatesAmp[iterPos]; // According to McLeod (2005), the "clarity" (between 0 and 1) is simply this value
+	tracker->m_hasfreq = periodEstimatesAmp[choosenMaxIndex]; // According to McLeod (2005), the "clarity" (between 0 and 1) is simply this value
 	
-	unit->m_currfreq= fundamentalFreq;
+	tracker->m_currfreq= fundamentalFreq;
 	
-	//printf("freq %f period %f rate %f \n",fundamentalFreq, period, unit->rate);
+	//printf("freq %f period %f rate %f \n",fundamentalFreq, period, rate);
 	
 	}
-
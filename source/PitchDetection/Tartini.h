@@ -35,15 +35,12 @@
 #endif
 
 
-struct Tartini : public Unit  {
+//state of one pitch tracker; the buffers are carved from a single RT allocation made in the Ctor
+struct TartiniTracker {
 	int n,k, size;  //n=size of FFT buffer window k = autocorrelation window overlap size= n+k for autocorrelation calculation via FFT
-					//double freqPerBin;
-	int blocklength;
-	double rate;
 	
-	int nover2;
 	int overlap;
-    int overlapindex;
+	int overlapindex;
 	
 	int m_bufWritePos;
 	
@@ -53,8 +50,13 @@ struct Tartini : public Unit  {
 	float* autocorrTime;
 	float* autocorrFFT;
 	
+	//peak picking scratch, k entries each
+	int * maxPositions;
+	float * periodEstimates;
+	float * periodEstimatesAmp;
+	
 #if SC_FFT_FFTW
-	fftwf_plan planAutocorrTime2FFT, planAutocorrFFT2Time;
+	fftwf_plan planAutocorrTime2FFT, planAutocorrFFT2Time; //owned by the plug-in or the unit, see Tartini.cpp
 #elif SC_FFT_VDSP
 	int m_whichfftindex;
 	int log2n; 
@@ -67,11 +69,62 @@ struct Tartini : public Unit  {
 	int m_amortisationstate;
 };
 
+#if SC_FFT_FFTW
+struct TartiniPlans {
+	int size;
+	fftwf_plan time2FFT, fft2Time;
+};
+
+//a request for the plans of a size that isn't planned at load, passed between the RT and NRT threads
+struct TartiniPlanCmd {
+	Unit * unit; //cleared when the unit is freed before the plans arrive
+	int size;
+	TartiniPlans plans;
+	
+	//where the plans go in the unit
+	TartiniTracker * trackers;
+	int numtrackers;
+	TartiniPlans * ownplans;
+	struct TartiniPlanCmd ** pending;
+	UnitCalcFunc calcfunc;
+};
+#endif
+
+struct Tartini : public Unit  {
+	int blocklength;
+	double rate;
+	
+	TartiniTracker tracker;
+	
+#if SC_FFT_FFTW
+	TartiniPlans ownplans; //size 0 when the tracker uses standard plans
+	TartiniPlanCmd * pending;
+#endif
+};
+
+//N trackers in one unit, their analyses are staggered over the hop so only some of them take an FFT in any block
+struct MultiTartini : public Unit  {
+	int blocklength;
+	double rate;
+	
+	int numtrackers;
+	TartiniTracker * trackers;
+	
+#if SC_FFT_FFTW
+	TartiniPlans ownplans;
+	TartiniPlanCmd * pending;
+#endif
+};
+
 extern "C" {  
 	
 	void Tartini_next(Tartini *unit, int inNumSamples);
 	void Tartini_Ctor(Tartini* unit);
 	void Tartini_Dtor(Tartini* unit);
+	
+	void MultiTartini_next(MultiTartini *unit, int inNumSamples);
+	void MultiTartini_Ctor(MultiTartini* unit);
+	void MultiTartini_Dtor(MultiTartini* unit);
 }
 
 
@@ -0,0 +1,14 @@
+//several Tartini pitch trackers in one UGen, their analyses spread over successive control blocks
+
+MultiTartini : MultiOutUGen {
+
+	//returns one [freq, hasFreq] pair per input
+	*kr { arg in, threshold=0.93, n=2048, k=0, overlap=1024, smallCutoff=0.5;
+		^this.multiNewList(['control', threshold, n, k, overlap, smallCutoff] ++ in.asArray).clump(2)
+	}
+
+	init { arg ... theInputs;
+		inputs = theInputs;
+		^this.initOutputs((inputs.size - 5) * 2, rate);
+	}
+}
@@ -23,19 +23,98 @@
 
 #include "stdio.h"
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
 InterfaceTable *ft; 
 
 
+//Files are written by a writer thread, so the audio thread never touches the disk. Each open file has a slot holding a
+//ring of frames; FeatureSave_next only copies a frame into the ring, the writer drains the rings in large writes.
+//Opening happens in an asynchronous command, on the NRT thread.
+
+//two output formats:
+//0 interleaved (the original): int32 frame count, int32 feature count, then the frames one after another
+//1 columnar, for memory mapping: "FSAV", int32 feature count, int64 frame count, then one contiguous float array per feature.
+//The frames are collected interleaved in path.tmp and transposed on closing
+
+#define FEATURESAVE_MAXFILES 256
+#define FEATURESAVE_RINGFRAMES 16384 //at one frame per control block this is over 20 seconds of slack for the writer
+#define FEATURESAVE_POLLMS 20
+
+struct FeatureSaveFile {
+	
+	enum { Free, Requested, Open };
+	
+	std::atomic<int> state_; 
+	std::atomic<bool> closerequested_; 
+	
+	//set in the audio thread before the open request 
+	int numfeatures_; 
+	int columnar_; 
+	uint64 dropped_; //audio thread, read by the writer after the close request
+	
+	//set up on the NRT thread before the slot is Open
+	float * ring_; 
+	std::atomic<uint64> writeposition_; 
+	std::atomic<uint64> readposition_; 
+	
+	//writer thread
+	FILE * fp_; 
+	std::string path_; 
+	
+};
+
+FeatureSaveFile g_featuresavefiles[FEATURESAVE_MAXFILES]; 
+
+
+struct FeatureSaveWriter {
+	
+	std::thread thread_; 
+	std::mutex mutex_; 
+	std::condition_variable condition_; 
+	bool running_; 
+	int openfiles_; 
+	
+	FeatureSaveWriter(): running_(false), openfiles_(0) {}
+	
+	~FeatureSaveWriter() {
+		
+		if(thread_.joinable()) {
+			{
+				std::lock_guard<std::mutex> lock(mutex_); 
+				running_ = false; 
+			}
+			condition_.notify_one(); 
+			thread_.join(); 
+		}
+		
+	}
+	
+};
+
+FeatureSaveWriter g_featuresavewriter; 
+
+
 struct FeatureSave : public Unit    
 {
  
-	int frameswritten_; 
 	int numfeatures_; 
-	//char * filename_;
-	int fileready_; 
+	int file_; //slot of the open file, -1 if none
 	
-	//open file data
-	FILE *fp;
+};
+
+
+//createfile data, the path follows the struct
+struct FeatureSaveCmdData {
+	
+	int file_; 
+	char path_[1]; 
 	
 };
 
@@ -43,7 +122,7 @@ extern "C" {
 	
 	void FeatureSave_next(FeatureSave *unit, int inNumSamples);
 	void FeatureSave_Ctor(FeatureSave* unit);
-	//void FeatureSave_Dtor(FeatureSave* unit);
+	void FeatureSave_Dtor(FeatureSave* unit);
 
 }
 
@@ -51,16 +130,27 @@ extern "C" {
 void FeatureSaveUnitCmdFunc (Unit *unit, struct sc_msg_iter *args); 
 void FeatureSaveUnitCmdFunc2 (Unit *unit, struct sc_msg_iter *args); 
 
+bool FeatureSave_openStage2(World* world, FeatureSaveCmdData* cmd); 
+void FeatureSave_cmdCleanup(World* world, void* cmd); 
+void FeatureSave_writerLoop(); 
+void FeatureSave_drain(FeatureSaveFile * file); 
+void FeatureSave_transpose(FILE * tmp, const char * path, int numfeatures, uint64 numframes); 
+void FeatureSave_finish(FeatureSaveFile * file); 
+void FeatureSave_requestClose(FeatureSave * unit); 
 
 
-//will need to create in NRT mode
 
 void FeatureSave_Ctor(FeatureSave* unit) {
 	
-	unit->frameswritten_ = 0; 
-	unit->fileready_ = 0; 
+	unit->file_ = -1; 
 	unit->numfeatures_ = IN0(0); 
 	
+	//the features follow the numfeatures and trigger inputs
+	if((unit->numfeatures_<1) || (unit->numfeatures_>(int)unit->mNumInputs-2)) {
+		Print("FeatureSave: numfeatures must be between 1 and the number of feature inputs, not %d\n", unit->numfeatures_); 
+		unit->numfeatures_ = 0; 
+	}
+	
 	//printf("FeatureSave: numfeatures %d \n",unit->numfeatures_); 
 	
 	
@@ -80,6 +170,14 @@ void FeatureSave_Ctor(FeatureSave* unit) {
 }
 
 
+void FeatureSave_Dtor(FeatureSave* unit) {
+	
+	//a file left open is closed properly
+	FeatureSave_requestClose(unit); 
+	
+}
+
+
 
 void FeatureSave_next(FeatureSave *unit, int inNumSamples) {
 
@@ -87,29 +185,40 @@ void FeatureSave_next(FeatureSave *unit, int inNumSamples) {
 
 	//if trigger and file open 
 
-	//printf("%f %d %d %d \n",trig, unit->fileready_, unit->numfeatures_, trig>(-0.01f));
-	//printf("FeatureSave:next sanity check: unit pointer %p \n",unit->mUnitDef); 
-	
-	if((trig>(-0.01f)) && (unit->fileready_==1)) {
+	if((trig>(-0.01f)) && (unit->file_>=0)) {
 		
-		//printf("%f %d \n",trig, unit->fileready_); 
+		FeatureSaveFile * file = g_featuresavefiles + unit->file_; 
 		
-		//write to file
+		//still being opened on the NRT thread
+		if(file->state_.load(std::memory_order_acquire)!=FeatureSaveFile::Open) {
+			++file->dropped_; 
+			return; 
+		}
 		
-		for (int i=0; i<unit->numfeatures_; ++i) {
+		int numfeatures = unit->numfeatures_; 
 		
-			float featureval = IN0(i+2);  
-			//printf("%d %f trig %f \n",i, featureval, trig); 
-			
-			//printf("featureval %f %d \n",featureval, unit->fileready_);
-			
+		uint64 writeposition = file->writeposition_.load(std::memory_order_relaxed); 
+		
+		if((writeposition - file->readposition_.load(std::memory_order_acquire))>=FEATURESAVE_RINGFRAMES) {
 			
-			fwrite(&featureval, sizeof(float),1, unit->fp);
+			//in NRT mode the analysis can wait for the disk, in real time the frame is lost
+			if(unit->mWorld->mRealTime) {
+				++file->dropped_; 
+				return; 
+			}
 			
+			while((writeposition - file->readposition_.load(std::memory_order_acquire))>=FEATURESAVE_RINGFRAMES) {
+				g_featuresavewriter.condition_.notify_one(); 
+				std::this_thread::sleep_for(std::chrono::milliseconds(1)); 
+			}
 		}
 		
+		float * frame = file->ring_ + ((writeposition % FEATURESAVE_RINGFRAMES) * numfeatures); 
 		
-		++unit->frameswritten_; 
+		for (int i=0; i<numfeatures; ++i)
+			frame[i] = IN0(i+2); 
+		
+		file->writeposition_.store(writeposition+1, std::memory_order_release); 
 		
 	}
 	
@@ -122,28 +231,68 @@ void FeatureSaveUnitCmdFunc (Unit *unit, struct sc_msg_iter *args) {
 	
 	FeatureSave * fsave = (FeatureSave*) unit; 
 	
-	//message type:
-	//int cmdtype = args->geti();
-	 
-	
 	const char * stringarg = args->gets();
 	
-	//printf("got here at least %s\n",stringarg);
+	//0 interleaved, 1 columnar
+	int format = args->geti(0); 
 	
-	//strcpy(fsave->filename_, stringarg);  
+	if(!stringarg) {
+		Print("FeatureSave: createfile needs a path\n"); 
+		return; 
+	}
 	
-	//create file for writing 
-	//won't push to NRT thread for now since assuming only using this UGen in NRT mode to start with
+	if(fsave->file_>=0) {
+		Print("FeatureSave: a file is already open, send closefile first\n"); 
+		return; 
+	}
 	
-	//fsave->fp = fopen(fsave->filename_, "wb");
-	fsave->fp = fopen(stringarg, "wb+");
-
-	//dummy header data for now
-	fwrite(&fsave->frameswritten_, sizeof(int),1, fsave->fp);
+	if(fsave->numfeatures_<1) {
+		Print("FeatureSave: no features to save, cannot create %s\n", stringarg); 
+		return; 
+	}
 	
-	fwrite(&fsave->numfeatures_, sizeof(int),1, fsave->fp);
+	int i, slot = -1; 
+	
+	for (i=0; i<FEATURESAVE_MAXFILES; ++i) {
+		
+		int expected = FeatureSaveFile::Free; 
 		
-	fsave->fileready_ = 1; 
+		if(g_featuresavefiles[i].state_.compare_exchange_strong(expected, FeatureSaveFile::Requested)) {
+			slot = i; 
+			break; 
+		}
+	}
+	
+	if(slot<0) {
+		Print("FeatureSave: too many open files, cannot create %s\n", stringarg); 
+		return; 
+	}
+	
+	FeatureSaveFile * file = g_featuresavefiles + slot; 
+	
+	file->numfeatures_ = fsave->numfeatures_; 
+	file->columnar_ = (format==1); 
+	file->dropped_ = 0; 
+	file->closerequested_.store(false, std::memory_order_relaxed); 
+	
+	FeatureSaveCmdData* cmd = (FeatureSaveCmdData*)RTAlloc(unit->mWorld, sizeof(FeatureSaveCmdData) + strlen(stringarg));
+
+	if(!cmd) {
+		Print("FeatureSave: RT memory allocation failed, cannot create %s\n", stringarg);
+		file->state_.store(FeatureSaveFile::Free, std::memory_order_release);
+		return;
+	}
+
+	cmd->file_ = slot;
+	strcpy(cmd->path_, stringarg); 
+	
+	DoAsynchronousCommand(unit->mWorld, 0, "", (void*)cmd,
+						  (AsyncStageFn)FeatureSave_openStage2,
+						  NULL,NULL,
+						  FeatureSave_cmdCleanup,
+						  0, 0);
+	
+	fsave->file_ = slot; 
 	
 }
 
@@ -153,61 +302,257 @@ void FeatureSaveUnitCmdFunc2 (Unit *unit, struct sc_msg_iter *args) {
 	
 	FeatureSave * fsave = (FeatureSave*) unit; 
 	
-	//message type:
-	//int cmdtype = args->geti();
+	//the writer writes out what is left in the ring, finalises the header data and closes the file
+	FeatureSave_requestClose(fsave); 
+	
+}
+
+
+void FeatureSave_requestClose(FeatureSave * unit) {
+	
+	if(unit->file_<0) return; 
+	
+	g_featuresavefiles[unit->file_].closerequested_.store(true, std::memory_order_release); 
+	
+	unit->file_ = -1; 
+	
+}
+
+
+
+//NRT thread
+bool FeatureSave_openStage2(World* world, FeatureSaveCmdData* cmd) {
+	
+	FeatureSaveFile * file = g_featuresavefiles + cmd->file_; 
+	
+	file->path_ = cmd->path_; 
+	
+	//columnar data is collected interleaved first
+	std::string writepath = file->columnar_ ? (file->path_ + ".tmp") : file->path_; 
+	
+	file->fp_ = fopen(writepath.c_str(), "wb+");
+	
+	if(file->fp_) {
+		
+		if(!file->columnar_) {
+			
+			//frame count is finalised on closing
+			int header[2] = {0, file->numfeatures_}; 
+			
+			fwrite(header, sizeof(int),2, file->fp_);
+			
+		}
+		
+	} else 
+		printf("FeatureSave: could not open %s\n", writepath.c_str()); 
+	
+	file->ring_ = new float[FEATURESAVE_RINGFRAMES * file->numfeatures_]; 
+	file->writeposition_.store(0, std::memory_order_relaxed); 
+	file->readposition_.store(0, std::memory_order_relaxed); 
 	
-	fsave->fileready_ = 0; 
+	{
+		std::lock_guard<std::mutex> lock(g_featuresavewriter.mutex_); 
+		
+		if(!g_featuresavewriter.running_) {
+			g_featuresavewriter.running_ = true; 
+			g_featuresavewriter.thread_ = std::thread(FeatureSave_writerLoop); 
+		}
+		
+		++g_featuresavewriter.openfiles_; 
+	}
 	
-	//printf("ever called? %d \n", fsave->frameswritten_);
+	file->state_.store(FeatureSaveFile::Open, std::memory_order_release); 
 	
-	//finalise header data: 
+	g_featuresavewriter.condition_.notify_one(); 
 	
-	//back to start
-	//rewind(fsave->fp); 
+	return false; 
 	
-	fseek(fsave->fp, 0, SEEK_SET);
+}
+
+
+void FeatureSave_cmdCleanup(World* world, void* cmd) {
 	
-	//int testval = 64; 
-	//fwrite(&testval, sizeof(int),1, fsave->fp);
+	RTFree(world, cmd);
 	
-	fwrite(&fsave->frameswritten_, sizeof(int),1, fsave->fp);
+}
+
+
+
+//writer thread: the audio thread never signals it, it polls while there are open files
+void FeatureSave_writerLoop() {
 	
-//	int test; 
-//	fread(&test, sizeof(int),1, fsave->fp);
-//	printf("ever called 2? %d \n", test);
-//	
-//	
-//	fseek(fsave->fp, 0, SEEK_END);
+	FeatureSaveWriter & writer = g_featuresavewriter; 
 	
-	//close file
-	fclose(fsave->fp); 
+	std::unique_lock<std::mutex> lock(writer.mutex_); 
 	
+	while(writer.running_) {
+		
+		if(writer.openfiles_==0)
+			writer.condition_.wait(lock); 
+		else
+			writer.condition_.wait_for(lock, std::chrono::milliseconds(FEATURESAVE_POLLMS)); 
+		
+		lock.unlock(); 
+		
+		int closed = 0; 
+		
+		for (int i=0; i<FEATURESAVE_MAXFILES; ++i) {
+			
+			FeatureSaveFile * file = g_featuresavefiles + i; 
+			
+			if(file->state_.load(std::memory_order_acquire)!=FeatureSaveFile::Open) continue; 
+			
+			//read before draining, so no frame pushed before the request is missed
+			bool closerequested = file->closerequested_.load(std::memory_order_acquire); 
+			
+			FeatureSave_drain(file); 
+			
+			if(closerequested) {
+				FeatureSave_finish(file); 
+				++closed; 
+			}
+		}
+		
+		lock.lock(); 
+		
+		writer.openfiles_ -= closed; 
+	}
+	
+	//closing down, finish any files still open
+	for (int i=0; i<FEATURESAVE_MAXFILES; ++i) {
+		
+		FeatureSaveFile * file = g_featuresavefiles + i; 
+		
+		if(file->state_.load(std::memory_order_acquire)==FeatureSaveFile::Open) {
+			FeatureSave_drain(file); 
+			FeatureSave_finish(file); 
+		}
+	}
 	
 }
 
-PluginLoad(FeatureSave) {
+
+//write everything in the ring, in at most two writes
+void FeatureSave_drain(FeatureSaveFile * file) {
 	
-	//FILE * testfile = fopen("blah", "wb");
-//	
-//	int numelements = 1000; 
-//	
-//	fwrite(&numelements, sizeof(int),1, testfile);
-//	
-//	for (int i=0; i<numelements; ++i) {
-//		float now = i*0.67; 
-//		fwrite(&now, sizeof(int),1, testfile);
-//	
-//	}
-//
-//	fclose(testfile); 
+	uint64 writeposition = file->writeposition_.load(std::memory_order_acquire); 
+	uint64 readposition = file->readposition_.load(std::memory_order_relaxed); 
 	
+	while(readposition!=writeposition) {
+		
+		uint64 offset = readposition % FEATURESAVE_RINGFRAMES; 
+		uint64 frames = writeposition - readposition; 
+		
+		if(frames>(FEATURESAVE_RINGFRAMES-offset)) frames = FEATURESAVE_RINGFRAMES-offset; 
+		
+		if(file->fp_)
+			fwrite(file->ring_ + (offset * file->numfeatures_), sizeof(float) * file->numfeatures_, frames, file->fp_); 
+		
+		readposition += frames; 
+		
+		file->readposition_.store(readposition, std::memory_order_release); 
+	}
 	
-	ft = inTable;
+}
+
+
+//transpose the interleaved frames in tmp into the columnar file at path
+void FeatureSave_transpose(FILE * tmp, const char * path, int numfeatures, uint64 numframes) {
 	
-	DefineSimpleUnit(FeatureSave); 
+	FILE * fp = fopen(path, "wb"); 
+	
+	if(!fp) {
+		printf("FeatureSave: could not open %s\n", path); 
+		return; 
+	}
+	
+	int32 header[2]; 
+	memcpy(header, "FSAV", 4); 
+	header[1] = numfeatures; 
+	int64 frames = numframes; 
+	
+	fwrite(header, sizeof(int32),2, fp); 
+	fwrite(&frames, sizeof(int64),1, fp); 
+	
+	//in blocks of about 1MB of frames, each block adds a slice to every column
+	uint64 blockframes = (1<<20)/(numfeatures*sizeof(float)) + 1; 
+	
+	std::vector<float> block(blockframes*numfeatures); 
+	std::vector<float> column(blockframes); 
+	
+	fseek(tmp, 0, SEEK_SET); 
+	
+	for (uint64 start=0; start<numframes; start+=blockframes) {
+		
+		uint64 count = numframes - start; 
+		if(count>blockframes) count = blockframes; 
+		
+		if(fread(&block[0], sizeof(float) * numfeatures, count, tmp)!=count) {
+			printf("FeatureSave: could not read back %s.tmp\n", path); 
+			break; 
+		}
+		
+		for (int i=0; i<numfeatures; ++i) {
+			
+			for (uint64 j=0; j<count; ++j)
+				column[j] = block[(j*numfeatures) + i]; 
+			
+			fseek(fp, 16 + (((uint64)i*numframes) + start)*sizeof(float), SEEK_SET); 
+			fwrite(&column[0], sizeof(float), count, fp); 
+		}
+	}
+	
+	fclose(fp); 
+	
+}
+
+
+void FeatureSave_finish(FeatureSaveFile * file) {
+	
+	uint64 frames = file->readposition_.load(std::memory_order_relaxed); 
+	
+	if(file->fp_) {
+		
+		if(file->columnar_) {
+			
+			std::string tmppath = file->path_ + ".tmp"; 
+			
+			fflush(file->fp_); 
+			FeatureSave_transpose(file->fp_, file->path_.c_str(), file->numfeatures_, frames); 
+			fclose(file->fp_); 
+			remove(tmppath.c_str()); 
+			
+		} else {
+			
+			//finalise header data: back to start
+			int frameswritten = frames; 
+			
+			fseek(file->fp_, 0, SEEK_SET);
+			fwrite(&frameswritten, sizeof(int),1, file->fp_);
+			fclose(file->fp_); 
+			
+		}
+		
+		file->fp_ = NULL; 
+	}
+	
+	if(file->dropped_)
+		printf("FeatureSave: warning - %llu frames dropped writing %s\n", (unsigned long long)file->dropped_, file->path_.c_str()); 
+	
+	delete [] file->ring_; 
+	file->ring_ = NULL; 
+	
+	file->state_.store(FeatureSaveFile::Free, std::memory_order_release); 
 	
 }
 
 
+PluginLoad(FeatureSave) {
+	
+	ft = inTable;
+	
+	DefineDtorUnit(FeatureSave); 
+	
+}
 
 
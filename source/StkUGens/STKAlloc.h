@@ -25,5 +25,178 @@
         void * _STKMem_ = RTAlloc(_World_, sizeof(_STKInstrument_));    \
         _STKPtr_ = new(_STKMem_) _STKInstrument_();
 
+/*
+    in Ctor.
+	STKAllocNRT(unit, instrument, Instrument, 40, Unit_start);
+	STKAllocNRT0(unit, instrument, Instrument, Unit_start);
+
+    builds the instrument in the NRT thread instead: several instruments read
+    rawwaves from disk in their constructor and all of them allocate with the
+    system heap. the unit needs a 'STKCmd * pending' member next to the
+    instrument pointer. it outputs silence until the instrument arrives, then
+    unit->instrument is set and Unit_start(unit) is called in the RT thread to
+    do the rest of the old Ctor, including SETCALC.
+
+    in Dtor.
+	STKFreeNRT(unit, instrument);
+
+    deletes the instrument in the NRT thread. if the unit goes away before its
+    instrument has arrived, the instrument is deleted on arrival.
+
+    for instruments chosen at run time, call STKRequest with an own build
+    function. both need the InterfaceTable 'ft' to be declared before this
+    header
+*/
+
+#include <type_traits>
+
+struct STKCmd
+{
+    Unit * unit; // cleared when the unit is freed before the instrument arrives
+    void * instrument;
+    stk::StkFloat args[2];
+    void * (*build)(const stk::StkFloat * args);
+    void (*destroy)(void * instrument);
+    void (*handover)(Unit * unit, void * instrument);
+};
+
+template <typename Instrument>
+void * STKBuild(const stk::StkFloat * args)
+{
+    return new Instrument(args[0]);
+}
+
+template <typename Instrument>
+void * STKBuild0(const stk::StkFloat *)
+{
+    return new Instrument();
+}
+
+template <typename Instrument>
+void STKDestroy(void * instrument)
+{
+    delete (Instrument*)instrument;
+}
+
+template <typename UnitType, typename Instrument, Instrument * UnitType::*Member, void (*Start)(UnitType*)>
+void STKHandover(Unit * unit, void * instrument)
+{
+    UnitType * typedUnit = (UnitType*)unit;
+    typedUnit->pending = 0;
+    if (instrument) {
+        typedUnit->*Member = (Instrument*)instrument;
+        Start(typedUnit);
+    }
+}
+
+static bool STKCmd_build(World * world, STKCmd * cmd) // NRT
+{
+    try {
+        cmd->instrument = (cmd->build)(cmd->args);
+    }
+    catch (stk::StkError & e) {
+        Print("STK: error on creation %s\n", e.getMessageCString());
+        cmd->instrument = 0;
+    }
+    return true;
+}
+
+static bool STKCmd_handover(World * world, STKCmd * cmd) // RT
+{
+    if (!cmd->unit)
+        return cmd->instrument != 0; // orphaned, deleted in stage 4
+
+    (cmd->handover)(cmd->unit, cmd->instrument);
+    return false;
+}
+
+static bool STKCmd_destroy(World * world, STKCmd * cmd) // NRT
+{
+    (cmd->destroy)(cmd->instrument);
+    return false;
+}
+
+static void STKCmd_cleanup(World * world, void * cmd)
+{
+    RTFree(world, cmd);
+}
+
+static void STKRequest(Unit * unit, STKCmd ** pending, void * (*build)(const stk::StkFloat *),
+                       stk::StkFloat arg0, stk::StkFloat arg1,
+                       void (*destroy)(void *), void (*handover)(Unit *, void *))
+{
+    // with a non-realtime server all stages run before DoAsynchronousCommand returns,
+    // so everything the handover relies on is set up first
+    *pending = 0;
+    unit->mCalcFunc = ft->fClearUnitOutputs;
+    ClearUnitOutputs(unit, 1);
+
+    STKCmd * cmd = (STKCmd*)RTAlloc(unit->mWorld, sizeof(STKCmd));
+    if (!cmd) {
+        Print("STK: RT memory allocation failed\n");
+        return;
+    }
+    cmd->unit = unit;
+    cmd->instrument = 0;
+    cmd->args[0] = arg0;
+    cmd->args[1] = arg1;
+    cmd->build = build;
+    cmd->destroy = destroy;
+    cmd->handover = handover;
+    *pending = cmd;
+
+    DoAsynchronousCommand(unit->mWorld, 0, "", (void*)cmd,
+                          (AsyncStageFn)STKCmd_build,
+                          (AsyncStageFn)STKCmd_handover,
+                          (AsyncStageFn)STKCmd_destroy,
+                          STKCmd_cleanup,
+                          0, 0);
+}
+
+static void STKFree(Unit * unit, STKCmd * pending, void * instrument, void (*destroy)(void *))
+{
+    if (pending) {
+        pending->unit = 0;
+        return;
+    }
+    if (!instrument)
+        return;
+
+    STKCmd * cmd = (STKCmd*)RTAlloc(unit->mWorld, sizeof(STKCmd));
+    if (!cmd) {
+        Print("STK: RT memory allocation failed, instrument leaked\n");
+        return;
+    }
+    cmd->unit = 0;
+    cmd->instrument = instrument;
+    cmd->destroy = destroy;
+
+    DoAsynchronousCommand(unit->mWorld, 0, "", (void*)cmd,
+                          (AsyncStageFn)STKCmd_destroy,
+                          0, 0,
+                          STKCmd_cleanup,
+                          0, 0);
+}
+
+#define STKUnitType(_Unit_) std::remove_pointer<decltype(_Unit_)>::type
+
+#define STKAllocNRT(_Unit_, _Member_, _STKInstrument_, _Arg_, _Start_)                          \
+        (_Unit_)->_Member_ = 0;                                                                 \
+        STKRequest(_Unit_, &(_Unit_)->pending, STKBuild<_STKInstrument_>, _Arg_, 0,            \
+                   STKDestroy<_STKInstrument_>,                                                 \
+                   STKHandover<STKUnitType(_Unit_), _STKInstrument_,                            \
+                               &STKUnitType(_Unit_)::_Member_, _Start_>);
+
+#define STKAllocNRT0(_Unit_, _Member_, _STKInstrument_, _Start_)                                \
+        (_Unit_)->_Member_ = 0;                                                                 \
+        STKRequest(_Unit_, &(_Unit_)->pending, STKBuild0<_STKInstrument_>, 0, 0,                \
+                   STKDestroy<_STKInstrument_>,                                                 \
+                   STKHandover<STKUnitType(_Unit_), _STKInstrument_,                            \
+                               &STKUnitType(_Unit_)::_Member_, _Start_>);
+
+#define STKFreeNRT(_Unit_, _Member_)                                                            \
+        STKFree(_Unit_, (_Unit_)->pending, (_Unit_)->_Member_,                                  \
+                STKDestroy<std::remove_pointer<decltype((_Unit_)->_Member_)>::type>);
+
 #endif
 
@@ -35,7 +35,6 @@
 #include <TubeBell.h>
 
 #include <Stk.h>
-#include "STKAlloc.h"
 
 #include <math.h>
 
@@ -53,9 +52,13 @@
 using namespace stk;
 
 static InterfaceTable *ft;
+
+#include "STKAlloc.h"
+
  struct StkBandedWG : public Unit
 {
 	BandedWG *bandedWG;
+	STKCmd *pending;
 	int		lastperiod;
 	float   trig;
 	float   instr;
@@ -71,6 +74,7 @@ static InterfaceTable *ft;
  struct StkBeeThree : public Unit
 {
 	BeeThree *beethree;
+	STKCmd *pending;
 	float op4gain;
 	float op3gain;
 	float lfospeed;
@@ -89,6 +93,7 @@ static InterfaceTable *ft;
   struct StkBlowHole : public Unit
 {
 	BlowHole *blowhole;
+	STKCmd *pending;
 	float freq;
 	float reedstiffness;
 	float noisegain;
@@ -101,6 +106,7 @@ static InterfaceTable *ft;
   struct StkBowed : public Unit
 {
 	Bowed *bowed;
+	STKCmd *pending;
 	float freq;
 	float bowpressure;
 	float bowposition;
@@ -121,6 +127,7 @@ static InterfaceTable *ft;
   struct StkClarinet : public Unit
 {
 	Clarinet *clarinet;
+	STKCmd *pending;
 	float freq;
 	float reedstiffness;
 	float noisegain;
@@ -133,6 +140,7 @@ static InterfaceTable *ft;
   struct StkFlute : public Unit
 {
 	Flute *flute;
+	STKCmd *pending;
 	float jetdelay;
 	float noisegain;
 	float vibfreq;
@@ -145,6 +153,7 @@ static InterfaceTable *ft;
  struct StkModalBar : public Unit
 {
 	ModalBar *modalBar;
+	STKCmd *pending;
 	float   trig;
 	float   instrument;
 	float   stickhardness;
@@ -159,6 +168,7 @@ static InterfaceTable *ft;
  struct StkMoog : public Unit
 {
 	Moog *moog;
+	STKCmd *pending;
 	float filterQ;
 	float sweeprate;
 	float vibfreq;
@@ -194,6 +204,7 @@ static InterfaceTable *ft;
 struct StkSaxofony : public Unit
 {
 	Saxofony *saxofony;
+	STKCmd *pending;
 	float frequency;
 	float reedstiffness;
 	float reedaperture;
@@ -208,6 +219,7 @@ struct StkSaxofony : public Unit
  struct StkShakers : public Unit
 {
 	Shakers *shakers;
+	STKCmd *pending;
 	float freq;
 	float shakernumber;
 	float energy;
@@ -220,6 +232,7 @@ struct StkSaxofony : public Unit
  struct StkVoicForm : public Unit
 {
 	VoicForm *voiceForm;
+	STKCmd *pending;
 	float freq;
 	float vuvmix;
 	float vowelphon;
@@ -233,6 +246,7 @@ struct StkSaxofony : public Unit
 struct StkMandolin : public Unit
 {
 	Mandolin *mandolin;
+	STKCmd *pending;
 	float bodysize;
 	float pickposition;
 	float stringdamping;
@@ -244,6 +258,7 @@ struct StkMandolin : public Unit
 struct StkSitar : public Unit
 {
 	Sitar *sitar;
+	STKCmd *pending;
 	float trig;
   };
 
@@ -256,6 +271,7 @@ struct StkSitar : public Unit
   struct StkStifKarp : public Unit
 {
 	StifKarp *stifkarp;
+	STKCmd *pending;
 	float freq;
 	float pickuppos;
 	float stringsustain;
@@ -265,6 +281,7 @@ struct StkSitar : public Unit
   struct StkTubeBell : public Unit
 {
 	TubeBell *tubebell;
+	STKCmd *pending;
 };
 
  struct Sflute : public Unit
@@ -284,34 +301,42 @@ extern "C"
 {
         void StkBandedWG_next(StkBandedWG *unit, int inNumSamples);
         void StkBandedWG_Ctor(StkBandedWG* unit);
+        void StkBandedWG_start(StkBandedWG* unit);
         void StkBandedWG_Dtor(StkBandedWG* unit);
 
         void StkBeeThree_next(StkBeeThree *unit, int inNumSamples);
         void StkBeeThree_Ctor(StkBeeThree* unit);
+        void StkBeeThree_start(StkBeeThree* unit);
         void StkBeeThree_Dtor(StkBeeThree* unit);
 
         void StkBlowHole_next(StkBlowHole *unit, int inNumSamples);
         void StkBlowHole_Ctor(StkBlowHole* unit);
+        void StkBlowHole_start(StkBlowHole* unit);
         void StkBlowHole_Dtor(StkBlowHole* unit);
 
         void StkBowed_next(StkBowed *unit, int inNumSamples);
         void StkBowed_Ctor(StkBowed* unit);
+        void StkBowed_start(StkBowed* unit);
         void StkBowed_Dtor(StkBowed* unit);
 
         void StkClarinet_next(StkClarinet *unit, int inNumSamples);
         void StkClarinet_Ctor(StkClarinet* unit);
+        void StkClarinet_start(StkClarinet* unit);
         void StkClarinet_Dtor(StkClarinet* unit);
 
         void StkFlute_next(StkFlute *unit, int inNumSamples);
         void StkFlute_Ctor(StkFlute* unit);
+        void StkFlute_start(StkFlute* unit);
         void StkFlute_Dtor(StkFlute* unit);
 
 	void StkModalBar_next(StkModalBar *unit, int inNumSamples);
         void StkModalBar_Ctor(StkModalBar* unit);
+        void StkModalBar_start(StkModalBar* unit);
         void StkModalBar_Dtor(StkModalBar* unit);
 
         void StkMoog_next(StkMoog *unit, int inNumSamples);
         void StkMoog_Ctor(StkMoog* unit);
+        void StkMoog_start(StkMoog* unit);
         void StkMoog_Dtor(StkMoog* unit);
 
         void StkPluck_next_notfull(StkPluck *unit, int inNumSamples);
@@ -320,30 +345,37 @@ extern "C"
 
         void StkSaxofony_next(StkSaxofony *unit, int inNumSamples);
         void StkSaxofony_Ctor(StkSaxofony* unit);
+        void StkSaxofony_start(StkSaxofony* unit);
         void StkSaxofony_Dtor(StkSaxofony* unit);
 
         void StkShakers_next(StkShakers *unit, int inNumSamples);
         void StkShakers_Ctor(StkShakers* unit);
+        void StkShakers_start(StkShakers* unit);
         void StkShakers_Dtor(StkShakers* unit);
 
         void StkVoicForm_next(StkVoicForm *unit, int inNumSamples);
         void StkVoicForm_Ctor(StkVoicForm* unit);
+        void StkVoicForm_start(StkVoicForm* unit);
         void StkVoicForm_Dtor(StkVoicForm* unit);
 
         void StkMandolin_next(StkMandolin *unit, int inNumSamples);
         void StkMandolin_Ctor(StkMandolin* unit);
+        void StkMandolin_start(StkMandolin* unit);
         void StkMandolin_Dtor(StkMandolin* unit);
 
         void StkSitar_next(StkSitar *unit, int inNumSamples);
         void StkSitar_Ctor(StkSitar* unit);
+        void StkSitar_start(StkSitar* unit);
         void StkSitar_Dtor(StkSitar* unit);
 
         void StkStifKarp_next(StkStifKarp *unit, int inNumSamples);
         void StkStifKarp_Ctor(StkStifKarp* unit);
+        void StkStifKarp_start(StkStifKarp* unit);
         void StkStifKarp_Dtor(StkStifKarp* unit);
 
         void StkTubeBell_next(StkTubeBell *unit, int inNumSamples);
         void StkTubeBell_Ctor(StkTubeBell* unit);
+        void StkTubeBell_start(StkTubeBell* unit);
         void StkTubeBell_Dtor(StkTubeBell* unit);
 
         void Sflute_next(Sflute *unit, int inNumSamples);
@@ -359,8 +391,11 @@ void StkBandedWG_Ctor(StkBandedWG* unit)
 // p0=freq,p2=bowpressure, p3=bowmotion, p4=strikeposition, p5=vibratofreq, p6=gain, p7=bowvelocity, p8=setstriking
 
 	//unit->bandedWG = new BandedWG();
-	STKAlloc0(unit->mWorld,  unit->bandedWG, BandedWG);
+	STKAllocNRT0(unit, bandedWG, BandedWG, StkBandedWG_start);
+}
 
+void StkBandedWG_start(StkBandedWG* unit)
+{
 /******
      Control Change Numbers:
        - Bow Pressure = 2
@@ -437,8 +472,7 @@ void StkBandedWG_Dtor(StkBandedWG* unit)
 {
 	//unit->bandedWG->clear();
 	//delete unit->bandedWG;
-	unit->bandedWG->~BandedWG();
-	RTFree(unit->mWorld, unit->bandedWG);
+	STKFreeNRT(unit, bandedWG);
 }
 
 
@@ -456,8 +490,11 @@ void StkBeeThree_Ctor(StkBeeThree* unit)
 
 *****/
 
-	STKAlloc0(unit->mWorld,  unit->beethree, BeeThree);
+	STKAllocNRT0(unit, beethree, BeeThree, StkBeeThree_start);
+}
 
+void StkBeeThree_start(StkBeeThree* unit)
+{
 	unit->beethree->controlChange((int)2,unit->op4gain=IN0(1));// operator4gain
 	unit->beethree->controlChange((int)4,unit->op3gain=IN0(2));// operator3gain
 	unit->beethree->controlChange((int)11,unit->lfospeed=IN0(3)); // lfospeed
@@ -505,16 +542,18 @@ void StkBeeThree_Dtor(StkBeeThree* unit)
 {
 	//unit->BeeThree->clear();
 	//delete unit->BeeThree;
-	unit->beethree->~BeeThree();
-	RTFree(unit->mWorld, unit->beethree);
+	STKFreeNRT(unit, beethree);
 }
 
 //////////////////////////////////////////////////////////////////
 
 void StkBlowHole_Ctor(StkBlowHole* unit)
 {
- 	STKAlloc(unit->mWorld, unit->blowhole, BlowHole, 40);
+ 	STKAllocNRT(unit, blowhole, BlowHole, 40, StkBlowHole_start);
+}
 
+void StkBlowHole_start(StkBlowHole* unit)
+{
 	unit->freq = unit->reedstiffness = unit->noisegain = unit->tonehole = unit->rgister = unit->breathpressure = 0;
 	unit->trig = 1;
 	unit->blowhole->noteOn(IN0(0) ,1);
@@ -577,8 +616,7 @@ void StkBlowHole_next(StkBlowHole *unit, int inNumSamples)
 void StkBlowHole_Dtor(StkBlowHole* unit)
 {
 	//delete unit->blowhole;
-	unit->blowhole->~BlowHole();
-    RTFree(unit->mWorld, unit->blowhole);
+	STKFreeNRT(unit, blowhole);
 
 }
 
@@ -594,8 +632,11 @@ void StkBowed_Ctor(StkBowed* unit)
        //- Vibrato Gain = 1
        - Volume = 128
 */
-	STKAlloc(unit->mWorld, unit->bowed, Bowed, 40);
+	STKAllocNRT(unit, bowed, Bowed, 40, StkBowed_start);
+}
 
+void StkBowed_start(StkBowed* unit)
+{
 	unit->freq = unit->bowposition = unit->bowpressure = unit->loudness = 0;
 	unit->bowed->noteOn(IN0(0) ,1);
 	SETCALC(StkBowed_next);
@@ -674,16 +715,17 @@ void StkBowed_next(StkBowed *unit, int inNumSamples)
 void StkBowed_Dtor(StkBowed* unit)
 {
 	//delete unit->bowed;
-	unit->bowed->~Bowed();
-    RTFree(unit->mWorld, unit->bowed);
+	STKFreeNRT(unit, bowed);
 
 }
 
 void StkClarinet_Ctor(StkClarinet* unit)
 {
- 	STKAlloc(unit->mWorld, unit->clarinet, Clarinet, 40);
-
+ 	STKAllocNRT(unit, clarinet, Clarinet, 40, StkClarinet_start);
+}
 
+void StkClarinet_start(StkClarinet* unit)
+{
  	unit->clarinet->controlChange(2, unit->reedstiffness = IN0(1));
 	unit->clarinet->controlChange(4, unit->noisegain = IN0(2));
 	unit->clarinet->controlChange(11,unit->vibfreq = IN0(3));
@@ -748,8 +790,7 @@ void StkClarinet_next(StkClarinet *unit, int inNumSamples)
 void StkClarinet_Dtor(StkClarinet* unit)
 {
 	//delete unit->clarinet;
-	unit->clarinet->~Clarinet();
-    RTFree(unit->mWorld, unit->clarinet);
+	STKFreeNRT(unit, clarinet);
 
 }
 
@@ -758,8 +799,11 @@ void StkClarinet_Dtor(StkClarinet* unit)
 
 void StkFlute_Ctor(StkFlute* unit)
 {
-	STKAlloc(unit->mWorld, unit->flute, Flute, 40);
+	STKAllocNRT(unit, flute, Flute, 40, StkFlute_start);
+}
 
+void StkFlute_start(StkFlute* unit)
+{
 	unit->flute->setFrequency( unit->freq = IN0(0) );
 	unit->flute->noteOn(IN0(0),1);
 
@@ -810,8 +854,7 @@ void StkFlute_next(StkFlute *unit, int inNumSamples)
 void StkFlute_Dtor(StkFlute* unit)
 {
 	//delete unit->flute;
-	unit->flute->~Flute();
-    RTFree(unit->mWorld, unit->flute);
+	STKFreeNRT(unit, flute);
 }
 
 //////////////////////////////////////////////////////////////////
@@ -839,8 +882,11 @@ void StkModalBar_Ctor(StkModalBar* unit)
 */
 
 	//unit->modalBar = new ModalBar();
-	STKAlloc0(unit->mWorld,  unit->modalBar, ModalBar);
+	STKAllocNRT0(unit, modalBar, ModalBar, StkModalBar_start);
+}
 
+void StkModalBar_start(StkModalBar* unit)
+{
 	unit->modalBar->noteOn(IN0(0) ,1);
 
 	unit->modalBar->controlChange(16,unit->instrument = IN0(1));// instrument
@@ -886,8 +932,7 @@ void StkModalBar_next(StkModalBar *unit, int inNumSamples)
 
 void StkModalBar_Dtor(StkModalBar* unit)
 {
-	unit->modalBar->~ModalBar();
-    RTFree(unit->mWorld, unit->modalBar);
+	STKFreeNRT(unit, modalBar);
 }
 
 //////////////////////////////////////////////////////////////////
@@ -903,8 +948,11 @@ void StkMoog_Ctor(StkMoog* unit)
        - Gain = 128
 *****/
 
-	STKAlloc0(unit->mWorld,  unit->moog, Moog);
+	STKAllocNRT0(unit, moog, Moog, StkMoog_start);
+}
 
+void StkMoog_start(StkMoog* unit)
+{
 	unit->moog->controlChange((int)2, unit->filterQ = IN0(1));// filter Q
 	unit->moog->controlChange((int)4, unit->sweeprate = IN0(2));// sweep rate
 	unit->moog->controlChange((int)11, unit->vibfreq = IN0(3)); // vibrato freq
@@ -960,8 +1008,7 @@ void StkMoog_Dtor(StkMoog* unit)
 {
 	//unit->Moog->clear();
 	//delete unit->Moog;
-	unit->moog->~Moog();
-	RTFree(unit->mWorld, unit->moog);
+	STKFreeNRT(unit, moog);
 }
 
 //////////////////////////////////////////////////////////////////
@@ -1034,8 +1081,11 @@ void StkPluck_Dtor(StkPluck* unit)
 void StkSaxofony_Ctor(StkSaxofony* unit)
 {
 	//Stk :: setRawwavePath("/Users/paul/stk-4.1.3/rawwaves");
-	STKAlloc(unit->mWorld,unit->saxofony, Saxofony, 40);
+	STKAllocNRT(unit, saxofony, Saxofony, 40, StkSaxofony_start);
+}
 
+void StkSaxofony_start(StkSaxofony* unit)
+{
 	//unit->saxofony = new Saxofony((MY_FLOAT) 40); // 40 is lowest frequency
 	unit->reedstiffness=unit->frequency=unit->reedaperture=unit->noisegain=
 		unit->blowposition=unit->vibratofrequency=unit->vibratogain=unit->breathpressure=0;
@@ -1110,8 +1160,7 @@ void StkSaxofony_Dtor(StkSaxofony* unit)
 {
 	//unit->saxofony->clear();
 	//delete unit->saxofony;
-    unit->saxofony->~Saxofony();
-    RTFree(unit->mWorld, unit->saxofony);
+	STKFreeNRT(unit, saxofony);
 
 }
 
@@ -1122,8 +1171,11 @@ void StkShakers_Ctor(StkShakers* unit)
 {
 // p0=freq, p1=shaker number, p2=energy, p3=system decay, p4=number of objects, p5 = resonance freq
 //	unit->shakers = new Shakers();
-	STKAlloc0(unit->mWorld,  unit->shakers, Shakers);
+	STKAllocNRT0(unit, shakers, Shakers, StkShakers_start);
+}
 
+void StkShakers_start(StkShakers* unit)
+{
 /******
     Control Change Numbers:
        - Shake Energy = 2
@@ -1196,8 +1248,7 @@ void StkShakers_next(StkShakers *unit, int inNumSamples)
 void StkShakers_Dtor(StkShakers* unit)
 {
 //	delete unit->shakers;
-	unit->shakers->~Shakers();
-    RTFree(unit->mWorld, unit->shakers);
+	STKFreeNRT(unit, shakers);
 
 }
 
@@ -1207,7 +1258,11 @@ void StkShakers_Dtor(StkShakers* unit)
 void StkVoicForm_Ctor(StkVoicForm* unit)
 {
 	//unit->voiceForm = new VoicForm();
-	STKAlloc0(unit->mWorld,  unit->voiceForm, VoicForm);
+	STKAllocNRT0(unit, voiceForm, VoicForm, StkVoicForm_start);
+}
+
+void StkVoicForm_start(StkVoicForm* unit)
+{
 	//unit->voiceForm = (VoicForm *)RTAlloc(unit->mWorld, sizeof(unit->voiceForm));
 
 /*********************************
@@ -1286,8 +1341,7 @@ void StkVoicForm_Dtor(StkVoicForm* unit)
 {
 	//unit->voiceForm->clear();
 	//delete unit->voiceForm;
-	unit->voiceForm->~VoicForm();
-    RTFree(unit->mWorld, unit->voiceForm);
+	STKFreeNRT(unit, voiceForm);
 
 }
 
@@ -1297,9 +1351,11 @@ void StkMandolin_Ctor(StkMandolin* unit)
 {
 
 	//unit->mandolin = new Mandolin((MY_FLOAT) 40);
-	STKAlloc(unit->mWorld, unit->mandolin, Mandolin, 40);
-
+	STKAllocNRT(unit, mandolin, Mandolin, 40, StkMandolin_start);
+}
 
+void StkMandolin_start(StkMandolin* unit)
+{
 	unit->mandolin->controlChange(__SK_BodySize_, unit->bodysize = IN0(1));
 	unit->mandolin->controlChange(__SK_PickPosition_, unit->pickposition = IN0(2));
 	unit->mandolin->controlChange(__SK_StringDamping_, unit->stringdamping = IN0(3));
@@ -1341,8 +1397,7 @@ void StkMandolin_next(StkMandolin *unit, int inNumSamples)
 void StkMandolin_Dtor(StkMandolin* unit)
 {
 	//delete unit->mandolin;
-	unit->mandolin->~Mandolin();
-    RTFree(unit->mWorld, unit->mandolin);
+	STKFreeNRT(unit, mandolin);
 
 }
 
@@ -1350,7 +1405,11 @@ void StkMandolin_Dtor(StkMandolin* unit)
 
 void StkSitar_Ctor(StkSitar* unit)
 {
- 	STKAlloc(unit->mWorld, unit->sitar, Sitar, 40);
+ 	STKAllocNRT(unit, sitar, Sitar, 40, StkSitar_start);
+}
+
+void StkSitar_start(StkSitar* unit)
+{
 	unit->sitar->clear();
 	unit->sitar->noteOn(IN0(0) ,1);
 	SETCALC(StkSitar_next);
@@ -1381,8 +1440,7 @@ void StkSitar_next(StkSitar *unit, int inNumSamples)
 void StkSitar_Dtor(StkSitar* unit)
 {
 	//delete unit->sitar;
-	unit->sitar->~Sitar();
-    RTFree(unit->mWorld, unit->sitar);
+	STKFreeNRT(unit, sitar);
 
 }
 
@@ -1391,8 +1449,11 @@ void StkSitar_Dtor(StkSitar* unit)
 
 void StkStifKarp_Ctor(StkStifKarp* unit)
 {
- 	STKAlloc(unit->mWorld, unit->stifkarp, StifKarp, 40);
+ 	STKAllocNRT(unit, stifkarp, StifKarp, 40, StkStifKarp_start);
+}
 
+void StkStifKarp_start(StkStifKarp* unit)
+{
 	unit->freq = unit->pickuppos = unit->stringsustain = unit->stringstretch = 0;
 	unit->stifkarp->noteOn(IN0(0) ,IN0(1));
 	SETCALC(StkStifKarp_next);
@@ -1435,8 +1496,7 @@ void StkStifKarp_next(StkStifKarp *unit, int inNumSamples)
 void StkStifKarp_Dtor(StkStifKarp* unit)
 {
 	//delete unit->stifkarp;
-	unit->stifkarp->~StifKarp();
-    RTFree(unit->mWorld, unit->stifkarp);
+	STKFreeNRT(unit, stifkarp);
 
 }
 
@@ -1446,8 +1506,11 @@ void StkTubeBell_Ctor(StkTubeBell* unit)
 {
 //	Stk :: setRawwavePath("/Users/paul/stk-4.1.3/rawwaves");
 
-  STKAlloc0(unit->mWorld, unit->tubebell, TubeBell );
+  STKAllocNRT0(unit, tubebell, TubeBell, StkTubeBell_start);
+}
 
+void StkTubeBell_start(StkTubeBell* unit)
+{
 //	unit->tubebell = new TubeBell();
 	unit->tubebell->noteOn(IN0(0) ,1);
 	SETCALC(StkTubeBell_next);
@@ -1469,8 +1532,7 @@ void StkTubeBell_next(StkTubeBell *unit, int inNumSamples)
 void StkTubeBell_Dtor(StkTubeBell* unit)
 {
 //	delete unit->tubebell;
-	unit->tubebell->~TubeBell();
-    RTFree(unit->mWorld, unit->tubebell);
+	STKFreeNRT(unit, tubebell);
 
 }
 
@@ -1587,7 +1649,7 @@ PluginLoad(Stk)
         DefineDtorUnit(StkMandolin);
         DefineDtorUnit(StkSitar);
         DefineDtorUnit(StkStifKarp);
-	DefineSimpleUnit(StkTubeBell);
+        DefineDtorUnit(StkTubeBell);
         DefineDtorUnit(Sflute);
 
 }
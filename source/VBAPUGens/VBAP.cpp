@@ -72,6 +72,8 @@ use or for distribution:
 #include <cmath>
 #include <limits>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 
 #ifdef NOVA_SIMD
 #include "simd_memory.hpp"
@@ -88,27 +90,82 @@ using nova::wrap_argument;
 #endif
 
 #define RES_ID 9171					/* resource ID for assistance (we'll add that later) */
-#define MAX_LS_SETS 100				/* maximum number of loudspeaker sets (triplets or pairs) allowed */
-#define MAX_LS_AMOUNT 55			/* maximum amount of loudspeakers, can be increased */
+#define GRID_AZI_CELLS_2D 360		/* 1 degree cells of the direction grid of 2D layouts */
+#define GRID_AZI_CELLS_3D 120		/* 3 degree cells of the direction grid of 3D layouts */
+#define GRID_ELE_CELLS_3D 60
+#define GRID_MIN_SETS 16			/* smaller layouts are scanned faster than looked up */
 
 static InterfaceTable *ft;
 
+/* A loudspeaker layout, parsed once per buffer and shared by all VBAP units
+ * reading the same data. The sets are parsed and the direction grid is built in
+ * the NRT thread, the list of layouts and the reference counts live in the RT
+ * thread. */
+struct VBAPLayout
+{
+	VBAPLayout *next;			/* rt: next shared layout */
+	World *world;
+	float *values;				/* rt: copy of the buffer contents, the key of the layout */
+	int numvals;
+	int refcount;				/* rt: the units and the pending build command */
+	bool ready;					/* rt: the sets and the grid have been built */
+	bool valid;					/* the loudspeaker data could be parsed */
+
+	int dimension;				/* 2 or 3 */
+	int ls_amount;				/* amount of loudspeakers */
+	int lsset_amount;			/* amount of loudspeaker sets */
+	int (*lsset)[3];			/* channel numbers of loudspeakers in each LS set */
+	float (*set_inv_matx)[9];	/* inverse matrice for each loudspeaker set */
+	float (*set_matx)[9];		/* matrice for each loudspeaker set */
+
+	/* direction grid over azimuth and elevation: the sets that can contain a
+	 * direction of a cell are cell_sets[cell_start[cell]] .. cell_sets[cell_start[cell + 1] - 1],
+	 * in the order of the sets. cell_start is 0 for small layouts */
+	int grid_azi, grid_ele;
+	int *cell_start;
+	int *cell_sets;
+};
+
+struct VBAPLayoutCmd
+{
+	VBAPLayout *layout;
+	bool release;				/* free the layout in the cleanup */
+};
+
+static VBAPLayout *gLayouts = 0;
+
 struct VBAP : Unit
 {
 	float x_azi;				/* panning direction azimuth */
 	float x_ele;				/* panning direction elevation */
-	float x_set_inv_matx[MAX_LS_SETS][9];  /* inverse matrice for each loudspeaker set */
-	float x_set_matx[MAX_LS_SETS][9];	   /* matrice for each loudspeaker set */
-	int x_lsset[MAX_LS_SETS][3];		  /* channel numbers of loudspeakers in each LS set */
-	int x_lsset_available;			/* have loudspeaker sets been defined with define_loudspeakers */
-	int x_lsset_amount;			/* amount of loudspeaker sets */
-	int x_ls_amount;					  /* amount of loudspeakers */
-	int x_dimension;					  /* 2 or 3 */
+	VBAPLayout *x_layout;		/* loudspeaker sets, shared with the other units */
 	float x_spread;							/* speading amount of virtual source (0-100) */
 	float x_spread_base[3];				   /* used to create uniform spreading */
 	float *final_gs;
 
-	float m_chanamp[MAX_LS_AMOUNT]; // for smoothing amp changes max channels 55 at the moment
+	float *m_chanamp; // for smoothing amp changes
+};
+
+// one source of a VBAPMix: only the speakers it sounds on are mixed into the outputs
+struct VBAPMixSource
+{
+	float x_azi;				/* panning direction azimuth */
+	float x_ele;				/* panning direction elevation */
+	VBAPLayout *x_layout;
+	float x_spread;				/* speading amount of virtual source (0-100) */
+	float x_spread_base[3];		/* used to create uniform spreading */
+	float *final_gs;			/* gain of each output */
+	float *m_chanamp;			/* for smoothing amp changes */
+	int *m_active;				/* outputs with a non-zero current or final gain */
+	int m_numActive;
+};
+
+struct VBAPMix : Unit
+{
+	VBAPLayout *x_layout;
+	int m_numSources;
+	VBAPMixSource *m_sources;
+	float *m_gains;				/* gains of one source, as calculated for all loudspeakers */
 };
 
 // for circular smoothing
@@ -182,7 +239,11 @@ static void cart_to_angle(float cvec[3], float avec[3])
 	avec[2]=dist;
 }
 
-static void new_spread_dir(VBAP *x, float spreaddir[3], float vscartdir[3], float spread_base[3])
+// the panning functions below work on VBAP units and on the sources of VBAPMix units,
+// which have the same x_ members
+
+template <typename Source>
+static void new_spread_dir(Source *x, float spreaddir[3], float vscartdir[3], float spread_base[3])
 /* subroutine for spreading */
 {
 	float beta,gamma;
@@ -213,7 +274,8 @@ static void new_spread_dir(VBAP *x, float spreaddir[3], float vscartdir[3], floa
 	spreaddir[2] /= power;
 }
 
-static void new_spread_base(VBAP *x, float spreaddir[3], float vscartdir[3])
+template <typename Source>
+static void new_spread_base(Source *x, float spreaddir[3], float vscartdir[3])
 /* subroutine for spreading */
 {
 	float d;
@@ -245,37 +307,293 @@ static void cross_prod(float v1[3], float v2[3], float v3[3])
 	v3[2] /= length;
 }
 
-static void additive_vbap(float *final_gs, float cartdir[3], VBAP *x)
-/* calculates gains to be added to previous gains, used in
-// multiple direction panning (source spreading) */
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// Shared loudspeaker layouts
+
+static bool VBAPLayout_parse(VBAPLayout *layout)
+/* reads the loudspeaker sets from the copy of the buffer, runs in the NRT thread */
+// [dim, numSpeakers, [chanOffsets 0-2, invmx 0-8, [lp1, lp2, lp2].x, sim.y, sim.z] * sets.size].flat
 {
-	float power;
-	int i,j,k, gains_modified;
+	const float *data = layout->values;
+	int numvals = layout->numvals, datapointer = 0, setpointer, counter, i;
+
+	if(numvals < 2)
+		return false;
+
+	int dim = layout->dimension = (int)(data[datapointer++]);
+	layout->ls_amount = (int)(data[datapointer++]);
+
+	if(((dim != 2) && (dim != 3)) || (layout->ls_amount < 2))
+		return false;
+
+	if(dim == 3)
+		counter = (numvals - 2) / ((dim * dim * 2) + dim);
+	else
+		counter = (numvals - 2) / ((dim * dim) + dim);
+	layout->lsset_amount = counter;
+
+	if(counter <= 0)
+		return false;
+
+	layout->lsset = (int(*)[3])calloc(counter, sizeof(int[3]));
+	layout->set_inv_matx = (float(*)[9])calloc(counter, sizeof(float[9]));
+	layout->set_matx = (float(*)[9])calloc(counter, sizeof(float[9]));
+	if(!layout->lsset || !layout->set_inv_matx || !layout->set_matx)
+		return false;
+
+	for(setpointer = 0; setpointer < counter; setpointer++){
+		for(i=0; i < dim; i++){
+			int ls = (int)data[datapointer++];
+			if(ls < 1 || ls > layout->ls_amount)
+				return false;
+			layout->lsset[setpointer][i] = ls;
+		}
+
+		for(i=0; i < dim * dim; i++)
+			layout->set_inv_matx[setpointer][i] = data[datapointer++];
+
+		if(dim == 3){
+			for(i=0; i < dim * dim; i++)
+				layout->set_matx[setpointer][i] = data[datapointer++];
+		}
+	}
+	return true;
+}
+
+static bool VBAPLayout_may_contain(VBAPLayout *layout, int set, float center[3], float radius)
+/* false if no direction within radius (as a chord) of center can get non-negative
+// gain factors from the set: each gain factor is a dot product with a row of the
+// inverse matrix, so it changes by at most the length of the row times radius */
+{
+	int dim = layout->dimension;
+	for(int j=0;j<dim;j++){
+		float g = 0.0, length = 0.0;
+		for(int k=0;k<dim;k++){
+			float m = layout->set_inv_matx[set][k+j*dim];
+			g += center[k] * m;
+			length += m * m;
+		}
+		if(g + sqrt(length) * radius < -0.01)
+			return false;
+	}
+	return true;
+}
+
+static bool VBAPLayout_build_grid(VBAPLayout *layout)
+/* lists the candidate sets of each cell of the direction grid, runs in the NRT thread */
+{
+	float atorad = (2 * 3.1415927 / 360) ;
+	int dim = layout->dimension;
+	int cells, cell, capacity, used = 0;
+
+	layout->grid_azi = dim == 3 ? GRID_AZI_CELLS_3D : GRID_AZI_CELLS_2D;
+	layout->grid_ele = dim == 3 ? GRID_ELE_CELLS_3D : 1;
+	cells = layout->grid_azi * layout->grid_ele;
+
+	float azi_step = 360.0 / layout->grid_azi;
+	float ele_step = dim == 3 ? 180.0 / layout->grid_ele : 0.0;
+
+	/* every direction of a cell is within half a step in elevation plus half
+	// a step in azimuth of its center, with a small margin for rounding */
+	float radius = (azi_step + ele_step) * 0.5 * atorad + 1e-4;
+
+	capacity = cells * 4;
+	layout->cell_start = (int*)malloc((cells + 1) * sizeof(int));
+	layout->cell_sets = (int*)malloc(capacity * sizeof(int));
+	if(!layout->cell_start || !layout->cell_sets)
+		return false;
+
+	for(cell = 0; cell < cells; cell++){
+		int row = cell / layout->grid_azi, column = cell % layout->grid_azi;
+		float center[3];
+		angle_to_cart(-180.0 + (column + 0.5) * azi_step,
+					  dim == 3 ? -90.0 + (row + 0.5) * ele_step : 0.0, center);
+
+		layout->cell_start[cell] = used;
+		for(int set = 0; set < layout->lsset_amount; set++){
+			if(!VBAPLayout_may_contain(layout, set, center, radius))
+				continue;
+			if(used == capacity){
+				capacity *= 2;
+				int *cell_sets = (int*)realloc(layout->cell_sets, capacity * sizeof(int));
+				if(!cell_sets)
+					return false;
+				layout->cell_sets = cell_sets;
+			}
+			layout->cell_sets[used++] = set;
+		}
+	}
+	layout->cell_start[cells] = used;
+	return true;
+}
+
+static int VBAPLayout_cell(VBAPLayout *layout, float cartdir[3])
+/* the cell of the direction grid containing a direction */
+{
+	float atorad = (2 * 3.1415927 / 360) ;
+	float azi = atan2(cartdir[1], cartdir[0]) / atorad;
+	float column = (azi + 180.0) * layout->grid_azi / 360.0;
+	if(!(column >= 0.0)) // also catches NaN
+		column = 0.0;
+	int cell = sc_min((int)column, layout->grid_azi - 1);
+
+	if(layout->grid_ele > 1){
+		float ele = asin(sc_clip(cartdir[2], -1.0f, 1.0f)) / atorad;
+		float row = (ele + 90.0) * layout->grid_ele / 180.0;
+		if(!(row >= 0.0))
+			row = 0.0;
+		cell += sc_min((int)row, layout->grid_ele - 1) * layout->grid_azi;
+	}
+	return cell;
+}
+
+static void VBAPLayout_free_sets(VBAPLayout *layout)
+{
+	free(layout->lsset);
+	free(layout->set_inv_matx);
+	free(layout->set_matx);
+	free(layout->cell_start);
+	free(layout->cell_sets);
+	layout->lsset = 0;
+	layout->set_inv_matx = layout->set_matx = 0;
+	layout->cell_start = layout->cell_sets = 0;
+}
+
+static bool VBAPLayout_build(World *world, void *inUserData)
+{
+	// NRT
+	VBAPLayout *layout = ((VBAPLayoutCmd*)inUserData)->layout;
+	layout->valid = VBAPLayout_parse(layout)
+		&& (layout->lsset_amount < GRID_MIN_SETS || VBAPLayout_build_grid(layout));
+	if(!layout->valid)
+		VBAPLayout_free_sets(layout);
+	return true;
+}
+
+static bool VBAPLayout_unref(VBAPLayout *layout)
+/* drops a reference, true if it was the last one. the layout can then no
+// longer be found by new units */
+{
+	if(--layout->refcount > 0)
+		return false;
+
+	VBAPLayout **link = &gLayouts;
+	while(*link != layout)
+		link = &(*link)->next;
+	*link = layout->next;
+	return true;
+}
+
+static bool VBAPLayout_built(World *world, void *inUserData)
+{
+	// RT: the units waiting for the layout start with their next block
+	VBAPLayoutCmd *cmd = (VBAPLayoutCmd*)inUserData;
+	cmd->layout->ready = true;
+	if(VBAPLayout_unref(cmd->layout)){
+		cmd->release = true; // all units are gone already
+		return true;
+	}
+	return false;
+}
+
+static bool VBAPLayout_free(World *world, void *inUserData)
+{
+	// NRT
+	VBAPLayout_free_sets(((VBAPLayoutCmd*)inUserData)->layout);
+	return false;
+}
+
+static void VBAPLayout_cleanup(World *world, void *inUserData)
+{
+	// RT
+	VBAPLayoutCmd *cmd = (VBAPLayoutCmd*)inUserData;
+	if(cmd->release){
+		RTFree(world, cmd->layout->values);
+		RTFree(world, cmd->layout);
+	}
+	RTFree(world, cmd);
+}
+
+static VBAPLayout *VBAPLayout_acquire(World *world, const float *data, int numvals)
+/* finds the layout of the buffer contents, or starts building a new one */
+{
+	VBAPLayout *layout;
+	for(layout = gLayouts; layout; layout = layout->next){
+		if(layout->world == world && layout->numvals == numvals
+		   && !memcmp(layout->values, data, numvals * sizeof(float))){
+			layout->refcount++;
+			return layout;
+		}
+	}
+
+	layout = (VBAPLayout*)RTAlloc(world, sizeof(VBAPLayout));
+	VBAPLayoutCmd *cmd = (VBAPLayoutCmd*)RTAlloc(world, sizeof(VBAPLayoutCmd));
+	float *values = (float*)RTAlloc(world, numvals * sizeof(float));
+	if(!layout || !cmd || !values){
+		if(layout) RTFree(world, layout);
+		if(cmd) RTFree(world, cmd);
+		if(values) RTFree(world, values);
+		return 0;
+	}
+
+	memset(layout, 0, sizeof(VBAPLayout));
+	layout->world = world;
+	layout->values = values;
+	layout->numvals = numvals;
+	memcpy(values, data, numvals * sizeof(float));
+	layout->refcount = 2; // the unit and the build command
+	layout->next = gLayouts;
+	gLayouts = layout;
+
+	cmd->layout = layout;
+	cmd->release = false;
+	DoAsynchronousCommand(world, 0, 0, (void*)cmd, VBAPLayout_build, VBAPLayout_built,
+						  VBAPLayout_free, VBAPLayout_cleanup, 0, 0);
+	return layout;
+}
+
+static void VBAPLayout_release(World *world, VBAPLayout *layout)
+{
+	if(!VBAPLayout_unref(layout))
+		return;
+
+	VBAPLayoutCmd *cmd = (VBAPLayoutCmd*)RTAlloc(world, sizeof(VBAPLayoutCmd));
+	if(!cmd){
+		// leak the sets rather than freeing them in the RT thread
+		RTFree(world, layout->values);
+		RTFree(world, layout);
+		return;
+	}
+	cmd->layout = layout;
+	cmd->release = true;
+	DoAsynchronousCommand(world, 0, 0, (void*)cmd, VBAPLayout_free, 0, 0, VBAPLayout_cleanup, 0, 0);
+}
+
+static int vbap_scan_sets(VBAPLayout *layout, const int *sets, int count, float cartdir[3],
+						  float g[3], int ls[3], int *neg_g_amount)
+/* go through the given loudspeaker sets (all of them if sets is 0) and find the set which
+// has all positive values. If such is not found, set with largest
+// minimum value is chosen. If at least one of gain factors of one LS set is negative
+// it means that the virtual source does not lie in that LS set. */
+{
+	int i,j,k,n;
 	float small_g;
 	float big_sm_g, gtmp[3];
-	int winner_set;
-	//		float new_cartdir[3];	/* warning: unused variable */
-	//		float new_angle_dir[3];		/* warning: unused variable */
-	int dim = x->x_dimension;
+	int winner_set=0;
+	int dim = layout->dimension;
 	int neg_g_am, best_neg_g_am;
-	float g[3];
-	int ls[3] = { 0, 0, 0 };
 
-	big_sm_g = -100000.0;
-	best_neg_g_am=3;
+	big_sm_g = -100000.0;	/* initial value for largest minimum gain value */
+	best_neg_g_am=3;		  /* how many negative values in this set */
 
-	/* BUG: there is a bug that sometimes causes x->x_lsset_amount to be a massive
-		* number.  I haven't tracked it down yet, but its probably an init
-		* bug. 2006-08-13 <hans@at.or.at>
-		*/
-	//	post("x_lsset_amount: %li", x->x_lsset_amount);
-	for(i=0;i<x->x_lsset_amount;i++){
+	for(n=0;n<count;n++){
+		i = sets ? sets[n] : n;
 		small_g = 10000000.0;
 		neg_g_am = 3;
 		for(j=0;j<dim;j++){
 			gtmp[j]=0.0;
 			for(k=0;k<dim;k++)
-				gtmp[j]+=cartdir[k]* x->x_set_inv_matx[i][k+j*dim];
+				gtmp[j]+=cartdir[k]* layout->set_inv_matx[i][k+j*dim];
 			if(gtmp[j] < small_g)
 				small_g = gtmp[j];
 			if(gtmp[j]>= -0.01)
@@ -286,16 +604,55 @@ static void additive_vbap(float *final_gs, float cartdir[3], VBAP *x)
 			best_neg_g_am = neg_g_am;
 			winner_set=i;
 			g[0]=gtmp[0]; g[1]=gtmp[1];
-			ls[0]= x->x_lsset[i][0]; ls[1]= x->x_lsset[i][1];
+			ls[0]= layout->lsset[i][0]; ls[1]= layout->lsset[i][1];
 			if(dim==3){
 				g[2]=gtmp[2];
-				ls[2]= x->x_lsset[i][2];
+				ls[2]= layout->lsset[i][2];
 			} else {
 				g[2]=0.0;
 				ls[2]=0;
 			}
 		}
 	}
+	*neg_g_amount = best_neg_g_am;
+	return winner_set;
+}
+
+static int vbap_find_set(VBAPLayout *layout, float cartdir[3], float g[3], int ls[3])
+/* finds the loudspeaker set for a direction, returns its index and its gain factors.
+// the sets of the cell of the direction include all sets containing the direction,
+// in the same order, so when one of them contains it the result is the same as
+// with a scan of all sets. otherwise the direction lies outside of all sets and
+// all of them have to be scanned for the closest one */
+{
+	int neg_g_am;
+	if(!layout->cell_start)
+		return vbap_scan_sets(layout, 0, layout->lsset_amount, cartdir, g, ls, &neg_g_am);
+
+	int cell = VBAPLayout_cell(layout, cartdir);
+	int first = layout->cell_start[cell];
+	int winner_set = vbap_scan_sets(layout, layout->cell_sets + first, layout->cell_start[cell + 1] - first,
+									cartdir, g, ls, &neg_g_am);
+	if(neg_g_am != 0)
+		winner_set = vbap_scan_sets(layout, 0, layout->lsset_amount, cartdir, g, ls, &neg_g_am);
+	return winner_set;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <typename Source>
+static void additive_vbap(float *final_gs, float cartdir[3], Source *x)
+/* calculates gains to be added to previous gains, used in
+// multiple direction panning (source spreading) */
+{
+	float power;
+	int i, gains_modified;
+	VBAPLayout *layout = x->x_layout;
+	int dim = layout->dimension;
+	float g[3];
+	int ls[3] = { 0, 0, 0 };
+
+	vbap_find_set(layout, cartdir, g, ls);
 
 	gains_modified=0;
 	for(i=0;i<dim;i++)
@@ -323,7 +680,8 @@ static void additive_vbap(float *final_gs, float cartdir[3], VBAP *x)
 	}
 }
 
-static void spread_it(VBAP *x, float *final_gs)
+template <typename Source>
+static void spread_it(Source *x, float *final_gs)
 /*
  // apply the sound signal to multiple panning directions
  // that causes some spreading.
@@ -336,7 +694,7 @@ static void spread_it(VBAP *x, float *final_gs)
 	float spreadbase[16][3];
 	int i, spreaddirnum;
 	float power;
-	if(x->x_dimension == 3){
+	if(x->x_layout->dimension == 3){
 		spreaddirnum=16;
 		angle_to_cart(x->x_azi,x->x_ele,vscartdir);
 		new_spread_dir(x, spreaddir[0], vscartdir, x->x_spread_base);
@@ -368,7 +726,7 @@ static void spread_it(VBAP *x, float *final_gs)
 			new_spread_dir(x, spreaddir[i], vscartdir, spreadbase[i]);
 			additive_vbap(final_gs,spreaddir[i],x);
 		}
-	} else if (x->x_dimension == 2) {
+	} else if (x->x_layout->dimension == 2) {
 		spreaddirnum=6;
 
 		angle_to_cart(x->x_azi - x->x_spread, 0, spreaddir[0]);
@@ -384,35 +742,34 @@ static void spread_it(VBAP *x, float *final_gs)
 		return;
 
 	if(x->x_spread > 70)
-		for(i=0;i<x->x_ls_amount;i++){
+		for(i=0;i<x->x_layout->ls_amount;i++){
 			final_gs[i] += (x->x_spread - 70) / 30.0 * (x->x_spread - 70) / 30.0 * 10.0;
 		}
 
-	for(i=0,power=0.0;i<x->x_ls_amount;i++){
+	for(i=0,power=0.0;i<x->x_layout->ls_amount;i++){
 		power += final_gs[i] * final_gs[i];
 	}
 
     power = sqrt(power);
-	for(i=0;i<x->x_ls_amount;i++){
+	for(i=0;i<x->x_layout->ls_amount;i++){
 		final_gs[i] /= power;
 	}
 }
 
 
 
-static void vbap(float g[3], int ls[3], VBAP *x)
+template <typename Source>
+static void vbap(float g[3], int ls[3], Source *x)
 {
 	/* calculates gain factors using loudspeaker setup and given direction */
 	float power;
-	int i,j,k, gains_modified;
-	float small_g;
-	float big_sm_g, gtmp[3];
-	int winner_set=0;
+	int i, gains_modified;
+	int winner_set;
 	float cartdir[3];
 	float new_cartdir[3];
 	float new_angle_dir[3];
-	int dim = x->x_dimension;
-	int neg_g_am, best_neg_g_am;
+	VBAPLayout *layout = x->x_layout;
+	int dim = layout->dimension;
 
 	/* transfering the azimuth angle to a decent value */
 	while(x->x_azi > 180)
@@ -430,43 +787,8 @@ static void vbap(float g[3], int ls[3], VBAP *x)
 		x->x_ele = 0;
 
 
-	/* go through all defined loudspeaker sets and find the set which
-		// has all positive values. If such is not found, set with largest
-		// minimum value is chosen. If at least one of gain factors of one LS set is negative
-		// it means that the virtual source does not lie in that LS set. */
-
 	angle_to_cart(x->x_azi,x->x_ele,cartdir);
-	big_sm_g = -100000.0;	/* initial value for largest minimum gain value */
-	best_neg_g_am=3;		  /* how many negative values in this set */
-
-
-	for(i=0;i<x->x_lsset_amount;i++){
-		small_g = 10000000.0;
-		neg_g_am = 3;
-		for(j=0;j<dim;j++){
-			gtmp[j]=0.0;
-			for(k=0;k<dim;k++)
-				gtmp[j]+=cartdir[k]* x->x_set_inv_matx[i][k+j*dim];
-			if(gtmp[j] < small_g)
-				small_g = gtmp[j];
-			if(gtmp[j]>= -0.01)
-				neg_g_am--;
-		}
-		if(small_g > big_sm_g && neg_g_am <= best_neg_g_am){
-			big_sm_g = small_g;
-			best_neg_g_am = neg_g_am;
-			winner_set=i;
-			g[0]=gtmp[0]; g[1]=gtmp[1];
-			ls[0]= x->x_lsset[i][0]; ls[1]= x->x_lsset[i][1];
-			if(dim==3){
-				g[2]=gtmp[2];
-				ls[2]= x->x_lsset[i][2];
-			} else {
-				g[2]=0.0;
-				ls[2]=0;
-			}
-		}
-	}
+	winner_set = vbap_find_set(layout, cartdir, g, ls);
 
 	/* If chosen set produced a negative value, make it zero and
 		// calculate direction that corresponds	 to these new
@@ -481,15 +803,15 @@ static void vbap(float g[3], int ls[3], VBAP *x)
 				gains_modified=1;
 			}
 		if(gains_modified==1){
-			new_cartdir[0] =  x->x_set_matx[winner_set][0] * g[0]
-				+ x->x_set_matx[winner_set][1] * g[1]
-				+ x->x_set_matx[winner_set][2] * g[2];
-			new_cartdir[1] =  x->x_set_matx[winner_set][3] * g[0]
-				+ x->x_set_matx[winner_set][4] * g[1]
-				+ x->x_set_matx[winner_set][5] * g[2];
-			new_cartdir[2] =  x->x_set_matx[winner_set][6] * g[0]
-				+ x->x_set_matx[winner_set][7] * g[1]
-				+ x->x_set_matx[winner_set][8] * g[2];
+			new_cartdir[0] =  layout->set_matx[winner_set][0] * g[0]
+				+ layout->set_matx[winner_set][1] * g[1]
+				+ layout->set_matx[winner_set][2] * g[2];
+			new_cartdir[1] =  layout->set_matx[winner_set][3] * g[0]
+				+ layout->set_matx[winner_set][4] * g[1]
+				+ layout->set_matx[winner_set][5] * g[2];
+			new_cartdir[2] =  layout->set_matx[winner_set][6] * g[0]
+				+ layout->set_matx[winner_set][7] * g[1]
+				+ layout->set_matx[winner_set][8] * g[2];
 			cart_to_angle(new_cartdir,new_angle_dir);
 			x->x_azi = (float) (new_angle_dir[0] + 0.5);
 			x->x_ele = (float) (new_angle_dir[1] + 0.5);
@@ -525,20 +847,18 @@ static inline void VBAP_calc_gain_factors(VBAP * unit)
 		unit->x_ele = elevation;
 		unit->x_spread = spread;
 
-		if(unit->x_lsset_available ==1){
-			vbap(g,ls, unit);
-			for(i=0;i<unit->x_ls_amount;i++)
-				final_gs[i]=0.0;
-			for(i=0;i<unit->x_dimension;i++){
-				final_gs[ls[i]-1]=g[i];
-			}
-			if(unit->x_spread != 0){
-				spread_it(unit,final_gs);
-			}
-//			for(i=0; i < unit->mNumOutputs; i++){
-//				printf("chan %i: %f\n", i, final_gs[i] );
-//			}
+		vbap(g,ls, unit);
+		for(i=0;i<unit->x_layout->ls_amount;i++)
+			final_gs[i]=0.0;
+		for(i=0;i<unit->x_layout->dimension;i++){
+			final_gs[ls[i]-1]=g[i];
+		}
+		if(unit->x_spread != 0){
+			spread_it(unit,final_gs);
 		}
+//		for(i=0; i < unit->mNumOutputs; i++){
+//			printf("chan %i: %f\n", i, final_gs[i] );
+//		}
 	}
 }
 
@@ -605,18 +925,59 @@ static inline_functions void VBAP_next_simd(VBAP *unit, int inNumSamples)
 }
 #endif
 
-static void VBAP_Ctor(VBAP* unit)
+static void VBAP_start(VBAP *unit, int inNumSamples)
+/* sets up the unit once its loudspeaker layout is ready */
 {
-	int numOutputs = unit->mNumOutputs, counter = 0, datapointer=0, setpointer=0, i;
+	VBAPLayout *layout = unit->x_layout;
+	int numOutputs = unit->mNumOutputs;
 
-	// initialise interpolation levels and outputs
-	for (int i=0; i<numOutputs; ++i) {
-		unit->m_chanamp[i] = 0;
-		ZOUT0(i) = 0.f;
+	if(!layout->valid) {
+		printf("vbap: Error in loudspeaker data. Bufnum: %i\n", (int)ZIN0(1));
+		SETCALC(ClearUnitOutputs);
+		ClearUnitOutputs(unit, inNumSamples);
+		return;
 	}
 
-	// [dim, numSpeakers, [chanOffsets 0-2, invmx 0-8, [lp1, lp2, lp2].x, sim.y, sim.z] * sets.size].flat
-	float fbufnum = ZIN0(1);
+	// the loudspeaker numbers of the sets may exceed the number of outputs
+	int numGains = sc_max(numOutputs, layout->ls_amount);
+	unit->final_gs = (float*)RTAlloc(unit->mWorld, numGains * sizeof(float));
+	unit->m_chanamp = (float*)RTAlloc(unit->mWorld, numOutputs * sizeof(float));
+	if(!unit->final_gs || !unit->m_chanamp) {
+		printf("vbap: Could not allocate real-time memory\n");
+		SETCALC(ClearUnitOutputs);
+		ClearUnitOutputs(unit, inNumSamples);
+		return;
+	}
+
+	// initialise interpolation levels
+	memset(unit->final_gs, 0, numGains * sizeof(float));
+	memset(unit->m_chanamp, 0, numOutputs * sizeof(float));
+
+#ifdef NOVA_SIMD
+	if (!(BUFLENGTH & 15))
+		SETCALC(VBAP_next_simd);
+	else
+#endif
+		SETCALC(VBAP_next);
+
+	unit->x_spread_base[0] = 0.0;
+	unit->x_spread_base[1] = 1.0;
+	unit->x_spread_base[2] = 0.0;
+	VBAP_next(unit, inNumSamples); // calculate initial gain factors && compute initial samples
+}
+
+static void VBAP_wait(VBAP *unit, int inNumSamples)
+/* silence until the NRT thread has built the layout */
+{
+	if(unit->x_layout->ready)
+		VBAP_start(unit, inNumSamples);
+	else
+		ClearUnitOutputs(unit, inNumSamples);
+}
+
+static VBAPLayout *VBAP_acquire_layout(Unit *unit, float fbufnum)
+/* the loudspeaker sets are parsed once per buffer contents and shared */
+{
 	uint32 ibufnum = (uint32)fbufnum;
 	World *world = unit->mWorld;
 
@@ -624,7 +985,7 @@ static void VBAP_Ctor(VBAP* unit)
 	if (ibufnum >= world->mNumSndBufs) {
 		int localBufNum = ibufnum - world->mNumSndBufs;
 		Graph *parent = unit->mParent;
-		if(localBufNum <= parent->localBufNum) {
+		if(localBufNum < parent->localBufNum) {
 			buf = parent->mLocalSndBufs + localBufNum;
 		} else {
 			buf = world->mSndBufs;
@@ -633,78 +994,214 @@ static void VBAP_Ctor(VBAP* unit)
 		buf = world->mSndBufs + ibufnum;
 	}
 
-	int numvals = buf->samples;
-	unit->x_dimension = (int)(buf->data[datapointer++]);
-	unit->x_ls_amount = (int)(buf->data[datapointer++]);
+	if(!buf->data || buf->samples < 2)
+		return 0;
+	return VBAPLayout_acquire(world, buf->data, buf->samples);
+}
 
-	unit->x_azi = unit->x_ele = unit->x_spread = std::numeric_limits<float>::quiet_NaN();
+static void VBAP_Ctor(VBAP* unit)
+{
+	float fbufnum = ZIN0(1);
 
-	unit->final_gs = (float*)RTAlloc(unit->mWorld, numOutputs * sizeof(float));
-	unit->x_lsset_available = 1;
+	unit->x_azi = unit->x_ele = unit->x_spread = std::numeric_limits<float>::quiet_NaN();
+	unit->final_gs = unit->m_chanamp = 0;
 
-	if(((unit->x_dimension != 2) && (unit->x_dimension != 3)) || (unit->x_ls_amount < 2)) {
+	unit->x_layout = VBAP_acquire_layout(unit, fbufnum);
+	if(!unit->x_layout) {
 		printf("vbap: Error in loudspeaker data. Bufnum: %i\n", (int)fbufnum);
-		unit->x_lsset_available = 0;
-		// do something else here
+		SETCALC(ClearUnitOutputs);
+		ClearUnitOutputs(unit, 1);
+		return;
 	}
 
-	if(unit->x_dimension == 3)
-		counter = (numvals - 2) / ((unit->x_dimension * unit->x_dimension*2) + unit->x_dimension);
-	if(unit->x_dimension == 2)
-		counter = (numvals - 2) / ((unit->x_dimension * unit->x_dimension) + unit->x_dimension);
-	unit->x_lsset_amount=counter;
-
-	if(counter<=0){
-		printf("vbap: Error in loudspeaker data. Bufnum: %i\n", (int)fbufnum);
-		unit->x_lsset_available=0;
-//		return;
+	if(unit->x_layout->ready) {
+		VBAP_start(unit, 1);
+	} else {
+		SETCALC(VBAP_wait);
+		ClearUnitOutputs(unit, 1);
 	}
+}
 
-	// probably sets should be created with rtalloc
-	while(counter-- > 0){
-		for(i=0; i < unit->x_dimension; i++){
-			unit->x_lsset[setpointer][i]=(int)buf->data[datapointer++];
-		}
 
-		for(i=0; i < unit->x_dimension*unit->x_dimension; i++){
-			unit->x_set_inv_matx[setpointer][i]=buf->data[datapointer++];
-				/*				post("%d",deb++); */
-		}
-		if(unit->x_dimension == 3){
-			for(i=0; i < unit->x_dimension*unit->x_dimension; i++){
-				unit->x_set_matx[setpointer][i]=buf->data[datapointer++];
+static void VBAP_Dtor(VBAP* unit)
+{
+	if(unit->final_gs)
+		RTFree(unit->mWorld, unit->final_gs);
+	if(unit->m_chanamp)
+		RTFree(unit->mWorld, unit->m_chanamp);
+	if(unit->x_layout)
+		VBAPLayout_release(unit->mWorld, unit->x_layout);
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+
+// inputs: bufnum, then in, azimuth, elevation, spread of each source
+#define VBAPMIX_SOURCE_INPUT(s, i) (1 + (s) * 4 + (i))
+
+static void VBAPMix_calc_gain_factors(VBAPMix *unit, VBAPMixSource *source, int s)
+{
+	float azimuth = ZIN0(VBAPMIX_SOURCE_INPUT(s, 1));
+	float elevation = ZIN0(VBAPMIX_SOURCE_INPUT(s, 2));
+	float spread = ZIN0(VBAPMIX_SOURCE_INPUT(s, 3));
 
+	// only recalculate gain factors if inputs have changed
+	if((azimuth == source->x_azi) && (elevation == source->x_ele) && (spread == source->x_spread))
+		return;
+
+	float g[3];
+	int ls[3];
+	int i;
+	VBAPLayout *layout = unit->x_layout;
+	float *gains = unit->m_gains;
+
+	source->x_azi = azimuth;
+	source->x_ele = elevation;
+	source->x_spread = spread;
+
+	vbap(g, ls, source);
+	for(i=0;i<layout->ls_amount;i++)
+		gains[i]=0.0;
+	for(i=0;i<layout->dimension;i++){
+		gains[ls[i]-1]=g[i];
+	}
+	if(source->x_spread != 0){
+		spread_it(source, gains);
+	}
+
+	// the speakers to mix into: the new ones and the ones still ramping down
+	int numActive = 0;
+	for(i=0;i<(int)unit->mNumOutputs;i++){
+		source->final_gs[i] = gains[i];
+		if(gains[i] != 0.f || source->m_chanamp[i] != 0.f)
+			source->m_active[numActive++] = i;
+	}
+	source->m_numActive = numActive;
+}
+
+static void VBAPMix_next(VBAPMix *unit, int inNumSamples)
+{
+	for (int i=0; i<(int)unit->mNumOutputs; ++i)
+		memset(OUT(i), 0, inNumSamples * sizeof(float));
+
+	for (int s=0; s<unit->m_numSources; ++s) {
+		VBAPMixSource *source = unit->m_sources + s;
+		VBAPMix_calc_gain_factors(unit, source, s);
+
+		const float *in = IN(VBAPMIX_SOURCE_INPUT(s, 0));
+		int numActive = 0;
+
+		for (int n=0; n<source->m_numActive; ++n) {
+			int i = source->m_active[n];
+			float *out = OUT(i);
+			float chanamp = source->m_chanamp[i];
+			float nextchanamp = source->final_gs[i];
+			if (nextchanamp == chanamp) {
+				for (int j = 0; j < inNumSamples; j++)
+					out[j] += in[j] * nextchanamp;
+			} else {
+				float chanampslope = CALCSLOPE(nextchanamp, chanamp);
+				for (int j = 0; j < inNumSamples; j++) {
+					out[j] += in[j] * chanamp;
+					chanamp += chanampslope;
+				}
+				source->m_chanamp[i] = nextchanamp;
 			}
+
+			// speakers which have been ramped down are dropped
+			if (nextchanamp != 0.f)
+				source->m_active[numActive++] = i;
 		}
+		source->m_numActive = numActive;
+	}
+}
 
-		setpointer++;
+static void VBAPMix_start(VBAPMix *unit, int inNumSamples)
+/* sets up the sources once the loudspeaker layout is ready */
+{
+	VBAPLayout *layout = unit->x_layout;
+	int numOutputs = unit->mNumOutputs;
+	int numSources = unit->m_numSources;
+
+	if(!layout->valid) {
+		printf("vbap: Error in loudspeaker data. Bufnum: %i\n", (int)ZIN0(0));
+		SETCALC(ClearUnitOutputs);
+		ClearUnitOutputs(unit, inNumSamples);
+		return;
 	}
-	//printf("vbap: Loudspeaker setup configured!\n");
 
-#ifdef NOVA_SIMD
-	if (!(BUFLENGTH & 15))
-		SETCALC(VBAP_next_simd);
-	else
-#endif
-		SETCALC(VBAP_next);
+	// one allocation for the scratch gains and the state of all sources
+	int numGains = sc_max(numOutputs, layout->ls_amount);
+	size_t sourceSize = numOutputs * (2 * sizeof(float) + sizeof(int));
+	char *memory = (char*)RTAlloc(unit->mWorld, numSources * (sizeof(VBAPMixSource) + sourceSize)
+								  + numGains * sizeof(float));
+	if(!memory) {
+		printf("vbap: Could not allocate real-time memory\n");
+		SETCALC(ClearUnitOutputs);
+		ClearUnitOutputs(unit, inNumSamples);
+		return;
+	}
+
+	unit->m_sources = (VBAPMixSource*)memory;
+	memory += numSources * sizeof(VBAPMixSource);
+	for (int s=0; s<numSources; ++s) {
+		VBAPMixSource *source = unit->m_sources + s;
+		source->x_azi = source->x_ele = source->x_spread = std::numeric_limits<float>::quiet_NaN();
+		source->x_layout = layout;
+		source->x_spread_base[0] = 0.0;
+		source->x_spread_base[1] = 1.0;
+		source->x_spread_base[2] = 0.0;
+		source->final_gs = (float*)memory;
+		source->m_chanamp = source->final_gs + numOutputs;
+		source->m_active = (int*)(source->m_chanamp + numOutputs);
+		source->m_numActive = 0;
+		memset(source->m_chanamp, 0, numOutputs * sizeof(float));
+		memory += sourceSize;
+	}
+	unit->m_gains = (float*)memory;
+	memset(unit->m_gains, 0, numGains * sizeof(float));
+
+	SETCALC(VBAPMix_next);
+	VBAPMix_next(unit, inNumSamples); // calculate initial gain factors && compute initial samples
+}
 
-    if (unit->x_lsset_available == 1) {
-        unit->x_spread_base[0] = 0.0;
-        unit->x_spread_base[1] = 1.0;
-        unit->x_spread_base[2] = 0.0;
-        VBAP_next(unit, 1); // calculate initial gain factors && compute initial sample
-    } else {
-        ZOUT0(0) = 0;
-		// if the ls data was bad, just set every gain to 0 and bail
-		for(i=0;i<unit->x_ls_amount;i++)
-			unit->final_gs[i]=0.f;
-    }
+static void VBAPMix_wait(VBAPMix *unit, int inNumSamples)
+/* silence until the NRT thread has built the layout */
+{
+	if(unit->x_layout->ready)
+		VBAPMix_start(unit, inNumSamples);
+	else
+		ClearUnitOutputs(unit, inNumSamples);
 }
 
+static void VBAPMix_Ctor(VBAPMix* unit)
+{
+	float fbufnum = ZIN0(0);
 
-static void VBAP_Dtor(VBAP* unit)
+	unit->m_numSources = (unit->mNumInputs - 1) / 4;
+	unit->m_sources = 0;
+
+	unit->x_layout = VBAP_acquire_layout(unit, fbufnum);
+	if(!unit->x_layout) {
+		printf("vbap: Error in loudspeaker data. Bufnum: %i\n", (int)fbufnum);
+		SETCALC(ClearUnitOutputs);
+		ClearUnitOutputs(unit, 1);
+		return;
+	}
+
+	if(unit->x_layout->ready) {
+		VBAPMix_start(unit, 1);
+	} else {
+		SETCALC(VBAPMix_wait);
+		ClearUnitOutputs(unit, 1);
+	}
+}
+
+static void VBAPMix_Dtor(VBAPMix* unit)
 {
-	RTFree(unit->mWorld, unit->final_gs);
+	if(unit->m_sources)
+		RTFree(unit->mWorld, unit->m_sources);
+	if(unit->x_layout)
+		VBAPLayout_release(unit->mWorld, unit->x_layout);
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////////////
@@ -801,6 +1298,7 @@ PluginLoad(VBAP)
 {
 	ft = inTable;
 	DefineDtorCantAliasUnit(VBAP);
+	DefineDtorCantAliasUnit(VBAPMix);
 	DefineSimpleUnit(CircleRamp);
 }
 
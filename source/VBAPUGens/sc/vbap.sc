@@ -580,3 +580,18 @@ VBAP : MultiOutUGen {
 		^channels
 	}
 }
+
+VBAPMix : MultiOutUGen {
+	// in, azimuth, elevation and spread may be arrays, one value per source
+	*ar { arg numChans, in, bufnum, azimuth = 0.0, elevation = 1.0, spread = 0.0;
+		^this.multiNewList(['audio', numChans, bufnum] ++ [in, azimuth, elevation, spread].flop.flat)
+	}
+	*kr { arg numChans, in, bufnum, azimuth = 0.0, elevation = 1.0, spread = 0.0;
+		^this.multiNewList(['control', numChans, bufnum] ++ [in, azimuth, elevation, spread].flop.flat)
+	}
+	init { arg numChans ... theInputs;
+		inputs = theInputs;
+		channels = Array.fill(numChans, { arg i; OutputProxy(rate,this, i) });
+		^channels
+	}
+}